@@ -0,0 +1,211 @@
+#include <ha3/common/ColumnarMatchDocsFormat.h>
+#include <suez/turing/expression/framework/VariableTypeTraits.h>
+
+using namespace std;
+using namespace autil;
+using namespace suez::turing;
+
+BEGIN_HA3_NAMESPACE(common);
+HA3_LOG_SETUP(common, ColumnarMatchDocsFormat);
+
+namespace {
+
+template <typename T>
+void serializeColumn(matchdoc::ReferenceBase *ref,
+                     const vector<matchdoc::MatchDoc> &matchDocs,
+                     DataBuffer &dataBuffer)
+{
+    auto typedRef = static_cast<matchdoc::Reference<T> *>(ref);
+    vector<T> column(matchDocs.size());
+    for (size_t i = 0; i < matchDocs.size(); ++i) {
+        column[i] = typedRef->get(matchDocs[i]);
+    }
+    dataBuffer.writeBytes(column.data(), sizeof(T) * column.size());
+}
+
+// docs batch allocated by a fresh allocator are laid out in order with a
+// fixed stride inside one storage chunk, a block of the column is written
+// through raw pointers when its first, second and last doc agree on that
+// stride. a block is far smaller than a chunk, so it crosses at most one
+// chunk boundary and the check fails unless the chunks are adjacent.
+const size_t COLUMN_BLOCK_SIZE = 64;
+
+template <typename T>
+void deserializeColumn(matchdoc::ReferenceBase *ref,
+                       const vector<matchdoc::MatchDoc> &matchDocs,
+                       DataBuffer &dataBuffer)
+{
+    auto typedRef = static_cast<matchdoc::Reference<T> *>(ref);
+    // column buffer may be unaligned in the received data
+    const char *data = (const char *)dataBuffer.readNoCopy(sizeof(T) * matchDocs.size());
+    for (size_t begin = 0; begin < matchDocs.size(); begin += COLUMN_BLOCK_SIZE) {
+        size_t count = matchDocs.size() - begin;
+        if (count > COLUMN_BLOCK_SIZE) {
+            count = COLUMN_BLOCK_SIZE;
+        }
+        const char *src = data + begin * sizeof(T);
+        char *first = (char *)typedRef->getPointer(matchDocs[begin]);
+        if (count == 1) {
+            memcpy(first, src, sizeof(T));
+            continue;
+        }
+        char *second = (char *)typedRef->getPointer(matchDocs[begin + 1]);
+        char *last = (char *)typedRef->getPointer(matchDocs[begin + count - 1]);
+        ptrdiff_t stride = second - first;
+        if (stride < (ptrdiff_t)sizeof(T)
+            || last - first != stride * (ptrdiff_t)(count - 1))
+        {
+            for (size_t i = 0; i < count; ++i) {
+                T value;
+                memcpy(&value, src + i * sizeof(T), sizeof(T));
+                typedRef->set(matchDocs[begin + i], value);
+            }
+            continue;
+        }
+        if (stride == (ptrdiff_t)sizeof(T)) {
+            memcpy(first, src, count * sizeof(T));
+            continue;
+        }
+        for (size_t i = 0; i < count; ++i) {
+            memcpy(first + i * stride, src + i * sizeof(T), sizeof(T));
+        }
+    }
+}
+
+}
+
+bool ColumnarMatchDocsFormat::isSupportedReference(matchdoc::ReferenceBase *ref) {
+    if (ref->getValueType().isMultiValue()) {
+        return false;
+    }
+    switch (ref->getValueType().getBuiltinType()) {
+#define SUPPORTED_REF_CASE(vt_type)                                     \
+        case vt_type: {                                                 \
+            typedef VariableTypeTraits<vt_type, false>::AttrExprType T; \
+            return dynamic_cast<matchdoc::Reference<T> *>(ref) != NULL; \
+        }
+        NUMERIC_VARIABLE_TYPE_MACRO_HELPER(SUPPORTED_REF_CASE);
+#undef SUPPORTED_REF_CASE
+    default:
+        return false;
+    }
+}
+
+bool ColumnarMatchDocsFormat::isSupported(const Ha3MatchDocAllocatorPtr &allocator,
+        uint8_t serializeLevel)
+{
+    if (!allocator || allocator->hasSubDocAllocator()) {
+        return false;
+    }
+    auto refs = allocator->getAllNeedSerializeReferences(serializeLevel);
+    for (auto ref : refs) {
+        if (!isSupportedReference(ref)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void ColumnarMatchDocsFormat::serialize(const Ha3MatchDocAllocatorPtr &allocator,
+                                        const vector<matchdoc::MatchDoc> &matchDocs,
+                                        uint8_t serializeLevel,
+                                        DataBuffer &dataBuffer)
+{
+    assert(isSupported(allocator, serializeLevel));
+    auto refs = allocator->getAllNeedSerializeReferences(serializeLevel);
+    uint32_t docCount = matchDocs.size();
+    uint32_t columnCount = refs.size();
+    dataBuffer.write(docCount);
+    dataBuffer.write(columnCount);
+    for (auto ref : refs) {
+        dataBuffer.write(ref->getName());
+        dataBuffer.write(ref->getGroupName());
+        dataBuffer.write((uint8_t)ref->getValueType().getBuiltinType());
+        dataBuffer.write(ref->getSerializeLevel());
+    }
+    if (docCount == 0) {
+        return;
+    }
+    vector<docid_t> docIds(docCount);
+    for (size_t i = 0; i < docCount; ++i) {
+        docIds[i] = matchDocs[i].getDocId();
+    }
+    dataBuffer.writeBytes(docIds.data(), sizeof(docid_t) * docCount);
+    for (auto ref : refs) {
+        switch (ref->getValueType().getBuiltinType()) {
+#define SERIALIZE_COLUMN_CASE(vt_type)                                  \
+            case vt_type: {                                             \
+                typedef VariableTypeTraits<vt_type, false>::AttrExprType T; \
+                serializeColumn<T>(ref, matchDocs, dataBuffer);         \
+                break;                                                  \
+            }
+            NUMERIC_VARIABLE_TYPE_MACRO_HELPER(SERIALIZE_COLUMN_CASE);
+#undef SERIALIZE_COLUMN_CASE
+        default:
+            assert(false);
+        }
+    }
+}
+
+bool ColumnarMatchDocsFormat::deserialize(DataBuffer &dataBuffer,
+        const Ha3MatchDocAllocatorPtr &allocator,
+        vector<matchdoc::MatchDoc> &matchDocs)
+{
+    uint32_t docCount = 0;
+    uint32_t columnCount = 0;
+    dataBuffer.read(docCount);
+    dataBuffer.read(columnCount);
+    vector<matchdoc::ReferenceBase *> refs(columnCount, NULL);
+    vector<VariableType> types(columnCount, vt_unknown);
+    for (uint32_t i = 0; i < columnCount; ++i) {
+        string name;
+        string groupName;
+        uint8_t type = 0;
+        uint8_t serializeLevel = 0;
+        dataBuffer.read(name);
+        dataBuffer.read(groupName);
+        dataBuffer.read(type);
+        dataBuffer.read(serializeLevel);
+        types[i] = (VariableType)type;
+        switch (types[i]) {
+#define DECLARE_COLUMN_CASE(vt_type)                                    \
+            case vt_type: {                                             \
+                typedef VariableTypeTraits<vt_type, false>::AttrExprType T; \
+                refs[i] = allocator->declare<T>(name, groupName, serializeLevel); \
+                break;                                                  \
+            }
+            NUMERIC_VARIABLE_TYPE_MACRO_HELPER(DECLARE_COLUMN_CASE);
+#undef DECLARE_COLUMN_CASE
+        default:
+            break;
+        }
+        if (!refs[i]) {
+            HA3_LOG(WARN, "declare column [%s] with type [%d] failed",
+                    name.c_str(), (int32_t)type);
+            return false;
+        }
+    }
+    if (docCount == 0) {
+        return true;
+    }
+    vector<docid_t> docIds(docCount);
+    dataBuffer.readBytes(docIds.data(), sizeof(docid_t) * docCount);
+    matchDocs = allocator->batchAllocate(docIds);
+    for (uint32_t i = 0; i < columnCount; ++i) {
+        switch (types[i]) {
+#define DESERIALIZE_COLUMN_CASE(vt_type)                                \
+            case vt_type: {                                             \
+                typedef VariableTypeTraits<vt_type, false>::AttrExprType T; \
+                deserializeColumn<T>(refs[i], matchDocs, dataBuffer);   \
+                break;                                                  \
+            }
+            NUMERIC_VARIABLE_TYPE_MACRO_HELPER(DESERIALIZE_COLUMN_CASE);
+#undef DESERIALIZE_COLUMN_CASE
+        default:
+            assert(false);
+        }
+    }
+    return true;
+}
+
+END_HA3_NAMESPACE(common);
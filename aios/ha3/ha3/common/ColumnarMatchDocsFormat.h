@@ -0,0 +1,39 @@
+#ifndef ISEARCH_COLUMNARMATCHDOCSFORMAT_H
+#define ISEARCH_COLUMNARMATCHDOCSFORMAT_H
+
+#include <ha3/common.h>
+#include <ha3/isearch.h>
+#include <ha3/util/Log.h>
+#include <ha3/common/Ha3MatchDocAllocator.h>
+#include <autil/DataBuffer.h>
+#include <matchdoc/MatchDoc.h>
+
+BEGIN_HA3_NAMESPACE(common);
+
+// columnar wire format of matchdocs: a schema header, the docid column and
+// one contiguous value buffer per reference. deserialize reads the columns
+// in place from the received buffer instead of decoding doc by doc, and
+// declares references in their original field groups, so the allocator can
+// be merged with one deserialized from the row format.
+// only single value numeric references without sub doc are supported.
+class ColumnarMatchDocsFormat
+{
+public:
+    static bool isSupported(const Ha3MatchDocAllocatorPtr &allocator,
+                            uint8_t serializeLevel);
+    static void serialize(const Ha3MatchDocAllocatorPtr &allocator,
+                          const std::vector<matchdoc::MatchDoc> &matchDocs,
+                          uint8_t serializeLevel,
+                          autil::DataBuffer &dataBuffer);
+    static bool deserialize(autil::DataBuffer &dataBuffer,
+                            const Ha3MatchDocAllocatorPtr &allocator,
+                            std::vector<matchdoc::MatchDoc> &matchDocs);
+private:
+    static bool isSupportedReference(matchdoc::ReferenceBase *ref);
+private:
+    HA3_LOG_DECLARE();
+};
+
+END_HA3_NAMESPACE(common);
+
+#endif //ISEARCH_COLUMNARMATCHDOCSFORMAT_H
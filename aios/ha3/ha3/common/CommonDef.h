@@ -42,6 +42,10 @@ static const std::string HA3_SUBMATCHDATA_GROUP = "ha3_submatchdata_group";
 static const std::string HA3_RESULT_TENSOR_NAME = "ha3_result";
 
 static const std::string OP_DEBUG_KEY = "op_debug";
+// kvpair set by qrs which accepts columnar matchdocs from searcher
+static const std::string COLUMNAR_MATCHDOCS_KEY = "columnar_matchdocs";
+// kvpair to skip docid blocks that can not beat the rank heap by sort attribute
+static const std::string SORT_BLOCK_SKIP_KEY = "sort_block_skip";
 
 
 END_HA3_NAMESPACE(common);
@@ -1,6 +1,7 @@
 #include <ha3/common/MatchDocs.h>
 #include <ha3/common/CommonDef.h>
 #include <ha3/common/GlobalIdentifier.h>
+#include <ha3/common/ColumnarMatchDocsFormat.h>
 #include <iostream>
 
 using namespace autil;
@@ -16,6 +17,7 @@ MatchDocs::MatchDocs() {
     _totalMatchDocs = 0;
     _actualMatchDocs = 0;
     _serializeLevel = SL_QRS;
+    _columnarFormat = false;
 }
 
 MatchDocs::~MatchDocs() {
@@ -102,28 +104,48 @@ void MatchDocs::addMatchDoc(MatchDoc matchDoc) {
 void MatchDocs::serialize(DataBuffer &dataBuffer) const {
     dataBuffer.writeBytes(&_totalMatchDocs, sizeof(uint32_t));
     dataBuffer.writeBytes(&_actualMatchDocs, sizeof(uint32_t));
-    bool bExisted = (_allocator != NULL);
-    dataBuffer.writeBytes(&bExisted, sizeof(bExisted));
-    if (bExisted) {
-        auto length_before = dataBuffer.getDataLen();
+    uint8_t format = MDF_NONE;
+    if (_allocator != NULL) {
+        format = _columnarFormat
+                 && ColumnarMatchDocsFormat::isSupported(_allocator, _serializeLevel)
+                 ? MDF_COLUMNAR : MDF_ROW;
+    }
+    dataBuffer.writeBytes(&format, sizeof(format));
+    if (format == MDF_NONE) {
+        return;
+    }
+    auto length_before = dataBuffer.getDataLen();
+    if (format == MDF_COLUMNAR) {
+        ColumnarMatchDocsFormat::serialize(_allocator, _matchDocs,
+                _serializeLevel, dataBuffer);
+    } else {
         _allocator->setSortRefFlag(false);
         _allocator->serialize(dataBuffer, _matchDocs, _serializeLevel);
-        auto length_after = dataBuffer.getDataLen();
-        HA3_LOG(TRACE3, "serializer serilize length[%d]", length_after - length_before);
     }
+    auto length_after = dataBuffer.getDataLen();
+    HA3_LOG(TRACE3, "serializer serilize length[%d]", length_after - length_before);
 }
 
 void MatchDocs::deserialize(DataBuffer &dataBuffer, autil::mem_pool::Pool *pool) {
     dataBuffer.readBytes(&_totalMatchDocs, sizeof(uint32_t));
     dataBuffer.readBytes(&_actualMatchDocs, sizeof(uint32_t));
-    bool bExisted = false;
-    dataBuffer.readBytes(&bExisted, sizeof(bExisted));
-    if (!bExisted) {
+    uint8_t format = MDF_NONE;
+    dataBuffer.readBytes(&format, sizeof(format));
+    if (format == MDF_NONE) {
         return;
     }
     _allocator.reset(new Ha3MatchDocAllocator(pool));
     auto length_before = dataBuffer.getDataLen();
-    _allocator->deserialize(dataBuffer, _matchDocs);
+    if (format == MDF_COLUMNAR) {
+        if (!ColumnarMatchDocsFormat::deserialize(dataBuffer, _allocator, _matchDocs)) {
+            HA3_LOG(WARN, "deserialize columnar matchdocs failed");
+            _matchDocs.clear();
+            _allocator.reset();
+            return;
+        }
+    } else {
+        _allocator->deserialize(dataBuffer, _matchDocs);
+    }
     auto length_after = dataBuffer.getDataLen();
     HA3_LOG(TRACE3, "deserializer deserilize length[%d]", length_before - length_after);
 }
@@ -13,6 +13,13 @@ BEGIN_HA3_NAMESPACE(common);
 
 class MatchDocs
 {
+public:
+    // wire format flag, MDF_ROW keeps compatible with the old bool flag
+    enum MatchDocsFormat {
+        MDF_NONE = 0,
+        MDF_ROW = 1,
+        MDF_COLUMNAR = 2,
+    };
 public:
     MatchDocs();
     ~MatchDocs();
@@ -75,6 +82,11 @@ public:
                serializeLevel <= SL_MAX);
         _serializeLevel = serializeLevel;
     }
+    // receiver should understand columnar format, fall back to row format
+    // when some reference is not supported
+    void setColumnarFormat(bool columnarFormat) {
+        _columnarFormat = columnarFormat;
+    }
 private:
     std::vector<matchdoc::MatchDoc> _matchDocs;
     Ha3MatchDocAllocatorPtr _allocator;
@@ -82,6 +94,7 @@ private:
     uint32_t _actualMatchDocs;
     // for searcher cache
     uint8_t _serializeLevel;
+    bool _columnarFormat;
 private:
     HA3_LOG_DECLARE();
 };
@@ -3,6 +3,7 @@
 #include <ha3/isearch.h>
 #include <ha3/util/Log.h>
 #include <ha3/common/MatchDocs.h>
+#include <ha3/common/ColumnarMatchDocsFormat.h>
 #include <ha3/common/test/ResultConstructor.h>
 #include <matchdoc/MatchDoc.h>
 #include <matchdoc/Reference.h>
@@ -426,6 +427,141 @@ TEST_F(MatchDocsTest, testSerializeLevel) {
     #undef NO_USE
 }
 
+TEST_F(MatchDocsTest, testSerializeColumnarFormat) {
+    MatchDocs *matchDocs = new MatchDocs();
+    matchDocs->setTotalMatchDocs(20);
+    matchDocs->setActualMatchDocs(10);
+    common::Ha3MatchDocAllocatorPtr vsa(new common::Ha3MatchDocAllocator(&_pool));
+    matchDocs->setMatchDocAllocator(vsa);
+    auto ref1 = vsa->declare<int32_t>("ref1", SL_QRS);
+    auto ref2 = vsa->declare<double>("ref2", SL_CACHE);
+    auto ref3 = vsa->declare<uint64_t>("ref3", SL_QRS);
+    auto ref4 = vsa->declare<int8_t>("ref4", SL_NONE);
+    for (docid_t docId = 0; docId < 10; ++docId) {
+        matchdoc::MatchDoc matchDoc = vsa->allocate(docId * 2);
+        ref1->set(matchDoc, docId - 5);
+        ref2->set(matchDoc, docId * 0.5);
+        ref3->set(matchDoc, (uint64_t)docId << 40);
+        ref4->set(matchDoc, 1);
+        matchDocs->addMatchDoc(matchDoc);
+    }
+    ASSERT_TRUE(ColumnarMatchDocsFormat::isSupported(vsa, SL_QRS));
+    matchDocs->setColumnarFormat(true);
+
+    autil::DataBuffer rowBuffer(autil::DataBuffer::DEFAUTL_DATA_BUFFER_SIZE, &_pool);
+    autil::DataBuffer columnarBuffer(autil::DataBuffer::DEFAUTL_DATA_BUFFER_SIZE, &_pool);
+    matchDocs->serialize(columnarBuffer);
+    matchDocs->setColumnarFormat(false);
+    matchDocs->serialize(rowBuffer);
+    DELETE_AND_SET_NULL(matchDocs);
+
+    for (auto dataBuffer : {&rowBuffer, &columnarBuffer}) {
+        MatchDocs resultMatchDocs;
+        resultMatchDocs.deserialize(*dataBuffer, &_pool);
+        ASSERT_EQ(0u, dataBuffer->getDataLen());
+        ASSERT_EQ(20u, resultMatchDocs.totalMatchDocs());
+        ASSERT_EQ(10u, resultMatchDocs.actualMatchDocs());
+        ASSERT_EQ(10u, resultMatchDocs.size());
+        auto resultVsa = resultMatchDocs.getMatchDocAllocator();
+        auto resultRef1 = resultVsa->findReference<int32_t>("ref1");
+        auto resultRef2 = resultVsa->findReference<double>("ref2");
+        auto resultRef3 = resultVsa->findReference<uint64_t>("ref3");
+        ASSERT_TRUE(resultRef1 && resultRef2 && resultRef3);
+        ASSERT_EQ(SL_CACHE, resultRef2->getSerializeLevel());
+        ASSERT_FALSE(resultVsa->findReference<int8_t>("ref4"));
+        for (docid_t docId = 0; docId < 10; ++docId) {
+            auto matchDoc = resultMatchDocs.getMatchDoc(docId);
+            ASSERT_EQ(docId * 2, matchDoc.getDocId());
+            ASSERT_EQ(docId - 5, resultRef1->get(matchDoc));
+            ASSERT_DOUBLE_EQ(docId * 0.5, resultRef2->get(matchDoc));
+            ASSERT_EQ((uint64_t)docId << 40, resultRef3->get(matchDoc));
+        }
+    }
+}
+
+TEST_F(MatchDocsTest, testMergeColumnarWithRowFormat) {
+    autil::DataBuffer rowBuffer(autil::DataBuffer::DEFAUTL_DATA_BUFFER_SIZE, &_pool);
+    autil::DataBuffer columnarBuffer(autil::DataBuffer::DEFAUTL_DATA_BUFFER_SIZE, &_pool);
+    const docid_t docCount = 150;
+    for (auto dataBuffer : {&rowBuffer, &columnarBuffer}) {
+        MatchDocs matchDocs;
+        common::Ha3MatchDocAllocatorPtr vsa(new common::Ha3MatchDocAllocator(&_pool));
+        matchDocs.setMatchDocAllocator(vsa);
+        auto ref1 = vsa->declare<int32_t>("ref1", SL_QRS);
+        auto ref2 = vsa->declare<double>("ref2", "group_a", SL_QRS);
+        auto ref3 = vsa->declare<int64_t>("ref3", "group_a", SL_QRS);
+        docid_t base = dataBuffer == &rowBuffer ? 0 : docCount;
+        for (docid_t docId = base; docId < base + docCount; ++docId) {
+            matchdoc::MatchDoc matchDoc = vsa->allocate(docId);
+            ref1->set(matchDoc, docId);
+            ref2->set(matchDoc, docId * 0.5);
+            ref3->set(matchDoc, (int64_t)docId << 33);
+            matchDocs.addMatchDoc(matchDoc);
+        }
+        matchDocs.setColumnarFormat(dataBuffer == &columnarBuffer);
+        matchDocs.serialize(*dataBuffer);
+    }
+
+    MatchDocs rowMatchDocs;
+    rowMatchDocs.deserialize(rowBuffer, &_pool);
+    MatchDocs columnarMatchDocs;
+    columnarMatchDocs.deserialize(columnarBuffer, &_pool);
+    auto rowVsa = rowMatchDocs.getMatchDocAllocator();
+    auto columnarVsa = columnarMatchDocs.getMatchDocAllocator();
+    ASSERT_TRUE(rowVsa && columnarVsa);
+    for (auto name : {"ref1", "ref2", "ref3"}) {
+        auto rowRef = rowVsa->findReferenceWithoutType(name);
+        auto columnarRef = columnarVsa->findReferenceWithoutType(name);
+        ASSERT_TRUE(rowRef && columnarRef);
+        ASSERT_EQ(rowRef->getGroupName(), columnarRef->getGroupName());
+    }
+
+    auto &rowDocs = rowMatchDocs.getMatchDocsVect();
+    auto &columnarDocs = columnarMatchDocs.getMatchDocsVect();
+    ASSERT_TRUE(rowVsa->mergeAllocator(columnarVsa.get(), columnarDocs, rowDocs));
+    columnarDocs.clear();
+    ASSERT_EQ((size_t)docCount * 2, rowDocs.size());
+    auto ref1 = rowVsa->findReference<int32_t>("ref1");
+    auto ref2 = rowVsa->findReference<double>("ref2");
+    auto ref3 = rowVsa->findReference<int64_t>("ref3");
+    ASSERT_TRUE(ref1 && ref2 && ref3);
+    for (auto matchDoc : rowDocs) {
+        docid_t docId = matchDoc.getDocId();
+        ASSERT_EQ(docId, ref1->get(matchDoc));
+        ASSERT_DOUBLE_EQ(docId * 0.5, ref2->get(matchDoc));
+        ASSERT_EQ((int64_t)docId << 33, ref3->get(matchDoc));
+    }
+}
+
+TEST_F(MatchDocsTest, testColumnarFormatFallback) {
+    common::Ha3MatchDocAllocatorPtr vsa(new common::Ha3MatchDocAllocator(&_pool));
+    vsa->declare<int32_t>("ref1", SL_QRS);
+    ASSERT_TRUE(ColumnarMatchDocsFormat::isSupported(vsa, SL_QRS));
+    auto strRef = vsa->declare<string>("ref2", SL_NONE);
+    ASSERT_TRUE(ColumnarMatchDocsFormat::isSupported(vsa, SL_QRS));
+    strRef->setSerializeLevel(SL_QRS);
+    ASSERT_FALSE(ColumnarMatchDocsFormat::isSupported(vsa, SL_QRS));
+    vsa->declare<MultiInt32>("ref3", SL_NONE)->setSerializeLevel(SL_CACHE);
+    ASSERT_FALSE(ColumnarMatchDocsFormat::isSupported(vsa, SL_CACHE));
+
+    MatchDocs *matchDocs = new MatchDocs();
+    matchDocs->setMatchDocAllocator(vsa);
+    matchDocs->setColumnarFormat(true);
+    matchdoc::MatchDoc matchDoc = vsa->allocate(3);
+    strRef->set(matchDoc, "abc");
+    matchDocs->addMatchDoc(matchDoc);
+    autil::DataBuffer dataBuffer(autil::DataBuffer::DEFAUTL_DATA_BUFFER_SIZE, &_pool);
+    matchDocs->serialize(dataBuffer);
+    DELETE_AND_SET_NULL(matchDocs);
+
+    MatchDocs resultMatchDocs;
+    resultMatchDocs.deserialize(dataBuffer, &_pool);
+    ASSERT_EQ(1u, resultMatchDocs.size());
+    auto resultRef = resultMatchDocs.getMatchDocAllocator()->findReference<string>("ref2");
+    ASSERT_TRUE(resultRef);
+    ASSERT_EQ(string("abc"), resultRef->get(resultMatchDocs.getMatchDoc(0)));
+}
+
 void MatchDocsTest::checkDeserialize(autil::DataBuffer &dataBuffer, uint8_t serializeLevel,
                                      bool hasRef1, bool hasRef2, bool hasRef3,
                                      docid_t expectedDocId, int32_t value1,
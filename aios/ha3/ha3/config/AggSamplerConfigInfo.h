@@ -20,6 +20,8 @@ public:
         _batchSampleMaxCount = _aggThreshold;
         _enableJit = false;
         _enableDenseMode = false;
+        _paraSeekExactMode = false;
+        _enableSampling = true;
         _tupleSep = "|";
     }
     
@@ -33,6 +35,8 @@ public:
         , _batchSampleMaxCount(batchSampleMaxCount)
         , _enableJit(false)
         , _enableDenseMode(false)
+        , _paraSeekExactMode(false)
+        , _enableSampling(true)
         , _tupleSep("|")
     {
     }
@@ -96,6 +100,26 @@ public:
         _enableDenseMode = enableDenseMode;
     }
 
+    // parallel seek ways aggregate without sampling, partial results are
+    // merged exactly at Ha3SeekParaMergeOp
+    bool isParaSeekExactMode() const {
+        return _paraSeekExactMode;
+    }
+
+    void setParaSeekExactMode(bool paraSeekExactMode) {
+        _paraSeekExactMode = paraSeekExactMode;
+    }
+
+    // runtime switch, not jsonized; threshold and step of aggregate
+    // description and config are ignored when sampling is disabled
+    bool isEnableSampling() const {
+        return _enableSampling;
+    }
+
+    void setEnableSampling(bool enableSampling) {
+        _enableSampling = enableSampling;
+    }
+
     const std::string &getTupleSep() const {
         return _tupleSep;
     }
@@ -110,6 +134,7 @@ public:
         JSONIZE(json, "maxSortCount", _maxSortCount);
         JSONIZE(json, "enableJit", _enableJit);
         JSONIZE(json, "enableDenseMode", _enableDenseMode);
+        JSONIZE(json, "paraSeekExactMode", _paraSeekExactMode);
         JSONIZE(json, "tupleSep", _tupleSep);
     }
 private:
@@ -120,6 +145,8 @@ private:
     uint32_t _batchSampleMaxCount;
     bool _enableJit;
     bool _enableDenseMode;
+    bool _paraSeekExactMode;
+    bool _enableSampling;
     std::string _tupleSep;
 private:
     HA3_LOG_DECLARE();
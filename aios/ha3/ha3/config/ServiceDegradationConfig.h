@@ -51,6 +51,24 @@ public:
     uint32_t rerankSize;
 };
 
+// with cost_threshold set, a degrading searcher only degrades the requests
+// whose predicted seek cost reaches it, the level grows with the cost
+class ServiceDegradationCost : public autil::legacy::Jsonizable
+{
+public:
+    ServiceDegradationCost() {
+        costThreshold = 0;
+    }
+    ~ServiceDegradationCost() {
+    }
+public:
+    void Jsonize(autil::legacy::Jsonizable::JsonWrapper& json) {
+        json.Jsonize("cost_threshold", costThreshold, costThreshold);
+    }
+public:
+    double costThreshold;
+};
+
 class ServiceDegradationConfig : public autil::legacy::Jsonizable
 {
 public:
@@ -62,10 +80,12 @@ public:
     void Jsonize(autil::legacy::Jsonizable::JsonWrapper& json) {
         json.Jsonize("condition", condition, condition);
         json.Jsonize("request", request, request);
+        json.Jsonize("cost", cost, cost);
     }    
 public:
     ServiceDegradationCondition condition;
     ServiceDegradationRequest request;
+    ServiceDegradationCost cost;
 private:
     HA3_LOG_DECLARE();
 };
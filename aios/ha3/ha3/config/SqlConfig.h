@@ -21,6 +21,7 @@ static const double DEFAULT_SQL_TIMEOUT_FACTOR = 0.5;
 static const double DEFAULT_SUB_GRAPH_TIMEOUT_FACTOR = 0.9;
 static const uint32_t DEFAULT_SUB_GRAPH_THREAD_LIMIT = 10;
 static const uint32_t DEFAULT_MAIN_GRAPH_THREAD_LIMIT = 5;
+static const uint32_t DEFAULT_SCAN_THREAD_QUEUE_SIZE = 1000;
 static const std::string DEFAULT_IQUAN_PLAN_PREPARE_LEVEL = "jni.post.optimize";
 
 class SqlConfig : public autil::legacy::Jsonizable {
@@ -36,6 +37,7 @@ public:
         , lackResultEnable(false)
         , iquanPlanPrepareLevel(DEFAULT_IQUAN_PLAN_PREPARE_LEVEL)
         , iquanPlanCacheEnable(false)
+        , scanThreadNum(0)
     {}
     ~SqlConfig() {}
 public:
@@ -54,6 +56,7 @@ public:
         json.Jsonize("iquan_plan_prepare_level", iquanPlanPrepareLevel, iquanPlanPrepareLevel);
         json.Jsonize("iquan_plan_cache_enable", iquanPlanCacheEnable, iquanPlanCacheEnable);
         json.Jsonize("parallel_tables", parallelTables, parallelTables);
+        json.Jsonize("scan_thread_num", scanThreadNum, scanThreadNum);
 
 
         json.Jsonize("sql_agg_plugin_config", sqlAggPluginConfig, sqlAggPluginConfig);
@@ -78,6 +81,8 @@ public:
     std::string iquanPlanPrepareLevel;
     bool iquanPlanCacheEnable;
     std::vector<std::string> parallelTables;
+    // threads shared by scan kernels for intra partition parallel scan, 0 means disabled
+    uint32_t scanThreadNum;
 
     SqlAggPluginConfig sqlAggPluginConfig;
     SqlTvfPluginConfig sqlTvfPluginConfig;
@@ -80,5 +80,30 @@ TEST_F(AggSamplerConfigInfoTest, testJsonizeWithBatchSampleMaxCount) {
     ASSERT_EQ((uint32_t)2000, aggInfo2.getBatchSampleMaxCount());    
 }
 
+TEST_F(AggSamplerConfigInfoTest, testJsonizeParaSeekExactMode) {
+    HA3_LOG(DEBUG, "Begin Test!");
+    AggSamplerConfigInfo defaultInfo;
+    ASSERT_FALSE(defaultInfo.isParaSeekExactMode());
+    ASSERT_TRUE(defaultInfo.isEnableSampling());
+
+    string jsonStr = "\
+    {                                           \
+        \"aggThreshold\" : 1000,                \
+        \"paraSeekExactMode\" : true            \
+    }                                           \
+";
+    AggSamplerConfigInfo aggInfo;
+    FromJsonString(aggInfo, jsonStr);
+    ASSERT_TRUE(aggInfo.isParaSeekExactMode());
+    ASSERT_TRUE(aggInfo.isEnableSampling());
+
+    aggInfo.setEnableSampling(false);
+    string jsonStr2 = ToJsonString(aggInfo);
+    AggSamplerConfigInfo aggInfo2;
+    FromJsonString(aggInfo2, jsonStr2);
+    ASSERT_TRUE(aggInfo2.isParaSeekExactMode());
+    ASSERT_TRUE(aggInfo2.isEnableSampling());
+}
+
 END_HA3_NAMESPACE(config);
 
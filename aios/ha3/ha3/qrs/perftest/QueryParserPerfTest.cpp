@@ -0,0 +1,89 @@
+#include<unittest/unittest.h>
+#include <ha3/common.h>
+#include <ha3/isearch.h>
+#include <ha3/util/Log.h>
+#include <ha3/common/Query.h>
+#include <ha3/queryparser/QueryParser.h>
+#include <ha3/queryparser/FastQueryParser.h>
+#include <ha3/qrs/QueryFlatten.h>
+#include <autil/TimeUtility.h>
+#include <vector>
+#include <string>
+
+using namespace std;
+using namespace autil;
+USE_HA3_NAMESPACE(common);
+USE_HA3_NAMESPACE(queryparser);
+BEGIN_HA3_NAMESPACE(qrs);
+
+class QueryParserPerfTest : public TESTBASE {
+public:
+    void setUp();
+    void tearDown();
+protected:
+    void runQueryParser(int repeat);
+    void runFastQueryParser(int repeat);
+protected:
+    vector<string> _queryTexts;
+protected:
+    HA3_LOG_DECLARE();
+};
+
+HA3_LOG_SETUP(qrs, QueryParserPerfTest);
+
+void QueryParserPerfTest::setUp() {
+    _queryTexts.push_back("iphone");
+    _queryTexts.push_back("title:iphone AND cat:'1234'");
+    _queryTexts.push_back("title:iphone OR title:ipad OR title:mac");
+    _queryTexts.push_back("(title:apple OR brand:apple) AND cat:'phone' AND seller:'100001'");
+    _queryTexts.push_back("mp3 player \"sony walkman\"");
+}
+
+void QueryParserPerfTest::tearDown() {
+}
+
+// bison parse followed by QueryFlatten, as in the qrs chain
+void QueryParserPerfTest::runQueryParser(int repeat) {
+    for (int i = 0; i < repeat; ++i) {
+        for (size_t j = 0; j < _queryTexts.size(); ++j) {
+            QueryParser queryParser("default", OP_AND);
+            ParserContext *ctx = queryParser.parse(_queryTexts[j].c_str());
+            ASSERT_EQ(ParserContext::OK, ctx->getStatus());
+            vector<Query*> querys = ctx->stealQuerys();
+            QueryFlatten queryFlatten;
+            queryFlatten.flatten(querys[0]);
+            delete queryFlatten.stealQuery();
+            delete querys[0];
+            delete ctx;
+        }
+    }
+}
+
+void QueryParserPerfTest::runFastQueryParser(int repeat) {
+    for (int i = 0; i < repeat; ++i) {
+        for (size_t j = 0; j < _queryTexts.size(); ++j) {
+            FastQueryParser queryParser("default", OP_AND);
+            Query *query = queryParser.parse(_queryTexts[j]);
+            ASSERT_TRUE(query);
+            delete query;
+        }
+    }
+}
+
+TEST_F(QueryParserPerfTest, testParseCommonQuery) {
+    HA3_LOG(DEBUG, "Begin Test!");
+    static const int repeatTimes = 100000;
+
+    int64_t beginTime = TimeUtility::currentTime();
+    runQueryParser(repeatTimes);
+    int64_t midTime = TimeUtility::currentTime();
+    runFastQueryParser(repeatTimes);
+    int64_t endTime = TimeUtility::currentTime();
+
+    double queryCount = (double)repeatTimes * _queryTexts.size();
+    HA3_LOG(ERROR, "\n***********bison parser : %.3lf us/query"
+            "\n***********fast parser : %.3lf us/query",
+            (midTime - beginTime) / queryCount, (endTime - midTime) / queryCount);
+}
+
+END_HA3_NAMESPACE(qrs);
@@ -0,0 +1,226 @@
+#include <ha3/queryparser/FastQueryParser.h>
+#include <ha3/common/Term.h>
+#include <ha3/common/TermQuery.h>
+#include <ha3/common/PhraseQuery.h>
+#include <ha3/common/AndQuery.h>
+#include <ha3/common/OrQuery.h>
+#include <memory>
+#include <typeinfo>
+
+using namespace std;
+USE_HA3_NAMESPACE(common);
+
+BEGIN_HA3_NAMESPACE(queryparser);
+HA3_LOG_SETUP(queryparser, FastQueryParser);
+
+namespace {
+
+inline bool isIdFirstChar(char c) {
+    return c == '_' || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+inline bool isIdChar(char c) {
+    return isIdFirstChar(c) || (c >= '0' && c <= '9');
+}
+
+}
+
+FastQueryParser::FastQueryParser(const string &defaultIndex,
+                                 QueryOperator defaultOP)
+    : _defaultIndex(defaultIndex)
+    , _defaultOP(defaultOP)
+    , _cursor(0)
+{
+}
+
+FastQueryParser::~FastQueryParser() {
+}
+
+Query *FastQueryParser::parse(const string &queryText) {
+    _tokens.clear();
+    _cursor = 0;
+    if (!tokenize(queryText)) {
+        HA3_LOG(TRACE2, "unsupported query [%s]", queryText.c_str());
+        return NULL;
+    }
+    unique_ptr<Query> query(parseExprs());
+    if (!query || peek() != TT_END) {
+        HA3_LOG(TRACE2, "unsupported query [%s]", queryText.c_str());
+        return NULL;
+    }
+    return query.release();
+}
+
+// token rules follow Scanner.ll, any input the rules below do not cover
+// rejects the whole query
+bool FastQueryParser::tokenize(const string &queryText) {
+    const char *p = queryText.c_str();
+    const char *end = p + queryText.size();
+    while (p < end) {
+        char c = *p;
+        if (c == ' ' || c == '\t') {
+            ++p;
+        } else if (c == '(') {
+            _tokens.push_back(Token(TT_LPAREN, p, 1));
+            ++p;
+        } else if (c == ')') {
+            const char *next = p + 1;
+            while (next < end && (*next == ' ' || *next == '\t')) {
+                ++next;
+            }
+            if (next < end && *next == ':') {
+                // RPARENT_COLON of fields identifier
+                return false;
+            }
+            _tokens.push_back(Token(TT_RPAREN, p, 1));
+            ++p;
+        } else if (c == ':') {
+            _tokens.push_back(Token(TT_COLON, p, 1));
+            ++p;
+        } else if (c == '\'' || c == '"') {
+            const char *begin = p + 1;
+            const char *close = begin;
+            while (close < end && *close != c) {
+                if (*close == '\\') {
+                    return false;
+                }
+                ++close;
+            }
+            if (close == end || close == begin) {
+                return false;
+            }
+            _tokens.push_back(Token(c == '"' ? TT_PHRASE : TT_WORDS,
+                                    begin, close - begin));
+            p = close + 1;
+        } else if (isIdChar(c)) {
+            const char *begin = p;
+            while (p < end && isIdChar(*p)) {
+                ++p;
+            }
+            // usable symbols or cjk bytes would extend it to a CJK_STRING
+            // token, they are rejected as the next token
+            Token token(isIdFirstChar(c) ? TT_IDENTIFIER : TT_WORDS,
+                        begin, p - begin);
+            if (token.text == "AND") {
+                token.type = TT_AND;
+            } else if (token.text == "OR") {
+                token.type = TT_OR;
+            } else if (token.text == "ANDNOT" || token.text == "RANK") {
+                return false;
+            }
+            _tokens.push_back(token);
+        } else {
+            return false;
+        }
+    }
+    _tokens.push_back(Token(TT_END, end, 0));
+    return true;
+}
+
+// exprs : expr | exprs expr, adjacent exprs are joined by the default operator
+Query *FastQueryParser::parseExprs() {
+    unique_ptr<Query> query(parseOrExpr());
+    if (!query) {
+        return NULL;
+    }
+    while (peek() != TT_END && peek() != TT_RPAREN) {
+        Query *next = parseOrExpr();
+        if (!next) {
+            return NULL;
+        }
+        query.reset(combine(_defaultOP, query.release(), next));
+    }
+    return query.release();
+}
+
+Query *FastQueryParser::parseOrExpr() {
+    unique_ptr<Query> query(parseAndExpr());
+    if (!query) {
+        return NULL;
+    }
+    while (peek() == TT_OR) {
+        ++_cursor;
+        Query *next = parseAndExpr();
+        if (!next) {
+            return NULL;
+        }
+        query.reset(combine(OP_OR, query.release(), next));
+    }
+    return query.release();
+}
+
+Query *FastQueryParser::parseAndExpr() {
+    unique_ptr<Query> query(parsePrimary());
+    if (!query) {
+        return NULL;
+    }
+    while (peek() == TT_AND) {
+        ++_cursor;
+        Query *next = parsePrimary();
+        if (!next) {
+            return NULL;
+        }
+        query.reset(combine(OP_AND, query.release(), next));
+    }
+    return query.release();
+}
+
+Query *FastQueryParser::parsePrimary() {
+    if (peek() != TT_LPAREN) {
+        return parseAtomic();
+    }
+    ++_cursor;
+    unique_ptr<Query> query(parseExprs());
+    if (!query || peek() != TT_RPAREN) {
+        return NULL;
+    }
+    ++_cursor;
+    return query.release();
+}
+
+Query *FastQueryParser::parseAtomic() {
+    string indexName = _defaultIndex;
+    if (peek() == TT_IDENTIFIER && _tokens[_cursor + 1].type == TT_COLON) {
+        indexName = _tokens[_cursor].text;
+        _cursor += 2;
+    }
+    const Token &token = _tokens[_cursor];
+    if (token.type == TT_WORDS || token.type == TT_IDENTIFIER) {
+        ++_cursor;
+        return new TermQuery(Term(token.text, indexName, RequiredFields()), "");
+    }
+    if (token.type == TT_PHRASE) {
+        ++_cursor;
+        PhraseQuery *query = new PhraseQuery("");
+        query->addTerm(TermPtr(new Term(token.text, indexName, RequiredFields())));
+        return query;
+    }
+    return NULL;
+}
+
+// children of the same type are merged as QueryFlatten does, the queries
+// built here never carry labels or sub query match data level
+Query *FastQueryParser::combine(QueryOperator op, Query *left, Query *right) {
+    unique_ptr<Query> result;
+    if (op == OP_OR) {
+        result.reset(new OrQuery(""));
+    } else {
+        result.reset(new AndQuery(""));
+    }
+    Query *children[] = {left, right};
+    for (size_t i = 0; i < 2; ++i) {
+        Query *child = children[i];
+        if (typeid(*child) == typeid(*result)) {
+            const vector<QueryPtr> *grandChildren = child->getChildQuery();
+            for (size_t j = 0; j < grandChildren->size(); ++j) {
+                result->addQuery((*grandChildren)[j]);
+            }
+            delete child;
+        } else {
+            result->addQuery(QueryPtr(child));
+        }
+    }
+    return result.release();
+}
+
+END_HA3_NAMESPACE(queryparser);
@@ -0,0 +1,78 @@
+#ifndef ISEARCH_FASTQUERYPARSER_H
+#define ISEARCH_FASTQUERYPARSER_H
+
+#include <ha3/common.h>
+#include <ha3/isearch.h>
+#include <ha3/util/Log.h>
+#include <ha3/common/Query.h>
+#include <string>
+#include <vector>
+
+BEGIN_HA3_NAMESPACE(queryparser);
+
+// single pass parser for the dominant query shape: words, single quoted and
+// phrase terms with an optional index prefix, combined by AND, OR, default
+// operator and parentheses. the same-operator chains are flattened while
+// building, so the result equals the bison parse followed by QueryFlatten.
+// any other syntax (boost, labels, ranges, multi term, ANDNOT, RANK, ';',
+// non-ascii words...) is left to QueryParser.
+class FastQueryParser
+{
+private:
+    enum TokenType {
+        TT_WORDS,
+        TT_IDENTIFIER,
+        TT_PHRASE,
+        TT_AND,
+        TT_OR,
+        TT_LPAREN,
+        TT_RPAREN,
+        TT_COLON,
+        TT_END
+    };
+    struct Token {
+        Token(TokenType type_, const char *begin, size_t len)
+            : type(type_)
+            , text(begin, len)
+        {}
+        TokenType type;
+        std::string text;
+    };
+public:
+    FastQueryParser(const std::string &defaultIndex,
+                    QueryOperator defaultOP = OP_AND);
+    ~FastQueryParser();
+private:
+    FastQueryParser(const FastQueryParser &);
+    FastQueryParser& operator=(const FastQueryParser &);
+public:
+    // return NULL if queryText is not in the supported shape
+    common::Query *parse(const std::string &queryText);
+private:
+    bool tokenize(const std::string &queryText);
+    common::Query *parseExprs();
+    common::Query *parseOrExpr();
+    common::Query *parseAndExpr();
+    common::Query *parsePrimary();
+    common::Query *parseAtomic();
+    common::Query *combine(QueryOperator op, common::Query *left,
+                           common::Query *right);
+    TokenType peek() const {
+        return _tokens[_cursor].type;
+    }
+private:
+    std::string _defaultIndex;
+    QueryOperator _defaultOP;
+    std::vector<Token> _tokens;
+    size_t _cursor;
+private:
+    friend class FastQueryParserTest;
+private:
+    HA3_LOG_DECLARE();
+};
+
+HA3_TYPEDEF_PTR(FastQueryParser);
+
+END_HA3_NAMESPACE(queryparser);
+
+#endif //ISEARCH_FASTQUERYPARSER_H
@@ -0,0 +1,241 @@
+#include <ha3/queryparser/FastSyntaxExprParser.h>
+#include <memory>
+#include <set>
+
+using namespace std;
+using namespace suez::turing;
+
+BEGIN_HA3_NAMESPACE(queryparser);
+HA3_LOG_SETUP(queryparser, FastSyntaxExprParser);
+
+namespace {
+
+inline bool isIdFirstChar(char c) {
+    return c == '_' || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+inline bool isIdChar(char c) {
+    return isIdFirstChar(c) || (c >= '0' && c <= '9');
+}
+
+inline bool isDigit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+inline bool isHexDigit(char c) {
+    return isDigit(c) || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+
+// words ClauseScanner returns as keyword tokens instead of IDENTIFIER
+bool isClauseKeyword(const string &word) {
+    static const set<string> keywords = {
+        "AND", "OR", "RANK", "UNLIMITED",
+        "dist_key", "dist_count", "dist_times", "max_item_count", "reserved",
+        "update_total_hit", "dbmodule", "dist_filter", "grade", "group_key",
+        "range", "agg_fun", "max", "min", "count", "sum", "distinct_count",
+        "agg_filter", "max_group", "agg_sampler_threshold", "agg_sampler_step",
+        "quota", "key", "use", "cur_time", "expire_time", "cache_filter",
+        "cache_doc_num_limit", "refresh_attributes", "sort", "percent"
+    };
+    return keywords.find(word) != keywords.end();
+}
+
+}
+
+FastSyntaxExprParser::FastSyntaxExprParser()
+    : _cursor(0)
+{
+}
+
+FastSyntaxExprParser::~FastSyntaxExprParser() {
+}
+
+SyntaxExpr *FastSyntaxExprParser::parseAttribute(const string &exprText) {
+    if (!tokenize(exprText) || peek() != TT_IDENTIFIER
+        || _tokens[1].type != TT_END)
+    {
+        HA3_LOG(TRACE2, "unsupported attribute expr [%s]", exprText.c_str());
+        return NULL;
+    }
+    return _syntaxExprParser.createAtomicExpr(new string(_tokens[0].text),
+            ATTRIBUTE_NAME);
+}
+
+// filter : relation | filter AND relation, AND is left associative as in
+// ClauseBisonParser
+SyntaxExpr *FastSyntaxExprParser::parseFilter(const string &exprText) {
+    if (!tokenize(exprText)) {
+        HA3_LOG(TRACE2, "unsupported filter expr [%s]", exprText.c_str());
+        return NULL;
+    }
+    unique_ptr<SyntaxExpr> expr(parseRelation());
+    while (expr && peek() == TT_AND) {
+        ++_cursor;
+        unique_ptr<SyntaxExpr> next(parseRelation());
+        if (!next) {
+            expr.reset();
+            break;
+        }
+        SyntaxExpr *andExpr = _syntaxExprParser.createAndExpr(expr.get(), next.get());
+        if (!andExpr) {
+            expr.reset();
+            break;
+        }
+        expr.release();
+        next.release();
+        expr.reset(andExpr);
+    }
+    if (!expr || peek() != TT_END) {
+        HA3_LOG(TRACE2, "unsupported filter expr [%s]", exprText.c_str());
+        return NULL;
+    }
+    return expr.release();
+}
+
+// token rules follow ClauseScanner.ll, any input the rules below do not
+// cover rejects the whole expression
+bool FastSyntaxExprParser::tokenize(const string &exprText) {
+    _tokens.clear();
+    _cursor = 0;
+    const char *p = exprText.c_str();
+    const char *end = p + exprText.size();
+    while (p < end) {
+        char c = *p;
+        const char *begin = p;
+        if (c == ' ' || c == '\t') {
+            ++p;
+            continue;
+        }
+        if (isDigit(c)) {
+            TokenType type = TT_INTEGER;
+            if (c == '0' && p + 2 < end && (p[1] == 'x' || p[1] == 'X')
+                && isHexDigit(p[2]))
+            {
+                p += 2;
+                while (p < end && isHexDigit(*p)) {
+                    ++p;
+                }
+            } else {
+                while (p < end && isDigit(*p)) {
+                    ++p;
+                }
+                if (p + 1 < end && *p == '.' && isDigit(p[1])) {
+                    type = TT_FLOAT;
+                    ++p;
+                    while (p < end && isDigit(*p)) {
+                        ++p;
+                    }
+                }
+            }
+            if (p < end && (isIdChar(*p) || *p == '.')) {
+                return false;
+            }
+            _tokens.push_back(Token(type, begin, p - begin));
+        } else if (isIdFirstChar(c)) {
+            while (p < end && isIdChar(*p)) {
+                ++p;
+            }
+            Token token(TT_IDENTIFIER, begin, p - begin);
+            if (token.text == "AND") {
+                token.type = TT_AND;
+            } else if (isClauseKeyword(token.text)) {
+                return false;
+            }
+            _tokens.push_back(token);
+        } else if (c == '"') {
+            const char *close = p + 1;
+            while (close < end && *close != '"') {
+                if (*close == '\\') {
+                    return false;
+                }
+                ++close;
+            }
+            if (close == end) {
+                return false;
+            }
+            _tokens.push_back(Token(TT_STRING, p + 1, close - p - 1));
+            p = close + 1;
+        } else if (c == '-') {
+            _tokens.push_back(Token(TT_MINUS, p, 1));
+            ++p;
+        } else if (c == '=') {
+            _tokens.push_back(Token(TT_EQUAL, p, 1));
+            ++p;
+        } else if (c == '!' && p + 1 < end && p[1] == '=') {
+            _tokens.push_back(Token(TT_NE, p, 2));
+            p += 2;
+        } else if (c == '<' || c == '>') {
+            bool withEqual = p + 1 < end && p[1] == '=';
+            TokenType type = c == '<' ? (withEqual ? TT_LE : TT_LESS)
+                             : (withEqual ? TT_GE : TT_GREATER);
+            size_t len = withEqual ? 2 : 1;
+            _tokens.push_back(Token(type, p, len));
+            p += len;
+        } else {
+            return false;
+        }
+    }
+    _tokens.push_back(Token(TT_END, end, 0));
+    return true;
+}
+
+// relation : IDENTIFIER op literal
+SyntaxExpr *FastSyntaxExprParser::parseRelation() {
+    if (peek() != TT_IDENTIFIER) {
+        return NULL;
+    }
+    const string &attrName = _tokens[_cursor].text;
+    TokenType op = _tokens[_cursor + 1].type;
+    if (op != TT_EQUAL && op != TT_NE && op != TT_LESS && op != TT_GREATER
+        && op != TT_LE && op != TT_GE)
+    {
+        return NULL;
+    }
+    _cursor += 2;
+    unique_ptr<SyntaxExpr> literal(parseLiteral());
+    if (!literal) {
+        return NULL;
+    }
+    SyntaxExpr *attr = _syntaxExprParser.createAtomicExpr(new string(attrName),
+            ATTRIBUTE_NAME);
+    SyntaxExpr *value = literal.release();
+    switch (op) {
+    case TT_EQUAL:
+        return _syntaxExprParser.createEqualExpr(attr, value);
+    case TT_NE:
+        return _syntaxExprParser.createNotEqualExpr(attr, value);
+    case TT_LESS:
+        return _syntaxExprParser.createLessExpr(attr, value);
+    case TT_GREATER:
+        return _syntaxExprParser.createGreaterExpr(attr, value);
+    case TT_LE:
+        return _syntaxExprParser.createLessEqualExpr(attr, value);
+    default:
+        return _syntaxExprParser.createGreaterEqualExpr(attr, value);
+    }
+}
+
+// literal : INTEGER | FLOAT | '-' INTEGER | '-' FLOAT | PHRASE_STRING
+SyntaxExpr *FastSyntaxExprParser::parseLiteral() {
+    bool isPositive = true;
+    if (peek() == TT_MINUS) {
+        isPositive = false;
+        ++_cursor;
+    }
+    const Token &token = _tokens[_cursor];
+    AtomicSyntaxExprType valueType;
+    if (token.type == TT_INTEGER) {
+        valueType = INTEGER_VALUE;
+    } else if (token.type == TT_FLOAT) {
+        valueType = FLOAT_VALUE;
+    } else if (token.type == TT_STRING && isPositive) {
+        valueType = STRING_VALUE;
+    } else {
+        return NULL;
+    }
+    ++_cursor;
+    return _syntaxExprParser.createAtomicExpr(new string(token.text),
+            valueType, isPositive);
+}
+
+END_HA3_NAMESPACE(queryparser);
@@ -0,0 +1,77 @@
+#ifndef ISEARCH_FASTSYNTAXEXPRPARSER_H
+#define ISEARCH_FASTSYNTAXEXPRPARSER_H
+
+#include <ha3/common.h>
+#include <ha3/isearch.h>
+#include <ha3/util/Log.h>
+#include <ha3/queryparser/SyntaxExprParser.h>
+#include <string>
+#include <vector>
+
+BEGIN_HA3_NAMESPACE(queryparser);
+
+// single pass parser for the dominant sort and filter shapes: a plain
+// attribute name, or "attr op literal" relations joined by AND, where op is
+// one of = != < > <= >= and literal is an integer, float or double quoted
+// string. the tree is built by SyntaxExprParser as ClauseBisonParser does.
+// any other syntax (OR, parentheses, functions, arithmetic, keywords of
+// ClauseScanner, escaped strings...) is left to ClauseParserContext.
+class FastSyntaxExprParser
+{
+private:
+    enum TokenType {
+        TT_IDENTIFIER,
+        TT_INTEGER,
+        TT_FLOAT,
+        TT_STRING,
+        TT_MINUS,
+        TT_AND,
+        TT_EQUAL,
+        TT_NE,
+        TT_LESS,
+        TT_GREATER,
+        TT_LE,
+        TT_GE,
+        TT_END
+    };
+    struct Token {
+        Token(TokenType type_, const char *begin, size_t len)
+            : type(type_)
+            , text(begin, len)
+        {}
+        TokenType type;
+        std::string text;
+    };
+public:
+    FastSyntaxExprParser();
+    ~FastSyntaxExprParser();
+private:
+    FastSyntaxExprParser(const FastSyntaxExprParser &);
+    FastSyntaxExprParser& operator=(const FastSyntaxExprParser &);
+public:
+    // return NULL if exprText is not a plain attribute name
+    suez::turing::SyntaxExpr *parseAttribute(const std::string &exprText);
+    // return NULL if exprText is not in the supported filter shape
+    suez::turing::SyntaxExpr *parseFilter(const std::string &exprText);
+private:
+    bool tokenize(const std::string &exprText);
+    suez::turing::SyntaxExpr *parseRelation();
+    suez::turing::SyntaxExpr *parseLiteral();
+    TokenType peek() const {
+        return _tokens[_cursor].type;
+    }
+private:
+    suez::turing::SyntaxExprParser _syntaxExprParser;
+    std::vector<Token> _tokens;
+    size_t _cursor;
+private:
+    friend class FastSyntaxExprParserTest;
+private:
+    HA3_LOG_DECLARE();
+};
+
+HA3_TYPEDEF_PTR(FastSyntaxExprParser);
+
+END_HA3_NAMESPACE(queryparser);
+
+#endif //ISEARCH_FASTSYNTAXEXPRPARSER_H
@@ -1,5 +1,7 @@
 #include <ha3/queryparser/RequestParser.h>
 #include <ha3/queryparser/QueryParser.h>
+#include <ha3/queryparser/FastQueryParser.h>
+#include <ha3/queryparser/FastSyntaxExprParser.h>
 #include <ha3/queryparser/ParserContext.h>
 #include <autil/StringTokenizer.h>
 #include <suez/turing/expression/syntax/SyntaxExpr.h>
@@ -562,11 +564,18 @@ bool RequestParser::parseQueryClause(RequestPtr &requestPtr,
         defaultOP = queryInfo.getDefaultOperator();
     }
 
+    HA3_LOG(TRACE2, "QueryText: [%s]", queryClauseStr.c_str());
+
+    FastQueryParser fastQueryParser(defaultIndexName, defaultOP);
+    Query *fastQuery = fastQueryParser.parse(queryClauseStr);
+    if (fastQuery) {
+        queryClause->setRootQuery(fastQuery, 0);
+        return true;
+    }
+
     QueryParser queryParser(defaultIndexName.c_str(), defaultOP,
                             queryInfo.getDefaultMultiTermOptimizeFlag());
 
-    HA3_LOG(TRACE2, "QueryText: [%s]", queryClauseStr.c_str());
-
     ParserContext *context = queryParser.parse(queryClauseStr.c_str());
 
     if(ParserContext::OK != context->getStatus()){
@@ -592,6 +601,12 @@ bool RequestParser::parseFilterClause(FilterClause *filterClause) {
         return false;
     }
     const string &filterClauseStr = filterClause->getOriginalString();
+    FastSyntaxExprParser fastParser;
+    SyntaxExpr *fastExpr = fastParser.parseFilter(filterClauseStr);
+    if (fastExpr) {
+        filterClause->setRootSyntaxExpr(fastExpr);
+        return true;
+    }
     ClauseParserContext ctx;
     if (!ctx.parseSyntaxExpr(filterClauseStr.c_str())) {
         _errorResult.resetError(ERROR_FILTER_CLAUSE, string("original string:") + filterClauseStr);
@@ -766,6 +781,7 @@ bool RequestParser::parseSortClause(RequestPtr &requestPtr) {
                            "empty error sort description: ");
         return false;
     }
+    FastSyntaxExprParser fastParser;
     for (StringTokenizer::Iterator it = st.begin(); it != st.end(); it++) {
         const string &originalString = *it;
         unique_ptr<SortDescription> sortDescriptionPtr(new SortDescription(originalString));
@@ -785,13 +801,16 @@ bool RequestParser::parseSortClause(RequestPtr &requestPtr) {
         }
 
         if (trimedString != SORT_CLAUSE_RANK) {
-            ClauseParserContext ctx;
-            if (!ctx.parseSyntaxExpr(trimedString.c_str())) {
-                _errorResult.resetError(ERROR_SORT_CLAUSE,
-                        string("trimedString: ") + trimedString);
-                return false;
+            SyntaxExpr* expr = fastParser.parseAttribute(trimedString);
+            if (!expr) {
+                ClauseParserContext ctx;
+                if (!ctx.parseSyntaxExpr(trimedString.c_str())) {
+                    _errorResult.resetError(ERROR_SORT_CLAUSE,
+                            string("trimedString: ") + trimedString);
+                    return false;
+                }
+                expr = ctx.stealSyntaxExpr();
             }
-            SyntaxExpr* expr = ctx.stealSyntaxExpr();
             assert(expr);
             sortDescriptionPtr->setRootSyntaxExpr(expr);
             sortDescriptionPtr->setExpressionType(SortDescription::RS_NORMAL);
@@ -0,0 +1,126 @@
+#include<unittest/unittest.h>
+#include <ha3/common.h>
+#include <ha3/isearch.h>
+#include <ha3/util/Log.h>
+#include <ha3/queryparser/FastQueryParser.h>
+#include <ha3/queryparser/QueryParser.h>
+#include <ha3/qrs/QueryFlatten.h>
+#include <ha3/common/Query.h>
+#include <memory>
+
+using namespace std;
+USE_HA3_NAMESPACE(common);
+USE_HA3_NAMESPACE(qrs);
+
+BEGIN_HA3_NAMESPACE(queryparser);
+
+class FastQueryParserTest : public TESTBASE {
+public:
+    void setUp();
+    void tearDown();
+protected:
+    void checkSameAsQueryParser(const string &queryText,
+                                QueryOperator defaultOP = OP_AND);
+    void checkUnsupported(const string &queryText);
+protected:
+    HA3_LOG_DECLARE();
+};
+
+HA3_LOG_SETUP(queryparser, FastQueryParserTest);
+
+void FastQueryParserTest::setUp() {
+}
+
+void FastQueryParserTest::tearDown() {
+}
+
+void FastQueryParserTest::checkSameAsQueryParser(const string &queryText,
+        QueryOperator defaultOP)
+{
+    FastQueryParser fastParser("default", defaultOP);
+    unique_ptr<Query> fastQuery(fastParser.parse(queryText));
+    ASSERT_TRUE(fastQuery.get()) << queryText;
+
+    QueryParser queryParser("default", defaultOP);
+    unique_ptr<ParserContext> ctx(queryParser.parse(queryText.c_str()));
+    ASSERT_EQ(ParserContext::OK, ctx->getStatus()) << queryText;
+    vector<Query*> querys = ctx->stealQuerys();
+    ASSERT_EQ(size_t(1), querys.size());
+    unique_ptr<Query> query(querys[0]);
+    QueryFlatten queryFlatten;
+    queryFlatten.flatten(query.get());
+    unique_ptr<Query> flattenQuery(queryFlatten.stealQuery());
+
+    ASSERT_EQ(flattenQuery->toString(), fastQuery->toString()) << queryText;
+    ASSERT_TRUE(*flattenQuery == *fastQuery) << queryText;
+}
+
+void FastQueryParserTest::checkUnsupported(const string &queryText) {
+    FastQueryParser fastParser("default");
+    unique_ptr<Query> fastQuery(fastParser.parse(queryText));
+    ASSERT_FALSE(fastQuery.get()) << queryText;
+}
+
+TEST_F(FastQueryParserTest, testParseTerms) {
+    checkSameAsQueryParser("abc");
+    checkSameAsQueryParser("123");
+    checkSameAsQueryParser("12ab_c");
+    checkSameAsQueryParser("title:abc");
+    checkSameAsQueryParser("title : abc");
+    checkSameAsQueryParser("title:'a:b c'");
+    checkSameAsQueryParser("'\xe6\x9d\x8e'");
+    checkSameAsQueryParser("\"ab cd\"");
+    checkSameAsQueryParser("title:\"ab cd\"");
+    checkSameAsQueryParser("ANDROID");
+    checkSameAsQueryParser("ORACLE");
+}
+
+TEST_F(FastQueryParserTest, testParseBinaryExprs) {
+    checkSameAsQueryParser("a AND b");
+    checkSameAsQueryParser("a OR b");
+    checkSameAsQueryParser("a AND b AND c AND d");
+    checkSameAsQueryParser("a OR b AND c OR d");
+    checkSameAsQueryParser("a AND b OR c AND d");
+    checkSameAsQueryParser("(a OR b) AND (c OR d)");
+    checkSameAsQueryParser("a AND (b AND (c AND d))");
+    checkSameAsQueryParser("((a))");
+    checkSameAsQueryParser("title:a AND body:'b' OR \"c d\"");
+}
+
+TEST_F(FastQueryParserTest, testParseDefaultOP) {
+    checkSameAsQueryParser("a b c");
+    checkSameAsQueryParser("a b c", OP_OR);
+    checkSameAsQueryParser("a AND b c");
+    checkSameAsQueryParser("a b OR c");
+    checkSameAsQueryParser("a b OR c", OP_OR);
+    checkSameAsQueryParser("a (b OR c) d");
+    checkSameAsQueryParser("title:a'b'(c)");
+}
+
+TEST_F(FastQueryParserTest, testUnsupported) {
+    checkUnsupported("");
+    checkUnsupported("   ");
+    checkUnsupported("a;b");
+    checkUnsupported("a ANDNOT b");
+    checkUnsupported("a RANK b");
+    checkUnsupported("abc^10");
+    checkUnsupported("abc#chain");
+    checkUnsupported("(a OR b)@label");
+    checkUnsupported("title:(a|b)");
+    checkUnsupported("title:a&b");
+    checkUnsupported("title:[1,10]");
+    checkUnsupported("title:=10");
+    checkUnsupported("-10");
+    checkUnsupported("abc.def");
+    checkUnsupported("\xe6\x9d\x8e");
+    checkUnsupported("'a\\'b'");
+    checkUnsupported("''");
+    checkUnsupported("'abc");
+    checkUnsupported("(title,body):abc");
+    checkUnsupported("title:");
+    checkUnsupported("a AND");
+    checkUnsupported("(a OR b");
+    checkUnsupported("a OR b)");
+}
+
+END_HA3_NAMESPACE(queryparser);
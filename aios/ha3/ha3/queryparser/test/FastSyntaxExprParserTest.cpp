@@ -0,0 +1,113 @@
+#include<unittest/unittest.h>
+#include <ha3/common.h>
+#include <ha3/isearch.h>
+#include <ha3/util/Log.h>
+#include <ha3/queryparser/FastSyntaxExprParser.h>
+#include <ha3/queryparser/ClauseParserContext.h>
+#include <memory>
+
+using namespace std;
+using namespace suez::turing;
+
+BEGIN_HA3_NAMESPACE(queryparser);
+
+class FastSyntaxExprParserTest : public TESTBASE {
+public:
+    void setUp();
+    void tearDown();
+protected:
+    void checkSameAsBison(const string &exprText, bool isFilter);
+    void checkUnsupported(const string &exprText, bool isFilter);
+protected:
+    HA3_LOG_DECLARE();
+};
+
+HA3_LOG_SETUP(queryparser, FastSyntaxExprParserTest);
+
+void FastSyntaxExprParserTest::setUp() {
+}
+
+void FastSyntaxExprParserTest::tearDown() {
+}
+
+void FastSyntaxExprParserTest::checkSameAsBison(const string &exprText, bool isFilter) {
+    FastSyntaxExprParser fastParser;
+    unique_ptr<SyntaxExpr> fastExpr(isFilter ? fastParser.parseFilter(exprText)
+                                    : fastParser.parseAttribute(exprText));
+    ASSERT_TRUE(fastExpr.get()) << exprText;
+
+    ClauseParserContext ctx;
+    ASSERT_TRUE(ctx.parseSyntaxExpr(exprText.c_str())) << exprText;
+    unique_ptr<SyntaxExpr> bisonExpr(ctx.stealSyntaxExpr());
+    ASSERT_TRUE(bisonExpr.get()) << exprText;
+
+    ASSERT_EQ(bisonExpr->getExprString(), fastExpr->getExprString()) << exprText;
+    ASSERT_EQ(bisonExpr->getSyntaxExprType(), fastExpr->getSyntaxExprType()) << exprText;
+    ASSERT_EQ(bisonExpr->getExprResultType(), fastExpr->getExprResultType()) << exprText;
+    AtomicSyntaxExpr *bisonAtomic = dynamic_cast<AtomicSyntaxExpr *>(bisonExpr.get());
+    AtomicSyntaxExpr *fastAtomic = dynamic_cast<AtomicSyntaxExpr *>(fastExpr.get());
+    ASSERT_EQ(bisonAtomic == NULL, fastAtomic == NULL) << exprText;
+    if (bisonAtomic) {
+        ASSERT_EQ(bisonAtomic->getAtomicSyntaxExprType(),
+                  fastAtomic->getAtomicSyntaxExprType()) << exprText;
+    }
+}
+
+void FastSyntaxExprParserTest::checkUnsupported(const string &exprText, bool isFilter) {
+    FastSyntaxExprParser fastParser;
+    unique_ptr<SyntaxExpr> fastExpr(isFilter ? fastParser.parseFilter(exprText)
+                                    : fastParser.parseAttribute(exprText));
+    ASSERT_FALSE(fastExpr.get()) << exprText;
+}
+
+TEST_F(FastSyntaxExprParserTest, testParseAttribute) {
+    checkSameAsBison("price", false);
+    checkSameAsBison("  _price2 ", false);
+    checkSameAsBison("ANDROID", false);
+
+    checkUnsupported("", false);
+    checkUnsupported("RANK", false);
+    checkUnsupported("dist_key", false);
+    checkUnsupported("price + 1", false);
+    checkUnsupported("func(price)", false);
+    checkUnsupported("2price", false);
+    checkUnsupported("a > 1", false);
+}
+
+TEST_F(FastSyntaxExprParserTest, testParseFilter) {
+    checkSameAsBison("price > 10", true);
+    checkSameAsBison("price=10", true);
+    checkSameAsBison("price != 10", true);
+    checkSameAsBison("price < 1.5", true);
+    checkSameAsBison("price <= -10", true);
+    checkSameAsBison("price >= - 2.5", true);
+    checkSameAsBison("price = 0x1F", true);
+    checkSameAsBison("title = \"a b\"", true);
+    checkSameAsBison("title = \"\"", true);
+    checkSameAsBison("a > 1 AND b < 2", true);
+    checkSameAsBison("a > 1 AND b < 2 AND c = \"x\" AND d != -3", true);
+}
+
+TEST_F(FastSyntaxExprParserTest, testFilterUnsupported) {
+    checkUnsupported("", true);
+    checkUnsupported("price", true);
+    checkUnsupported("a > 1 OR b < 2", true);
+    checkUnsupported("(a > 1)", true);
+    checkUnsupported("a > 1 AND", true);
+    checkUnsupported("a > b", true);
+    checkUnsupported("1 < a", true);
+    checkUnsupported("a + 1 > 2", true);
+    checkUnsupported("a > 1 + 2", true);
+    checkUnsupported("in(a, \"1|2\")", true);
+    checkUnsupported("a = \"x\\\"y\"", true);
+    checkUnsupported("a = \"x", true);
+    checkUnsupported("a = -\"x\"", true);
+    checkUnsupported("a > 1.", true);
+    checkUnsupported("a > 12ab", true);
+    checkUnsupported("a > 0x", true);
+    checkUnsupported("max > 1", true);
+    checkUnsupported("a ! 1", true);
+    checkUnsupported("a > 1 ; b < 2", true);
+}
+
+END_HA3_NAMESPACE(queryparser);
@@ -5,6 +5,8 @@
 #include <ha3/isearch.h>
 #include <ha3/util/Log.h>
 #include <vector>
+#include <string.h>
+#include <type_traits>
 #include <ha3/rank/Comparator.h>
 #include <ha3/common/GlobalIdentifier.h>
 #include <suez/turing/expression/framework/AttributeExpression.h>
@@ -12,6 +14,51 @@
 
 BEGIN_HA3_NAMESPACE(rank);
 
+// fixed-width key of at most two sort values, ordered as (key1, key2) ascending,
+// unordered keys hold a NaN and are compared on the docs instead
+struct SortKey {
+    uint64_t key1;
+    uint64_t key2;
+    bool unordered;
+};
+
+// encode a numeric sort value into an unsigned key keeping its order,
+// -0.0 is folded into 0.0 so that values equal under operator< share one key.
+// NaN is neither less nor greater than any value under operator<, no key
+// can keep that, so it is reported by isUnordered
+template <typename T, typename Enable = void>
+struct SortKeyNormalizer {
+    static const bool SUPPORTED = false;
+    static uint64_t normalize(const T &value) { return 0; }
+    static bool isUnordered(const T &value) { return false; }
+};
+
+template <typename T>
+struct SortKeyNormalizer<T, typename std::enable_if<std::is_integral<T>::value>::type> {
+    static const bool SUPPORTED = true;
+    static bool isUnordered(T value) { return false; }
+    static uint64_t normalize(T value) {
+        if (std::is_signed<T>::value) {
+            return (uint64_t)(int64_t)value ^ (1ULL << 63);
+        }
+        return (uint64_t)value;
+    }
+};
+
+template <typename T>
+struct SortKeyNormalizer<T, typename std::enable_if<std::is_same<T, float>::value
+                                                    || std::is_same<T, double>::value>::type>
+{
+    static const bool SUPPORTED = true;
+    static bool isUnordered(T value) { return value != value; }
+    static uint64_t normalize(T value) {
+        double d = value == 0 ? 0.0 : (double)value;
+        uint64_t bits;
+        memcpy(&bits, &d, sizeof(bits));
+        return (bits >> 63) ? ~bits : (bits | (1ULL << 63));
+    }
+};
+
 class ComboComparator : public Comparator
 {
 public:
@@ -27,7 +74,31 @@ public:
     void setExtrDocIdComparator(Comparator *cmp);
     void setExtrHashIdComparator(Comparator *cmp);
     void setExtrClusterIdComparator(Comparator *cmp);
+public:
+    // comparators on one or two numeric references can extract a SortKey
+    // once per doc, compareSortKey on the keys agrees with compare on the docs
+    virtual bool supportSortKey() const { return false; }
+    virtual void extractSortKey(matchdoc::MatchDoc doc, SortKey &key) const {
+        assert(false);
+    }
+    bool compareSortKey(const SortKey &keyA, matchdoc::MatchDoc a,
+                        const SortKey &keyB, matchdoc::MatchDoc b) const
+    {
+        if (unlikely(keyA.unordered || keyB.unordered)) {
+            return compare(a, b);
+        }
+        if (keyA.key1 != keyB.key1) {
+            return keyA.key1 < keyB.key1;
+        }
+        if (keyA.key2 != keyB.key2) {
+            return keyA.key2 < keyB.key2;
+        }
+        return compareDocInfo(a, b);
+    }
 protected:
+    static uint64_t getSortKeyMask(bool sortFlag) {
+        return sortFlag ? ~0ULL : 0ULL;
+    }
     bool compareDocInfo(matchdoc::MatchDoc a, matchdoc::MatchDoc b) const;
 public:
     // for test
@@ -50,6 +121,7 @@ public:
     OneRefComparatorTyped(const matchdoc::Reference<T> *variableReference, bool sortFlag) {
         _reference = variableReference;
         _sortFlag = sortFlag;
+        _keyMask = getSortKeyMask(sortFlag);
     }
 public:
     bool compare(matchdoc::MatchDoc a, matchdoc::MatchDoc b) const override {
@@ -62,6 +134,15 @@ public:
         }
         return compareDocInfo(a, b);
     }
+    bool supportSortKey() const override {
+        return SortKeyNormalizer<T>::SUPPORTED;
+    }
+    void extractSortKey(matchdoc::MatchDoc doc, SortKey &key) const override {
+        const T &value = *_reference->getPointer(doc);
+        key.key1 = SortKeyNormalizer<T>::normalize(value) ^ _keyMask;
+        key.key2 = 0;
+        key.unordered = SortKeyNormalizer<T>::isUnordered(value);
+    }
 private:
     inline bool compareRef(T& a, T& b) const {
         return _sortFlag ? b < a : a < b;
@@ -70,6 +151,7 @@ private:
 private:
     const matchdoc::Reference<T> *_reference;
     bool _sortFlag;
+    uint64_t _keyMask;
 };
 
 template <typename T1, typename T2>
@@ -83,6 +165,8 @@ public:
         _reference2 = variableReference2;
         _sortFlag1 = sortFlag1;
         _sortFlag2 = sortFlag2;
+        _keyMask1 = getSortKeyMask(sortFlag1);
+        _keyMask2 = getSortKeyMask(sortFlag2);
     }
 public:
     bool compare(matchdoc::MatchDoc a, matchdoc::MatchDoc b) const override {
@@ -102,6 +186,17 @@ public:
         }
         return compareDocInfo(a, b);
     }
+    bool supportSortKey() const override {
+        return SortKeyNormalizer<T1>::SUPPORTED && SortKeyNormalizer<T2>::SUPPORTED;
+    }
+    void extractSortKey(matchdoc::MatchDoc doc, SortKey &key) const override {
+        const T1 &value1 = *_reference1->getPointer(doc);
+        const T2 &value2 = *_reference2->getPointer(doc);
+        key.key1 = SortKeyNormalizer<T1>::normalize(value1) ^ _keyMask1;
+        key.key2 = SortKeyNormalizer<T2>::normalize(value2) ^ _keyMask2;
+        key.unordered = SortKeyNormalizer<T1>::isUnordered(value1)
+                        || SortKeyNormalizer<T2>::isUnordered(value2);
+    }
     
 private:
     inline bool compareRef1(T1 &a, T1 &b) const {
@@ -117,6 +212,8 @@ private:
     bool _sortFlag1;
     const matchdoc::Reference<T2> *_reference2;
     bool _sortFlag2;
+    uint64_t _keyMask1;
+    uint64_t _keyMask2;
 };
 
 template <typename T1, typename T2>
@@ -58,26 +58,39 @@ bool DefaultScorer::beginRequest(suez::turing::ScoringProvider *turingProvider){
     return true;
 }
 
-score_t DefaultScorer::score(matchdoc::MatchDoc &matchDoc) {
+inline score_t DefaultScorer::doScore(matchdoc::MatchDoc matchDoc) {
     if (!_matchDataRef) {
         return matchDoc.getDocId();
     }
     const MatchData &data = _matchDataRef->getReference(matchDoc);
     score_t score = 0.0;
-    //int32_t docCount = _globalMatchData->getDocCount();
-    for (uint32_t i = 0; i < data.getNumTerms(); i++) {
+    uint32_t numTerms = data.getNumTerms();
+    for (uint32_t i = 0; i < numTerms; i++) {
         const TermMatchData &tmd = data.getTermMatchData(i);
         if (tmd.isMatched()) {
             int tf = tmd.getTermFreq();
-            score_t singleTermScore  = (score_t)tf / _metaInfo[i].getDocFreq();
-            score += singleTermScore;
+            score += (score_t)tf / _metaInfo[i].getDocFreq();
             RANK_TRACE(TRACE1, matchDoc, "tf=%d", tf);
         }
     }
+    return score;
+}
+
+score_t DefaultScorer::score(matchdoc::MatchDoc &matchDoc) {
+    score_t score = doScore(matchDoc);
     HA3_LOG(TRACE3, "*******rank score: docid[%d], score[%f]", matchDoc.getDocId(), score);
     return score;
 }
 
+void DefaultScorer::batchScore(ScorerParam &scorerParam) {
+    matchdoc::MatchDoc *matchDocs = scorerParam.matchDocs;
+    auto scoreRef = scorerParam.reference;
+    size_t count = scorerParam.scoreDocCount;
+    for (size_t i = 0; i < count; ++i) {
+        scoreRef->set(matchDocs[i], doScore(matchDocs[i]));
+    }
+}
+
 void DefaultScorer::destroy() {
     delete this;
 }
@@ -27,10 +27,13 @@ public:
     suez::turing::Scorer* clone() override;
     bool beginRequest(suez::turing::ScoringProvider *provider) override;
     score_t score(matchdoc::MatchDoc &matchDoc) override;
+    void batchScore(suez::turing::ScorerParam &scorerParam) override;
     void endRequest() override {}
     void destroy() override;
 protected:
     TRACE_DECLARE();
+private:
+    score_t doScore(matchdoc::MatchDoc matchDoc);
 private:
     const matchdoc::Reference<MatchData> *_matchDataRef;
     const rank::GlobalMatchData *_globalMatchData;
@@ -36,6 +36,9 @@ public:
     const ComboComparator *getComparator() const override {
         return _cmp;
     }
+    bool isFull() const override {
+        return _queue->isFull();
+    }
 protected:
     matchdoc::MatchDoc collectOneDoc(matchdoc::MatchDoc matchDoc) override;
     void doQuickInit(matchdoc::MatchDoc *matchDocs, uint32_t count) override;
@@ -63,6 +63,10 @@ public:
      */
     virtual matchdoc::MatchDoc top() const = 0;
     virtual const ComboComparator *getComparator() const = 0;
+    /*
+     * heap is full, new match doc has to beat top() to get in.
+     */
+    virtual bool isFull() const { return false; }
 public:
     void enableLazyScore(size_t bufferSize);
     const common::Ha3MatchDocAllocatorPtr &getMatchDocAllocator() const {
@@ -12,6 +12,9 @@ MatchDocPriorityQueue::MatchDocPriorityQueue(uint32_t size,
             * (size + 1));
     _count = 0;
     _size = size;
+    _keyCmp = NULL;
+    _keys = NULL;
+    _pool = pool;
     setComparator(cmp);
     assert(_items);    
 }
@@ -19,12 +22,36 @@ MatchDocPriorityQueue::MatchDocPriorityQueue(uint32_t size,
 MatchDocPriorityQueue::~MatchDocPriorityQueue() { 
 }
 
+void MatchDocPriorityQueue::setComparator(const Comparator *cmp) {
+    assert(cmp);
+    _queueCmp = cmp;
+    const ComboComparator *keyCmp = dynamic_cast<const ComboComparator *>(cmp);
+    if (keyCmp == NULL || !keyCmp->supportSortKey()) {
+        _keyCmp = NULL;
+        _keys = NULL;
+        return;
+    }
+    bool needExtract = _keys == NULL || _keyCmp != keyCmp;
+    _keyCmp = keyCmp;
+    if (_keys == NULL) {
+        _keys = (SortKey *)_pool->allocate(sizeof(SortKey) * (_size + 1));
+    }
+    if (needExtract) {
+        for (uint32_t i = 1; i <= _count; ++i) {
+            _keyCmp->extractSortKey(_items[i], _keys[i]);
+        }
+    }
+}
+
 matchdoc::MatchDoc MatchDocPriorityQueue::pop() {
     if (_count < 1) {
         return matchdoc::INVALID_MATCHDOC;
     }
     auto retItem = _items[1];
     _items[1] = _items[_count];
+    if (_keys) {
+        _keys[1] = _keys[_count];
+    }
     _count--;
     adjustDown(1);
     return retItem;
@@ -34,7 +61,7 @@ void MatchDocPriorityQueue::adjustUp(uint32_t idx) {
     assert(idx <= _count);
     while (idx > 1) {
         uint32_t parent = idx >> 1;
-        if (!_queueCmp->compare(_items[idx], _items[parent])) {
+        if (!lessThan(idx, parent)) {
             break;
         }
         swap(idx, parent);
@@ -48,10 +75,10 @@ void MatchDocPriorityQueue::adjustDown(uint32_t idx) {
         idx = min;
         uint32_t left = idx << 1;
         uint32_t right = left + 1;
-        if (left <= _count && _queueCmp->compare(_items[left], _items[min])) {
+        if (left <= _count && lessThan(left, min)) {
             min = left;
         }
-        if (right <= _count && _queueCmp->compare(_items[right], _items[min])) {
+        if (right <= _count && lessThan(right, min)) {
             min = right;
         }
         if (min != idx) {
@@ -66,6 +93,11 @@ void MatchDocPriorityQueue::swap(uint32_t a, uint32_t b) {
         auto tmp = _items[a];
         _items[a] = _items[b];
         _items[b] = tmp;
+        if (_keys) {
+            SortKey tmpKey = _keys[a];
+            _keys[a] = _keys[b];
+            _keys[b] = tmpKey;
+        }
     }
 }
 
@@ -7,6 +7,7 @@
 #include <assert.h>
 #include <matchdoc/MatchDoc.h>
 #include <ha3/rank/Comparator.h>
+#include <ha3/rank/ComboComparator.h>
 
 BEGIN_HA3_NAMESPACE(rank);
 
@@ -23,10 +24,7 @@ public:
         ITEM_REPLACED,
     };
 
-    void setComparator(const Comparator *cmp) {
-        assert(cmp);
-        _queueCmp = cmp;
-    }
+    void setComparator(const Comparator *cmp);
 
     const Comparator* getComparator() const {
         return _queueCmp;
@@ -51,6 +49,11 @@ public:
         assert(count <= _size);
         memcpy(_items + 1, matchDocs, sizeof(matchdoc::MatchDoc) * count);
         _count = count;
+        if (_keys) {
+            for (uint32_t i = 1; i <= _count; ++i) {
+                _keyCmp->extractSortKey(_items[i], _keys[i]);
+            }
+        }
         for (int32_t i = _count / 2; i >= 1; --i) {
             adjustDown(i);
         }
@@ -63,6 +66,7 @@ public:
     matchdoc::MatchDoc *getAllMatchDocs() {
         return _items + 1;
     }
+    // sort keys are not refreshed, modify items only with a comparator without sort key
     matchdoc::MatchDoc &item(uint32_t idx) {
         return _items[idx];
     }
@@ -71,11 +75,18 @@ public:
                           matchdoc::MatchDoc *retItem);
     bool isFull() const { return _size == _count; }
     virtual void swap(uint32_t a, uint32_t b);
+protected:
+    inline bool lessThan(uint32_t a, uint32_t b) const;
 protected:
     uint32_t _size;
     uint32_t _count;
     const Comparator *_queueCmp;
     matchdoc::MatchDoc *_items;
+    // sort keys kept next to _items when the comparator supports them,
+    // slot 0 of both arrays holds the item being pushed
+    const ComboComparator *_keyCmp;
+    SortKey *_keys;
+    autil::mem_pool::Pool *_pool;
 private:
     friend class MatchDocPriorityQueueTest;
     HA3_LOG_DECLARE();
@@ -83,15 +94,29 @@ private:
 
 /////////////////////////////////////////////////////////////
 
+inline bool MatchDocPriorityQueue::lessThan(uint32_t a, uint32_t b) const {
+    if (_keys) {
+        return _keyCmp->compareSortKey(_keys[a], _items[a], _keys[b], _items[b]);
+    }
+    return _queueCmp->compare(_items[a], _items[b]);
+}
+
 inline MatchDocPriorityQueue::PUSH_RETURN_CODE
 MatchDocPriorityQueue::push(matchdoc::MatchDoc item, matchdoc::MatchDoc *retItem) {
     if (isFull()) {
-        if (!_queueCmp->compare(_items[1], item)) {
+        _items[0] = item;
+        if (_keys) {
+            _keyCmp->extractSortKey(item, _keys[0]);
+        }
+        if (!lessThan(1, 0)) {
             *retItem = item;
             return ITEM_DENIED;
         } else {
             *retItem = _items[1];
             _items[1] = item;
+            if (_keys) {
+                _keys[1] = _keys[0];
+            }
             swap(1, 1);
             adjustDown(1);
             return ITEM_REPLACED;
@@ -99,6 +124,9 @@ MatchDocPriorityQueue::push(matchdoc::MatchDoc item, matchdoc::MatchDoc *retItem
     }
     _count++;
     _items[_count] = item;
+    if (_keys) {
+        _keyCmp->extractSortKey(item, _keys[_count]);
+    }
     swap(_count, _count);
     adjustUp(_count);
     return ITEM_ACCEPTED;
@@ -8,6 +8,7 @@
 #include <ha3/common/Ha3MatchDocAllocator.h>
 #include <ha3/rank/ReferenceComparator.h>
 #include <string>
+#include <limits>
 #include <matchdoc/MatchDoc.h>
 #include <ha3/common/CommonDef.h>
 #include <ha3/test/test.h>
@@ -265,5 +266,96 @@ TEST_F(ComboComparatorTest, testThreeRefComparatorFirstReverse) {
 }
 
 
+TEST_F(ComboComparatorTest, testSortKeyNormalizer) {
+    HA3_LOG(DEBUG, "Begin Test!");
+    vector<double> doubles = {-1e300, -2.5, -1.0, -1e-300, 0.0, 1e-300, 1.0, 2.5, 1e300};
+    for (size_t i = 1; i < doubles.size(); ++i) {
+        ASSERT_LT(SortKeyNormalizer<double>::normalize(doubles[i - 1]),
+                  SortKeyNormalizer<double>::normalize(doubles[i])) << i;
+    }
+    ASSERT_EQ(SortKeyNormalizer<double>::normalize(0.0),
+              SortKeyNormalizer<double>::normalize(-0.0));
+    ASSERT_EQ(SortKeyNormalizer<float>::normalize(1.5f),
+              SortKeyNormalizer<double>::normalize(1.5));
+
+    vector<int64_t> ints = {numeric_limits<int64_t>::min(), -100, -1, 0, 1, 100,
+                           numeric_limits<int64_t>::max()};
+    for (size_t i = 1; i < ints.size(); ++i) {
+        ASSERT_LT(SortKeyNormalizer<int64_t>::normalize(ints[i - 1]),
+                  SortKeyNormalizer<int64_t>::normalize(ints[i])) << i;
+    }
+    ASSERT_EQ(SortKeyNormalizer<int64_t>::normalize(-5),
+              SortKeyNormalizer<int32_t>::normalize(-5));
+    ASSERT_LT(SortKeyNormalizer<uint32_t>::normalize(1),
+              SortKeyNormalizer<uint32_t>::normalize(numeric_limits<uint32_t>::max()));
+    ASSERT_FALSE(SortKeyNormalizer<std::string>::SUPPORTED);
+}
+
+TEST_F(ComboComparatorTest, testSortKeyAgreeWithCompare) {
+    HA3_LOG(DEBUG, "Begin Test!");
+    vector<matchdoc::MatchDoc> docs = {_a, _b, _c, _d, _e, _f};
+    auto checkComparator = [&](const ComboComparator &comp) {
+        ASSERT_TRUE(comp.supportSortKey());
+        for (auto x : docs) {
+            for (auto y : docs) {
+                SortKey keyX, keyY;
+                comp.extractSortKey(x, keyX);
+                comp.extractSortKey(y, keyY);
+                ASSERT_EQ(comp.compare(x, y), comp.compareSortKey(keyX, x, keyY, y))
+                    << comp.getType() << " " << x.getDocId() << " " << y.getDocId();
+            }
+        }
+    };
+    for (bool flag1 : {false, true}) {
+        ASSERT_NO_FATAL_FAILURE(checkComparator(
+                        OneRefComparatorTyped<int32_t>(_idRef, flag1)));
+        ASSERT_NO_FATAL_FAILURE(checkComparator(
+                        OneRefComparatorTyped<float>(_scoreRef, flag1)));
+        for (bool flag2 : {false, true}) {
+            ASSERT_NO_FATAL_FAILURE(checkComparator(
+                            TwoRefComparatorTyped<float, int32_t>(
+                                    _scoreRef, _idRef, flag1, flag2)));
+        }
+    }
+    ASSERT_FALSE(_comboCmp->supportSortKey());
+}
+
+TEST_F(ComboComparatorTest, testSortKeyAgreeWithCompareOnNaN) {
+    HA3_LOG(DEBUG, "Begin Test!");
+    matchdoc::MatchDoc nanDoc = createMatchDoc(0, 3, numeric_limits<float>::quiet_NaN(), 9);
+    matchdoc::MatchDoc negNanDoc = createMatchDoc(5, 0, -numeric_limits<float>::quiet_NaN(), 7);
+    vector<matchdoc::MatchDoc> docs = {_a, _c, _e, nanDoc, negNanDoc};
+    auto checkComparator = [&](const ComboComparator &comp) {
+        for (auto x : docs) {
+            for (auto y : docs) {
+                SortKey keyX, keyY;
+                comp.extractSortKey(x, keyX);
+                comp.extractSortKey(y, keyY);
+                ASSERT_EQ(comp.compare(x, y), comp.compareSortKey(keyX, x, keyY, y))
+                    << comp.getType() << " " << x.getDocId() << " " << y.getDocId();
+            }
+        }
+    };
+    for (bool flag1 : {false, true}) {
+        ASSERT_NO_FATAL_FAILURE(checkComparator(
+                        OneRefComparatorTyped<float>(_scoreRef, flag1)));
+        for (bool flag2 : {false, true}) {
+            ASSERT_NO_FATAL_FAILURE(checkComparator(
+                            TwoRefComparatorTyped<float, int32_t>(
+                                    _scoreRef, _idRef, flag1, flag2)));
+            ASSERT_NO_FATAL_FAILURE(checkComparator(
+                            TwoRefComparatorTyped<int32_t, float>(
+                                    _idRef, _scoreRef, flag1, flag2)));
+        }
+    }
+    SortKey key;
+    OneRefComparatorTyped<float>(_scoreRef, false).extractSortKey(nanDoc, key);
+    ASSERT_TRUE(key.unordered);
+    OneRefComparatorTyped<float>(_scoreRef, false).extractSortKey(_a, key);
+    ASSERT_FALSE(key.unordered);
+    _allocator->deallocate(nanDoc);
+    _allocator->deallocate(negNanDoc);
+}
+
 END_HA3_NAMESPACE(rank);
 
@@ -9,6 +9,7 @@
 #include <autil/StringUtil.h>
 #include <autil/StringTokenizer.h>
 #include <ha3/rank/ReferenceComparator.h>
+#include <ha3/rank/ComboComparator.h>
 #include <matchdoc/MatchDoc.h>
 #include <ha3/rank/MatchDocPriorityQueue.h>
 #include <memory>
@@ -188,6 +189,50 @@ TEST_F(MatchDocPriorityQueueTest, testTop) {
     ASSERT_EQ((docid_t)23, matchDoc.getDocId());
 }
 
+TEST_F(MatchDocPriorityQueueTest, testSortKeyAgreeWithComparator) {
+    HA3_LOG(DEBUG, "Begin test");
+    matchdoc::Reference<int32_t> *idRef = _allocatorPtr->declare<int32_t>("id");
+    for (bool flag1 : {false, true}) {
+        for (bool flag2 : {false, true}) {
+            TwoRefComparatorTyped<float, int32_t> keyCmp(_scoreRef, idRef, flag1, flag2);
+            ComboComparator rawCmp;
+            rawCmp.addComparator(POOL_NEW_CLASS(_pool, ReferenceComparator<float>,
+                            _scoreRef, flag1));
+            rawCmp.addComparator(POOL_NEW_CLASS(_pool, ReferenceComparator<int32_t>,
+                            idRef, flag2));
+            MatchDocPriorityQueue keyQueue(16, _pool, &keyCmp);
+            MatchDocPriorityQueue rawQueue(16, _pool, &rawCmp);
+            auto pushBoth = [&](docid_t docId, float score, int32_t id) {
+                matchdoc::MatchDoc keyDoc = createMatchDoc(docId, score);
+                matchdoc::MatchDoc rawDoc = createMatchDoc(docId, score);
+                idRef->set(keyDoc, id);
+                idRef->set(rawDoc, id);
+                matchdoc::MatchDoc keyRet = matchdoc::INVALID_MATCHDOC;
+                matchdoc::MatchDoc rawRet = matchdoc::INVALID_MATCHDOC;
+                ASSERT_EQ(rawQueue.push(rawDoc, &rawRet), keyQueue.push(keyDoc, &keyRet));
+                ASSERT_EQ(rawRet.getDocId(), keyRet.getDocId());
+                if (keyRet != matchdoc::INVALID_MATCHDOC) {
+                    _allocatorPtr->deallocate(keyRet);
+                    _allocatorPtr->deallocate(rawRet);
+                }
+            };
+            // few distinct values so that ties fall through to docid
+            for (docid_t docId = 0; docId < 200; ++docId) {
+                ASSERT_NO_FATAL_FAILURE(pushBoth(docId, (float)((docId * 7) % 5) - 2.0f,
+                                (docId * 13) % 3 - 1));
+            }
+            ASSERT_EQ(rawQueue.count(), keyQueue.count());
+            while (rawQueue.count() > 0) {
+                matchdoc::MatchDoc keyDoc = keyQueue.pop();
+                matchdoc::MatchDoc rawDoc = rawQueue.pop();
+                ASSERT_EQ(rawDoc.getDocId(), keyDoc.getDocId());
+                _allocatorPtr->deallocate(keyDoc);
+                _allocatorPtr->deallocate(rawDoc);
+            }
+        }
+    }
+}
+
 void MatchDocPriorityQueueTest::internalTestPushAndPop(
         uint32_t queueSize, const string &pushOpteratorStr,
         const string &popResultStr, uint32_t leftCount)
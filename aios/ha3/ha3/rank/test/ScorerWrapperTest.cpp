@@ -13,9 +13,13 @@
 #include <ha3/config/IndexInfoHelper.h>
 #include <autil/mem_pool/Pool.h>
 #include <ha3/rank/test/TrivialScorer.h>
+#include <ha3/rank/DefaultScorer.h>
 #include <ha3/search/test/FakeAttributeExpression.h>
 #include <ha3/search/test/FakeAttributeExpressionFactory.h>
 #include <ha3/search/test/FakeQueryExecutor.h>
+#include <ha3/search/test/SearcherTestHelper.h>
+#include <ha3/search/QueryExecutorCreator.h>
+#include <ha3_sdk/testlib/index/FakeIndexPartitionReaderCreator.h>
 #include <memory>
 #include <string>
 
@@ -50,6 +54,8 @@ protected:
     search::MatchDataManager _matchDataManager;
     IE_NAMESPACE(partition)::PartitionReaderSnapshotPtr _snapshotPtr;
     IE_NAMESPACE(partition)::TableMem2IdMap _emptyTableMem2IdMap;
+protected:
+    void internalTestDefaultScorerWithMatchData(const std::string &rankTrace);
 protected:
     HA3_LOG_DECLARE();
 };
@@ -132,4 +138,108 @@ TEST_F(ScorerWrapperTest, testSimpleProcess) {
                          _scoreRef->getReference(matchDoc));
 }
 
+TEST_F(ScorerWrapperTest, testDefaultScorerBatchScore) {
+    HA3_LOG(DEBUG, "Begin Test!");
+    Request request;
+    ConfigClause *configClause = new ConfigClause();
+    configClause->addKVPair("ds_score_type", "docid");
+    request.setConfigClause(configClause);
+
+    RankResource rankResource;
+    rankResource.pool = _poolPtr.get();
+    rankResource.attrExprCreator = _attrExprCreator;
+    rankResource.indexInfoHelper = _indexInfoHelper;
+    rankResource.boostTable = &(_tableInfo->getIndexInfos()->getFieldBoostTable());
+    rankResource.dataProvider = _dataProvider;
+    rankResource.matchDocAllocator = _allocator;
+    rankResource.matchDataManager = &_matchDataManager;
+    rankResource.partitionReaderSnapshot = _snapshotPtr.get();
+    rankResource.request = &request;
+    ScoringProvider provider(rankResource);
+
+    ScorerWrapper scorerWrapper(new DefaultScorer(), _scoreRef);
+    ASSERT_TRUE(scorerWrapper.beginRequest(&provider));
+    vector<matchdoc::MatchDoc> matchDocs;
+    for (docid_t docId = 0; docId < 5; ++docId) {
+        matchDocs.push_back(_allocator->allocate(docId * 3));
+    }
+    scorerWrapper.batchScore(matchDocs.data(), matchDocs.size());
+    for (size_t i = 0; i < matchDocs.size(); ++i) {
+        ASSERT_EQ((score_t)(i * 3), _scoreRef->getReference(matchDocs[i])) << i;
+    }
+    scorerWrapper.endRequest();
+    for (auto matchDoc : matchDocs) {
+        _allocator->deallocate(matchDoc);
+    }
+}
+
+void ScorerWrapperTest::internalTestDefaultScorerWithMatchData(const string &rankTrace) {
+    FakeIndex fakeIndex;
+    fakeIndex.indexes["default"] = "a:1[1,2];2[3];3[1,2,3,4]\n"
+                                   "b:1[1];3[2,3]\n";
+    IndexPartitionReaderWrapperPtr readerWrapper =
+        FakeIndexPartitionReaderCreator::createIndexPartitionReader(fakeIndex);
+    readerWrapper->setTopK(1);
+    Request request;
+    QueryPtr query(SearcherTestHelper::createQuery("a OR b"));
+    request.setQueryClause(new QueryClause(query->clone()));
+    ConfigClause *configClause = new ConfigClause();
+    configClause->setRankTrace(rankTrace);
+    request.setConfigClause(configClause);
+
+    MatchDataManager matchDataManager;
+    QueryExecutorCreator creator(&matchDataManager, readerWrapper.get(), _poolPtr.get());
+    query->accept(&creator);
+    QueryExecutor *queryExecutor = creator.stealQuery();
+    matchDataManager.setQueryCount(1);
+    matchDataManager.moveToLayer(0);
+
+    RankResource rankResource;
+    rankResource.pool = _poolPtr.get();
+    rankResource.attrExprCreator = _attrExprCreator;
+    rankResource.indexInfoHelper = _indexInfoHelper;
+    rankResource.boostTable = &(_tableInfo->getIndexInfos()->getFieldBoostTable());
+    rankResource.dataProvider = _dataProvider;
+    rankResource.matchDocAllocator = _allocator;
+    rankResource.matchDataManager = &matchDataManager;
+    rankResource.partitionReaderSnapshot = _snapshotPtr.get();
+    rankResource.request = &request;
+    ScoringProvider provider(rankResource);
+    ASSERT_EQ(!rankTrace.empty(), provider.getTracerRefer() != NULL);
+
+    DefaultScorer *scorer = new DefaultScorer();
+    ScorerWrapper scorerWrapper(scorer, _scoreRef);
+    ASSERT_TRUE(scorerWrapper.beginRequest(&provider));
+    vector<matchdoc::MatchDoc> matchDocs;
+    for (docid_t docId = 1; docId <= 3; ++docId) {
+        ASSERT_EQ(docId, queryExecutor->legacySeek(docId));
+        matchdoc::MatchDoc matchDoc = _allocator->allocate(docId);
+        ASSERT_EQ(IE_NAMESPACE(common)::ErrorCode::OK, matchDataManager.fillMatchData(matchDoc));
+        matchDocs.push_back(matchDoc);
+    }
+    scorerWrapper.batchScore(matchDocs.data(), matchDocs.size());
+    // tf / df, df of a is 3, df of b is 2
+    score_t expectScores[] = {2.0 / 3 + 1.0 / 2, 1.0 / 3, 4.0 / 3 + 2.0 / 2};
+    for (size_t i = 0; i < matchDocs.size(); ++i) {
+        score_t batchScore = _scoreRef->getReference(matchDocs[i]);
+        ASSERT_NEAR(expectScores[i], batchScore, 1e-5) << i;
+        ASSERT_EQ(scorer->score(matchDocs[i]), batchScore) << i;
+    }
+    scorerWrapper.endRequest();
+    for (auto matchDoc : matchDocs) {
+        _allocator->deallocate(matchDoc);
+    }
+    POOL_DELETE_CLASS(queryExecutor);
+}
+
+TEST_F(ScorerWrapperTest, testDefaultScorerBatchScoreWithMatchData) {
+    HA3_LOG(DEBUG, "Begin Test!");
+    internalTestDefaultScorerWithMatchData("");
+}
+
+TEST_F(ScorerWrapperTest, testDefaultScorerBatchScoreWithRankTrace) {
+    HA3_LOG(DEBUG, "Begin Test!");
+    internalTestDefaultScorerWithMatchData("TRACE1");
+}
+
 END_HA3_NAMESPACE(rank);
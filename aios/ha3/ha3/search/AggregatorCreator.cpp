@@ -329,6 +329,11 @@ Aggregator * AggregatorCreator::doCreateSingleAggregator(const AggregateDescript
         aggThreshold = _aggSamplerConfigInfo.getAggThreshold();
         sampleStep = _aggSamplerConfigInfo.getSampleStep();
     }
+    if (!_aggSamplerConfigInfo.isEnableSampling()) {
+        aggThreshold = 0;
+        sampleStep = 1;
+        batchSampleMaxCount = 0;
+    }
 
     Aggregator *aggregator = NULL;
     if (expr->getExpressionType() == ET_TUPLE) {
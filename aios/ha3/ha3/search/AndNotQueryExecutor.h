@@ -36,6 +36,18 @@ public:
 public:
     void addQueryExecutors(QueryExecutor* leftExecutor,
                            QueryExecutor* rightExecutor);
+    // the caller tests the returned filter by itself and drops the docs it
+    // passes, seek then returns the left docs without testing the right side
+    IE_NAMESPACE(index)::DocValueFilter* stealRightFilter() {
+        if (_hasSubDocExecutor || _rightFilter == NULL) {
+            return NULL;
+        }
+        IE_NAMESPACE(index)::DocValueFilter* filter = _rightFilter;
+        _rightFilter = NULL;
+        // still kept in _queryExecutors for deconstruct
+        _rightQueryExecutor = NULL;
+        return filter;
+    }
 public:
     std::string toString() const override;
 private:
@@ -22,6 +22,12 @@ public:
                        docid_t subDocEnd, bool needSubMatchdata, docid_t& result) override;
     bool isMainDocHit(docid_t docId) const override;
     void addQueryExecutors(const std::vector<QueryExecutor*> &queryExecutor) override;
+    // caller takes over testing of doc value filters, seek will not test them any more
+    std::vector<IE_NAMESPACE(index)::DocValueFilter*> stealFilters() {
+        std::vector<IE_NAMESPACE(index)::DocValueFilter*> filters;
+        filters.swap(_filters);
+        return filters;
+    }
 public:
     std::string toString() const override;
     uint32_t getSeekDocCount() override {
@@ -0,0 +1,95 @@
+#include <ha3/search/QueryCostPredictor.h>
+#include <ha3/search/TermDFVisitor.h>
+#include <ha3/common/QueryTermVisitor.h>
+#include <ha3/common/QueryLayerClause.h>
+#include <algorithm>
+
+using namespace std;
+USE_HA3_NAMESPACE(common);
+
+BEGIN_HA3_NAMESPACE(search);
+HA3_LOG_SETUP(search, QueryCostPredictor);
+
+QueryCostPredictor::QueryCostPredictor()
+    : _postingCount(0)
+    , _matchCount(0)
+{
+}
+
+QueryCostPredictor::~QueryCostPredictor() {
+}
+
+double QueryCostPredictor::predict(const Request *request,
+                                   IndexPartitionReaderWrapper *readerWrapper)
+{
+    TermDFMap termDFMap;
+    QueryClause *queryClause = request->getQueryClause();
+    Query *query = queryClause ? queryClause->getRootQuery() : NULL;
+    if (query) {
+        QueryTermVisitor visitor(QueryTermVisitor::VT_ALL);
+        query->accept(&visitor);
+        const TermVector &termVector = visitor.getTermVector();
+        for (size_t i = 0; i < termVector.size(); ++i) {
+            if (termDFMap.find(termVector[i]) == termDFMap.end()) {
+                termDFMap[termVector[i]] = readerWrapper->getTermDF(termVector[i]);
+            }
+        }
+    }
+    return predict(request, termDFMap);
+}
+
+double QueryCostPredictor::predict(const Request *request, const TermDFMap &termDFMap) {
+    _postingCount = 0;
+    _matchCount = 0;
+    QueryClause *queryClause = request->getQueryClause();
+    Query *query = queryClause ? queryClause->getRootQuery() : NULL;
+    if (!query) {
+        return 0;
+    }
+    for (TermDFMap::const_iterator it = termDFMap.begin(); it != termDFMap.end(); ++it) {
+        _postingCount += it->second;
+    }
+    TermDFVisitor visitor(termDFMap);
+    query->accept(&visitor);
+    _matchCount = visitor.getDF();
+    df_t layerQuota = getLayerQuota(request);
+    if (layerQuota > 0) {
+        _matchCount = min(_matchCount, layerQuota);
+    }
+    return (double)_postingCount + (double)_matchCount * getPerDocCost(request);
+}
+
+// seek stops at the layer quotas only if every layer has one
+df_t QueryCostPredictor::getLayerQuota(const Request *request) {
+    QueryLayerClause *layerClause = request->getQueryLayerClause();
+    if (!layerClause || layerClause->getLayerCount() == 0) {
+        return 0;
+    }
+    df_t quota = 0;
+    for (size_t i = 0; i < layerClause->getLayerCount(); ++i) {
+        LayerDescription *layerDesc = layerClause->getLayerDescription(i);
+        if (!layerDesc || layerDesc->getQuota() == 0) {
+            return 0;
+        }
+        quota += layerDesc->getQuota();
+    }
+    return quota;
+}
+
+uint32_t QueryCostPredictor::getPerDocCost(const Request *request) {
+    uint32_t cost = 1;
+    if (request->getFilterClause()) {
+        ++cost;
+    }
+    SortClause *sortClause = request->getSortClause();
+    if (sortClause) {
+        cost += sortClause->getSortDescriptions().size();
+    }
+    AggregateClause *aggClause = request->getAggregateClause();
+    if (aggClause) {
+        cost += aggClause->getAggDescriptions().size();
+    }
+    return cost;
+}
+
+END_HA3_NAMESPACE(search);
@@ -0,0 +1,50 @@
+#ifndef ISEARCH_QUERYCOSTPREDICTOR_H
+#define ISEARCH_QUERYCOSTPREDICTOR_H
+
+#include <ha3/common.h>
+#include <ha3/isearch.h>
+#include <ha3/util/Log.h>
+#include <ha3/common/Request.h>
+#include <ha3/search/AuxiliaryChainDefine.h>
+#include <ha3/search/IndexPartitionReaderWrapper.h>
+
+BEGIN_HA3_NAMESPACE(search);
+
+// estimates the seek cost of a request before execution, in docs: the
+// postings of all query terms plus the estimated matched docs weighted by
+// the filter, sort and aggregate work done on each of them. term df lookups
+// go through the posting cache of the reader wrapper, the seek reuses them.
+class QueryCostPredictor
+{
+public:
+    QueryCostPredictor();
+    ~QueryCostPredictor();
+private:
+    QueryCostPredictor(const QueryCostPredictor &);
+    QueryCostPredictor& operator=(const QueryCostPredictor &);
+public:
+    double predict(const common::Request *request,
+                   IndexPartitionReaderWrapper *readerWrapper);
+    double predict(const common::Request *request, const TermDFMap &termDFMap);
+    int64_t getPostingCount() const {
+        return _postingCount;
+    }
+    df_t getMatchCount() const {
+        return _matchCount;
+    }
+private:
+    static df_t getLayerQuota(const common::Request *request);
+    static uint32_t getPerDocCost(const common::Request *request);
+private:
+    // sum of term dfs, may exceed df_t
+    int64_t _postingCount;
+    df_t _matchCount;
+private:
+    HA3_LOG_DECLARE();
+};
+
+HA3_TYPEDEF_PTR(QueryCostPredictor);
+
+END_HA3_NAMESPACE(search);
+
+#endif //ISEARCH_QUERYCOSTPREDICTOR_H
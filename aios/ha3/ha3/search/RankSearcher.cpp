@@ -159,6 +159,10 @@ uint32_t RankSearcher::searchMultiLayers(RankSearcherResource &resource,
                     queryExecutor, curLayer, _filterWrapper,
                     _delMapReader.get(), matchDocAllocator, timeoutTerminator,
                     _mainToSubIt, _subDelMapReader.get(), resource._getAllSubDoc);
+            // skipped docs are neither aggregated nor counted
+            if (!needAggregate && !needSubDoc) {
+                param._sortBlockSkipper = resource._sortBlockSkipper;
+            }
 
             if (likely(needScore)) {
                 seekResult = searchSingleLayerWithScore(
@@ -231,6 +235,10 @@ uint32_t RankSearcher::searchMultiLayers(RankSearcherResource &resource,
     REQUEST_TRACE(DEBUG, "total seekCount [ %u ], matchCount [ %u ],  "
                   "total matchCount [ %u ]", estimator.getTotalSeekedCount(),
                   estimator.getMatchCount(), estimator.getTotalMatchCount());
+    if (resource._sortBlockSkipper) {
+        REQUEST_TRACE(DEBUG, "sort block skipped doc count [ %u ]",
+                      resource._sortBlockSkipper->getSkippedDocCount());
+    }
     return estimator.getTotalMatchCount();
 }
 
@@ -395,6 +403,8 @@ SingleLayerSeekResult RankSearcher::searchSingleLayerWithScore(
             param._layerMeta, param._filterWrapper, param._deletionMapReader,
             param._matchDocAllocator, param._timeoutTerminator,
             param._main2SubIt, param._subDeletionMapReader, manager, param._getAllSubDoc);
+    SortBlockSkipper *sortBlockSkipper = param._sortBlockSkipper;
+    singleLayerSearcher.setSortBlockSkipper(sortBlockSkipper);
     auto ec = IE_NAMESPACE(common)::ErrorCode::OK;
     while (true) {
         matchdoc::MatchDoc matchDoc;
@@ -409,6 +419,9 @@ SingleLayerSeekResult RankSearcher::searchSingleLayerWithScore(
             aggregator->aggregate(matchDoc);
         }
         hitCollector->collect(matchDoc, needFlatten);
+        if (sortBlockSkipper) {
+            sortBlockSkipper->updateThreshold(hitCollector);
+        }
     }
 
     SingleLayerSeekResult result;
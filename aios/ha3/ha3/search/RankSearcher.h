@@ -21,6 +21,7 @@
 #include <suez/turing/expression/framework/RankAttributeExpression.h>
 #include <suez/turing/expression/function/FunctionManager.h>
 #include <ha3/search/SingleLayerSearcher.h>
+#include <ha3/search/SortBlockSkipper.h>
 #include <ha3/search/IndexPartitionReaderWrapper.h>
 #include <ha3/search/FilterWrapper.h>
 #include <ha3/func_expression/FunctionProvider.h>
@@ -36,6 +37,7 @@ struct RankSearcherResource {
         _matchDocAllocator = NULL;
         _sessionMetricsCollector = NULL;
         _getAllSubDoc = false;
+        _sortBlockSkipper = NULL;
     }
     bool _needFlattenMatchDoc;
     uint32_t _requiredTopK;
@@ -43,6 +45,7 @@ struct RankSearcherResource {
     monitor::SessionMetricsCollector *_sessionMetricsCollector;
     common::Ha3MatchDocAllocator *_matchDocAllocator;
     bool _getAllSubDoc;
+    SortBlockSkipper *_sortBlockSkipper;
 };
 
 struct RankSearcherParam {
@@ -93,6 +96,7 @@ struct SingleLayerSearcherParam {
         , _deletionMapReader(deletionMapReader)
         , _subDeletionMapReader(subDeletionMapReader)
         , _getAllSubDoc(getAllSubDoc)
+        , _sortBlockSkipper(NULL)
     {
     }
 public:
@@ -105,6 +109,7 @@ public:
     IE_NAMESPACE(index)::DeletionMapReader *_deletionMapReader;
     IE_NAMESPACE(index)::DeletionMapReader *_subDeletionMapReader;
     bool _getAllSubDoc;
+    SortBlockSkipper *_sortBlockSkipper;
 };
 
 struct SingleLayerSeekResult {
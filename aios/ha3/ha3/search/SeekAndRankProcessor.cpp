@@ -2,6 +2,7 @@
 #include <ha3/search/MatchDocSearchStrategy.h>
 #include <ha3/search/HitCollectorManager.h>
 #include <ha3/rank/ScoringProvider.h>
+#include <ha3/common/CommonDef.h>
 #include <algorithm>
 #include <suez/turing/common/KvTracerMacro.h>
 
@@ -85,9 +86,28 @@ bool SeekAndRankProcessor::init(const common::Request* request) {
         optimizeHitCollector(request, _hitCollectorManager,
                              _processorResource.rankProfile->getPhaseCount());
     }
+    initSortBlockSkipper(request);
     return true;
 }
 
+void SeekAndRankProcessor::initSortBlockSkipper(const common::Request *request) {
+    const ConfigClause *configClause = request->getConfigClause();
+    if (!configClause || configClause->getKVPairValue(SORT_BLOCK_SKIP_KEY) != "true") {
+        return;
+    }
+    SortExpressionVector firstExpressions = _hitCollectorManager->getFirstExpressions();
+    if (firstExpressions.size() != 1) {
+        return;
+    }
+    SortBlockSkipperPtr skipper(new SortBlockSkipper(firstExpressions[0]));
+    if (!skipper->init(_partitionResource.indexPartitionReaderWrapper->getReader())) {
+        HA3_LOG(DEBUG, "sort expression [%s] not support block skip",
+                firstExpressions[0]->getOriginalString().c_str());
+        return;
+    }
+    _sortBlockSkipper = skipper;
+}
+
 SeekAndRankResult SeekAndRankProcessor::process(const common::Request *request,
         MatchDocSearchStrategy *searchStrategy,
         InnerSearchResult& innerResult)
@@ -103,6 +123,7 @@ SeekAndRankResult SeekAndRankProcessor::process(const common::Request *request,
     resource._matchDocAllocator = _resource.matchDocAllocator.get();
     resource._sessionMetricsCollector = _resource.sessionMetricsCollector;
     resource._getAllSubDoc = request->getConfigClause()->getAllSubDoc();
+    resource._sortBlockSkipper = _sortBlockSkipper.get();
 
     rank::HitCollectorBase *rankCollector =
         _hitCollectorManager->getRankHitCollector();
@@ -141,6 +162,7 @@ SeekAndRankResult SeekAndRankProcessor::processWithCache(const common::Request *
     resource._matchDocAllocator = _resource.matchDocAllocator.get();
     resource._sessionMetricsCollector = _resource.sessionMetricsCollector;
     resource._getAllSubDoc = request->getConfigClause()->getAllSubDoc();
+    resource._sortBlockSkipper = _sortBlockSkipper.get();
 
     rank::HitCollectorBase *rankCollector =
         _hitCollectorManager->getRankHitCollector();
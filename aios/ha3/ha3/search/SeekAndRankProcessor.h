@@ -68,6 +68,7 @@ private:
                               HitCollectorManager *hitCollectorManager,
                               uint32_t phaseCount) const;
     HitCollectorManager *createHitCollectorManager(const common::Request *request) const;
+    void initSortBlockSkipper(const common::Request *request);
 
     static bool needFlattenMatchDoc(const common::Request *request) {
         if (request->getConfigClause()) {
@@ -93,6 +94,7 @@ private:
     RankSearcher _rankSearcher;
     suez::turing::RankAttributeExpression *_rankExpression;
     HitCollectorManager *_hitCollectorManager;
+    SortBlockSkipperPtr _sortBlockSkipper;
 private:
     friend class MatchDocSearcherTest;
 private:
@@ -35,6 +35,8 @@ SingleLayerSearcher::SingleLayerSearcher(
     , _seekTimes(0)
     , _hashJoinInfo(hashJoinInfo)
     , _joinAttrExpr(joinAttrExpr)
+    , _sortBlockSkipper(NULL)
+    , _sortSkippedDocCount(0)
 {
     if (layerMeta->quotaMode == QM_PER_LAYER) {
         _curQuota = layerMeta->maxQuota;
@@ -9,6 +9,7 @@
 #include <ha3/search/FilterWrapper.h>
 #include <ha3/common/Ha3MatchDocAllocator.h>
 #include <ha3/search/MatchDataManager.h>
+#include <ha3/search/SortBlockSkipper.h>
 #include <matchdoc/MatchDocAllocator.h>
 #include <indexlib/index/normal/deletionmap/deletion_map_reader.h>
 #include <indexlib/index/normal/attribute/accessor/join_docid_attribute_iterator.h>
@@ -72,11 +73,15 @@ public:
     uint32_t getSeekDocCount() const {
         return _queryExecutor->getSeekDocCount();
     }
+    void setSortBlockSkipper(SortBlockSkipper *sortBlockSkipper) {
+        _sortBlockSkipper = sortBlockSkipper;
+    }
 private:
     bool moveToNextRange();
     bool moveBack();
     bool moveToCorrectRange(docid_t &docId);
     inline bool tryToMakeItInRange(docid_t &docId);
+    inline docid_t skipDeletedDocs(docid_t docId) const;
     IE_NAMESPACE(common)::ErrorCode constructSubMatchDocs(matchdoc::MatchDoc matchDoc);
 private:
     docid_t _curDocId;
@@ -99,6 +104,8 @@ private:
     const common::HashJoinInfo *_hashJoinInfo;
     suez::turing::AttributeExpression *_joinAttrExpr;
     std::list<matchdoc::MatchDoc> _matchDocBuffer;
+    SortBlockSkipper *_sortBlockSkipper;
+    uint32_t _sortSkippedDocCount;
 
 private:
     friend class SingleLayerSearcherTest;
@@ -131,8 +138,10 @@ inline uint32_t SingleLayerSearcher::getSeekedCount() const {
                               (*_layerMeta)[cousor].begin;
         }
     }
-
-    return seekedDocCount;
+    // docs skipped by sort block are not seeked, total hits of the
+    // layer are extrapolated from the docs really seeked
+    return seekedDocCount > _sortSkippedDocCount ?
+        seekedDocCount - _sortSkippedDocCount : 0;
 }
 
 inline bool SingleLayerSearcher::tryToMakeItInRange(docid_t &docId) {
@@ -143,6 +152,17 @@ inline bool SingleLayerSearcher::tryToMakeItInRange(docid_t &docId) {
     return moveToCorrectRange(docId);
 }
 
+// docId is deleted, return the first undeleted doc after it in current range,
+// deleted docs are skipped by deletion map slot instead of seeking them one by one
+inline docid_t SingleLayerSearcher::skipDeletedDocs(docid_t docId) const {
+    docid_t begin = docId + 1;
+    if (begin > _curEnd) {
+        return begin;
+    }
+    docid_t next = _deletionMapReader->NextUndeleted(begin);
+    return (next == INVALID_DOCID || next > _curEnd) ? _curEnd + 1 : next;
+}
+
 inline IE_NAMESPACE(common)::ErrorCode SingleLayerSearcher::seek(
     bool needSubDoc, matchdoc::MatchDoc& matchDoc) {
     docid_t docId = _curDocId;
@@ -164,9 +184,15 @@ inline IE_NAMESPACE(common)::ErrorCode SingleLayerSearcher::seek(
             }
             continue;
         }
+        docid_t nextDocId;
+        if (_sortBlockSkipper && _sortBlockSkipper->skip(docId, nextDocId)) {
+            _sortSkippedDocCount += std::min(nextDocId, _curEnd + 1) - docId;
+            docId = nextDocId;
+            continue;
+        }
         ++_seekTimes;
         if (_deletionMapReader && _deletionMapReader->IsDeleted(docId)) {
-            ++docId;
+            docId = skipDeletedDocs(docId);
             continue;
         }
         matchDoc = _matchDocAllocator->allocate(docId);
@@ -238,7 +264,7 @@ IE_NAMESPACE(common)::ErrorCode SingleLayerSearcher::seekAndJoin(
                 continue;
             }
             if (_deletionMapReader && _deletionMapReader->IsDeleted(docId)) {
-                ++docId;
+                docId = skipDeletedDocs(docId);
                 continue;
             }
             tmpMatchDoc = _matchDocAllocator->allocate(docId);
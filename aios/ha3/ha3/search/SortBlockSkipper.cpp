@@ -0,0 +1,257 @@
+#include <ha3/search/SortBlockSkipper.h>
+#include <indexlib/index/max_min_segment_metrics_updater.h>
+#include <indexlib/index/normal/attribute/accessor/single_value_attribute_reader.h>
+#include <indexlib/index_base/partition_data.h>
+#include <indexlib/config/field_type_traits.h>
+#include <indexlib/config/attribute_schema.h>
+#include <suez/turing/expression/framework/VariableTypeTraits.h>
+#include <algorithm>
+
+using namespace std;
+using namespace suez::turing;
+USE_HA3_NAMESPACE(rank);
+IE_NAMESPACE_USE(config);
+IE_NAMESPACE_USE(index);
+IE_NAMESPACE_USE(index_base);
+IE_NAMESPACE_USE(partition);
+
+BEGIN_HA3_NAMESPACE(search);
+HA3_LOG_SETUP(search, SortBlockSkipper);
+
+SortBlockSkipper::SortBlockSkipper(SortExpression *sortExpr)
+    : _sortExpr(sortExpr)
+    , _sortAsc(sortExpr ? sortExpr->getSortFlag() : false)
+    , _hasThreshold(false)
+    , _threshold(0)
+    , _cursor(0)
+    , _skippedDocCount(0)
+{
+}
+
+SortBlockSkipper::~SortBlockSkipper() {
+}
+
+bool SortBlockSkipper::init(const IndexPartitionReaderPtr &reader) {
+    if (!reader || !_sortExpr || _sortExpr->isMultiValue()) {
+        return false;
+    }
+    if (_sortExpr->getAttributeExpression()->getExpressionType() != ET_ATOMIC) {
+        return false;
+    }
+    const string &attrName = _sortExpr->getOriginalString();
+    const AttributeSchemaPtr &attrSchema = reader->GetSchema()->GetAttributeSchema();
+    AttributeConfigPtr attrConfig = attrSchema ?
+                                    attrSchema->GetAttributeConfig(attrName) : AttributeConfigPtr();
+    if (!attrConfig) {
+        return false;
+    }
+    FieldType fieldType = attrConfig->GetFieldType();
+    CompressTypeOption compressType = attrConfig->GetCompressType();
+    if (fieldType == ft_float && (compressType.HasFp16EncodeCompress()
+                                  || compressType.HasBlockFpEncodeCompress()
+                                  || compressType.HasInt8EncodeCompress()))
+    {
+        return false;
+    }
+    bool ret = false;
+    switch (fieldType) {
+#define INIT_TYPED_BLOCKS(ft)                                           \
+        case ft:                                                        \
+            ret = initTyped<FieldTypeTraits<ft>::AttrItemType>(reader, attrConfig); \
+            break;
+        INIT_TYPED_BLOCKS(ft_int8);
+        INIT_TYPED_BLOCKS(ft_uint8);
+        INIT_TYPED_BLOCKS(ft_int16);
+        INIT_TYPED_BLOCKS(ft_uint16);
+        INIT_TYPED_BLOCKS(ft_int32);
+        INIT_TYPED_BLOCKS(ft_uint32);
+        INIT_TYPED_BLOCKS(ft_int64);
+        INIT_TYPED_BLOCKS(ft_uint64);
+        INIT_TYPED_BLOCKS(ft_float);
+        INIT_TYPED_BLOCKS(ft_double);
+#undef INIT_TYPED_BLOCKS
+    default:
+        return false;
+    }
+    HA3_LOG(DEBUG, "attribute [%s] has [%zu] sort blocks", attrName.c_str(), _blocks.size());
+    return ret && !_blocks.empty();
+}
+
+template <typename T>
+bool SortBlockSkipper::initTyped(const IndexPartitionReaderPtr &reader,
+                                 const AttributeConfigPtr &attrConfig)
+{
+    typedef SingleValueAttributeReader<T> TypedAttributeReader;
+    typedef std::tr1::shared_ptr<TypedAttributeReader> TypedAttributeReaderPtr;
+    const string &attrName = attrConfig->GetAttrName();
+    TypedAttributeReaderPtr attrReader = DYNAMIC_POINTER_CAST(
+            TypedAttributeReader, reader->GetAttributeReader(attrName));
+    // updated values are only known by the segment readers
+    bool updatable = attrConfig->IsAttributeUpdatable();
+    if (updatable && !attrReader) {
+        return false;
+    }
+    PartitionDataPtr partitionData = reader->GetPartitionData();
+    if (!partitionData) {
+        return false;
+    }
+    for (auto it = partitionData->Begin(); it != partitionData->End(); ++it) {
+        const SegmentData &segData = *it;
+        uint32_t docCount = segData.GetSegmentInfo().docCount;
+        if (docCount == 0) {
+            continue;
+        }
+        SegmentGroupMetricsPtr groupMetrics =
+            segData.GetSegmentMetrics().GetSegmentCustomizeGroupMetrics();
+        if (!groupMetrics) {
+            continue;
+        }
+        typename TypedAttributeReader::SegmentReaderPtr segReader;
+        if (attrReader) {
+            segReader = attrReader->GetSegmentReaderBySegmentId(segData.GetSegmentId());
+        }
+        if (updatable && !segReader) {
+            continue;
+        }
+        addSegmentBlocks<T>(groupMetrics, attrName, segData.GetBaseDocId(),
+                            docCount, segReader.get());
+    }
+    if (attrReader) {
+        addBuildingBlocks<T>(attrReader->GetBuildingAttributeReader());
+    }
+    return true;
+}
+
+template <typename T>
+void SortBlockSkipper::addSegmentBlocks(const SegmentGroupMetricsPtr &groupMetrics,
+                                        const string &attrName,
+                                        docid_t baseDocId, uint32_t docCount,
+                                        const SingleValueAttributeSegmentReader<T> *segReader)
+{
+    uint32_t blockSize = 0;
+    vector<T> maxValues;
+    vector<T> minValues;
+    if (!MaxMinSegmentMetricsUpdater::GetBlockAttrValues(
+                    groupMetrics, attrName, blockSize, maxValues, minValues))
+    {
+        return;
+    }
+    if (maxValues.size() != (docCount + blockSize - 1) / blockSize) {
+        HA3_LOG(WARN, "block count [%zu] of attribute [%s] mismatch doc count [%u],"
+                " block size [%u]", maxValues.size(), attrName.c_str(), docCount, blockSize);
+        return;
+    }
+    // blocks with docs patched or updated after dump also cover the updated values
+    docid_t updatedBegin = INVALID_DOCID;
+    docid_t updatedEnd = INVALID_DOCID;
+    T updatedMin = T();
+    T updatedMax = T();
+    bool hasUpdated = segReader && segReader->GetUpdatedRange(
+            updatedBegin, updatedEnd, updatedMin, updatedMax);
+    for (size_t i = 0; i < maxValues.size(); ++i) {
+        docid_t begin = i * blockSize;
+        docid_t end = std::min(begin + (docid_t)blockSize, (docid_t)docCount);
+        double minValue = (double)minValues[i];
+        double maxValue = (double)maxValues[i];
+        if (hasUpdated && begin < updatedEnd && updatedBegin < end) {
+            minValue = std::min(minValue, (double)updatedMin);
+            maxValue = std::max(maxValue, (double)updatedMax);
+        }
+        addBlock(baseDocId + begin, baseDocId + end, minValue, maxValue);
+    }
+}
+
+template <typename T>
+void SortBlockSkipper::addBuildingBlocks(
+        const std::tr1::shared_ptr<BuildingAttributeReader<T> > &buildingReader)
+{
+    if (!buildingReader) {
+        return;
+    }
+    for (size_t i = 0; i < buildingReader->Size(); ++i) {
+        const auto &inMemReader = buildingReader->GetSegmentReader(i);
+        const SingleValueBlockMaxMin<T> *blockMaxMin = inMemReader->GetBlockMaxMin();
+        if (!blockMaxMin) {
+            continue;
+        }
+        // block values are widened before docs are appended, docs added
+        // after doc count is read are not covered by any block
+        docid_t docCount = inMemReader->GetDocCount();
+        docid_t baseDocId = buildingReader->GetBaseDocId(i);
+        docid_t blockSize = blockMaxMin->GetBlockSize();
+        for (docid_t begin = 0; begin < docCount; begin += blockSize) {
+            T minValue;
+            T maxValue;
+            if (!blockMaxMin->Get(begin / blockSize, minValue, maxValue)) {
+                break;
+            }
+            docid_t end = std::min(begin + blockSize, docCount);
+            addBlock(baseDocId + begin, baseDocId + end, (double)minValue, (double)maxValue);
+        }
+    }
+}
+
+void SortBlockSkipper::addBlock(docid_t begin, docid_t end,
+                                double minValue, double maxValue)
+{
+    assert(_blocks.empty() || _blocks.back().end <= begin);
+    _blocks.push_back(Block(begin, end, minValue, maxValue));
+}
+
+void SortBlockSkipper::updateThreshold(HitCollectorBase *hitCollector) {
+    if (hitCollector->getType() != HitCollectorBase::HCT_SINGLE
+        || !hitCollector->isScored() || !hitCollector->isFull())
+    {
+        return;
+    }
+    double value = 0;
+    if (getSortValue(hitCollector->top(), value)) {
+        setThreshold(value);
+    }
+}
+
+bool SortBlockSkipper::getSortValue(matchdoc::MatchDoc matchDoc, double &value) const {
+    if (matchdoc::INVALID_MATCHDOC == matchDoc) {
+        return false;
+    }
+    // lazy evaluated sort expression may not be filled yet
+    _sortExpr->evaluate(matchDoc);
+    matchdoc::ReferenceBase *ref = _sortExpr->getReferenceBase();
+    switch (_sortExpr->getType()) {
+#define GET_SORT_VALUE_CASE(vt)                                         \
+        case vt: {                                                      \
+            typedef VariableTypeTraits<vt, false>::AttrExprType T;      \
+            auto typedRef = dynamic_cast<matchdoc::Reference<T> *>(ref); \
+            if (!typedRef) {                                            \
+                return false;                                           \
+            }                                                           \
+            value = (double)typedRef->get(matchDoc);                    \
+            return true;                                                \
+        }
+        NUMERIC_VARIABLE_TYPE_MACRO_HELPER(GET_SORT_VALUE_CASE);
+#undef GET_SORT_VALUE_CASE
+    default:
+        return false;
+    }
+}
+
+bool SortBlockSkipper::findBlock(docid_t docId) {
+    if (_blocks.empty()) {
+        return false;
+    }
+    if (docId < _blocks[_cursor].begin) {
+        // seek moved back, restart from the first block after docId
+        auto iter = upper_bound(_blocks.begin(), _blocks.end(), docId,
+                                [](docid_t id, const Block &block) {
+                                    return id < block.end;
+                                });
+        _cursor = iter == _blocks.end() ? _blocks.size() - 1 : iter - _blocks.begin();
+    }
+    while (_cursor + 1 < _blocks.size() && _blocks[_cursor].end <= docId) {
+        ++_cursor;
+    }
+    const Block &block = _blocks[_cursor];
+    return docId >= block.begin && docId < block.end;
+}
+
+END_HA3_NAMESPACE(search);
@@ -0,0 +1,112 @@
+#ifndef ISEARCH_SORTBLOCKSKIPPER_H
+#define ISEARCH_SORTBLOCKSKIPPER_H
+
+#include <ha3/common.h>
+#include <ha3/isearch.h>
+#include <ha3/util/Log.h>
+#include <ha3/search/SortExpression.h>
+#include <ha3/rank/HitCollectorBase.h>
+#include <indexlib/partition/index_partition_reader.h>
+#include <indexlib/index_base/index_meta/segment_group_metrics.h>
+#include <indexlib/config/attribute_config.h>
+#include <indexlib/index/normal/attribute/accessor/single_value_attribute_segment_reader.h>
+#include <indexlib/index/normal/attribute/accessor/building_attribute_reader.h>
+
+BEGIN_HA3_NAMESPACE(search);
+
+// skip docid blocks whose best sort value can not beat the worst doc of a full
+// rank heap. block max/min of built segments come from segment metrics dumped
+// by the max_min segment metrics updater with block_size set, widened by the
+// values patched or updated into the segment since. building segments use the
+// block max/min kept by the attribute writer. built segments without block
+// metrics are always seeked.
+class SortBlockSkipper
+{
+public:
+    struct Block {
+        Block(docid_t begin_, docid_t end_, double minValue_, double maxValue_)
+            : begin(begin_)
+            , end(end_)
+            , minValue(minValue_)
+            , maxValue(maxValue_)
+        {}
+        docid_t begin;
+        docid_t end; // exclusive
+        double minValue;
+        double maxValue;
+    };
+public:
+    SortBlockSkipper(SortExpression *sortExpr);
+    ~SortBlockSkipper();
+private:
+    SortBlockSkipper(const SortBlockSkipper &);
+    SortBlockSkipper& operator=(const SortBlockSkipper &);
+public:
+    // return false if sort expression is not a plain attribute with block
+    // values, or the values of the attribute are lossy compressed
+    bool init(const IE_NAMESPACE(partition)::IndexPartitionReaderPtr &reader);
+    // blocks should be added in docid order
+    void addBlock(docid_t begin, docid_t end, double minValue, double maxValue);
+    void updateThreshold(rank::HitCollectorBase *hitCollector);
+    void setThreshold(double threshold) {
+        _threshold = threshold;
+        _hasThreshold = true;
+    }
+    // return true if the block of docId can be skipped, nextDocId is the end of it
+    inline bool skip(docid_t docId, docid_t &nextDocId);
+    bool empty() const {
+        return _blocks.empty();
+    }
+    uint32_t getSkippedDocCount() const {
+        return _skippedDocCount;
+    }
+private:
+    template <typename T>
+    bool initTyped(const IE_NAMESPACE(partition)::IndexPartitionReaderPtr &reader,
+                   const IE_NAMESPACE(config)::AttributeConfigPtr &attrConfig);
+    template <typename T>
+    void addSegmentBlocks(const IE_NAMESPACE(index_base)::SegmentGroupMetricsPtr &groupMetrics,
+                          const std::string &attrName, docid_t baseDocId, uint32_t docCount,
+                          const IE_NAMESPACE(index)::SingleValueAttributeSegmentReader<T> *segReader);
+    template <typename T>
+    void addBuildingBlocks(
+            const std::tr1::shared_ptr<IE_NAMESPACE(index)::BuildingAttributeReader<T> > &buildingReader);
+    bool getSortValue(matchdoc::MatchDoc matchDoc, double &value) const;
+    bool findBlock(docid_t docId);
+private:
+    SortExpression *_sortExpr;
+    bool _sortAsc;
+    bool _hasThreshold;
+    double _threshold;
+    std::vector<Block> _blocks;
+    size_t _cursor;
+    uint32_t _skippedDocCount;
+private:
+    friend class SortBlockSkipperTest;
+private:
+    HA3_LOG_DECLARE();
+};
+
+HA3_TYPEDEF_PTR(SortBlockSkipper);
+
+////////////////////////////////////////////////////////////////////////////
+
+inline bool SortBlockSkipper::skip(docid_t docId, docid_t &nextDocId) {
+    if (!_hasThreshold || !findBlock(docId)) {
+        return false;
+    }
+    const Block &block = _blocks[_cursor];
+    // equal values may still win by the following sort keys
+    bool canNotBeat = _sortAsc ? block.minValue > _threshold
+                      : block.maxValue < _threshold;
+    if (!canNotBeat) {
+        return false;
+    }
+    _skippedDocCount += block.end - docId;
+    nextDocId = block.end;
+    return true;
+}
+
+END_HA3_NAMESPACE(search);
+
+#endif //ISEARCH_SORTBLOCKSKIPPER_H
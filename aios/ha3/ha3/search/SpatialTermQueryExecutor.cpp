@@ -28,6 +28,10 @@ IE_NAMESPACE(common)::ErrorCode SpatialTermQueryExecutor::doSeek (
     IE_RETURN_CODE_IF_ERROR(ec);
     if (_filter) {
         while (tempDocId != INVALID_DOCID) {
+            // docs hit by cells inside query shape need no exact test
+            if (_spatialIter->IsInteriorDoc()) {
+                break;
+            }
             if (_filter->Test(tempDocId)) {
                 _testDocCount++;
                 break;
@@ -28,6 +28,11 @@ public:
     uint32_t getSeekDocCount() override { return _spatialIter->GetSeekDocCount() + _testDocCount; }
     /* override */ IE_NAMESPACE(index)::DocValueFilter* stealFilter() override
     {
+        // a stolen filter refines every doc, seeking keeps the hits of
+        // interior cells unrefined
+        if (_spatialIter && _spatialIter->HasInteriorPosting()) {
+            return NULL;
+        }
         IE_NAMESPACE(index)::DocValueFilter *tmp = _filter;
         _filter = NULL;
         return tmp;
@@ -38,6 +43,8 @@ private:
     IE_NAMESPACE(index)::SpatialPostingIterator *_spatialIter;
     IE_NAMESPACE(index)::DocValueFilter *_filter;
     int64_t _testDocCount;
+private:
+    friend class QueryExecutorCreatorTest;
 private:
     HA3_LOG_DECLARE();
 };
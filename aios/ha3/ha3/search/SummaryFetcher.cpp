@@ -6,6 +6,35 @@ USE_HA3_NAMESPACE(common);
 BEGIN_HA3_NAMESPACE(search);
 HA3_LOG_SETUP(search, SummaryFetcher);
 
+vector<bool> SummaryFetcher::batchFetchSummary(const vector<Hit*> &hits,
+        const SummaryGroupIdVec &summaryGroupIdVec, int64_t deadline)
+{
+    vector<docid_t> docIds;
+    vector<IE_NAMESPACE(document)::SearchSummaryDocument*> summaryDocs;
+    docIds.reserve(hits.size());
+    summaryDocs.reserve(hits.size());
+    for (auto hit : hits) {
+        assert(hit->getDocId() >= 0);
+        docIds.push_back(hit->getDocId());
+        summaryDocs.push_back(hit->getSummaryHit()->getSummaryDocument());
+    }
+    vector<bool> results;
+    if (!_summaryReader) {
+        results.assign(hits.size(), true);
+    } else if (summaryGroupIdVec.empty()) {
+        results = _summaryReader->BatchGetDocument(docIds, summaryDocs, deadline);
+    } else {
+        results = _summaryReader->BatchGetDocument(docIds, summaryDocs,
+                summaryGroupIdVec, deadline);
+    }
+    for (size_t i = 0; i < hits.size(); ++i) {
+        if (results[i]) {
+            results[i] = fillAttributeToSummary(docIds[i], summaryDocs[i]);
+        }
+    }
+    return results;
+}
+
 bool SummaryFetcher::fillAttributeToSummary(docid_t docid, 
         IE_NAMESPACE(document)::SearchSummaryDocument *summaryDoc)
 {
@@ -49,6 +49,10 @@ public:
                 && fillAttributeToSummary(docId, summaryDoc);
         }
     }
+    // hits should have valid docid, result[i] tells whether hits[i] is fetched,
+    // hits not read before deadline are left unfetched, -1 means no deadline
+    std::vector<bool> batchFetchSummary(const std::vector<common::Hit*> &hits,
+            const SummaryGroupIdVec &summaryGroupIdVec, int64_t deadline = -1);
     bool fillAttributeToSummary(docid_t docid,
                                 IE_NAMESPACE(document)::SearchSummaryDocument *summaryDoc);
 private:
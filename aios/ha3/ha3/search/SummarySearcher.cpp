@@ -518,24 +518,50 @@ void SummarySearcher::doFetchSummaryDocument(
     uint32_t hitSize = hits->size();
     HA3_LOG(DEBUG, "hitSize=%d", hitSize);
     uint32_t i = 0;
-    for (; i < hitSize; i++) {
+    vector<Hit*> batchHits;
+    batchHits.reserve(FETCH_SUMMARY_BATCH_SIZE);
+    int64_t deadline = _resource.timeoutTerminator ?
+                       _resource.timeoutTerminator->getExpireTime() : -1;
+    while (i < hitSize) {
         if (_resource.timeoutTerminator && _resource.timeoutTerminator->checkTimeout()) {
             HA3_LOG(WARN, "fetch summary timeout, required summary size[%d],"
                     " actual fetch summary size[%d]", hitSize, i);
             _resource.errorResult->addError(ERROR_FETCH_SUMMARY_TIMEOUT);
             break;
         }
-        Hit *hit = hits->getHit(i).get();
-        docid_t docId = hit->getDocId();
-        if (docId < 0) {
-            hit->setSummaryHit(NULL);
-            if (!allowLackOfSummary) {
-                HA3_LOG(WARN, "%s", "invalid docid, fetch summary failed!");
+        batchHits.clear();
+        uint32_t batchEnd = hitSize - i > FETCH_SUMMARY_BATCH_SIZE ?
+                            i + FETCH_SUMMARY_BATCH_SIZE : hitSize;
+        for (; i < batchEnd; i++) {
+            Hit *hit = hits->getHit(i).get();
+            if (hit->getDocId() < 0) {
+                hit->setSummaryHit(NULL);
+                if (!allowLackOfSummary) {
+                    HA3_LOG(WARN, "%s", "invalid docid, fetch summary failed!");
+                }
+                continue;
             }
+            batchHits.push_back(hit);
+        }
+        if (batchHits.empty()) {
             continue;
         }
-        if (!summaryFetcher.fetchSummary(hit, _summaryGroupIdVec)) {
+        // indexlib sorts the batch by file offset and merges nearby reads,
+        // the deadline is checked as each read completes
+        vector<bool> results = summaryFetcher.batchFetchSummary(
+                batchHits, _summaryGroupIdVec, deadline);
+        bool timeout = deadline >= 0 && _resource.timeoutTerminator->getLeftTime() <= 0;
+        uint32_t timeoutCount = 0;
+        for (size_t j = 0; j < batchHits.size(); j++) {
+            if (results[j]) {
+                continue;
+            }
+            Hit *hit = batchHits[j];
             hit->setSummaryHit(NULL);
+            if (timeout) {
+                timeoutCount++;
+                continue;
+            }
             stringstream ss;
             if (!allowLackOfSummary) {
                 ss << "fail to get document gid[" <<
@@ -543,7 +569,12 @@ void SummarySearcher::doFetchSummaryDocument(
                 HA3_LOG(WARN, "%s", ss.str().c_str());
             }
             _resource.errorResult->addError(ERROR_SEARCH_FETCH_SUMMARY, ss.str());
-            continue;
+        }
+        if (timeoutCount > 0) {
+            HA3_LOG(WARN, "fetch summary timeout, required summary size[%d],"
+                    " actual fetch summary size[%d]", hitSize, i - timeoutCount);
+            _resource.errorResult->addError(ERROR_FETCH_SUMMARY_TIMEOUT);
+            break;
         }
     }
 
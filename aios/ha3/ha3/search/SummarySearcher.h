@@ -108,6 +108,10 @@ private:
     int32_t _traceLevel;
     SummaryGroupIdVec _summaryGroupIdVec;
     SummarySearchType _summarySearchType;
+private:
+    // hits fetched by one BatchGetDocument, indexlib checks the deadline
+    // between its async reads
+    static const uint32_t FETCH_SUMMARY_BATCH_SIZE = 64;
 private:
     friend class SummarySearcherTest;
     // for test
@@ -535,6 +535,37 @@ TEST_F(AggregatorCreatorTest, testAggregatorFunc) {
 #undef CASE
 }
 
+TEST_F(AggregatorCreatorTest, testCreateAggregatorWithoutSampling) {
+    AggregatorCreator aggCreator(_attributeExpressionCreator, _pool);
+    aggCreator._aggSamplerConfigInfo._enableDenseMode = true;
+    aggCreator._aggSamplerConfigInfo.setAggThreshold(10);
+    aggCreator._aggSamplerConfigInfo.setSampleStep(5);
+
+#define CHECK_SAMPLER(expectThreshold, expectStep)                      \
+    {                                                                   \
+        AggregateClause aggClause;                                      \
+        ClauseParserContext ctx;                                        \
+        ASSERT_TRUE(ctx.parseAggClause("group_key:uid_int8, agg_fun:count()")); \
+        AggregateDescription *aggDescription = ctx.stealAggDescription(); \
+        aggDescription->getGroupKeyExpr()->setMultiValue(false);        \
+        aggDescription->getGroupKeyExpr()->setExprResultType(vt_int8);  \
+        aggClause.addAggDescription(aggDescription);                    \
+        Aggregator *agg = aggCreator.createAggregator(&aggClause);      \
+        ASSERT_TRUE(agg != NULL);                                       \
+        typedef typename DenseMapTraits<int8_t>::GroupMapType GroupInt8Map; \
+        auto normalAgg = dynamic_cast<NormalAggregator<int8_t, int8_t, GroupInt8Map> *>(agg); \
+        ASSERT_NE(nullptr, normalAgg);                                  \
+        ASSERT_EQ((uint32_t)expectThreshold, normalAgg->_aggSampler->_aggThreshold); \
+        ASSERT_EQ((uint32_t)expectStep, normalAgg->_aggSampler->_sampleStep); \
+        DELETE_AND_SET_NULL(agg);                                       \
+    }
+
+    CHECK_SAMPLER(10, 5);
+    aggCreator._aggSamplerConfigInfo.setEnableSampling(false);
+    CHECK_SAMPLER(0, 1);
+#undef CHECK_SAMPLER
+}
+
 
 TEST_F(AggregatorCreatorTest, testAggregatorFuncUnorderedMap) {
     AggregatorCreator aggCreator(_attributeExpressionCreator, _pool);
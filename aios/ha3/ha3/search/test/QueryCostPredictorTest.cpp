@@ -0,0 +1,88 @@
+#include<unittest/unittest.h>
+#include <ha3/common.h>
+#include <ha3/isearch.h>
+#include <ha3/util/Log.h>
+#include <ha3/search/QueryCostPredictor.h>
+#include <ha3/search/test/SearcherTestHelper.h>
+#include <ha3/common/Request.h>
+
+using namespace std;
+USE_HA3_NAMESPACE(common);
+
+BEGIN_HA3_NAMESPACE(search);
+
+class QueryCostPredictorTest : public TESTBASE {
+public:
+    void setUp();
+    void tearDown();
+protected:
+    autil::mem_pool::Pool _pool;
+    RequestPtr _request;
+    TermDFMap _termDFMap;
+protected:
+    HA3_LOG_DECLARE();
+};
+
+HA3_LOG_SETUP(search, QueryCostPredictorTest);
+
+void QueryCostPredictorTest::setUp() {
+    _request.reset(new Request(&_pool));
+    _termDFMap = SearcherTestHelper::createTermDFMap("a:10,b:20,c:30");
+}
+
+void QueryCostPredictorTest::tearDown() {
+    _request.reset();
+}
+
+TEST_F(QueryCostPredictorTest, testPredictWithoutQuery) {
+    QueryCostPredictor predictor;
+    ASSERT_EQ(0, predictor.predict(_request.get(), _termDFMap));
+    _request->setQueryClause(new QueryClause());
+    ASSERT_EQ(0, predictor.predict(_request.get(), _termDFMap));
+}
+
+TEST_F(QueryCostPredictorTest, testPredictByTermDF) {
+    QueryCostPredictor predictor;
+    _request->setQueryClause(new QueryClause(SearcherTestHelper::createQuery("a AND (b OR c)")));
+    // postings 10 + 20 + 30, matched min(10, 20 + 30)
+    ASSERT_DOUBLE_EQ(70, predictor.predict(_request.get(), _termDFMap));
+    ASSERT_EQ(60, predictor.getPostingCount());
+    ASSERT_EQ(10, predictor.getMatchCount());
+
+    _request->setQueryClause(new QueryClause(SearcherTestHelper::createQuery("b OR c")));
+    ASSERT_DOUBLE_EQ(100, predictor.predict(_request.get(), _termDFMap));
+}
+
+TEST_F(QueryCostPredictorTest, testPredictWithSortAndLayer) {
+    QueryCostPredictor predictor;
+    _request->setQueryClause(new QueryClause(SearcherTestHelper::createQuery("b OR c")));
+    SortClause *sortClause = new SortClause();
+    sortClause->addSortDescription(new SortDescription("price"));
+    sortClause->addSortDescription(new SortDescription("RANK"));
+    _request->setSortClause(sortClause);
+    // 50 postings, 50 matched docs each seeked and sorted by two keys
+    ASSERT_DOUBLE_EQ(200, predictor.predict(_request.get(), _termDFMap));
+
+    QueryLayerClause *layerClause = new QueryLayerClause();
+    LayerDescription *layerDesc = new LayerDescription();
+    layerDesc->setQuota(5);
+    layerClause->addLayerDescription(layerDesc);
+    _request->setQueryLayerClause(layerClause);
+    ASSERT_DOUBLE_EQ(65, predictor.predict(_request.get(), _termDFMap));
+    ASSERT_EQ(5, predictor.getMatchCount());
+
+    // a layer without quota seeks all matched docs
+    layerClause->addLayerDescription(new LayerDescription());
+    ASSERT_DOUBLE_EQ(200, predictor.predict(_request.get(), _termDFMap));
+}
+
+TEST_F(QueryCostPredictorTest, testPostingCountNotOverflow) {
+    QueryCostPredictor predictor;
+    _request->setQueryClause(new QueryClause(SearcherTestHelper::createQuery("a OR b OR c")));
+    TermDFMap termDFMap = SearcherTestHelper::createTermDFMap(
+            "a:2000000000,b:2000000000,c:2000000000");
+    predictor.predict(_request.get(), termDFMap);
+    ASSERT_EQ(6000000000L, predictor.getPostingCount());
+}
+
+END_HA3_NAMESPACE(search);
@@ -15,6 +15,8 @@
 #include <ha3/common/Term.h>
 #include <ha3/common/TermQuery.h>
 #include <ha3/search/TermQueryExecutor.h>
+#include <ha3/search/AndQueryExecutor.h>
+#include <ha3/search/SpatialTermQueryExecutor.h>
 #include <autil/StringTokenizer.h>
 #include <ha3/search/test/QueryExecutorTestHelper.h>
 #include <indexlib/testlib/schema_maker.h>
@@ -442,8 +444,42 @@ TEST_F(QueryExecutorCreatorTest, testSpatialAndQueryExecutor) {
         ASSERT_EQ((docid_t)3, seekDoc);
         seekDoc = queryExecutor->legacySeek(seekDoc + 1);
         ASSERT_EQ(END_DOCID, seekDoc);
-        //range iterator: 8 + spatial filter 4
-        ASSERT_EQ(12u, queryExecutor->getSeekDocCount());
+        // all docs are in interior cells of the rectangle, the spatial
+        // executor is not stolen as a filter and refines none of them
+        AndQueryExecutor *andExecutor = dynamic_cast<AndQueryExecutor*>(queryExecutor);
+        ASSERT_TRUE(andExecutor);
+        ASSERT_TRUE(andExecutor->stealFilters().empty());
+        ASSERT_EQ(size_t(2), andExecutor->getQueryExecutors().size());
+        SpatialTermQueryExecutor *spatialExecutor = dynamic_cast<SpatialTermQueryExecutor*>(
+                andExecutor->getQueryExecutors()[1]);
+        ASSERT_TRUE(spatialExecutor);
+        ASSERT_TRUE(spatialExecutor->_spatialIter->HasInteriorPosting());
+        ASSERT_EQ(0, spatialExecutor->_testDocCount);
+        //range iterator: 8 + spatial iterator
+        ASSERT_EQ(8u + spatialExecutor->getSeekDocCount(), queryExecutor->getSeekDocCount());
+        POOL_DELETE_CLASS(queryExecutor);
+    }
+    {
+        // docs near the circle edge are refined, doc 5 is 120m away
+        string queryStr = "(number_index:[1,6]) AND (spatial_index:'circle(116.3906 39.92324, 50)')";
+        IndexPartitionReaderWrapperPtr indexPartReaderPtr =
+            container.readerWrapper;
+        indexPartReaderPtr->setTopK(1000);
+        MatchDataManager matchDataManager;
+        matchDataManager.setQueryCount(1);
+        QueryExecutorCreator creator(&matchDataManager, indexPartReaderPtr.get(), _pool);
+
+        unique_ptr<Query> query(SearcherTestHelper::createQuery(
+                        queryStr, 0, "default", false));
+        query->accept(&creator);
+        QueryExecutor *queryExecutor = creator.stealQuery();
+        docid_t seekDoc = INVALID_DOCID;
+        for (docid_t docId = 0; docId < 5; ++docId) {
+            seekDoc = queryExecutor->legacySeek(seekDoc + 1);
+            ASSERT_EQ(docId, seekDoc);
+        }
+        seekDoc = queryExecutor->legacySeek(seekDoc + 1);
+        ASSERT_EQ(END_DOCID, seekDoc);
         POOL_DELETE_CLASS(queryExecutor);
     }
 }
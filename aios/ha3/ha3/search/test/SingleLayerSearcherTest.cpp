@@ -354,6 +354,76 @@ TEST_F(SingleLayerSearcherTest, testDeletionMap) {
     }
 }
 
+TEST_F(SingleLayerSearcherTest, testSkipDeletedDocs) {
+    string docsInIndex;
+    for (size_t i = 0; i < 100; ++i) {
+        docsInIndex += StringUtil::toString(i) + ",";
+    }
+    string deletionMap;
+    for (size_t i = 5; i <= 70; ++i) {
+        deletionMap += StringUtil::toString(i) + ",";
+    }
+    string expectResult("0,1,2,3,4");
+    for (size_t i = 71; i < 100; ++i) {
+        expectResult += "," + StringUtil::toString(i);
+    }
+    internalTestSeek(docsInIndex, "0,99,100", "", deletionMap, expectResult, 100, 66);
+
+    // deleted docs after the first one of a run are not seeked
+    LayerMeta layerMeta = LayerMetasConstructor::createLayerMeta(_pool, "0,99,100");
+    common::Ha3MatchDocAllocator matchDocAllocator(_pool);
+    QueryExecutorMock queryExecutor(docsInIndex);
+    initDeletionMapReader(deletionMap, _delReaderPtr);
+    SingleLayerSearcher searcher(&queryExecutor, &layerMeta, NULL,
+                                 _delReaderPtr.get(), &matchDocAllocator,
+                                 NULL, NULL, NULL);
+    matchdoc::MatchDoc matchDoc;
+    size_t count = 0;
+    while (true) {
+        ASSERT_EQ(IE_NAMESPACE(common)::ErrorCode::OK, searcher.seek(false, matchDoc));
+        if (matchdoc::INVALID_MATCHDOC == matchDoc) {
+            break;
+        }
+        ++count;
+    }
+    ASSERT_EQ(34u, count);
+    ASSERT_EQ(35u, searcher.getSeekTimes());
+}
+
+TEST_F(SingleLayerSearcherTest, testSortBlockSkippedDocsNotSeeked) {
+    string docsInIndex;
+    for (size_t i = 0; i < 30; ++i) {
+        docsInIndex += StringUtil::toString(i) + ",";
+    }
+    LayerMeta layerMeta = LayerMetasConstructor::createLayerMeta(_pool, "0,19,100");
+    common::Ha3MatchDocAllocator matchDocAllocator(_pool);
+    QueryExecutorMock queryExecutor(docsInIndex);
+    initDeletionMapReader("", _delReaderPtr);
+    SortBlockSkipper skipper(NULL);
+    skipper.addBlock(0, 5, 1, 2);
+    skipper.addBlock(5, 10, 50, 60);
+    // block crosses the end of layer range
+    skipper.addBlock(10, 25, 1, 2);
+    skipper.setThreshold(10);
+    SingleLayerSearcher searcher(&queryExecutor, &layerMeta, NULL,
+                                 _delReaderPtr.get(), &matchDocAllocator,
+                                 NULL, NULL, NULL);
+    searcher.setSortBlockSkipper(&skipper);
+    vector<docid_t> docIds;
+    while (true) {
+        matchdoc::MatchDoc matchDoc;
+        ASSERT_EQ(IE_NAMESPACE(common)::ErrorCode::OK, searcher.seek(false, matchDoc));
+        if (matchdoc::INVALID_MATCHDOC == matchDoc) {
+            break;
+        }
+        docIds.push_back(matchDoc.getDocId());
+    }
+    ASSERT_EQ(vector<docid_t>({5, 6, 7, 8, 9}), docIds);
+    // 15 docs of the range are skipped, only 5 are seeked
+    ASSERT_EQ(5u, searcher.getSeekedCount());
+    ASSERT_EQ(5u, searcher.getSeekTimes());
+}
+
 vector<docid_t> SingleLayerSearcherTest::seekSubDoc(
         docid_t docId, QueryExecutor *queryExecutor,
         common::Ha3MatchDocAllocator *matchDocAllocator,
@@ -0,0 +1,179 @@
+#include <unittest/unittest.h>
+#include <ha3/test/test.h>
+#include <ha3/search/SortBlockSkipper.h>
+#include <ha3/search/test/FakeAttributeExpression.h>
+#include <indexlib/test/schema_maker.h>
+#include <indexlib/test/partition_state_machine.h>
+#include <indexlib/config/index_partition_options.h>
+#include <fslib/fslib.h>
+#include <autil/StringUtil.h>
+
+using namespace std;
+using namespace suez::turing;
+IE_NAMESPACE_USE(config);
+IE_NAMESPACE_USE(test);
+
+BEGIN_HA3_NAMESPACE(search);
+
+// plain attribute sort expression on price
+class FakeAtomicExpression : public FakeAttributeExpression<int32_t>
+{
+public:
+    FakeAtomicExpression(const std::string &name, const std::vector<int32_t> &values)
+        : FakeAttributeExpression<int32_t>(name, values)
+    {}
+    ExpressionType getExpressionType() const override {
+        return ET_ATOMIC;
+    }
+};
+
+class SortBlockSkipperTest : public TESTBASE {
+public:
+    SortBlockSkipperTest() {
+        _indexRoot = GET_TEMP_DATA_PATH() + "SortBlockSkipperTest";
+    }
+public:
+    void setUp();
+    void tearDown();
+protected:
+    void setSortAsc(SortBlockSkipper &skipper, bool sortAsc) {
+        skipper._sortAsc = sortAsc;
+    }
+    string getBlocks(const SortBlockSkipper &skipper) {
+        string blocks;
+        for (const auto &block : skipper._blocks) {
+            blocks += autil::StringUtil::toString(block.begin) + ","
+                      + autil::StringUtil::toString(block.end) + ","
+                      + autil::StringUtil::toString(block.minValue) + ","
+                      + autil::StringUtil::toString(block.maxValue) + ";";
+        }
+        return blocks;
+    }
+protected:
+    string _indexRoot;
+private:
+    HA3_LOG_DECLARE();
+};
+
+HA3_LOG_SETUP(search, SortBlockSkipperTest);
+
+void SortBlockSkipperTest::setUp() {
+    fslib::fs::FileSystem::remove(_indexRoot);
+}
+
+void SortBlockSkipperTest::tearDown() {
+    fslib::fs::FileSystem::remove(_indexRoot);
+}
+
+TEST_F(SortBlockSkipperTest, testSkipDesc) {
+    SortBlockSkipper skipper(NULL);
+    skipper.addBlock(0, 4, 1, 10);
+    skipper.addBlock(4, 8, 20, 30);
+    skipper.addBlock(10, 12, 5, 8);
+    docid_t nextDocId = INVALID_DOCID;
+    // no threshold before heap is full
+    ASSERT_FALSE(skipper.skip(0, nextDocId));
+
+    skipper.setThreshold(10);
+    // equal value is not skipped
+    ASSERT_FALSE(skipper.skip(1, nextDocId));
+    ASSERT_FALSE(skipper.skip(5, nextDocId));
+    // docs without block
+    ASSERT_FALSE(skipper.skip(8, nextDocId));
+    ASSERT_TRUE(skipper.skip(11, nextDocId));
+    ASSERT_EQ(12, nextDocId);
+    ASSERT_FALSE(skipper.skip(12, nextDocId));
+    ASSERT_EQ(1u, skipper.getSkippedDocCount());
+
+    skipper.setThreshold(11);
+    // seek moved back
+    ASSERT_TRUE(skipper.skip(2, nextDocId));
+    ASSERT_EQ(4, nextDocId);
+    ASSERT_FALSE(skipper.skip(4, nextDocId));
+    ASSERT_TRUE(skipper.skip(10, nextDocId));
+    ASSERT_EQ(12, nextDocId);
+    ASSERT_EQ(5u, skipper.getSkippedDocCount());
+}
+
+TEST_F(SortBlockSkipperTest, testSkipAsc) {
+    SortBlockSkipper skipper(NULL);
+    setSortAsc(skipper, true);
+    skipper.addBlock(0, 4, 1, 10);
+    skipper.addBlock(4, 8, 20, 30);
+    docid_t nextDocId = INVALID_DOCID;
+    skipper.setThreshold(20);
+    ASSERT_FALSE(skipper.skip(0, nextDocId));
+    ASSERT_FALSE(skipper.skip(4, nextDocId));
+    skipper.setThreshold(19.5);
+    ASSERT_TRUE(skipper.skip(6, nextDocId));
+    ASSERT_EQ(8, nextDocId);
+    ASSERT_EQ(2u, skipper.getSkippedDocCount());
+}
+
+TEST_F(SortBlockSkipperTest, testInitWithoutReader) {
+    SortBlockSkipper skipper(NULL);
+    ASSERT_FALSE(skipper.init(IE_NAMESPACE(partition)::IndexPartitionReaderPtr()));
+    ASSERT_TRUE(skipper.empty());
+}
+
+TEST_F(SortBlockSkipperTest, testInitWithPartition) {
+    IndexPartitionOptions options;
+    string updaterConfigStr = R"([{
+        "class_name": "max_min",
+        "parameters": {"attribute_name": "price", "block_size": "2"}
+    }])";
+    autil::legacy::FromJsonString(
+            options.GetBuildConfig(false).GetSegmentMetricsUpdaterConfig(), updaterConfigStr);
+    autil::legacy::FromJsonString(
+            options.GetBuildConfig(true).GetSegmentMetricsUpdaterConfig(), updaterConfigStr);
+    IndexPartitionSchemaPtr schema = SchemaMaker::MakeSchema(
+            "pk:uint64:pk;price:int32;", "pk:primarykey64:pk;", "price", "");
+    ASSERT_TRUE(schema->GetAttributeSchema()->GetAttributeConfig("price")
+                ->IsAttributeUpdatable());
+    PartitionStateMachine psm;
+    ASSERT_TRUE(psm.Init(schema, options, _indexRoot));
+    string fullDocs = "cmd=add,pk=0,price=1;"
+                      "cmd=add,pk=1,price=2;"
+                      "cmd=add,pk=2,price=10;"
+                      "cmd=add,pk=3,price=20;"
+                      "cmd=add,pk=4,price=3;"
+                      "cmd=add,pk=5,price=4;";
+    ASSERT_TRUE(psm.Transfer(BUILD_FULL_NO_MERGE, fullDocs, "", ""));
+
+    vector<int32_t> values;
+    FakeAtomicExpression attrExpr("price", values);
+    SortExpression sortExpr(&attrExpr, false);
+    {
+        SortBlockSkipper skipper(&sortExpr);
+        ASSERT_TRUE(skipper.init(psm.GetIndexPartition()->GetReader()));
+        ASSERT_EQ("0,2,1,2;2,4,10,20;4,6,3,4;", getBlocks(skipper));
+    }
+    // realtime docs are in building segment, block size of building
+    // segment is fixed by the attribute writer
+    string rtDocs = "cmd=add,pk=6,price=30,ts=6;"
+                    "cmd=add,pk=7,price=5,ts=7;";
+    ASSERT_TRUE(psm.Transfer(BUILD_RT, rtDocs, "", ""));
+    {
+        SortBlockSkipper skipper(&sortExpr);
+        ASSERT_TRUE(skipper.init(psm.GetIndexPartition()->GetReader()));
+        ASSERT_EQ("0,2,1,2;2,4,10,20;4,6,3,4;6,8,5,30;", getBlocks(skipper));
+    }
+    // updated values widen the blocks they fall in
+    string updateDocs = "cmd=update_field,pk=1,price=100,ts=8;"
+                        "cmd=update_field,pk=7,price=0,ts=9;";
+    ASSERT_TRUE(psm.Transfer(BUILD_RT, updateDocs, "", ""));
+    {
+        SortBlockSkipper skipper(&sortExpr);
+        ASSERT_TRUE(skipper.init(psm.GetIndexPartition()->GetReader()));
+        ASSERT_EQ("0,2,1,100;2,4,10,20;4,6,3,4;6,8,0,30;", getBlocks(skipper));
+        docid_t nextDocId = INVALID_DOCID;
+        skipper.setThreshold(50);
+        ASSERT_FALSE(skipper.skip(1, nextDocId));
+        ASSERT_TRUE(skipper.skip(2, nextDocId));
+        ASSERT_EQ(4, nextDocId);
+        ASSERT_TRUE(skipper.skip(7, nextDocId));
+        ASSERT_EQ(8, nextDocId);
+    }
+}
+
+END_HA3_NAMESPACE(search);
@@ -84,6 +84,11 @@ ResultPtr QrsSearcherProcessDelegation::search(common::RequestPtr &requestPtr) {
     createClusterIdMap();
     ConfigClause *configClause = requestPtr->getConfigClause();
     configClause->setPhaseNumber(SEARCH_PHASE_ONE);
+    // qrs reads both matchdocs formats, ask searchers for the columnar one
+    // unless the user set it explicitly
+    if (configClause->getKVPairValue(COLUMNAR_MATCHDOCS_KEY).empty()) {
+        configClause->addKVPair(COLUMNAR_MATCHDOCS_KEY, "true");
+    }
     vector<string> clusterNameVec = configClause->getClusterNameVector();
     LevelClause *levelClause = requestPtr->getLevelClause();
     if (levelClause
@@ -0,0 +1,76 @@
+#include <ha3/service/RequestCostEstimator.h>
+#include <ha3/queryparser/RequestSymbolDefine.h>
+#include <autil/StringTokenizer.h>
+#include <autil/StringUtil.h>
+
+using namespace std;
+using namespace autil;
+
+BEGIN_HA3_NAMESPACE(service);
+HA3_LOG_SETUP(service, RequestCostEstimator);
+
+RequestCostEstimator::RequestCostEstimator() {
+}
+
+RequestCostEstimator::~RequestCostEstimator() {
+}
+
+double RequestCostEstimator::estimate(const string &requestStr) {
+    uint32_t termCount = 0;
+    uint32_t perDocCost = 1;
+    StringTokenizer clauses(requestStr, CLAUSE_SEPERATOR,
+                            StringTokenizer::TOKEN_IGNORE_EMPTY |
+                            StringTokenizer::TOKEN_TRIM);
+    for (StringTokenizer::Iterator it = clauses.begin(); it != clauses.end(); ++it) {
+        size_t pos = it->find(CLAUSE_KV_SEPERATOR);
+        if (pos == string::npos) {
+            continue;
+        }
+        string name = it->substr(0, pos);
+        StringUtil::trim(name);
+        string value = it->substr(pos + 1);
+        if (name == QUERY_CLAUSE) {
+            termCount += countQueryTerms(value);
+        } else if (name == FILTER_CLAUSE) {
+            ++perDocCost;
+        } else if (name == SORT_CLAUSE) {
+            perDocCost += countDescriptions(value, SORT_CLAUSE_SEPERATOR);
+        } else if (name == AGGREGATE_CLAUSE) {
+            perDocCost += countDescriptions(value, AGGREGATE_CLAUSE_SEPERATOR);
+        }
+    }
+    return (double)termCount * perDocCost;
+}
+
+// words between blanks and parentheses, boolean operators excluded
+uint32_t RequestCostEstimator::countQueryTerms(const string &queryStr) {
+    uint32_t count = 0;
+    size_t pos = 0;
+    while (pos < queryStr.size()) {
+        size_t begin = queryStr.find_first_not_of(" \t()", pos);
+        if (begin == string::npos) {
+            break;
+        }
+        size_t end = queryStr.find_first_of(" \t()", begin);
+        if (end == string::npos) {
+            end = queryStr.size();
+        }
+        string word = queryStr.substr(begin, end - begin);
+        if (word != "AND" && word != "OR" && word != "ANDNOT" && word != "RANK") {
+            ++count;
+        }
+        pos = end;
+    }
+    return count;
+}
+
+uint32_t RequestCostEstimator::countDescriptions(const string &clauseStr,
+        const string &seperator)
+{
+    StringTokenizer st(clauseStr, seperator,
+                       StringTokenizer::TOKEN_IGNORE_EMPTY |
+                       StringTokenizer::TOKEN_TRIM);
+    return st.getNumTokens();
+}
+
+END_HA3_NAMESPACE(service);
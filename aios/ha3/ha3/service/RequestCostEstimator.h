@@ -0,0 +1,38 @@
+#ifndef ISEARCH_REQUESTCOSTESTIMATOR_H
+#define ISEARCH_REQUESTCOSTESTIMATOR_H
+
+#include <ha3/common.h>
+#include <ha3/isearch.h>
+#include <ha3/util/Log.h>
+#include <string>
+
+BEGIN_HA3_NAMESPACE(service);
+
+// cheap cost estimate of a ha3 request string, used by qrs to pick a task
+// queue before the request is parsed. it uses the same per doc weights as
+// search::QueryCostPredictor (one for the seek, one for the filter, one
+// per sort key and aggregate description), but qrs has no index, so every
+// query term counts as one unit of posting work.
+class RequestCostEstimator
+{
+public:
+    RequestCostEstimator();
+    ~RequestCostEstimator();
+private:
+    RequestCostEstimator(const RequestCostEstimator &);
+    RequestCostEstimator& operator=(const RequestCostEstimator &);
+public:
+    static double estimate(const std::string &requestStr);
+private:
+    static uint32_t countQueryTerms(const std::string &queryStr);
+    static uint32_t countDescriptions(const std::string &clauseStr,
+            const std::string &seperator);
+private:
+    HA3_LOG_DECLARE();
+};
+
+HA3_TYPEDEF_PTR(RequestCostEstimator);
+
+END_HA3_NAMESPACE(service);
+
+#endif //ISEARCH_REQUESTCOSTESTIMATOR_H
@@ -1,5 +1,6 @@
 #include <ha3/service/ServiceDegrade.h>
 #include <autil/TimeUtility.h>
+#include <algorithm>
 using namespace autil;
 
 BEGIN_HA3_NAMESPACE(service);
@@ -32,4 +33,15 @@ bool ServiceDegrade::updateRequest(common::Request *request,
     return ret;
 }
 
+float ServiceDegrade::adjustDegradeLevel(float level, double predictedCost) const {
+    if (!needPredictCost() || level <= multi_call::MIN_PERCENT) {
+        return level;
+    }
+    if (predictedCost < _config.cost.costThreshold) {
+        return multi_call::MIN_PERCENT;
+    }
+    double adjustedLevel = level * predictedCost / _config.cost.costThreshold;
+    return std::min(adjustedLevel, (double)multi_call::MAX_PERCENT);
+}
+
 END_HA3_NAMESPACE(service);
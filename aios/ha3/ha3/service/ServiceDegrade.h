@@ -23,6 +23,12 @@ public:
     bool needDegade(uint32_t workerQueueSize);
     bool updateRequest(common::Request *request,
                        const multi_call::QueryInfoPtr &queryInfo);
+    bool needPredictCost() const {
+        return _config.cost.costThreshold > 0;
+    }
+    // cheap requests are not degraded, expensive ones get a level scaled
+    // by cost / cost_threshold
+    float adjustDegradeLevel(float level, double predictedCost) const;
     config::ServiceDegradationConfig getServiceDegradationConfig() const {
         return _config;
     };
@@ -1,6 +1,7 @@
 #include <ha3/service/ThreadPoolManager.h>
 #include <autil/StringTokenizer.h>
 #include <autil/StringUtil.h>
+#include <algorithm>
 
 using namespace std;
 using namespace autil;
@@ -17,6 +18,11 @@ ThreadPoolManager::~ThreadPoolManager() {
         delete it->second;
     }
     _pools.clear();
+    for (auto &poolItem : _stealingPools) {
+        delete poolItem.second;
+    }
+    _stealingPools.clear();
+    _lanes.clear();
 }
 
 bool ThreadPoolManager::addThreadPool(const string& threadPoolsConfigStr) {
@@ -33,7 +39,7 @@ bool ThreadPoolManager::addThreadPool(const string& threadPoolsConfigStr) {
             return false;
         }
         string poolName = st2[0];
-        if (_pools.end() != _pools.find(poolName)) {
+        if (isTaskQueueNameUsed(poolName)) {
             HA3_LOG(ERROR, "parse threadPoolConfigStr[%s] failed!", 
                     threadPoolsConfigStr.c_str());
             return false;
@@ -63,7 +69,7 @@ bool ThreadPoolManager::addThreadPool(const string& threadPoolsConfigStr) {
 bool ThreadPoolManager::addThreadPool(const string&poolName, 
                                        int32_t queueSize, int32_t threadNum) 
 {
-    if (_pools.end() != _pools.find(poolName)) {
+    if (isTaskQueueNameUsed(poolName)) {
         HA3_LOG(ERROR, "add thread pool[%s] failed, pool name already existed.",
                 poolName.c_str());
         return false;
@@ -74,6 +80,94 @@ bool ThreadPoolManager::addThreadPool(const string&poolName,
     return true;
 }
 
+bool ThreadPoolManager::addWorkStealingThreadPool(const string& threadPoolsConfigStr) {
+    StringTokenizer st1(threadPoolsConfigStr, ";",
+                        StringTokenizer::TOKEN_IGNORE_EMPTY |
+                        StringTokenizer::TOKEN_TRIM);
+    for (StringTokenizer::Iterator iter = st1.begin(); iter != st1.end(); iter++) {
+        StringTokenizer st2(*iter, "|",
+                            StringTokenizer::TOKEN_IGNORE_EMPTY |
+                            StringTokenizer::TOKEN_TRIM);
+        if (st2.getNumTokens() != 3) {
+            HA3_LOG(ERROR, "parse work stealing threadPoolConfigStr[%s] failed!",
+                    threadPoolsConfigStr.c_str());
+            return false;
+        }
+        vector<string> laneNames = StringUtil::split(st2[0], ",");
+        vector<pair<double, string> > costLanes;
+        for (size_t i = 0; i < laneNames.size(); ++i) {
+            StringUtil::trim(laneNames[i]);
+            size_t pos = laneNames[i].find(':');
+            if (pos == string::npos) {
+                continue;
+            }
+            double maxCost = 0;
+            string costStr = laneNames[i].substr(pos + 1);
+            StringUtil::trim(costStr);
+            laneNames[i] = laneNames[i].substr(0, pos);
+            StringUtil::trim(laneNames[i]);
+            if (!StringUtil::fromString<double>(costStr, maxCost) || maxCost < 0
+                || laneNames[i].empty())
+            {
+                HA3_LOG(ERROR, "invalid lane cost [%s], parse work stealing"
+                        " threadPoolConfigStr[%s] failed!",
+                        costStr.c_str(), threadPoolsConfigStr.c_str());
+                return false;
+            }
+            costLanes.push_back(make_pair(maxCost, laneNames[i]));
+        }
+        if (laneNames.empty()) {
+            HA3_LOG(ERROR, "parse work stealing threadPoolConfigStr[%s] failed!",
+                    threadPoolsConfigStr.c_str());
+            return false;
+        }
+        for (size_t i = 0; i < laneNames.size(); ++i) {
+            bool duplicated = isTaskQueueNameUsed(laneNames[i])
+                              || find(laneNames.begin(), laneNames.begin() + i,
+                                      laneNames[i]) != laneNames.begin() + i;
+            if (duplicated) {
+                HA3_LOG(ERROR, "task queue [%s] already existed, parse work stealing"
+                        " threadPoolConfigStr[%s] failed!",
+                        laneNames[i].c_str(), threadPoolsConfigStr.c_str());
+                return false;
+            }
+        }
+        uint32_t taskQueueSize;
+        uint32_t threadNum;
+        if (!(StringUtil::fromString<uint32_t>(st2[1], taskQueueSize) &&
+              StringUtil::toString(taskQueueSize) == st2[1])) {
+            HA3_LOG(ERROR, "parse work stealing threadPoolConfigStr[%s] failed!",
+                    threadPoolsConfigStr.c_str());
+            return false;
+        }
+        if (!(StringUtil::fromString<uint32_t>(st2[2], threadNum) &&
+              StringUtil::toString(threadNum) == st2[2])) {
+            HA3_LOG(ERROR, "parse work stealing threadPoolConfigStr[%s] failed!",
+                    threadPoolsConfigStr.c_str());
+            return false;
+        }
+
+        WorkStealingThreadPool *pool = new WorkStealingThreadPool(
+                threadNum, taskQueueSize, laneNames.size());
+        _stealingPools[laneNames[0]] = pool;
+        for (size_t i = 0; i < laneNames.size(); ++i) {
+            _lanes[laneNames[i]] = Lane(pool, i);
+        }
+        _costLanes.insert(_costLanes.end(), costLanes.begin(), costLanes.end());
+    }
+    sort(_costLanes.begin(), _costLanes.end());
+    return true;
+}
+
+string ThreadPoolManager::getLaneByCost(double cost) const {
+    for (size_t i = 0; i < _costLanes.size(); ++i) {
+        if (cost <= _costLanes[i].first) {
+            return _costLanes[i].second;
+        }
+    }
+    return string();
+}
+
 bool ThreadPoolManager::start() {
     bool ret = true;
     for (map<string, ThreadPool*>::iterator it = _pools.begin(); 
@@ -82,6 +176,10 @@ bool ThreadPoolManager::start() {
         bool success = it->second->start();
         ret = ret && success;
     }
+    for (auto &poolItem : _stealingPools) {
+        bool success = poolItem.second->start();
+        ret = ret && success;
+    }
     return ret;
 }
 
@@ -91,6 +189,9 @@ void ThreadPoolManager::stop(ThreadPool::STOP_TYPE stopType) {
     {
         it->second->stop(stopType);
     }
+    for (auto &poolItem : _stealingPools) {
+        poolItem.second->stop(stopType);
+    }
 }
 
 size_t ThreadPoolManager::getItemCount() const {
@@ -100,6 +201,9 @@ size_t ThreadPoolManager::getItemCount() const {
     {
         itemCount += it->second->getItemCount();
     }
+    for (auto &poolItem : _stealingPools) {
+        itemCount += poolItem.second->getItemCount();
+    }
     return itemCount;
 }
 
@@ -110,6 +214,9 @@ size_t ThreadPoolManager::getTotalThreadNum() const {
     {
         threadNum += it->second->getThreadNum();
     }
+    for (auto &poolItem : _stealingPools) {
+        threadNum += poolItem.second->getThreadNum();
+    }
     return threadNum;
 }
 
@@ -120,6 +227,9 @@ size_t ThreadPoolManager::getTotalQueueSize() const {
     {
         queueSize += it->second->getQueueSize();
     }
+    for (auto &poolItem : _stealingPools) {
+        queueSize += poolItem.second->getQueueSize();
+    }
     return queueSize;
 }
 
@@ -128,6 +238,9 @@ std::map<std::string, size_t> ThreadPoolManager::getActiveThreadCount() const{
     for (auto&& poolItem : _pools) {
         ret[poolItem.first] = poolItem.second->getActiveThreadNum();
     }
+    for (auto&& poolItem : _stealingPools) {
+        ret[poolItem.first] = poolItem.second->getActiveThreadNum();
+    }
     return ret;
 }
 
@@ -136,6 +249,22 @@ std::map<std::string, size_t> ThreadPoolManager::getTotalThreadCount() const{
     for (auto&& poolItem : _pools) {
         ret[poolItem.first] = poolItem.second->getThreadNum();
     }
+    for (auto&& poolItem : _stealingPools) {
+        ret[poolItem.first] = poolItem.second->getThreadNum();
+    }
+    return ret;
+}
+
+std::map<std::string, int64_t> ThreadPoolManager::getLaneQueueLatency() {
+    std::map<std::string, int64_t> ret;
+    std::map<WorkStealingThreadPool*, vector<int64_t> > poolLatency;
+    for (auto&& poolItem : _stealingPools) {
+        poolLatency[poolItem.second] = poolItem.second->getLaneQueueLatency();
+    }
+    for (auto&& laneItem : _lanes) {
+        const Lane &lane = laneItem.second;
+        ret[laneItem.first] = poolLatency[lane.first][lane.second];
+    }
     return ret;
 }
 
@@ -147,5 +276,16 @@ ThreadPool* ThreadPoolManager::getThreadPool(const string&poolName) {
     return it->second;
 }
 
+WorkStealingThreadPool* ThreadPoolManager::getWorkStealingThreadPool(
+        const string&laneName, size_t &lane)
+{
+    map<string, Lane>::iterator it = _lanes.find(laneName);
+    if (_lanes.end() == it) {
+        return NULL;
+    }
+    lane = it->second.second;
+    return it->second.first;
+}
+
 END_HA3_NAMESPACE(service);
 
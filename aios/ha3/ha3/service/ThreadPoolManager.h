@@ -5,7 +5,9 @@
 #include <ha3/isearch.h>
 #include <ha3/util/Log.h>
 #include <autil/ThreadPool.h>
+#include <ha3/service/WorkStealingThreadPool.h>
 #include <map>
+#include <vector>
 
 BEGIN_HA3_NAMESPACE(service);
 
@@ -23,20 +25,51 @@ public:
     bool addThreadPool(const std::string& threadPoolsConfigStr);
     bool addThreadPool(const std::string&poolName, 
                        int32_t queueSize, int32_t threadNum);
+    // task queues in one work stealing pool share its workers as lanes,
+    // earlier lanes are served first. a lane with maxCost takes requests
+    // without an explicit task queue whose estimated cost is at most maxCost,
+    // the default task queue can be a lane too
+    //format:  laneName[:maxCost][,laneName[:maxCost]]|queueSize|threadNum[;...]
+    //example: cheap_queue:20,search_queue|1000|24
+    bool addWorkStealingThreadPool(const std::string& threadPoolsConfigStr);
     bool start();
     void stop(autil::ThreadPool::STOP_TYPE stopType = 
               autil::ThreadPool::STOP_AFTER_QUEUE_EMPTY);
     autil::ThreadPool* getThreadPool(const std::string&poolName);
+    WorkStealingThreadPool* getWorkStealingThreadPool(const std::string&laneName,
+            size_t &lane);
+    bool hasTaskQueue(const std::string &name) const {
+        return isTaskQueueNameUsed(name);
+    }
+    bool hasCostLane() const {
+        return !_costLanes.empty();
+    }
+    // the lane with the smallest maxCost not below cost, empty if none
+    std::string getLaneByCost(double cost) const;
     size_t getItemCount() const;
     size_t getTotalThreadNum() const;
     size_t getTotalQueueSize() const;
     std::map<std::string, size_t> getActiveThreadCount() const;
     std::map<std::string, size_t> getTotalThreadCount() const;
+    // average queue latency (us) of each work stealing lane since last call
+    std::map<std::string, int64_t> getLaneQueueLatency();
     const std::map<std::string, autil::ThreadPool*> &getPools() const {
         return _pools;
     }
+private:
+    bool isTaskQueueNameUsed(const std::string &name) const {
+        return _pools.find(name) != _pools.end()
+            || _lanes.find(name) != _lanes.end();
+    }
+private:
+    typedef std::pair<WorkStealingThreadPool*, size_t> Lane;
 private:
     std::map<std::string, autil::ThreadPool*> _pools;
+    // keyed by the name of lane 0
+    std::map<std::string, WorkStealingThreadPool*> _stealingPools;
+    std::map<std::string, Lane> _lanes;
+    // (maxCost, laneName) in ascending maxCost
+    std::vector<std::pair<double, std::string> > _costLanes;
 private:
     friend class ThreadPoolManagerTest;
 private:
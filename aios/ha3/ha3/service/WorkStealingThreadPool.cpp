@@ -0,0 +1,202 @@
+#include <ha3/service/WorkStealingThreadPool.h>
+#include <autil/TimeUtility.h>
+
+using namespace std;
+using namespace autil;
+BEGIN_HA3_NAMESPACE(service);
+HA3_LOG_SETUP(service, WorkStealingThreadPool);
+
+namespace {
+// set in worker threads, items pushed by a worker go to its own queue
+__thread WorkStealingThreadPool *currentPool = NULL;
+__thread size_t currentWorkerId = 0;
+const int64_t IDLE_WAIT_TIME = 100 * 1000; // us
+}
+
+WorkStealingThreadPool::WorkStealingThreadPool(size_t threadNum,
+        size_t queueSize, size_t laneCount)
+    : _threadNum(threadNum)
+    , _queueSize(queueSize)
+    , _laneCount(laneCount > 0 ? laneCount : 1)
+    , _itemCount(0)
+    , _activeThreadNum(0)
+    , _pushCursor(0)
+    , _stealCount(0)
+    , _laneLatencySum(_laneCount)
+    , _laneLatencyCount(_laneCount)
+    , _running(false)
+    , _stopped(false)
+{
+    for (size_t i = 0; i < _laneCount; ++i) {
+        _laneLatencySum[i].store(0);
+        _laneLatencyCount[i].store(0);
+    }
+    for (size_t i = 0; i < _threadNum; ++i) {
+        RunQueue *runQueue = new RunQueue;
+        runQueue->lanes.resize(_laneCount);
+        _runQueues.push_back(runQueue);
+    }
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool() {
+    stop(ThreadPool::STOP_AND_CLEAR_QUEUE);
+    for (size_t i = 0; i < _runQueues.size(); ++i) {
+        delete _runQueues[i];
+    }
+    _runQueues.clear();
+}
+
+bool WorkStealingThreadPool::start() {
+    if (_running || _stopped) {
+        HA3_LOG(ERROR, "work stealing thread pool can only be started once");
+        return false;
+    }
+    if (_threadNum == 0) {
+        HA3_LOG(ERROR, "thread num of work stealing thread pool is zero");
+        return false;
+    }
+    _running = true;
+    for (size_t i = 0; i < _threadNum; ++i) {
+        ThreadPtr thread = Thread::createThread(
+                std::tr1::bind(&WorkStealingThreadPool::workerLoop, this, i));
+        if (!thread) {
+            HA3_LOG(ERROR, "create worker thread [%zu] failed", i);
+            stop(ThreadPool::STOP_AND_CLEAR_QUEUE);
+            return false;
+        }
+        _threads.push_back(thread);
+    }
+    return true;
+}
+
+void WorkStealingThreadPool::stop(ThreadPool::STOP_TYPE stopType) {
+    {
+        ScopedLock lock(_cond);
+        _stopped = true;
+        _cond.broadcast();
+    }
+    if (stopType != ThreadPool::STOP_AFTER_QUEUE_EMPTY) {
+        // running items are finished, the queued ones are dropped
+        dropQueuedItems();
+    }
+    for (size_t i = 0; i < _threads.size(); ++i) {
+        _threads[i]->join();
+    }
+    _threads.clear();
+    _running = false;
+    dropQueuedItems();
+}
+
+ThreadPool::ERROR_TYPE WorkStealingThreadPool::pushWorkItem(WorkItem *item, size_t lane) {
+    if (!item) {
+        return ThreadPool::ERROR_POOL_ITEM_IS_NULL;
+    }
+    if (!_running || _stopped) {
+        return ThreadPool::ERROR_POOL_HAS_STOP;
+    }
+    if (_itemCount.load(memory_order_relaxed) >= _queueSize) {
+        return ThreadPool::ERROR_POOL_QUEUE_FULL;
+    }
+    if (lane >= _laneCount) {
+        lane = _laneCount - 1;
+    }
+    size_t queueId = currentPool == this ? currentWorkerId
+                     : _pushCursor.fetch_add(1, memory_order_relaxed) % _threadNum;
+    RunQueue *runQueue = _runQueues[queueId];
+    // counted before queued, so a popped item is always counted
+    _itemCount.fetch_add(1, memory_order_release);
+    {
+        ScopedLock lock(runQueue->lock);
+        runQueue->lanes[lane].push_back(QueuedItem(item, TimeUtility::currentTime()));
+    }
+    ScopedLock lock(_cond);
+    _cond.signal();
+    return ThreadPool::ERROR_NONE;
+}
+
+vector<int64_t> WorkStealingThreadPool::getLaneQueueLatency() {
+    vector<int64_t> latency(_laneCount, 0);
+    for (size_t i = 0; i < _laneCount; ++i) {
+        int64_t count = _laneLatencyCount[i].exchange(0);
+        int64_t sum = _laneLatencySum[i].exchange(0);
+        if (count > 0) {
+            latency[i] = sum / count;
+        }
+    }
+    return latency;
+}
+
+void WorkStealingThreadPool::workerLoop(size_t workerId) {
+    currentPool = this;
+    currentWorkerId = workerId;
+    while (true) {
+        QueuedItem queuedItem;
+        size_t lane = 0;
+        if (popItem(workerId, queuedItem, lane)) {
+            int64_t latency = TimeUtility::currentTime() - queuedItem.enqueueTime;
+            _laneLatencySum[lane].fetch_add(latency, memory_order_relaxed);
+            _laneLatencyCount[lane].fetch_add(1, memory_order_relaxed);
+            _activeThreadNum.fetch_add(1, memory_order_relaxed);
+            queuedItem.item->process();
+            queuedItem.item->destroy();
+            _activeThreadNum.fetch_sub(1, memory_order_relaxed);
+            continue;
+        }
+        ScopedLock lock(_cond);
+        if (_itemCount.load(memory_order_acquire) > 0) {
+            continue;
+        }
+        if (_stopped) {
+            break;
+        }
+        _cond.wait(IDLE_WAIT_TIME);
+    }
+    currentPool = NULL;
+}
+
+bool WorkStealingThreadPool::popItem(size_t workerId, QueuedItem &queuedItem,
+                                     size_t &lane)
+{
+    for (lane = 0; lane < _laneCount; ++lane) {
+        if (popFromQueue(workerId, lane, queuedItem)) {
+            return true;
+        }
+        for (size_t i = 1; i < _threadNum; ++i) {
+            if (popFromQueue((workerId + i) % _threadNum, lane, queuedItem)) {
+                _stealCount.fetch_add(1, memory_order_relaxed);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// owner and thieves both take the oldest item, requests are served in
+// arrival order within a lane
+bool WorkStealingThreadPool::popFromQueue(size_t queueId, size_t lane,
+        QueuedItem &queuedItem)
+{
+    RunQueue *runQueue = _runQueues[queueId];
+    ScopedLock lock(runQueue->lock);
+    deque<QueuedItem> &items = runQueue->lanes[lane];
+    if (items.empty()) {
+        return false;
+    }
+    queuedItem = items.front();
+    items.pop_front();
+    _itemCount.fetch_sub(1, memory_order_relaxed);
+    return true;
+}
+
+void WorkStealingThreadPool::dropQueuedItems() {
+    for (size_t i = 0; i < _runQueues.size(); ++i) {
+        for (size_t lane = 0; lane < _laneCount; ++lane) {
+            QueuedItem queuedItem;
+            while (popFromQueue(i, lane, queuedItem)) {
+                queuedItem.item->drop();
+            }
+        }
+    }
+}
+
+END_HA3_NAMESPACE(service);
@@ -0,0 +1,103 @@
+#ifndef ISEARCH_WORKSTEALINGTHREADPOOL_H
+#define ISEARCH_WORKSTEALINGTHREADPOOL_H
+
+#include <ha3/common.h>
+#include <ha3/isearch.h>
+#include <ha3/util/Log.h>
+#include <autil/ThreadPool.h>
+#include <autil/WorkItem.h>
+#include <autil/Thread.h>
+#include <autil/Lock.h>
+#include <atomic>
+#include <deque>
+#include <vector>
+
+BEGIN_HA3_NAMESPACE(service);
+
+// every worker owns a run queue per lane, items are pushed to the queue of
+// the pushing worker or round robin from outside, and an idle worker steals
+// from the others, so a slow item only blocks the items queued behind it on
+// the same worker until someone else is free. lanes are in priority order:
+// a worker drains lane 0 of all queues (its own first) before lane 1.
+class WorkStealingThreadPool
+{
+private:
+    struct QueuedItem {
+        QueuedItem()
+            : item(NULL)
+            , enqueueTime(0)
+        {}
+        QueuedItem(autil::WorkItem *item_, int64_t enqueueTime_)
+            : item(item_)
+            , enqueueTime(enqueueTime_)
+        {}
+        autil::WorkItem *item;
+        int64_t enqueueTime;
+    };
+    struct RunQueue {
+        autil::ThreadMutex lock;
+        std::vector<std::deque<QueuedItem> > lanes;
+    };
+public:
+    WorkStealingThreadPool(size_t threadNum, size_t queueSize, size_t laneCount);
+    ~WorkStealingThreadPool();
+private:
+    WorkStealingThreadPool(const WorkStealingThreadPool &);
+    WorkStealingThreadPool& operator=(const WorkStealingThreadPool &);
+public:
+    bool start();
+    void stop(autil::ThreadPool::STOP_TYPE stopType =
+              autil::ThreadPool::STOP_AFTER_QUEUE_EMPTY);
+    // lane out of range is served as the last lane
+    autil::ThreadPool::ERROR_TYPE pushWorkItem(autil::WorkItem *item, size_t lane);
+    size_t getItemCount() const {
+        return _itemCount.load(std::memory_order_relaxed);
+    }
+    size_t getThreadNum() const {
+        return _threadNum;
+    }
+    size_t getQueueSize() const {
+        return _queueSize;
+    }
+    size_t getLaneCount() const {
+        return _laneCount;
+    }
+    size_t getActiveThreadNum() const {
+        return _activeThreadNum.load(std::memory_order_relaxed);
+    }
+    uint64_t getStealCount() const {
+        return _stealCount.load(std::memory_order_relaxed);
+    }
+    // average queue latency in us of each lane since the last call
+    std::vector<int64_t> getLaneQueueLatency();
+private:
+    void workerLoop(size_t workerId);
+    bool popItem(size_t workerId, QueuedItem &queuedItem, size_t &lane);
+    bool popFromQueue(size_t queueId, size_t lane, QueuedItem &queuedItem);
+    void dropQueuedItems();
+private:
+    size_t _threadNum;
+    size_t _queueSize;
+    size_t _laneCount;
+    std::vector<RunQueue*> _runQueues;
+    std::vector<autil::ThreadPtr> _threads;
+    autil::ThreadCond _cond;
+    std::atomic<size_t> _itemCount;
+    std::atomic<size_t> _activeThreadNum;
+    std::atomic<size_t> _pushCursor;
+    std::atomic<uint64_t> _stealCount;
+    std::vector<std::atomic<int64_t> > _laneLatencySum;
+    std::vector<std::atomic<int64_t> > _laneLatencyCount;
+    volatile bool _running;
+    volatile bool _stopped;
+private:
+    friend class WorkStealingThreadPoolTest;
+private:
+    HA3_LOG_DECLARE();
+};
+
+HA3_TYPEDEF_PTR(WorkStealingThreadPool);
+
+END_HA3_NAMESPACE(service);
+
+#endif //ISEARCH_WORKSTEALINGTHREADPOOL_H
@@ -438,6 +438,7 @@ TEST_F(QrsSearcherProcessDelegationTest, testSearchPhase1OneCluster) {
     ASSERT_TRUE(dele._hasReSearch == false);
     ASSERT_TRUE(resultPtr);
     ASSERT_TRUE(!resultPtr->hasError());
+    ASSERT_EQ("true", configClause->getKVPairValue(COLUMNAR_MATCHDOCS_KEY));
     Hits *hits = resultPtr->getHits();
     ASSERT_EQ((uint32_t)4, hits->size());
 
@@ -492,6 +493,7 @@ TEST_F(QrsSearcherProcessDelegationTest, testSearchPhase1MultiCluster) {
     ConfigClause *configClause = _requestPtr->getConfigClause();
     configClause->addClusterName("simple");
     configClause->addClusterName("simple2");
+    configClause->addKVPair(COLUMNAR_MATCHDOCS_KEY, "false");
 
     EXPECT_CALL(*_searchService, search(_, _))
         .Times(1)
@@ -502,6 +504,7 @@ TEST_F(QrsSearcherProcessDelegationTest, testSearchPhase1MultiCluster) {
     ResultPtr resultPtr = dele.search(_requestPtr);
     ASSERT_TRUE(dele._hasReSearch == false);
     ASSERT_TRUE(resultPtr);
+    ASSERT_EQ("false", configClause->getKVPairValue(COLUMNAR_MATCHDOCS_KEY));
     Hits *hits = resultPtr->getHits();
     ASSERT_EQ((uint32_t)5, hits->size());
 
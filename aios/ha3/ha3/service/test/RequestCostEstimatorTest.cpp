@@ -0,0 +1,41 @@
+#include <unittest/unittest.h>
+#include <ha3/test/test.h>
+#include <ha3/service/RequestCostEstimator.h>
+
+using namespace std;
+
+BEGIN_HA3_NAMESPACE(service);
+
+class RequestCostEstimatorTest : public TESTBASE {
+public:
+    void setUp();
+    void tearDown();
+protected:
+    HA3_LOG_DECLARE();
+};
+
+HA3_LOG_SETUP(service, RequestCostEstimatorTest);
+
+void RequestCostEstimatorTest::setUp() {
+}
+
+void RequestCostEstimatorTest::tearDown() {
+}
+
+TEST_F(RequestCostEstimatorTest, testEstimate) {
+    HA3_LOG(DEBUG, "Begin Test!");
+    ASSERT_DOUBLE_EQ(0, RequestCostEstimator::estimate(""));
+    ASSERT_DOUBLE_EQ(0, RequestCostEstimator::estimate("config=hit:10&&filter=a>1"));
+    ASSERT_DOUBLE_EQ(1, RequestCostEstimator::estimate("config=hit:10&&query=abc"));
+    ASSERT_DOUBLE_EQ(3, RequestCostEstimator::estimate(
+                    "query=title:a AND (b OR c)&&config=hit:10"));
+    ASSERT_DOUBLE_EQ(2, RequestCostEstimator::estimate("query=a ANDNOT b"));
+    // per doc cost: 1 + filter + 2 sort keys + 1 aggregate description
+    ASSERT_DOUBLE_EQ(10, RequestCostEstimator::estimate(
+                    "query=a AND b&&filter=price>10&&sort=-price;RANK"
+                    "&&aggregate=group_key:cat,agg_fun:count()"));
+    ASSERT_DOUBLE_EQ(4, RequestCostEstimator::estimate(
+                    "query=a AND b && sort = +price"));
+}
+
+END_HA3_NAMESPACE(service);
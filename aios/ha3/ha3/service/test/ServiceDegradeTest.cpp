@@ -127,4 +127,25 @@ TEST_F(ServiceDegradeTest, testUpdateRequest) {
     }
 }
 
+TEST_F(ServiceDegradeTest, testAdjustDegradeLevel) {
+    {
+        // no cost rule
+        config::ServiceDegradationConfig config;
+        ServiceDegrade serviceDegrade(config);
+        EXPECT_FALSE(serviceDegrade.needPredictCost());
+        EXPECT_FLOAT_EQ(0.5f, serviceDegrade.adjustDegradeLevel(0.5f, 1000));
+    }
+    {
+        config::ServiceDegradationConfig config;
+        config.cost.costThreshold = 100;
+        ServiceDegrade serviceDegrade(config);
+        EXPECT_TRUE(serviceDegrade.needPredictCost());
+        EXPECT_FLOAT_EQ(0.0f, serviceDegrade.adjustDegradeLevel(0.0f, 1000));
+        EXPECT_FLOAT_EQ(0.0f, serviceDegrade.adjustDegradeLevel(0.5f, 99));
+        EXPECT_FLOAT_EQ(0.5f, serviceDegrade.adjustDegradeLevel(0.5f, 100));
+        EXPECT_FLOAT_EQ(0.75f, serviceDegrade.adjustDegradeLevel(0.5f, 150));
+        EXPECT_FLOAT_EQ(1.0f, serviceDegrade.adjustDegradeLevel(0.5f, 1000));
+    }
+}
+
 END_HA3_NAMESPACE(service);
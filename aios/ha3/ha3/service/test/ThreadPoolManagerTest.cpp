@@ -153,4 +153,74 @@ TEST_F(ThreadPoolManagerTest, testPushWorkItem) {
     delete workItem3;
 }
 
+TEST_F(ThreadPoolManagerTest, testAddWorkStealingThreadPool) {
+    HA3_LOG(DEBUG, "Begin Test!");
+    {
+        ThreadPoolManager poolManager;
+        ASSERT_TRUE(poolManager.addThreadPool("search_queue|10|2"));
+        ASSERT_TRUE(poolManager.addWorkStealingThreadPool(
+                        "summary_queue, cheap_queue|100|4;slow_queue|20|1"));
+        ASSERT_EQ(size_t(2), poolManager._stealingPools.size());
+        ASSERT_EQ(size_t(3), poolManager._lanes.size());
+        ASSERT_EQ(size_t(7), poolManager.getTotalThreadNum());
+        ASSERT_EQ(size_t(130), poolManager.getTotalQueueSize());
+
+        size_t lane = 10;
+        WorkStealingThreadPool *pool =
+            poolManager.getWorkStealingThreadPool("cheap_queue", lane);
+        ASSERT_TRUE(pool);
+        ASSERT_EQ(size_t(1), lane);
+        ASSERT_EQ(pool, poolManager.getWorkStealingThreadPool("summary_queue", lane));
+        ASSERT_EQ(size_t(0), lane);
+        ASSERT_EQ(size_t(2), pool->getLaneCount());
+        ASSERT_FALSE(poolManager.getWorkStealingThreadPool("search_queue", lane));
+
+        map<string, size_t> threadCount = poolManager.getTotalThreadCount();
+        ASSERT_EQ(size_t(4), threadCount["summary_queue"]);
+        ASSERT_EQ(size_t(1), threadCount["slow_queue"]);
+        ASSERT_TRUE(poolManager.start());
+        map<string, int64_t> latency = poolManager.getLaneQueueLatency();
+        ASSERT_EQ(size_t(3), latency.size());
+        poolManager.stop();
+    }
+    {
+        ThreadPoolManager poolManager;
+        ASSERT_TRUE(poolManager.addThreadPool("search_queue|10|2"));
+        ASSERT_FALSE(poolManager.addWorkStealingThreadPool("a,search_queue|10|2"));
+        ASSERT_FALSE(poolManager.addWorkStealingThreadPool("a,a|10|2"));
+        ASSERT_FALSE(poolManager.addWorkStealingThreadPool("a|10"));
+        ASSERT_FALSE(poolManager.addWorkStealingThreadPool("a|x|2"));
+        ASSERT_TRUE(poolManager.addWorkStealingThreadPool("a|10|2"));
+        ASSERT_FALSE(poolManager.addThreadPool("a", 10, 2));
+        ASSERT_FALSE(poolManager.addWorkStealingThreadPool("b:x|10|2"));
+        ASSERT_FALSE(poolManager.addWorkStealingThreadPool("b:-1|10|2"));
+        ASSERT_FALSE(poolManager.addWorkStealingThreadPool(":10|10|2"));
+    }
+}
+
+TEST_F(ThreadPoolManagerTest, testCostLanes) {
+    HA3_LOG(DEBUG, "Begin Test!");
+    ThreadPoolManager poolManager;
+    ASSERT_FALSE(poolManager.hasCostLane());
+    ASSERT_TRUE(poolManager.addWorkStealingThreadPool(
+                    "cheap_queue:20, " + DEFAULT_TASK_QUEUE_NAME + "|100|4;"
+                    "medium_queue : 100|20|1"));
+    ASSERT_TRUE(poolManager.hasCostLane());
+    ASSERT_TRUE(poolManager.hasTaskQueue(DEFAULT_TASK_QUEUE_NAME));
+    ASSERT_TRUE(poolManager.hasTaskQueue("cheap_queue"));
+    ASSERT_TRUE(poolManager.hasTaskQueue("medium_queue"));
+    ASSERT_FALSE(poolManager.getThreadPool(DEFAULT_TASK_QUEUE_NAME));
+    size_t lane = 10;
+    ASSERT_TRUE(poolManager.getWorkStealingThreadPool(DEFAULT_TASK_QUEUE_NAME, lane));
+    ASSERT_EQ(size_t(1), lane);
+    // the default queue is already a lane
+    ASSERT_FALSE(poolManager.addThreadPool(DEFAULT_TASK_QUEUE_NAME, 10, 2));
+
+    ASSERT_EQ("cheap_queue", poolManager.getLaneByCost(0));
+    ASSERT_EQ("cheap_queue", poolManager.getLaneByCost(20));
+    ASSERT_EQ("medium_queue", poolManager.getLaneByCost(20.5));
+    ASSERT_EQ("medium_queue", poolManager.getLaneByCost(100));
+    ASSERT_EQ("", poolManager.getLaneByCost(101));
+}
+
 END_HA3_NAMESPACE(service);
@@ -0,0 +1,195 @@
+#include<unittest/unittest.h>
+#include <ha3/common.h>
+#include <ha3/isearch.h>
+#include <ha3/util/Log.h>
+#include <ha3/service/WorkStealingThreadPool.h>
+#include <autil/Lock.h>
+#include <autil/TimeUtility.h>
+#include <vector>
+
+using namespace std;
+using namespace autil;
+BEGIN_HA3_NAMESPACE(service);
+
+class WorkStealingThreadPoolTest : public TESTBASE {
+public:
+    void setUp();
+    void tearDown();
+protected:
+    HA3_LOG_DECLARE();
+};
+
+HA3_LOG_SETUP(service, WorkStealingThreadPoolTest);
+
+namespace {
+
+class RecordWorkItem : public WorkItem
+{
+public:
+    RecordWorkItem(int32_t id, ThreadMutex *lock, vector<int32_t> *processed,
+                   vector<int32_t> *dropped)
+        : _id(id)
+        , _lock(lock)
+        , _processed(processed)
+        , _dropped(dropped)
+    {}
+public:
+    void process() {
+        ScopedLock lock(*_lock);
+        _processed->push_back(_id);
+    }
+    void destroy() {
+        delete this;
+    }
+    void drop() {
+        {
+            ScopedLock lock(*_lock);
+            _dropped->push_back(_id);
+        }
+        destroy();
+    }
+private:
+    int32_t _id;
+    ThreadMutex *_lock;
+    vector<int32_t> *_processed;
+    vector<int32_t> *_dropped;
+};
+
+class BlockWorkItem : public WorkItem
+{
+public:
+    BlockWorkItem(volatile bool *started, volatile bool *released)
+        : _started(started)
+        , _released(released)
+    {}
+public:
+    void process() {
+        *_started = true;
+        while (!*_released) {
+            usleep(1000);
+        }
+    }
+    void destroy() {
+        delete this;
+    }
+    void drop() {
+        destroy();
+    }
+private:
+    volatile bool *_started;
+    volatile bool *_released;
+};
+
+void waitUntil(volatile bool *flag) {
+    while (!*flag) {
+        usleep(1000);
+    }
+}
+
+}
+
+void WorkStealingThreadPoolTest::setUp() {
+}
+
+void WorkStealingThreadPoolTest::tearDown() {
+}
+
+TEST_F(WorkStealingThreadPoolTest, testProcessAllItems) {
+    ThreadMutex lock;
+    vector<int32_t> processed;
+    vector<int32_t> dropped;
+    {
+        WorkStealingThreadPool pool(4, 1000, 2);
+        ASSERT_TRUE(pool.start());
+        for (int32_t i = 0; i < 200; ++i) {
+            ASSERT_EQ(ThreadPool::ERROR_NONE, pool.pushWorkItem(
+                            new RecordWorkItem(i, &lock, &processed, &dropped), i % 3));
+        }
+        pool.stop();
+        ASSERT_EQ(size_t(0), pool.getItemCount());
+        ASSERT_EQ(ThreadPool::ERROR_POOL_HAS_STOP, pool.pushWorkItem(
+                        new RecordWorkItem(0, &lock, &processed, &dropped), 0));
+    }
+    ASSERT_EQ(size_t(200), processed.size());
+    ASSERT_TRUE(dropped.empty());
+}
+
+TEST_F(WorkStealingThreadPoolTest, testLanePriority) {
+    ThreadMutex lock;
+    vector<int32_t> processed;
+    vector<int32_t> dropped;
+    volatile bool started = false;
+    volatile bool released = false;
+    WorkStealingThreadPool pool(1, 100, 2);
+    ASSERT_TRUE(pool.start());
+    ASSERT_EQ(ThreadPool::ERROR_NONE, pool.pushWorkItem(
+                    new BlockWorkItem(&started, &released), 1));
+    waitUntil(&started);
+    pool.pushWorkItem(new RecordWorkItem(10, &lock, &processed, &dropped), 1);
+    pool.pushWorkItem(new RecordWorkItem(11, &lock, &processed, &dropped), 1);
+    pool.pushWorkItem(new RecordWorkItem(0, &lock, &processed, &dropped), 0);
+    pool.pushWorkItem(new RecordWorkItem(1, &lock, &processed, &dropped), 0);
+    released = true;
+    pool.stop();
+
+    vector<int32_t> expected = {0, 1, 10, 11};
+    ASSERT_EQ(expected, processed);
+    vector<int64_t> latency = pool.getLaneQueueLatency();
+    ASSERT_EQ(size_t(2), latency.size());
+    ASSERT_TRUE(latency[0] > 0);
+    ASSERT_TRUE(latency[1] > 0);
+}
+
+TEST_F(WorkStealingThreadPoolTest, testStealFromBlockedWorker) {
+    ThreadMutex lock;
+    vector<int32_t> processed;
+    vector<int32_t> dropped;
+    volatile bool started = false;
+    volatile bool released = false;
+    WorkStealingThreadPool pool(2, 100, 1);
+    ASSERT_TRUE(pool.start());
+    ASSERT_EQ(ThreadPool::ERROR_NONE, pool.pushWorkItem(
+                    new BlockWorkItem(&started, &released), 0));
+    waitUntil(&started);
+    // half of them are queued to the blocked worker
+    for (int32_t i = 0; i < 10; ++i) {
+        pool.pushWorkItem(new RecordWorkItem(i, &lock, &processed, &dropped), 0);
+    }
+    int64_t beginTime = TimeUtility::currentTime();
+    while (pool.getItemCount() > 0
+           && TimeUtility::currentTime() - beginTime < 10 * 1000 * 1000)
+    {
+        usleep(1000);
+    }
+    ASSERT_EQ(size_t(0), pool.getItemCount());
+    ASSERT_TRUE(pool.getStealCount() > 0);
+    released = true;
+    pool.stop();
+    ASSERT_EQ(size_t(10), processed.size());
+}
+
+TEST_F(WorkStealingThreadPoolTest, testQueueFullAndClear) {
+    ThreadMutex lock;
+    vector<int32_t> processed;
+    vector<int32_t> dropped;
+    volatile bool started = false;
+    volatile bool released = false;
+    WorkStealingThreadPool pool(1, 2, 2);
+    ASSERT_TRUE(pool.start());
+    ASSERT_EQ(ThreadPool::ERROR_POOL_ITEM_IS_NULL, pool.pushWorkItem(NULL, 0));
+    ASSERT_EQ(ThreadPool::ERROR_NONE, pool.pushWorkItem(
+                    new BlockWorkItem(&started, &released), 0));
+    waitUntil(&started);
+    ASSERT_EQ(ThreadPool::ERROR_NONE, pool.pushWorkItem(
+                    new RecordWorkItem(0, &lock, &processed, &dropped), 0));
+    ASSERT_EQ(ThreadPool::ERROR_NONE, pool.pushWorkItem(
+                    new RecordWorkItem(1, &lock, &processed, &dropped), 5));
+    RecordWorkItem *item = new RecordWorkItem(2, &lock, &processed, &dropped);
+    ASSERT_EQ(ThreadPool::ERROR_POOL_QUEUE_FULL, pool.pushWorkItem(item, 0));
+    delete item;
+    released = true;
+    pool.stop(ThreadPool::STOP_AND_CLEAR_QUEUE);
+    ASSERT_EQ(size_t(2), processed.size() + dropped.size());
+}
+
+END_HA3_NAMESPACE(service);
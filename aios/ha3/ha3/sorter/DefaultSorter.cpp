@@ -2,6 +2,7 @@
 #include <autil/StringTokenizer.h>
 #include <ha3/queryparser/RequestSymbolDefine.h>
 #include <ha3/rank/ReferenceComparator.h>
+#include <ha3/util/LoserTree.h>
 
 using namespace std;
 using namespace autil;
@@ -21,6 +22,7 @@ DefaultSorter::DefaultSorter()
     , _type(DS_UNKNOWN)
     , _cmp(NULL)
     , _needSort(true)
+    , _maxMergeRunCount(1)
 { 
 
 }
@@ -72,6 +74,9 @@ bool DefaultSorter::beginSort(suez::turing::SorterProvider *suezProvider) {
     }
 
     initComparator(provider, sortExpressions);
+    if (provider->getLocation() != SL_SEARCHER) {
+        _maxMergeRunCount = std::max(provider->getResultSourceNum(), 1u);
+    }
     DistinctClause *distinctClause = request->getDistinctClause();
 
     if (distinctClause) {
@@ -103,10 +108,12 @@ void DefaultSorter::sort(suez::turing::SortParam &sortParam) {
     }
     PoolVector<matchdoc::MatchDoc> &matchDocs = sortParam.matchDocs;
     if (_type == DS_NORMAL_SORT) {
-        MatchDocComp matchDocCmp(_cmp);
         uint32_t needSortCount = min(sortParam.requiredTopK, (uint32_t)matchDocs.size());
-        std::partial_sort(matchDocs.begin(), matchDocs.begin() + needSortCount, 
-                          matchDocs.end(), matchDocCmp);
+        if (!mergeSortedRuns(matchDocs, needSortCount)) {
+            MatchDocComp matchDocCmp(_cmp);
+            std::partial_sort(matchDocs.begin(), matchDocs.begin() + needSortCount,
+                              matchDocs.end(), matchDocCmp);
+        }
     } else if (_type == DS_DISTINCT) {
         SortExpression *sortExpr = _distinctCollectorParam.sortExpr;
         DistinctHitCollector collector(sortParam.requiredTopK,
@@ -128,6 +135,50 @@ void DefaultSorter::sort(suez::turing::SortParam &sortParam) {
     }
 }
 
+// results from each source are already sorted by the same comparator and
+// only concatenated before sort, merge the runs lazily instead of sorting
+bool DefaultSorter::mergeSortedRuns(PoolVector<matchdoc::MatchDoc> &matchDocs,
+                                    uint32_t needSortCount)
+{
+    size_t docCount = matchDocs.size();
+    if (docCount == 0) {
+        return true;
+    }
+    MatchDocComp matchDocCmp(_cmp);
+    vector<size_t> runBegins(1, 0);
+    for (size_t i = 1; i < docCount; ++i) {
+        if (matchDocCmp(matchDocs[i], matchDocs[i - 1])) {
+            if (runBegins.size() >= _maxMergeRunCount) {
+                return false;
+            }
+            runBegins.push_back(i);
+        }
+    }
+    if (runBegins.size() == 1) {
+        return true;
+    }
+    vector<matchdoc::MatchDoc> inputDocs(matchDocs.begin(), matchDocs.end());
+    runBegins.push_back(docCount);
+    util::LoserTree<matchdoc::MatchDoc, MatchDocComp> loserTree(matchDocCmp);
+    for (size_t i = 0; i + 1 < runBegins.size(); ++i) {
+        loserTree.addRun(&inputDocs[runBegins[i]], &inputDocs[0] + runBegins[i + 1]);
+    }
+    loserTree.init();
+    size_t cursor = 0;
+    for (; cursor < needSortCount; ++cursor) {
+        matchDocs[cursor] = loserTree.top();
+        loserTree.pop();
+    }
+    // keep docs not output after top k, caller may need to release them
+    for (size_t i = 0; i < loserTree.getRunCount(); ++i) {
+        for (auto it = loserTree.getRunCursor(i); it != loserTree.getRunEnd(i); ++it) {
+            matchDocs[cursor++] = *it;
+        }
+    }
+    assert(cursor == docCount);
+    return true;
+}
+
 void DefaultSorter::initComparator(SorterProvider *provider, 
                                    const SortExpressionVector &sortExpressions) 
 {
@@ -53,6 +53,8 @@ private:
     bool needScoreInSort(const common::Request *request) const;
     bool validateSortInfo(const common::Request *request) const;
     bool needSort(HA3_NS(sorter)::SorterProvider *provider) const;
+    bool mergeSortedRuns(autil::mem_pool::PoolVector<matchdoc::MatchDoc> &matchDocs,
+                         uint32_t needSortCount);
 
 private:
     struct DistincCollectorParam {
@@ -68,6 +70,7 @@ private:
     rank::ComboComparator *_cmp;
     DistincCollectorParam _distinctCollectorParam;
     bool _needSort;
+    uint32_t _maxMergeRunCount;
 
 private:
     friend class DefaultSorterTest;
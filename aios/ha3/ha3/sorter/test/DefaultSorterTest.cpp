@@ -365,6 +365,56 @@ TEST_F(DefaultSorterTest, testBeginSortWithComboAndRankExpr) {
     release(*sorterResource);
 }
 
+TEST_F(DefaultSorterTest, testSortMergeSortedRunsInQrs) {
+    string query = "config=cluster:cluster1,rank_size:10&&query=phrase:with";
+    RequestPtr requestPtr = RequestCreator::prepareRequest(query);
+    ASSERT_TRUE(requestPtr);
+    SorterProviderPtr sorterProviderPtr = prepareSorterProvider(
+            requestPtr.get(), SL_QRS, 3);
+    DefaultSorter sorter;
+    ASSERT_TRUE(sorter.beginSort(sorterProviderPtr.get()));
+    ASSERT_EQ((uint32_t)3, sorter._maxMergeRunCount);
+
+    SorterResource *sorterResource = sorterProviderPtr->getInnerSorterResource();
+    RankAttributeExpression *rankExpression =
+        dynamic_cast<RankAttributeExpression*>(sorterResource->scoreExpression);
+    matchdoc::Reference<score_t> *scoreRef = rankExpression->getReference();
+    auto allocator = sorterResource->matchDocAllocator;
+    auto prepareSortParam = [&](const vector<score_t> &scores, SortParam &sortParam) {
+        for (size_t i = 0; i < scores.size(); i++) {
+            matchdoc::MatchDoc matchDoc = allocator->allocate(i);
+            scoreRef->set(matchDoc, scores[i]);
+            sortParam.matchDocs.push_back(matchDoc);
+        }
+    };
+    auto checkSortParam = [&](const vector<score_t> &expectTopK, SortParam &sortParam) {
+        ASSERT_EQ((size_t)9, sortParam.matchDocs.size());
+        for (size_t i = 0; i < expectTopK.size(); i++) {
+            ASSERT_EQ(expectTopK[i], scoreRef->get(sortParam.matchDocs[i])) << i;
+        }
+        for (auto matchDoc : sortParam.matchDocs) {
+            allocator->deallocate(matchDoc);
+        }
+    };
+    {
+        // three sorted runs from three searchers
+        SortParam sortParam(_pool);
+        sortParam.requiredTopK = 5;
+        prepareSortParam({9, 6, 3, 8, 5, 2, 7, 4, 1}, sortParam);
+        sorter.sort(sortParam);
+        ASSERT_NO_FATAL_FAILURE(checkSortParam({9, 8, 7, 6, 5}, sortParam));
+    }
+    {
+        // more runs than sources, fall back to partial sort
+        SortParam sortParam(_pool);
+        sortParam.requiredTopK = 5;
+        prepareSortParam({9, 1, 8, 2, 7, 3, 6, 4, 5}, sortParam);
+        sorter.sort(sortParam);
+        ASSERT_NO_FATAL_FAILURE(checkSortParam({9, 8, 7, 6, 5}, sortParam));
+    }
+    release(*sorterResource);
+}
+
 void DefaultSorterTest::innerTestValidateSortInfo(const string &requestStr, bool valid) {
     RequestPtr requestPtr = RequestCreator::prepareRequest(requestStr);
     ASSERT_TRUE(requestPtr);
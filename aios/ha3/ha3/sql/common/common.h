@@ -146,6 +146,7 @@ constexpr size_t DEFAULT_AGG_MEMORY_LIMIT = 512 * 1024 * 1024; // 512M
 constexpr uint32_t DEFAULT_BATCH_COUNT = 8 * 1024;
 constexpr uint32_t DEFAULT_BATCH_SIZE = 4 * 1024 * 1024; //4MB
 constexpr size_t NEED_COMPACT_MEM_SIZE = 4 * 1024 * 1024; // 4MB
+constexpr uint32_t MAX_SCAN_THREAD_NUM = 32;
 
 // pool size
 constexpr size_t MAX_SQL_POOL_SIZE = 512 * 1024 * 1024; // 512MB
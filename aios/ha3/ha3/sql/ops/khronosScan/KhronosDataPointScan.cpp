@@ -21,6 +21,9 @@ KhronosDataPointScan::KhronosDataPointScan(const KhronosScanHints &scanHints,
         KhronosScanAccessLog *accessLog)
     : KhronosDataScan(scanHints, accessLog)
     , _bufOffset(0)
+    , _downsampleOffset(0)
+    , _downsampleSeriesHash(0)
+    , _downsampleEof(false)
 {
 }
 
@@ -35,6 +38,17 @@ bool KhronosDataPointScan::initImpl(const ScanInitParam &param) {
     POOL_NEW_CLASS_ON_SHARED_PTR(
             _kernelPool.get(), _lineSegmentBuffer,
             LineSegmentBuffer, KHR_DEFAULT_BUFFER_COUNT, 1, _kernelPool.get());
+    if (_scanHints.downsampleInterval > 0) {
+        auto type = KhronosDownsampler::parseAggregatorType(_scanHints.downsampleAggregator);
+        if (type == KhronosDownsampler::DAT_UNKNOWN) {
+            SQL_LOG(ERROR, "unknown downsample aggregator [%s]",
+                    _scanHints.downsampleAggregator.c_str());
+            return false;
+        }
+        _downsampler.reset(new KhronosDownsampler(type, _scanHints.downsampleInterval));
+        SQL_LOG(TRACE2, "data point scan downsample: interval=[%ld], aggregator=[%s]",
+                _scanHints.downsampleInterval, _scanHints.downsampleAggregator.c_str());
+    }
     return true;
 }
 
@@ -134,31 +148,69 @@ bool KhronosDataPointScan::doBatchScanImpl(TablePtr &table, bool &eof) {
     }
 
     size_t batchSize = getBatchSize(table);
-    uint64_t lastHash = 0;
+    bool ret = _downsampler ?
+               fillDownsampledRows(table, tsColumnData, watermarkColumnData,
+                                   valueColumnData, tagkColumnPackMap, batchSize, eof) :
+               fillRawRows(table, tsColumnData, watermarkColumnData,
+                           valueColumnData, tagkColumnPackMap, batchSize, eof);
+    if (!ret) {
+        return false;
+    }
+    uint64_t afterSeek = TimeUtility::currentTime();
+    incSeekTime(afterSeek - _batchScanBeginTime);
+    if (!_calcTable->projectTable(table)) {
+        SQL_LOG(ERROR, "project table failed");
+        return false;
+    }
+    uint64_t afterEvaluate = TimeUtility::currentTime();
+    incEvaluateTime(afterEvaluate - afterSeek);
+    _seekCount = table->getRowCount();
+    eof |= _limit == 0;
+    return true;
+}
+
+bool KhronosDataPointScan::fetchLineSegment(bool &finished) {
+    finished = false;
+    if (unlikely(_timeoutTerminator && _timeoutTerminator->checkTimeout())) {
+        ON_KHRONOS_SCAN_TERMINATOR_TIMEOUT("run timeout");
+        reportSimpleQps("dataScanTimeoutQps");
+        return false;
+    }
     auto &lineSegmentBuffer = *_lineSegmentBuffer;
     int32_t errorCode = 0;
+    size_t nums = _rowIter->Next(lineSegmentBuffer, errorCode);
+    _khronosDataScanInfo.set_callnextcount(_khronosDataScanInfo.callnextcount() + 1);
+    if (errorCode != 0) {
+        SQL_LOG(ERROR, "caught IO exception, errorMsg=[%s]", _rowIter->GetLastError().c_str());
+        return false;
+    }
+    if (nums == 0) {
+        finished = true;
+        return true;
+    }
+    _khronosDataScanInfo.set_pointscancount(
+            _khronosDataScanInfo.pointscancount() + lineSegmentBuffer.size());
+    _bufOffset = 0;
+    return true;
+}
+
+bool KhronosDataPointScan::fillRawRows(TablePtr &table,
+                                       ColumnData<KHR_TS_TYPE> *tsColumnData,
+                                       ColumnData<KHR_WM_TYPE> *watermarkColumnData,
+                                       ColumnData<KHR_VALUE_TYPE> *valueColumnData,
+                                       TagkColumnPackMap &tagkColumnPackMap,
+                                       size_t batchSize, bool &eof)
+{
+    uint64_t lastHash = 0;
+    auto &lineSegmentBuffer = *_lineSegmentBuffer;
     while (batchSize > 0 && _limit > 0) {
         if (unlikely(lineSegmentBuffer.size() == _bufOffset)) {
-            if (unlikely(_timeoutTerminator && _timeoutTerminator->checkTimeout())) {
-                ON_KHRONOS_SCAN_TERMINATOR_TIMEOUT("run timeout");
-                reportSimpleQps("dataScanTimeoutQps");
+            if (!fetchLineSegment(eof)) {
                 return false;
             }
-
-	    size_t nums = _rowIter->Next(lineSegmentBuffer, errorCode);
-            _khronosDataScanInfo.set_callnextcount(_khronosDataScanInfo.callnextcount() + 1);
-            if (errorCode != 0)
-	    {
-	        SQL_LOG(ERROR, "caught IO exception, errorMsg=[%s]", _rowIter->GetLastError().c_str());
-		return false;
-            }
-            if (nums == 0) {
-                eof = true;
+            if (eof) {
                 break;
             }
-            _khronosDataScanInfo.set_pointscancount(
-                _khronosDataScanInfo.pointscancount() + lineSegmentBuffer.size());
-            _bufOffset = 0;
         }
         uint64_t curHash = lineSegmentBuffer.getSeriesHash();
         if (curHash != lastHash) {
@@ -190,16 +242,90 @@ bool KhronosDataPointScan::doBatchScanImpl(TablePtr &table, bool &eof) {
             }
         }
     }
-    uint64_t afterSeek = TimeUtility::currentTime();
-    incSeekTime(afterSeek - _batchScanBeginTime);
-    if (!_calcTable->projectTable(table)) {
-        SQL_LOG(ERROR, "project table failed");
-        return false;
+    return true;
+}
+
+bool KhronosDataPointScan::fillDownsampledRows(TablePtr &table,
+        ColumnData<KHR_TS_TYPE> *tsColumnData,
+        ColumnData<KHR_WM_TYPE> *watermarkColumnData,
+        ColumnData<KHR_VALUE_TYPE> *valueColumnData,
+        TagkColumnPackMap &tagkColumnPackMap,
+        size_t batchSize, bool &eof)
+{
+    assert(_downsampler != nullptr);
+    // tagk value cache is rebuilt in each batch
+    uint64_t cachedHash = 0;
+    auto &lineSegmentBuffer = *_lineSegmentBuffer;
+    while (batchSize > 0 && _limit > 0) {
+        // output finished buckets first, they always belong to _downsampleSeriesKey
+        if (_downsampleOffset < _downsampleBuckets.size()) {
+            if (cachedHash != _downsampleSeriesHash) {
+                cachedHash = _downsampleSeriesHash;
+                if (!updateTagkColumnValueCache(_downsampleSeriesKey, tagkColumnPackMap, true)) {
+                    SQL_LOG(ERROR, "update tagk column value cache failed");
+                    return false;
+                }
+            }
+            for (; batchSize > 0 && _limit > 0 && _downsampleOffset < _downsampleBuckets.size();
+                 --batchSize, --_limit, ++_downsampleOffset)
+            {
+                auto &bucket = _downsampleBuckets[_downsampleOffset];
+                Row tableRow = table->allocateRow();
+                if (tsColumnData != nullptr) {
+                    tsColumnData->set(tableRow, bucket.timestamp);
+                }
+                if (watermarkColumnData != nullptr) {
+                    watermarkColumnData->set(tableRow, _watermark);
+                }
+                assert(valueColumnData != nullptr);
+                valueColumnData->set(tableRow, bucket.value);
+
+                for (auto &pair : tagkColumnPackMap) {
+                    pair.second.columnData->set(tableRow, pair.second.columnValueCache);
+                }
+            }
+            continue;
+        }
+        _downsampleBuckets.clear();
+        _downsampleOffset = 0;
+        if (_downsampleEof) {
+            eof = true;
+            break;
+        }
+        if (lineSegmentBuffer.size() == _bufOffset) {
+            bool finished = false;
+            if (!fetchLineSegment(finished)) {
+                return false;
+            }
+            if (finished) {
+                _downsampler->flush(_downsampleBuckets);
+                _downsampleEof = true;
+                continue;
+            }
+        }
+        uint64_t curHash = lineSegmentBuffer.getSeriesHash();
+        if (curHash != _downsampleSeriesHash) {
+            // output the last bucket of previous series before switching tags
+            _downsampler->flush(_downsampleBuckets);
+            if (!_downsampleBuckets.empty()) {
+                continue;
+            }
+            _downsampleSeriesHash = curHash;
+            _downsampleSeriesKey = lineSegmentBuffer.getSeriesKey();
+        }
+        // decode the segment into contiguous arrays for vectorized reduction
+        size_t count = lineSegmentBuffer.size() - _bufOffset;
+        _tsBuffer.resize(count);
+        _valueBuffer.resize(count);
+        for (size_t i = 0; i < count; ++i) {
+            auto &dataPoint = lineSegmentBuffer[_bufOffset + i];
+            _tsBuffer[i] = dataPoint.timestamp;
+            _valueBuffer[i] = dataPoint.values[0];
+        }
+        _bufOffset = lineSegmentBuffer.size();
+        _downsampler->aggregate(_tsBuffer.data(), _valueBuffer.data(), count,
+                                _downsampleBuckets);
     }
-    uint64_t afterEvaluate = TimeUtility::currentTime();
-    incEvaluateTime(afterEvaluate - afterSeek);
-    _seekCount = table->getRowCount();
-    eof |= _limit == 0;
     return true;
 }
 
@@ -2,6 +2,7 @@
 
 #include <ha3/sql/ops/khronosScan/KhronosDataScan.h>
 #include <ha3/sql/ops/khronosScan/KhronosCommon.h>
+#include <ha3/sql/ops/khronosScan/KhronosDownsampler.h>
 #include <khronos_table_interface/CommonDefine.h>
 #include <khronos_table_interface/LineSegmentBuffer.h>
 
@@ -25,6 +26,20 @@ private:
                             ColumnData<KHR_VALUE_TYPE> *&valueColumnData,
                             TagkColumnPackMap &tagkColumnPackMap);
     size_t getBatchSize(TablePtr &table);
+    bool fetchLineSegment(bool &finished);
+    bool fillRawRows(TablePtr &table,
+                     ColumnData<KHR_TS_TYPE> *tsColumnData,
+                     ColumnData<KHR_WM_TYPE> *watermarkColumnData,
+                     ColumnData<KHR_VALUE_TYPE> *valueColumnData,
+                     TagkColumnPackMap &tagkColumnPackMap,
+                     size_t batchSize, bool &eof);
+    // push time bucket downsampling into scan, only one row per bucket is output
+    bool fillDownsampledRows(TablePtr &table,
+                             ColumnData<KHR_TS_TYPE> *tsColumnData,
+                             ColumnData<KHR_WM_TYPE> *watermarkColumnData,
+                             ColumnData<KHR_VALUE_TYPE> *valueColumnData,
+                             TagkColumnPackMap &tagkColumnPackMap,
+                             size_t batchSize, bool &eof);
 protected:
     bool initImpl(const ScanInitParam &param) override;
 private:
@@ -35,6 +50,15 @@ private:
     std::string _watermarkColName;
     khronos::LineSegmentBufferPtr _lineSegmentBuffer;
     size_t _bufOffset;
+    // downsample
+    KhronosDownsamplerPtr _downsampler;
+    std::vector<KhronosDownsampler::Bucket> _downsampleBuckets;
+    size_t _downsampleOffset;
+    uint64_t _downsampleSeriesHash;
+    std::string _downsampleSeriesKey;
+    bool _downsampleEof;
+    std::vector<KHR_TS_TYPE> _tsBuffer;
+    std::vector<KHR_VALUE_TYPE> _valueBuffer;
 private:
     HA3_LOG_DECLARE();
 };
@@ -0,0 +1,236 @@
+#include <ha3/sql/ops/khronosScan/KhronosDownsampler.h>
+#include <algorithm>
+#ifdef __AVX__
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+BEGIN_HA3_NAMESPACE(sql);
+HA3_LOG_SETUP(sql, KhronosDownsampler);
+
+namespace {
+
+// scalar fallback, four independent accumulators let the compiler vectorize
+template <typename T>
+T simdSum(const T *values, size_t count) {
+    T acc[4] = {0, 0, 0, 0};
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        acc[0] += values[i];
+        acc[1] += values[i + 1];
+        acc[2] += values[i + 2];
+        acc[3] += values[i + 3];
+    }
+    T ret = (acc[0] + acc[1]) + (acc[2] + acc[3]);
+    for (; i < count; ++i) {
+        ret += values[i];
+    }
+    return ret;
+}
+
+template <bool IsMin, typename T>
+inline T pick(T a, T b) {
+    return IsMin ? std::min(a, b) : std::max(a, b);
+}
+
+template <bool IsMin, typename T>
+T simdMinMax(const T *values, size_t count) {
+    assert(count > 0);
+    T acc[4] = {values[0], values[0], values[0], values[0]};
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        acc[0] = pick<IsMin>(acc[0], values[i]);
+        acc[1] = pick<IsMin>(acc[1], values[i + 1]);
+        acc[2] = pick<IsMin>(acc[2], values[i + 2]);
+        acc[3] = pick<IsMin>(acc[3], values[i + 3]);
+    }
+    T ret = pick<IsMin>(pick<IsMin>(acc[0], acc[1]), pick<IsMin>(acc[2], acc[3]));
+    for (; i < count; ++i) {
+        ret = pick<IsMin>(ret, values[i]);
+    }
+    return ret;
+}
+
+#ifdef __AVX__
+template <>
+double simdSum<double>(const double *values, size_t count) {
+    __m256d acc0 = _mm256_setzero_pd();
+    __m256d acc1 = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        acc0 = _mm256_add_pd(acc0, _mm256_loadu_pd(values + i));
+        acc1 = _mm256_add_pd(acc1, _mm256_loadu_pd(values + i + 4));
+    }
+    double lanes[4];
+    _mm256_storeu_pd(lanes, _mm256_add_pd(acc0, acc1));
+    double ret = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    for (; i < count; ++i) {
+        ret += values[i];
+    }
+    return ret;
+}
+
+template <bool IsMin>
+double simdMinMaxPd(const double *values, size_t count) {
+    assert(count > 0);
+    if (count < 4) {
+        double ret = values[0];
+        for (size_t i = 1; i < count; ++i) {
+            ret = pick<IsMin>(ret, values[i]);
+        }
+        return ret;
+    }
+    __m256d acc = _mm256_loadu_pd(values);
+    size_t i = 4;
+    for (; i + 4 <= count; i += 4) {
+        __m256d v = _mm256_loadu_pd(values + i);
+        acc = IsMin ? _mm256_min_pd(acc, v) : _mm256_max_pd(acc, v);
+    }
+    double lanes[4];
+    _mm256_storeu_pd(lanes, acc);
+    double ret = pick<IsMin>(pick<IsMin>(lanes[0], lanes[1]), pick<IsMin>(lanes[2], lanes[3]));
+    for (; i < count; ++i) {
+        ret = pick<IsMin>(ret, values[i]);
+    }
+    return ret;
+}
+
+template <>
+double simdMinMax<true, double>(const double *values, size_t count) {
+    return simdMinMaxPd<true>(values, count);
+}
+
+template <>
+double simdMinMax<false, double>(const double *values, size_t count) {
+    return simdMinMaxPd<false>(values, count);
+}
+#endif
+
+}
+
+KhronosDownsampler::KhronosDownsampler(AggregatorType type, int64_t interval)
+    : _type(type)
+    , _interval(interval)
+    , _bucketTimestamp(0)
+    , _count(0)
+    , _sum(0)
+    , _min(0)
+    , _max(0)
+{
+    assert(_interval > 0);
+}
+
+KhronosDownsampler::~KhronosDownsampler() {
+}
+
+KhronosDownsampler::AggregatorType KhronosDownsampler::parseAggregatorType(
+        const string &aggregator)
+{
+    if (aggregator == "avg") {
+        return DAT_AVG;
+    } else if (aggregator == "min") {
+        return DAT_MIN;
+    } else if (aggregator == "max") {
+        return DAT_MAX;
+    } else if (aggregator == "sum") {
+        return DAT_SUM;
+    } else if (aggregator == "count") {
+        return DAT_COUNT;
+    }
+    return DAT_UNKNOWN;
+}
+
+KHR_VALUE_TYPE KhronosDownsampler::sum(const KHR_VALUE_TYPE *values, size_t count) {
+    return simdSum(values, count);
+}
+
+KHR_VALUE_TYPE KhronosDownsampler::min(const KHR_VALUE_TYPE *values, size_t count) {
+    return simdMinMax<true>(values, count);
+}
+
+KHR_VALUE_TYPE KhronosDownsampler::max(const KHR_VALUE_TYPE *values, size_t count) {
+    return simdMinMax<false>(values, count);
+}
+
+KHR_TS_TYPE KhronosDownsampler::alignTimestamp(KHR_TS_TYPE timestamp) const {
+    KHR_TS_TYPE remainder = timestamp % _interval;
+    if (remainder < 0) {
+        remainder += _interval;
+    }
+    return timestamp - remainder;
+}
+
+void KhronosDownsampler::aggregate(const KHR_TS_TYPE *timestamps,
+                                   const KHR_VALUE_TYPE *values,
+                                   size_t count, vector<Bucket> &output)
+{
+    size_t begin = 0;
+    while (begin < count) {
+        KHR_TS_TYPE bucketTimestamp = alignTimestamp(timestamps[begin]);
+        if (_count > 0 && bucketTimestamp != _bucketTimestamp) {
+            flush(output);
+        }
+        _bucketTimestamp = bucketTimestamp;
+        KHR_TS_TYPE bucketEnd = bucketTimestamp + _interval;
+        size_t end = begin + 1;
+        for (; end < count && timestamps[end] >= bucketTimestamp
+                 && timestamps[end] < bucketEnd; ++end);
+        reduce(values + begin, end - begin);
+        begin = end;
+    }
+}
+
+void KhronosDownsampler::reduce(const KHR_VALUE_TYPE *values, size_t count) {
+    assert(count > 0);
+    switch (_type) {
+    case DAT_AVG:
+    case DAT_SUM:
+        _sum += sum(values, count);
+        break;
+    case DAT_MIN: {
+        KHR_VALUE_TYPE value = min(values, count);
+        _min = _count > 0 ? std::min(_min, value) : value;
+        break;
+    }
+    case DAT_MAX: {
+        KHR_VALUE_TYPE value = max(values, count);
+        _max = _count > 0 ? std::max(_max, value) : value;
+        break;
+    }
+    default:
+        break;
+    }
+    _count += count;
+}
+
+void KhronosDownsampler::flush(vector<Bucket> &output) {
+    if (_count == 0) {
+        return;
+    }
+    KHR_VALUE_TYPE value = 0;
+    switch (_type) {
+    case DAT_AVG:
+        value = _sum / _count;
+        break;
+    case DAT_MIN:
+        value = _min;
+        break;
+    case DAT_MAX:
+        value = _max;
+        break;
+    case DAT_SUM:
+        value = _sum;
+        break;
+    case DAT_COUNT:
+        value = _count;
+        break;
+    default:
+        assert(false);
+    }
+    output.emplace_back(_bucketTimestamp, value);
+    _count = 0;
+    _sum = 0;
+}
+
+END_HA3_NAMESPACE(sql);
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <ha3/common.h>
+#include <ha3/sql/ops/khronosScan/KhronosCommon.h>
+
+BEGIN_HA3_NAMESPACE(sql);
+
+// reduce sorted data points of one series into fixed time buckets,
+// bucket timestamp is aligned to the interval
+class KhronosDownsampler {
+public:
+    enum AggregatorType {
+        DAT_UNKNOWN = 0,
+        DAT_AVG,
+        DAT_MIN,
+        DAT_MAX,
+        DAT_SUM,
+        DAT_COUNT,
+    };
+    struct Bucket {
+        Bucket(KHR_TS_TYPE timestampIn = 0, KHR_VALUE_TYPE valueIn = 0)
+            : timestamp(timestampIn)
+            , value(valueIn)
+        {}
+        KHR_TS_TYPE timestamp;
+        KHR_VALUE_TYPE value;
+    };
+public:
+    KhronosDownsampler(AggregatorType type, int64_t interval);
+    ~KhronosDownsampler();
+    KhronosDownsampler(const KhronosDownsampler&) = delete;
+    KhronosDownsampler& operator=(const KhronosDownsampler &) = delete;
+public:
+    // timestamps should be ascending, finished buckets are appended to output
+    void aggregate(const KHR_TS_TYPE *timestamps, const KHR_VALUE_TYPE *values,
+                   size_t count, std::vector<Bucket> &output);
+    // finish the current bucket, called when series changed or scan finished
+    void flush(std::vector<Bucket> &output);
+    static AggregatorType parseAggregatorType(const std::string &aggregator);
+public:
+    static KHR_VALUE_TYPE sum(const KHR_VALUE_TYPE *values, size_t count);
+    static KHR_VALUE_TYPE min(const KHR_VALUE_TYPE *values, size_t count);
+    static KHR_VALUE_TYPE max(const KHR_VALUE_TYPE *values, size_t count);
+private:
+    KHR_TS_TYPE alignTimestamp(KHR_TS_TYPE timestamp) const;
+    void reduce(const KHR_VALUE_TYPE *values, size_t count);
+private:
+    AggregatorType _type;
+    int64_t _interval;
+    KHR_TS_TYPE _bucketTimestamp;
+    size_t _count;
+    KHR_VALUE_TYPE _sum;
+    KHR_VALUE_TYPE _min;
+    KHR_VALUE_TYPE _max;
+private:
+    HA3_LOG_DECLARE();
+};
+
+HA3_TYPEDEF_PTR(KhronosDownsampler);
+
+END_HA3_NAMESPACE(sql);
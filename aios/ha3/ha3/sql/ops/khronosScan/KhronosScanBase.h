@@ -12,8 +12,13 @@ BEGIN_HA3_NAMESPACE(sql);
 struct KhronosScanHints {
     KhronosScanHints()
         : oneLineScanPointLimit(KHR_DEFAULT_ONE_LINE_SCAN_POINT_LIMIT)
+        , downsampleInterval(0)
     {}
     size_t oneLineScanPointLimit;
+    // downsample data points into fixed time buckets inside data point scan,
+    // disabled when interval is 0
+    int64_t downsampleInterval;
+    std::string downsampleAggregator;
 };
 
 class KhronosScanBase : public ScanBase {
@@ -116,6 +116,18 @@ void KhronosScanKernel::patchHintInfo(const map<string, map<string, string> > &h
             _scanHints.oneLineScanPointLimit = limit;
         }
     }
+    iter = hints.find("khronosDownsampleInterval");
+    if (iter != hints.end()) {
+        int64_t interval = 0;
+        StringUtil::fromString(iter->second, interval);
+        if (interval > 0) {
+            _scanHints.downsampleInterval = interval;
+        }
+    }
+    iter = hints.find("khronosDownsampleAggregator");
+    if (iter != hints.end()) {
+        _scanHints.downsampleAggregator = iter->second;
+    }
 }
 
 REGISTER_KERNEL(KhronosScanKernel);
@@ -397,6 +397,89 @@ TEST_F(KhronosDataPointScanTest, testAllSuccess_WithBatch) {
     }
 }
 
+TEST_F(KhronosDataPointScanTest, testDownsample) {
+    ScanInitParam param = createAllSuccessScanInitParam();
+    KhronosScanHints scanHints;
+    scanHints.downsampleInterval = 4;
+    scanHints.downsampleAggregator = "avg";
+    KhronosDataPointScan scan(scanHints);
+    ASSERT_TRUE(scan.init(param));
+    ASSERT_NE(nullptr, scan._downsampler);
+
+    TablePtr outputTable;
+    bool eof = true;
+    ASSERT_TRUE(scan.doBatchScan(outputTable, eof));
+    ASSERT_TRUE(eof);
+    ASSERT_EQ(2, outputTable->getRowCount());
+    ASSERT_EQ(5, outputTable->getColumnCount());
+    ASSERT_NO_FATAL_FAILURE(
+            checkOutputColumn<double>(outputTable, "data", {6.05, 6.2}));
+    ASSERT_NO_FATAL_FAILURE(
+            checkOutputColumn(outputTable, "taghost", {"10.10.10.1", "10.10.10.1"}));
+    ASSERT_NO_FATAL_FAILURE(
+            checkOutputColumn(outputTable, "tags['app']", {"ha3", "ha3"}));
+    ASSERT_NO_FATAL_FAILURE(
+            checkOutputColumn<KHR_TS_TYPE>(outputTable, "timestamp", {1546272000, 1546272004}));
+    ASSERT_NO_FATAL_FAILURE(
+            checkOutputColumn<KHR_WM_TYPE>(outputTable, "wm", {1546272048001, 1546272048001}));
+}
+
+TEST_F(KhronosDataPointScanTest, testDownsample_WithBatch) {
+    ScanInitParam param = createAllSuccessScanInitParam();
+    param.batchSize = 1;
+    KhronosScanHints scanHints;
+    scanHints.downsampleInterval = 4;
+    scanHints.downsampleAggregator = "count";
+    KhronosDataPointScan scan(scanHints);
+    ASSERT_TRUE(scan.init(param));
+    scan._lineSegmentBuffer->mBufferLimit = 1;
+    // batch 1
+    {
+        TablePtr outputTable;
+        bool eof = true;
+        ASSERT_TRUE(scan.doBatchScan(outputTable, eof));
+        ASSERT_FALSE(eof);
+        ASSERT_EQ(1, outputTable->getRowCount());
+        ASSERT_NO_FATAL_FAILURE(
+                checkOutputColumn<double>(outputTable, "data", {3}));
+        ASSERT_NO_FATAL_FAILURE(
+                checkOutputColumn(outputTable, "taghost", {"10.10.10.1"}));
+        ASSERT_NO_FATAL_FAILURE(
+                checkOutputColumn<KHR_TS_TYPE>(outputTable, "timestamp", {1546272000}));
+    }
+    // batch 2
+    {
+        TablePtr outputTable;
+        bool eof = true;
+        ASSERT_TRUE(scan.doBatchScan(outputTable, eof));
+        ASSERT_FALSE(eof);
+        ASSERT_EQ(1, outputTable->getRowCount());
+        ASSERT_NO_FATAL_FAILURE(
+                checkOutputColumn<double>(outputTable, "data", {2}));
+        ASSERT_NO_FATAL_FAILURE(
+                checkOutputColumn(outputTable, "taghost", {"10.10.10.1"}));
+        ASSERT_NO_FATAL_FAILURE(
+                checkOutputColumn<KHR_TS_TYPE>(outputTable, "timestamp", {1546272004}));
+    }
+    // batch 3
+    {
+        TablePtr outputTable;
+        bool eof = false;
+        ASSERT_TRUE(scan.doBatchScan(outputTable, eof));
+        ASSERT_TRUE(eof);
+        ASSERT_EQ(0, outputTable->getRowCount());
+    }
+}
+
+TEST_F(KhronosDataPointScanTest, testDownsample_UnknownAggregator) {
+    ScanInitParam param = createAllSuccessScanInitParam();
+    KhronosScanHints scanHints;
+    scanHints.downsampleInterval = 4;
+    scanHints.downsampleAggregator = "p99";
+    KhronosDataPointScan scan(scanHints);
+    ASSERT_FALSE(scan.init(param));
+}
+
 TEST_F(KhronosDataPointScanTest, testAllSuccess_EmptyBatch) {
     ScanInitParam param = createAllSuccessScanInitParam();
     KhronosDataPointScan scan;
@@ -0,0 +1,117 @@
+#include <unittest/unittest.h>
+#include <ha3/test/test.h>
+#include <ha3/sql/ops/khronosScan/KhronosDownsampler.h>
+
+using namespace std;
+using namespace testing;
+
+BEGIN_HA3_NAMESPACE(sql);
+
+class KhronosDownsamplerTest : public TESTBASE {
+public:
+    void setUp();
+    void tearDown();
+protected:
+    void checkBuckets(const vector<KhronosDownsampler::Bucket> &expect,
+                      const vector<KhronosDownsampler::Bucket> &actual);
+private:
+    HA3_LOG_DECLARE();
+};
+
+HA3_LOG_SETUP(khronosScan, KhronosDownsamplerTest);
+
+void KhronosDownsamplerTest::setUp() {
+}
+
+void KhronosDownsamplerTest::tearDown() {
+}
+
+void KhronosDownsamplerTest::checkBuckets(
+        const vector<KhronosDownsampler::Bucket> &expect,
+        const vector<KhronosDownsampler::Bucket> &actual)
+{
+    ASSERT_EQ(expect.size(), actual.size());
+    for (size_t i = 0; i < expect.size(); ++i) {
+        ASSERT_EQ(expect[i].timestamp, actual[i].timestamp) << i;
+        ASSERT_DOUBLE_EQ(expect[i].value, actual[i].value) << i;
+    }
+}
+
+TEST_F(KhronosDownsamplerTest, testParseAggregatorType) {
+    ASSERT_EQ(KhronosDownsampler::DAT_AVG, KhronosDownsampler::parseAggregatorType("avg"));
+    ASSERT_EQ(KhronosDownsampler::DAT_MIN, KhronosDownsampler::parseAggregatorType("min"));
+    ASSERT_EQ(KhronosDownsampler::DAT_MAX, KhronosDownsampler::parseAggregatorType("max"));
+    ASSERT_EQ(KhronosDownsampler::DAT_SUM, KhronosDownsampler::parseAggregatorType("sum"));
+    ASSERT_EQ(KhronosDownsampler::DAT_COUNT, KhronosDownsampler::parseAggregatorType("count"));
+    ASSERT_EQ(KhronosDownsampler::DAT_UNKNOWN, KhronosDownsampler::parseAggregatorType("p99"));
+    ASSERT_EQ(KhronosDownsampler::DAT_UNKNOWN, KhronosDownsampler::parseAggregatorType(""));
+}
+
+TEST_F(KhronosDownsamplerTest, testReduce) {
+    vector<KHR_VALUE_TYPE> values;
+    for (size_t count = 1; count <= 37; ++count) {
+        values.push_back((KHR_VALUE_TYPE)((count * 7919) % 101) - 50);
+        KHR_VALUE_TYPE expectSum = 0;
+        KHR_VALUE_TYPE expectMin = values[0];
+        KHR_VALUE_TYPE expectMax = values[0];
+        for (auto value : values) {
+            expectSum += value;
+            expectMin = std::min(expectMin, value);
+            expectMax = std::max(expectMax, value);
+        }
+        ASSERT_DOUBLE_EQ(expectSum, KhronosDownsampler::sum(values.data(), count)) << count;
+        ASSERT_EQ(expectMin, KhronosDownsampler::min(values.data(), count)) << count;
+        ASSERT_EQ(expectMax, KhronosDownsampler::max(values.data(), count)) << count;
+    }
+}
+
+TEST_F(KhronosDownsamplerTest, testAggregate) {
+    typedef KhronosDownsampler::Bucket B;
+    vector<KHR_TS_TYPE> timestamps = {-3, 1, 2, 3, 4, 9, 10, 11};
+    vector<KHR_VALUE_TYPE> values = {10, 1, 2, 6, 4, 5, 7, 3};
+    auto doAggregate = [&](KhronosDownsampler::AggregatorType type, size_t step) {
+        KhronosDownsampler downsampler(type, 4);
+        vector<B> output;
+        for (size_t begin = 0; begin < timestamps.size(); begin += step) {
+            size_t count = std::min(step, timestamps.size() - begin);
+            downsampler.aggregate(timestamps.data() + begin, values.data() + begin,
+                                  count, output);
+        }
+        downsampler.flush(output);
+        return output;
+    };
+    // buckets: [-4, 0): {10}, [0, 4): {1, 2, 6}, [4, 8): {4}, [8, 12): {5, 7, 3}
+    for (size_t step : {1, 3, 8}) {
+        ASSERT_NO_FATAL_FAILURE(checkBuckets({B(-4, 10), B(0, 3), B(4, 4), B(8, 5)},
+                        doAggregate(KhronosDownsampler::DAT_AVG, step)));
+        ASSERT_NO_FATAL_FAILURE(checkBuckets({B(-4, 10), B(0, 1), B(4, 4), B(8, 3)},
+                        doAggregate(KhronosDownsampler::DAT_MIN, step)));
+        ASSERT_NO_FATAL_FAILURE(checkBuckets({B(-4, 10), B(0, 6), B(4, 4), B(8, 7)},
+                        doAggregate(KhronosDownsampler::DAT_MAX, step)));
+        ASSERT_NO_FATAL_FAILURE(checkBuckets({B(-4, 10), B(0, 9), B(4, 4), B(8, 15)},
+                        doAggregate(KhronosDownsampler::DAT_SUM, step)));
+        ASSERT_NO_FATAL_FAILURE(checkBuckets({B(-4, 1), B(0, 3), B(4, 1), B(8, 3)},
+                        doAggregate(KhronosDownsampler::DAT_COUNT, step)));
+    }
+}
+
+TEST_F(KhronosDownsamplerTest, testFlush) {
+    typedef KhronosDownsampler::Bucket B;
+    KhronosDownsampler downsampler(KhronosDownsampler::DAT_SUM, 10);
+    vector<B> output;
+    downsampler.flush(output);
+    ASSERT_TRUE(output.empty());
+
+    vector<KHR_TS_TYPE> timestamps = {11, 12};
+    vector<KHR_VALUE_TYPE> values = {1, 2};
+    downsampler.aggregate(timestamps.data(), values.data(), 2, output);
+    ASSERT_TRUE(output.empty());
+    // same bucket of next series is not merged after flush
+    downsampler.flush(output);
+    downsampler.aggregate(timestamps.data(), values.data(), 1, output);
+    downsampler.flush(output);
+    downsampler.flush(output);
+    ASSERT_NO_FATAL_FAILURE(checkBuckets({B(10, 3), B(10, 1)}, output));
+}
+
+END_HA3_NAMESPACE(sql);
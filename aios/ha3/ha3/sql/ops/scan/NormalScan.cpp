@@ -20,6 +20,8 @@
 #include <ha3/sql/ops/condition/ExprUtil.h>
 #include <ha3/common/AndQuery.h>
 #include <ha3/sql/ops/calc/CalcTable.h>
+#include <autil/Lock.h>
+#include <autil/WorkItem.h>
 
 using namespace std;
 using namespace autil;
@@ -33,12 +35,41 @@ BEGIN_HA3_NAMESPACE(sql);
 
 HA3_LOG_SETUP(sql, NormalScan);
 
+class ScanTaskWorkItem : public autil::WorkItem
+{
+public:
+    ScanTaskWorkItem(const std::function<void()> &task)
+        : _task(task)
+    {}
+public:
+    void process() override {
+        _task();
+    }
+    void destroy() override {
+        delete this;
+    }
+    void drop() override {
+        // caller is waiting for the task, run it anyway
+        _task();
+        destroy();
+    }
+private:
+    std::function<void()> _task;
+};
+
 NormalScan::NormalScan()
+    : _scanThreadPool(NULL)
+    , _subScanFailed(false)
+    , _orderedSubScanIdx(0)
 {
 
 }
 
 NormalScan::~NormalScan() {
+    if (!_subScans.empty()) {
+        waitSubScans();
+    }
+    _subScans.clear();
     _scanIter.reset();
     _attributeExpressionVec.clear();
     _indexPartitionReaderWrapper.reset();
@@ -59,12 +90,20 @@ bool NormalScan::init(const ScanInitParam &param) {
         SQL_LOG(ERROR, "table [%s] get sql query resource failed.", _tableName.c_str());
         return false;
     }
+    auto sqlSessionResource =
+        bizResource->getObject<turing::SqlSessionResource>("SqlSessionResource");
+    if (_scanThreadNum > 1 && param.innerParallelNum == 1 && !_useSub
+        && sqlSessionResource != NULL && sqlSessionResource->scanThreadPool != NULL)
+    {
+        bool ret = initParallelScan(param, sqlSessionResource->scanThreadPool.get());
+        uint64_t initEnd = TimeUtility::currentTime();
+        incInitTime(initEnd - initBegin);
+        return ret;
+    }
     if (!initOutputColumn()) {
         SQL_LOG(WARN, "table [%s] init scan column failed.", _tableName.c_str());
         return false;
     }
-    auto sqlSessionResource =
-        bizResource->getObject<turing::SqlSessionResource>("SqlSessionResource");
 
     ScanIteratorCreatorParam iterParam;
     iterParam.tableName = _tableName;
@@ -76,6 +115,8 @@ bool NormalScan::init(const ScanInitParam &param) {
     iterParam.timeoutTerminator = _timeoutTerminator.get();
     iterParam.parallelIndex = _parallelIndex;
     iterParam.parallelNum = _parallelNum;
+    iterParam.innerParallelIndex = param.innerParallelIndex;
+    iterParam.innerParallelNum = param.innerParallelNum;
     if (sqlSessionResource != NULL) {
         iterParam.analyzerFactory = sqlSessionResource->analyzerFactory.get();
         iterParam.queryInfo = &sqlSessionResource->queryInfo;
@@ -110,7 +151,200 @@ bool NormalScan::init(const ScanInitParam &param) {
     return true;
 }
 
+bool NormalScan::initParallelScan(const ScanInitParam &param, autil::ThreadPool *threadPool) {
+    _scanThreadPool = threadPool;
+    for (uint32_t i = 0; i < _scanThreadNum; ++i) {
+        ScanInitParam subParam = param;
+        subParam.innerParallelNum = _scanThreadNum;
+        subParam.innerParallelIndex = i;
+        // query pool is not thread safe, each sub scan allocates from its own pool
+        subParam.sessionPool = param.queryResource->createExtraPool();
+        std::shared_ptr<NormalScan> subScan(new NormalScan());
+        if (!subScan->init(subParam)) {
+            SQL_LOG(WARN, "table [%s] init sub scan [%u] failed.", _tableName.c_str(), i);
+            return false;
+        }
+        _subScans.push_back(subScan);
+    }
+    if (_batchSize == 0) {
+        _batchSize = _subScans[0]->_batchSize;
+    }
+    _subScanTables.assign(_subScans.size(), deque<TablePtr>());
+    _subScanEofs.assign(_subScans.size(), false);
+    _subScanRunnings.assign(_subScans.size(), false);
+    _subScanFailed = false;
+    _orderedSubScanIdx = 0;
+    SQL_LOG(TRACE1, "table [%s] scan in [%u] threads, keep order [%d].",
+            _tableName.c_str(), _scanThreadNum, _scanKeepOrder);
+    return true;
+}
+
+void NormalScan::startSubScans() {
+    vector<size_t> startIdxs;
+    {
+        autil::ScopedLock lock(_subScanCond);
+        if (_subScanFailed) {
+            return;
+        }
+        for (size_t i = 0; i < _subScans.size(); ++i) {
+            // at most one pending table per sub scan, sub scans run ahead of output by one batch
+            if (!_subScanRunnings[i] && !_subScanEofs[i] && _subScanTables[i].empty()) {
+                _subScanRunnings[i] = true;
+                startIdxs.push_back(i);
+            }
+        }
+    }
+    for (size_t idx : startIdxs) {
+        ScanTaskWorkItem *item = new ScanTaskWorkItem([this, idx]() { runSubScan(idx); });
+        if (_scanThreadPool->pushWorkItem(item, false) != autil::ThreadPool::ERROR_NONE) {
+            item->process();
+            item->destroy();
+        }
+    }
+}
+
+void NormalScan::runSubScan(size_t idx) {
+    TablePtr subTable;
+    bool subEof = false;
+    bool ret = _subScans[idx]->doBatchScan(subTable, subEof);
+    autil::ScopedLock lock(_subScanCond);
+    if (ret) {
+        _subScanTables[idx].push_back(subTable);
+        _subScanEofs[idx] = subEof;
+    } else {
+        SQL_LOG(ERROR, "table [%s] sub scan [%zu] failed.", _tableName.c_str(), idx);
+        _subScanFailed = true;
+    }
+    _subScanRunnings[idx] = false;
+    _subScanCond.broadcast();
+}
+
+void NormalScan::waitSubScans() {
+    autil::ScopedLock lock(_subScanCond);
+    while (hasRunningSubScan()) {
+        _subScanCond.wait();
+    }
+}
+
+bool NormalScan::hasRunningSubScan() const {
+    for (char running : _subScanRunnings) {
+        if (running) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool NormalScan::isSubScanOutputReady() const {
+    if (_subScanFailed) {
+        return true;
+    }
+    if (_scanKeepOrder) {
+        for (size_t i = _orderedSubScanIdx; i < _subScans.size(); ++i) {
+            if (!_subScanTables[i].empty()) {
+                return true;
+            }
+            if (!_subScanEofs[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+    bool allEof = true;
+    for (size_t i = 0; i < _subScans.size(); ++i) {
+        if (!_subScanTables[i].empty()) {
+            return true;
+        }
+        allEof = allEof && _subScanEofs[i];
+    }
+    return allEof;
+}
+
+bool NormalScan::popSubScanTables(TablePtr &table) {
+    // sub scans hold ascending docid parts, with keep order tables are taken
+    // part by part, otherwise every pending table can be taken
+    size_t i = _scanKeepOrder ? _orderedSubScanIdx : 0;
+    for (; i < _subScans.size(); ++i) {
+        deque<TablePtr> &subTables = _subScanTables[i];
+        while (!subTables.empty()) {
+            const TablePtr &subTable = subTables.front();
+            if (table == nullptr) {
+                table = subTable;
+            } else if (table->getRowCount() + subTable->getRowCount() > _batchSize) {
+                return true;
+            } else if (subTable->getRowCount() > 0 && !table->merge(subTable)) {
+                SQL_LOG(ERROR, "table [%s] merge table of sub scan [%zu] failed.",
+                        _tableName.c_str(), i);
+                return false;
+            }
+            subTables.pop_front();
+        }
+        if (_scanKeepOrder) {
+            if (!_subScanEofs[i]) {
+                break;
+            }
+            _orderedSubScanIdx = i + 1;
+        }
+    }
+    return true;
+}
+
+bool NormalScan::doParallelBatchScan(TablePtr &table, bool &eof) {
+    table.reset();
+    eof = false;
+    startSubScans();
+    {
+        autil::ScopedLock lock(_subScanCond);
+        while (!isSubScanOutputReady()) {
+            _subScanCond.wait();
+        }
+        incSeekTime(TimeUtility::currentTime() - _batchScanBeginTime);
+        if (!_subScanFailed && !popSubScanTables(table)) {
+            _subScanFailed = true;
+        }
+        if (_subScanFailed) {
+            while (hasRunningSubScan()) {
+                _subScanCond.wait();
+            }
+            return false;
+        }
+        eof = true;
+        for (size_t i = 0; i < _subScans.size(); ++i) {
+            if (!_subScanEofs[i] || !_subScanTables[i].empty()) {
+                eof = false;
+                break;
+            }
+        }
+    }
+    uint64_t afterSeek = TimeUtility::currentTime();
+    if (table != nullptr) {
+        _seekCount += table->getRowCount();
+        if (_seekCount >= _limit) {
+            table->clearBackRows(_seekCount - _limit);
+            _seekCount = _limit;
+            eof = true;
+        }
+    }
+    if (eof) {
+        waitSubScans();
+        for (auto &subScan : _subScans) {
+            // sub scans left by limit
+            subScan->finishScanIter();
+            incTotalScanCount(subScan->_scanInfo.totalscancount());
+            subScan->_scanInfo.set_totalscancount(0);
+        }
+    } else {
+        // scan next batches while the output is processed
+        startSubScans();
+    }
+    incOutputTime(TimeUtility::currentTime() - afterSeek);
+    return true;
+}
+
 bool NormalScan::doBatchScan(TablePtr &table, bool &eof) {
+    if (!_subScans.empty()) {
+        return doParallelBatchScan(table, eof);
+    }
     vector<MatchDoc> matchDocs;
     eof = false;
     if (_scanIter != NULL && _seekCount < _limit) {
@@ -141,19 +375,40 @@ bool NormalScan::doBatchScan(TablePtr &table, bool &eof) {
     table = createTable(matchDocs, _matchDocAllocator, eof && _scanOnce);
     int64_t endTime = TimeUtility::currentTime();
     incOutputTime(endTime - afterEvaluate);
-    if (eof && _scanIter) {
-        _scanInfo.set_totalscancount(_scanInfo.totalscancount() + _scanIter->getTotalScanCount());
-        if (_scanIter->isTimeout()) {
-            SQL_LOG(WARN, "scan table [%s] timeout, info: [%s]", _tableName.c_str(),
-                    _scanInfo.ShortDebugString().c_str());
-        }
-        _scanIter.reset();
+    if (eof) {
+        finishScanIter();
     }
     return true;
 }
 
+void NormalScan::finishScanIter() {
+    if (_scanIter == NULL) {
+        return;
+    }
+    _scanInfo.set_totalscancount(_scanInfo.totalscancount() + _scanIter->getTotalScanCount());
+    if (_scanIter->isTimeout()) {
+        SQL_LOG(WARN, "scan table [%s] timeout, info: [%s]", _tableName.c_str(),
+                _scanInfo.ShortDebugString().c_str());
+    }
+    _scanIter.reset();
+}
+
 bool NormalScan::updateScanQuery(const StreamQueryPtr &inputQuery) {
     _scanOnce = false;
+    if (!_subScans.empty()) {
+        waitSubScans();
+        autil::ScopedLock lock(_subScanCond);
+        for (size_t i = 0; i < _subScans.size(); ++i) {
+            if (!_subScans[i]->updateScanQuery(inputQuery)) {
+                return false;
+            }
+            _subScanTables[i].clear();
+            _subScanEofs[i] = false;
+        }
+        _subScanFailed = false;
+        _orderedSubScanIdx = 0;
+        return true;
+    }
     _scanIter.reset();
     uint64_t initBegin = TimeUtility::currentTime();
     if (nullptr == inputQuery) {
@@ -5,6 +5,9 @@
 #include <matchdoc/MatchDocAllocator.h>
 #include <suez/turing/expression/framework/AttributeExpressionCreator.h>
 #include <suez/turing/expression/framework/AttributeExpression.h>
+#include <autil/ThreadPool.h>
+#include <autil/Lock.h>
+#include <deque>
 
 BEGIN_HA3_NAMESPACE(sql);
 class NormalScan : public ScanBase {
@@ -20,6 +23,18 @@ public:
     bool updateScanQuery(const StreamQueryPtr &inputQuery) override;
 
 private:
+    // split docid space by segment and scan the parts by sub scans in scan thread pool
+    bool initParallelScan(const ScanInitParam &param, autil::ThreadPool *threadPool);
+    bool doParallelBatchScan(TablePtr &table, bool &eof);
+    // push a batch scan task for every sub scan which is idle and has no pending table
+    void startSubScans();
+    void runSubScan(size_t idx);
+    void waitSubScans();
+    // below require _subScanCond locked
+    bool isSubScanOutputReady() const;
+    bool hasRunningSubScan() const;
+    bool popSubScanTables(TablePtr &table);
+    void finishScanIter();
     bool initOutputColumn();
     bool copyField(const std::string &expr, const std::string &outputName, 
                    std::map<std::string, std::pair<std::string, bool> > &expr2Outputs);
@@ -49,6 +64,16 @@ private:
     std::string _tableMeta;
     ScanIteratorCreatorPtr _scanIterCreator;
     CreateScanIteratorInfo _baseCreateScanIterInfo;
+    autil::ThreadPool *_scanThreadPool;
+    std::vector<std::shared_ptr<NormalScan> > _subScans;
+    // sub scan states below are guarded by _subScanCond
+    autil::ThreadCond _subScanCond;
+    std::vector<std::deque<TablePtr> > _subScanTables;
+    std::vector<char> _subScanEofs;
+    std::vector<char> _subScanRunnings;
+    bool _subScanFailed;
+    // with keep order, tables of later sub scans wait until this one is drained
+    size_t _orderedSubScanIdx;
 private:
     HA3_LOG_DECLARE();
 };
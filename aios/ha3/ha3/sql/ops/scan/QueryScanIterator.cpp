@@ -1,6 +1,8 @@
 #include <ha3/sql/ops/scan/QueryScanIterator.h>
 #include <ha3/sql/common/common.h>
 #include <ha3/search/TermQueryExecutor.h>
+#include <ha3/search/AndQueryExecutor.h>
+#include <ha3/search/AndNotQueryExecutor.h>
 
 using namespace std;
 
@@ -31,6 +33,20 @@ QueryScanIterator::QueryScanIterator(const search::QueryExecutorPtr &queryExecut
     if (termExecutor != NULL) {
         _postingIter = termExecutor->getPostingIterator();
     }
+    search::AndQueryExecutor* andExecutor =
+        dynamic_cast<search::AndQueryExecutor*>(_queryExecutor.get());
+    if (andExecutor != NULL) {
+        // range/spatial filters are tested by batch, instead of per doc in seek
+        _docValueFilters = andExecutor->stealFilters();
+    }
+    search::AndNotQueryExecutor* andNotExecutor =
+        dynamic_cast<search::AndNotQueryExecutor*>(_queryExecutor.get());
+    if (andNotExecutor != NULL) {
+        auto filter = andNotExecutor->stealRightFilter();
+        if (filter != NULL) {
+            _docValueNotFilters.push_back(filter);
+        }
+    }
 }
 
 QueryScanIterator::~QueryScanIterator() {
@@ -70,10 +86,6 @@ bool QueryScanIterator::batchSeek(size_t batchSize, std::vector<matchdoc::MatchD
                 continue;
             }
             ++_totalScanCount;
-            if (_deletionMapReader && _deletionMapReader->IsDeleted(docId)) {
-                ++docId;
-                continue;
-            }
             docIds.push_back(docId);
             ++docId;
             if (docIds.size() >= minBatchSize) {
@@ -103,10 +115,6 @@ bool QueryScanIterator::batchSeek(size_t batchSize, std::vector<matchdoc::MatchD
                 continue;
             }
             _totalScanCount++;
-            if (_deletionMapReader && _deletionMapReader->IsDeleted(docId)) {
-                ++docId;
-                continue;
-            }
             docIds.push_back(docId);
             ++docId;
             if (docIds.size() >= minBatchSize) {
@@ -127,8 +135,19 @@ bool QueryScanIterator::batchSeek(size_t batchSize, std::vector<matchdoc::MatchD
     return _isTimeout || _curDocId == END_DOCID;
 }
 
-size_t QueryScanIterator::batchFilter(const std::vector<int32_t> &docIds, std::vector<matchdoc::MatchDoc> &matchDocs) {
+size_t QueryScanIterator::batchFilter(std::vector<int32_t> &docIds, std::vector<matchdoc::MatchDoc> &matchDocs) {
     int64_t beginTime = autil::TimeUtility::currentTime();
+    if (_deletionMapReader) {
+        // check deletion for the whole batch instead of per doc in seek loop
+        docIds.resize(_deletionMapReader->FilterDeleted(docIds.data(), docIds.size()));
+    }
+    if (!_docValueFilters.empty() || !_docValueNotFilters.empty()) {
+        size_t seekCount = docIds.size();
+        batchFilterDocValue(_docValueFilters, true, docIds);
+        batchFilterDocValue(_docValueNotFilters, false, docIds);
+        // docs dropped by the filters were never counted when tested in seek
+        _totalScanCount -= seekCount - docIds.size();
+    }
     std::vector<matchdoc::MatchDoc> allocateDocs = _matchDocAllocator->batchAllocate(docIds);
     assert(docIds.size() == allocateDocs.size());
     size_t count = 0;
@@ -152,6 +171,31 @@ size_t QueryScanIterator::batchFilter(const std::vector<int32_t> &docIds, std::v
     return count;
 }
 
+void QueryScanIterator::batchFilterDocValue(
+        const std::vector<IE_NAMESPACE(index)::DocValueFilter*> &filters,
+        bool keepPassed, std::vector<int32_t> &docIds)
+{
+    uint8_t keepMask = keepPassed ? 1 : 0;
+    for (auto filter : filters) {
+        size_t count = docIds.size();
+        if (count == 0) {
+            return;
+        }
+        _filterMask.resize(count);
+        uint8_t *mask = _filterMask.data();
+        size_t passCount = filter->BatchTest(docIds.data(), count, mask);
+        if (passCount == (keepPassed ? count : 0)) {
+            continue;
+        }
+        size_t keepCount = 0;
+        for (size_t i = 0; i < count; ++i) {
+            docIds[keepCount] = docIds[i];
+            keepCount += (mask[i] == keepMask);
+        }
+        docIds.resize(keepCount);
+    }
+}
+
 bool QueryScanIterator::moveToCorrectRange(docid_t &docId) {
     while (++_rangeCousor < _layerMeta->size()) {
         if (docId <= (*_layerMeta)[_rangeCousor].end) {
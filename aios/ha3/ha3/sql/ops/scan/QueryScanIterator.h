@@ -6,6 +6,7 @@
 #include <ha3/util/Log.h>
 #include <ha3/sql/ops/scan/ScanIterator.h>
 #include <ha3/search/QueryExecutor.h>
+#include <indexlib/index/normal/inverted_index/accessor/doc_value_filter.h>
 #include <ha3/search/FilterWrapper.h>
 #include <ha3/search/LayerMetas.h>
 #include <matchdoc/MatchDocAllocator.h>
@@ -30,7 +31,10 @@ private:
     inline bool tryToMakeItInRange(docid_t &docId);
     bool moveToCorrectRange(docid_t &docId);
 
-    size_t batchFilter(const std::vector<int32_t> &docIds, std::vector<matchdoc::MatchDoc> &matchDocs);
+    size_t batchFilter(std::vector<int32_t> &docIds, std::vector<matchdoc::MatchDoc> &matchDocs);
+    void batchFilterDocValue(
+            const std::vector<IE_NAMESPACE(index)::DocValueFilter*> &filters,
+            bool keepPassed, std::vector<int32_t> &docIds);
 
 private:
     search::QueryExecutorPtr _queryExecutor;
@@ -38,6 +42,10 @@ private:
     IE_NAMESPACE(index)::DeletionMapReaderPtr _deletionMapReader;
     search::LayerMetaPtr _layerMeta; 
     IE_NAMESPACE(index)::PostingIterator *_postingIter;
+    std::vector<IE_NAMESPACE(index)::DocValueFilter*> _docValueFilters;
+    // docs passing these filters are dropped, stolen from AndNotQueryExecutor
+    std::vector<IE_NAMESPACE(index)::DocValueFilter*> _docValueNotFilters;
+    std::vector<uint8_t> _filterMask;
     docid_t _curDocId;
     docid_t _curBegin;
     docid_t _curEnd;
@@ -29,26 +29,33 @@ bool RangeScanIterator::batchSeek(size_t batchSize, std::vector<matchdoc::MatchD
     for (; _rangeIdx < _layerMeta->size(); ++_rangeIdx) {
         auto &range = (*_layerMeta)[_rangeIdx];
         _curId = _curId >= (range.begin - 1) ? _curId : (range.begin - 1);
-        while (docCount < batchSize && ++_curId <= range.end ) {
+        while (docCount < batchSize && _curId < range.end) {
             if (_timeoutTerminator && _timeoutTerminator->checkTimeout()) {
                 _isTimeout = true;
                 break;
             }
-            ++_totalScanCount;
-            if (_delMapReader && _delMapReader->IsDeleted(_curId)) {
-                continue;
+            // scan [beginId, endId) at once, deleted docs are skipped by slot of deletion map
+            int32_t beginId = _curId + 1;
+            int32_t endId = std::min(range.end + 1,
+                    beginId + (int32_t)(minBatchSize - docIds.size()));
+            size_t offset = docIds.size();
+            docIds.resize(offset + endId - beginId);
+            if (_delMapReader) {
+                offset += _delMapReader->GetUndeletedDocIds(beginId, endId, docIds.data() + offset);
+            } else {
+                for (int32_t docId = beginId; docId < endId; ++docId) {
+                    docIds[offset++] = docId;
+                }
             }
-            docIds.push_back(_curId);
+            docIds.resize(offset);
+            _totalScanCount += endId - beginId;
+            _curId = endId - 1;
             if (docIds.size() >= minBatchSize) {
                 docCount += batchFilter(docIds, matchDocs);
                 docIds.clear();
             }
         }
-        if (docCount >= batchSize) {
-            break;
-        }
-        --_curId;
-        if (_isTimeout) {
+        if (docCount >= batchSize || _isTimeout) {
             break;
         }
     }
@@ -25,23 +25,28 @@ bool RangeScanIteratorWithoutFilter::batchSeek(size_t batchSize, std::vector<mat
     for (; _rangeIdx < _layerMeta->size(); ++_rangeIdx) {
         auto &range = (*_layerMeta)[_rangeIdx];
         _curId = _curId >= (range.begin - 1) ? _curId : (range.begin - 1);
-        while (docCount < batchSize && ++_curId <= range.end ) {
+        while (docCount < batchSize && _curId < range.end) {
             if (_timeoutTerminator && _timeoutTerminator->checkTimeout()) {
                 _isTimeout = true;
                 break;
             }
-            ++_totalScanCount;
-            if (_delMapReader && _delMapReader->IsDeleted(_curId)) {
-                continue;
+            // scan [beginId, endId) at once, deleted docs are skipped by slot of deletion map
+            size_t scanCount = std::min(batchSize - docCount, (size_t)DEFAULT_BATCH_COUNT);
+            int32_t beginId = _curId + 1;
+            int32_t endId = std::min(range.end + 1, beginId + (int32_t)scanCount);
+            docIds.resize(docCount + endId - beginId);
+            if (_delMapReader) {
+                docCount += _delMapReader->GetUndeletedDocIds(beginId, endId, docIds.data() + docCount);
+            } else {
+                for (int32_t docId = beginId; docId < endId; ++docId) {
+                    docIds[docCount++] = docId;
+                }
             }
-            docIds.push_back(_curId);
-            ++docCount;
+            docIds.resize(docCount);
+            _totalScanCount += endId - beginId;
+            _curId = endId - 1;
         }
-        if (docCount >= batchSize) {
-            break;
-        }
-        --_curId;
-        if (_isTimeout) {
+        if (docCount >= batchSize || _isTimeout) {
             break;
         }
     }
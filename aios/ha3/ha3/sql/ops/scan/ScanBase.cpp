@@ -129,6 +129,8 @@ ScanBase::ScanBase()
     , _seekCount(0)
     , _parallelNum(1)
     , _parallelIndex(0)
+    , _scanThreadNum(1)
+    , _scanKeepOrder(false)
     , _opId(-1)
     , _batchScanBeginTime(0)
     , _pool(nullptr)
@@ -200,7 +202,7 @@ bool ScanBase::init(const ScanInitParam &param) {
         SQL_LOG(ERROR, "get sql query resource failed.");
         return false;
     }
-    _pool = queryResource->getPool();
+    _pool = param.sessionPool ? param.sessionPool : queryResource->getPool();
     KERNEL_REQUIRES(_pool, "get pool failed");
     _queryMetricsReporter = queryResource->getQueryMetricsReporter();
     _sqlSearchInfoCollector = queryResource->getSqlSearchInfoCollector();
@@ -330,6 +332,18 @@ void ScanBase::patchHintInfo(const map<string, map<string, string> > &hintsMap)
             _batchSize = batchSize;
         }
     }
+    iter = hints.find("scanThreadNum");
+    if (iter != hints.end()) {
+        uint32_t scanThreadNum = 0;
+        StringUtil::fromString(iter->second, scanThreadNum);
+        if (scanThreadNum > 0) {
+            _scanThreadNum = std::min(scanThreadNum, MAX_SCAN_THREAD_NUM);
+        }
+    }
+    iter = hints.find("scanKeepOrder");
+    if (iter != hints.end()) {
+        _scanKeepOrder = iter->second == "true";
+    }
     iter = hints.find("nestTableJoinType");
     if (iter != hints.end()) {
         if (iter->second == "inner") {
@@ -36,10 +36,13 @@ struct ScanInitParam {
         , limit(-1)
         , parallelNum(1)
         , parallelIndex(0)
+        , innerParallelNum(1)
+        , innerParallelIndex(0)
         , opId(-1)
         , bizResource(nullptr)
         , memoryPoolResource(nullptr)
         , queryResource(nullptr)
+        , sessionPool(nullptr)
     {}
     bool initFromJson(autil::legacy::Jsonizable::JsonWrapper &wrapper);
 
@@ -63,12 +66,16 @@ struct ScanInitParam {
     uint32_t limit;
     uint32_t parallelNum;
     uint32_t parallelIndex;
+    // split of docid space inside one scan kernel, set by parallel scan
+    uint32_t innerParallelNum;
+    uint32_t innerParallelIndex;
     int32_t opId;
     std::string conditionJson;
     std::string outputExprsJson;
     SqlBizResource* bizResource;
     navi::MemoryPoolResource *memoryPoolResource;
     SqlQueryResource* queryResource;
+    autil::mem_pool::Pool *sessionPool; // use pool of query resource if null
 private:
     HA3_LOG_DECLARE();
 };
@@ -146,6 +153,8 @@ protected:
     uint32_t _seekCount;
     uint32_t _parallelNum;
     uint32_t _parallelIndex;
+    uint32_t _scanThreadNum;
+    bool _scanKeepOrder;
     int32_t _opId;
     uint64_t _batchScanBeginTime;
     std::string _conditionJson;
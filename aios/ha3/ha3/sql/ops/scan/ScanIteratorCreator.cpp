@@ -45,6 +45,8 @@ ScanIteratorCreator::ScanIteratorCreator(const ScanIteratorCreatorParam &param)
     , _timeoutTerminator(param.timeoutTerminator)
     , _parallelIndex(param.parallelIndex)
     , _parallelNum(param.parallelNum)
+    , _innerParallelIndex(param.innerParallelIndex)
+    , _innerParallelNum(param.innerParallelNum)
 {}
 
 ScanIteratorCreator::~ScanIteratorCreator() {
@@ -79,6 +81,10 @@ bool ScanIteratorCreator::genCreateScanIteratorInfo(const string &conditionInfo,
         return false;
     }
     LayerMetaPtr layerMeta = createLayerMeta(_indexPartitionReaderWrapper, _pool, _parallelIndex, _parallelNum);
+    if (layerMeta && _innerParallelNum > 1) {
+        layerMeta = splitLayerMetaBySegment(_indexPartitionReaderWrapper, _pool, layerMeta,
+                _innerParallelIndex, _innerParallelNum);
+    }
     if (!layerMeta) {
         SQL_LOG(WARN, "table name [%s], create layer meta failed.", _tableName.c_str());
         return false;
@@ -420,5 +426,34 @@ LayerMetaPtr ScanIteratorCreator::splitLayerMeta(autil::mem_pool::Pool *pool,
     return newMeta;
 }
 
+LayerMetaPtr ScanIteratorCreator::splitLayerMetaBySegment(
+        IndexPartitionReaderWrapperPtr &indexPartitionReader,
+        autil::mem_pool::Pool *pool,
+        const LayerMetaPtr& layerMeta, uint32_t index, uint32_t num)
+{
+    if (index >= num) {
+        return {};
+    }
+    DocIdRangeVector rangeHint;
+    for (auto &rangeMeta : *layerMeta) {
+        rangeHint.push_back(DocIdRange(rangeMeta.begin, rangeMeta.end + 1));
+    }
+    vector<DocIdRangeVector> partedRanges;
+    auto partReader = indexPartitionReader->getReader();
+    if (!partReader->GetPartedDocIdRanges(rangeHint, num, partedRanges)) {
+        SQL_LOG(WARN, "split doc id ranges by segment failed, part num [%u].", num);
+        return {};
+    }
+    LayerMetaPtr newMeta(new LayerMeta(pool));
+    newMeta->quotaMode = layerMeta->quotaMode;
+    // ways without doc are omitted by partitioner
+    if (index < partedRanges.size()) {
+        for (auto &range : partedRanges[index]) {
+            newMeta->push_back(DocIdRangeMeta(range.first, range.second - 1,
+                            range.second - range.first));
+        }
+    }
+    return newMeta;
+}
 
 END_HA3_NAMESPACE(sql);
@@ -29,6 +29,8 @@ struct ScanIteratorCreatorParam{
         , timeoutTerminator(NULL)
         , parallelIndex(0)
         , parallelNum(1)
+        , innerParallelIndex(0)
+        , innerParallelNum(1)
     {}
     std::string tableName;
     search::IndexPartitionReaderWrapperPtr indexPartitionReaderWrapper;
@@ -41,6 +43,8 @@ struct ScanIteratorCreatorParam{
     suez::turing::TimeoutTerminator *timeoutTerminator;
     uint32_t parallelIndex;
     uint32_t parallelNum;
+    uint32_t innerParallelIndex;
+    uint32_t innerParallelNum;
 };
 
 struct CreateScanIteratorInfo {
@@ -100,6 +104,11 @@ private:
     static search::LayerMetaPtr splitLayerMeta(
             autil::mem_pool::Pool *pool,
             const search::LayerMetaPtr& layerMeta, uint32_t index, uint32_t num);
+    // split by segment boundary, a segment is kept in one part as far as possible
+    static search::LayerMetaPtr splitLayerMetaBySegment(
+            search::IndexPartitionReaderWrapperPtr &indexPartitionReader,
+            autil::mem_pool::Pool *pool,
+            const search::LayerMetaPtr& layerMeta, uint32_t index, uint32_t num);
 
     static bool parseIndexMap(const std::string &indexStr, autil::mem_pool::Pool* pool,
                               std::map<std::string, std::string> &attrIndexMap);
@@ -120,6 +129,8 @@ private:
     suez::turing::TimeoutTerminator *_timeoutTerminator;
     uint32_t _parallelIndex;
     uint32_t _parallelNum;
+    uint32_t _innerParallelIndex;
+    uint32_t _innerParallelNum;
 private:
     HA3_LOG_DECLARE();
 };
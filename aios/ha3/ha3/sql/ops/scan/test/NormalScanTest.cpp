@@ -8,6 +8,7 @@
 #include <ha3/sql/data/TableUtil.h>
 #include <matchdoc/MatchDocAllocator.h>
 #include <matchdoc/SubDocAccessor.h>
+#include <autil/ThreadPool.h>
 
 using namespace std;
 using namespace suez::turing;
@@ -63,6 +64,51 @@ private:
         }
     }
 
+    void prepareScanThreadPool() {
+        std::shared_ptr<autil::ThreadPool> threadPool(new autil::ThreadPool(2, 100));
+        ASSERT_TRUE(threadPool->start());
+        _sqlResource->scanThreadPool = threadPool;
+    }
+
+    // scanHints: eg. {"scanThreadNum":"2","scanKeepOrder":"true"}
+    void prepareScanParam(ScanInitParam &param, uint32_t batchSize, uint32_t limit,
+                          const string &scanHints)
+    {
+        autil::legacy::json::JsonMap attributeMap;
+        attributeMap["table_type"] = string("normal");
+        attributeMap["table_name"] = _tableName;
+        attributeMap["db_name"] = string("default");
+        attributeMap["catalog_name"] = string("default");
+        attributeMap["hash_fields"] = ParseJson(string(R"json(["id"])json"));
+        attributeMap["output_fields"] = ParseJson(string(R"json(["$attr1"])json"));
+        attributeMap["batch_size"] = Any(batchSize);
+        attributeMap["limit"] = Any(limit);
+        if (!scanHints.empty()) {
+            attributeMap["hints"] = ParseJson("{\"SCAN_ATTR\":" + scanHints + "}");
+        }
+        string jsonStr = autil::legacy::ToJsonString(attributeMap);
+        JsonMap jsonMap;
+        FromJsonString(jsonMap, jsonStr);
+        autil::legacy::Jsonizable::JsonWrapper wrapper(jsonMap);
+        ASSERT_TRUE(param.initFromJson(wrapper));
+        param.bizResource = _sqlBizResource.get();
+        param.queryResource = _sqlQueryResource.get();
+        param.memoryPoolResource = &_memPoolResource;
+    }
+
+    void scanToEof(NormalScan &normalScan, uint32_t batchSize, vector<string> &values) {
+        bool eof = false;
+        while (!eof) {
+            TablePtr table;
+            ASSERT_TRUE(normalScan.doBatchScan(table, eof));
+            ASSERT_TRUE(table != nullptr);
+            ASSERT_GE(batchSize, table->getRowCount());
+            for (size_t i = 0; i < table->getRowCount(); ++i) {
+                values.push_back(table->toString(i, 0));
+            }
+        }
+    }
+
     IE_NAMESPACE(partition)::IndexPartitionPtr makeIndexPartition(const std::string &rootPath,
             const std::string &tableName)
     {
@@ -1577,4 +1623,158 @@ TEST_F(NormalScanTest, testCopyColumns) {
     }
 }
 
+class FailedNormalScan : public NormalScan {
+public:
+    bool doBatchScan(TablePtr &table, bool &eof) override {
+        return false;
+    }
+};
+
+TEST_F(NormalScanTest, testParallelScanKeepOrder) {
+    ASSERT_NO_FATAL_FAILURE(prepareScanThreadPool());
+    for (uint32_t batchSize : {1u, 2u, 3u, 10u}) {
+        ScanInitParam param;
+        ASSERT_NO_FATAL_FAILURE(prepareScanParam(param, batchSize, 1000, ""));
+        NormalScan sequentialScan;
+        ASSERT_TRUE(sequentialScan.init(param));
+        ASSERT_TRUE(sequentialScan._subScans.empty());
+        vector<string> expectValues;
+        ASSERT_NO_FATAL_FAILURE(scanToEof(sequentialScan, batchSize, expectValues));
+        ASSERT_EQ(vector<string>({"0", "1", "2", "3"}), expectValues);
+
+        for (uint32_t threadNum : {2u, 3u, 4u}) {
+            ScanInitParam parallelParam;
+            ASSERT_NO_FATAL_FAILURE(prepareScanParam(parallelParam, batchSize, 1000,
+                            R"json({"scanThreadNum":")json" + StringUtil::toString(threadNum)
+                            + R"json(","scanKeepOrder":"true"})json"));
+            NormalScan normalScan;
+            ASSERT_TRUE(normalScan.init(parallelParam));
+            ASSERT_EQ(threadNum, normalScan._subScans.size());
+            vector<string> values;
+            ASSERT_NO_FATAL_FAILURE(scanToEof(normalScan, batchSize, values));
+            ASSERT_EQ(expectValues, values) << batchSize << " " << threadNum;
+            ASSERT_EQ(4, normalScan._seekCount);
+            ASSERT_EQ(4, normalScan._scanInfo.totalscancount());
+        }
+    }
+}
+
+TEST_F(NormalScanTest, testParallelScanUnordered) {
+    ASSERT_NO_FATAL_FAILURE(prepareScanThreadPool());
+    for (uint32_t batchSize : {1u, 2u, 10u}) {
+        for (uint32_t threadNum : {2u, 4u}) {
+            ScanInitParam param;
+            ASSERT_NO_FATAL_FAILURE(prepareScanParam(param, batchSize, 1000,
+                            R"json({"scanThreadNum":")json" + StringUtil::toString(threadNum)
+                            + R"json("})json"));
+            NormalScan normalScan;
+            ASSERT_TRUE(normalScan.init(param));
+            ASSERT_EQ(threadNum, normalScan._subScans.size());
+            vector<string> values;
+            ASSERT_NO_FATAL_FAILURE(scanToEof(normalScan, batchSize, values));
+            sort(values.begin(), values.end());
+            ASSERT_EQ(vector<string>({"0", "1", "2", "3"}), values);
+            ASSERT_EQ(4, normalScan._seekCount);
+            ASSERT_EQ(4, normalScan._scanInfo.totalscancount());
+        }
+    }
+}
+
+TEST_F(NormalScanTest, testParallelScanLimit) {
+    ASSERT_NO_FATAL_FAILURE(prepareScanThreadPool());
+    for (uint32_t batchSize : {1u, 2u, 10u}) {
+        { // keep order
+            ScanInitParam param;
+            ASSERT_NO_FATAL_FAILURE(prepareScanParam(param, batchSize, 3,
+                            R"json({"scanThreadNum":"2","scanKeepOrder":"true"})json"));
+            NormalScan normalScan;
+            ASSERT_TRUE(normalScan.init(param));
+            vector<string> values;
+            ASSERT_NO_FATAL_FAILURE(scanToEof(normalScan, batchSize, values));
+            ASSERT_EQ(vector<string>({"0", "1", "2"}), values);
+            ASSERT_EQ(3, normalScan._seekCount);
+            ASSERT_LE(3, normalScan._scanInfo.totalscancount());
+        }
+        { // unordered
+            ScanInitParam param;
+            ASSERT_NO_FATAL_FAILURE(prepareScanParam(param, batchSize, 3,
+                            R"json({"scanThreadNum":"2"})json"));
+            NormalScan normalScan;
+            ASSERT_TRUE(normalScan.init(param));
+            vector<string> values;
+            ASSERT_NO_FATAL_FAILURE(scanToEof(normalScan, batchSize, values));
+            ASSERT_EQ(3, values.size());
+            ASSERT_EQ(3, set<string>(values.begin(), values.end()).size());
+            ASSERT_EQ(3, normalScan._seekCount);
+            ASSERT_LE(3, normalScan._scanInfo.totalscancount());
+        }
+    }
+}
+
+TEST_F(NormalScanTest, testParallelScanUpdateScanQuery) {
+    ASSERT_NO_FATAL_FAILURE(prepareScanThreadPool());
+    ScanInitParam param;
+    ASSERT_NO_FATAL_FAILURE(prepareScanParam(param, 1, 1000,
+                    R"json({"scanThreadNum":"2","scanKeepOrder":"true"})json"));
+    NormalScan normalScan;
+    ASSERT_TRUE(normalScan.init(param));
+    StreamQueryPtr inputQuery(new StreamQuery());
+    inputQuery->query.reset(new TermQuery("a", "index_2", RequiredFields(), ""));
+
+    ASSERT_TRUE(normalScan.updateScanQuery(inputQuery));
+    vector<string> values;
+    ASSERT_NO_FATAL_FAILURE(scanToEof(normalScan, 1, values));
+    ASSERT_EQ(vector<string>({"0", "1", "2"}), values);
+    ASSERT_EQ(3, normalScan._seekCount);
+    ASSERT_EQ(3, normalScan._scanInfo.totalscancount());
+
+    // update before eof, pending tables of the last query are dropped
+    ASSERT_TRUE(normalScan.updateScanQuery(inputQuery));
+    TablePtr table;
+    bool eof = false;
+    ASSERT_TRUE(normalScan.doBatchScan(table, eof));
+    ASSERT_FALSE(eof);
+    ASSERT_EQ(1, table->getRowCount());
+    ASSERT_EQ("0", table->toString(0, 0));
+    ASSERT_TRUE(normalScan.updateScanQuery(inputQuery));
+    values.clear();
+    ASSERT_NO_FATAL_FAILURE(scanToEof(normalScan, 1, values));
+    ASSERT_EQ(vector<string>({"0", "1", "2"}), values);
+    ASSERT_EQ(7, normalScan._seekCount);
+
+    ASSERT_TRUE(normalScan.updateScanQuery(StreamQueryPtr()));
+    eof = false;
+    table.reset();
+    ASSERT_TRUE(normalScan.doBatchScan(table, eof));
+    ASSERT_TRUE(eof);
+    ASSERT_TRUE(table != nullptr);
+    ASSERT_EQ(0, table->getRowCount());
+    ASSERT_EQ(7, normalScan._seekCount);
+}
+
+TEST_F(NormalScanTest, testParallelScanSubScanFailed) {
+    ASSERT_NO_FATAL_FAILURE(prepareScanThreadPool());
+    for (const string &keepOrder : {"true", "false"}) {
+        ScanInitParam param;
+        ASSERT_NO_FATAL_FAILURE(prepareScanParam(param, 1, 1000,
+                        R"json({"scanThreadNum":"2","scanKeepOrder":")json" + keepOrder
+                        + R"json("})json"));
+        NormalScan normalScan;
+        ASSERT_TRUE(normalScan.init(param));
+        ASSERT_EQ(2, normalScan._subScans.size());
+        normalScan._subScans[1].reset(new FailedNormalScan());
+        // tables of the good sub scan may come first, the failure is reported before eof
+        bool ret = true;
+        bool eof = false;
+        while (ret && !eof) {
+            TablePtr table;
+            ret = normalScan.doBatchScan(table, eof);
+        }
+        ASSERT_FALSE(ret);
+        ASSERT_FALSE(eof);
+        TablePtr table;
+        ASSERT_FALSE(normalScan.doBatchScan(table, eof));
+    }
+}
+
 END_HA3_NAMESPACE(sql);
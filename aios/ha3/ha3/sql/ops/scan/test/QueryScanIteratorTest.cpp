@@ -1,4 +1,5 @@
 #include <unittest/unittest.h>
+#define private public
 #include <ha3/test/test.h>
 #include <ha3/sql/ops/scan/QueryScanIterator.h>
 #include <ha3/search/LayerMetas.h>
@@ -10,6 +11,8 @@
 #include <ha3/search/test/QueryExecutorConstructor.h>
 #include <autil/StringUtil.h>
 #include <suez/turing/expression/framework/AttributeExpression.h>
+#include <ha3/search/AndQueryExecutor.h>
+#include <ha3/search/AndNotQueryExecutor.h>
 using namespace std;
 using namespace testing;
 using namespace matchdoc;
@@ -74,6 +77,37 @@ private:
     set<int32_t> _docIds;
 };
 
+class SetDocValueFilter : public IE_NAMESPACE(index)::DocValueFilter {
+public:
+    SetDocValueFilter(set<int32_t> docIds)
+        : DocValueFilter(NULL)
+        , _docIds(docIds)
+    {}
+public:
+    bool Test(docid_t docId) override {
+        return _docIds.count(docId) > 0;
+    }
+    DocValueFilter* Clone() const override {
+        return NULL;
+    }
+private:
+    set<int32_t> _docIds;
+};
+
+class FilteredAndQueryExecutor : public AndQueryExecutor {
+public:
+    void addFilter(IE_NAMESPACE(index)::DocValueFilter *filter) {
+        _filters.push_back(filter);
+    }
+};
+
+class FilteredAndNotQueryExecutor : public AndNotQueryExecutor {
+public:
+    void setRightFilter(IE_NAMESPACE(index)::DocValueFilter *filter) {
+        _rightFilter = filter;
+    }
+};
+
 TEST_F(QueryScanIteratorTest, testBatchSeek1) {
     int32_t begin = 10;
     int32_t end = 100;
@@ -277,6 +311,73 @@ TEST_F(QueryScanIteratorTest, testBatchSeek100WithoutFilter) {
     }
 }
 
+TEST_F(QueryScanIteratorTest, testBatchSeekWithDocValueFilter) {
+    int32_t begin = 10;
+    int32_t end = 100;
+    LayerMetaPtr layerMeta(new LayerMeta(&_pool));
+    layerMeta->push_back(DocIdRangeMeta(begin, end, end - begin + 1));
+    MatchDocAllocatorPtr allocator(new MatchDocAllocator(&_pool));
+    set<int32_t> expect{10, 20, 30, 40, 50, 55, 60, 80};
+    set<int32_t> passDocIds = expect;
+    passDocIds.insert(5);
+    passDocIds.insert(200);
+    SetDocValueFilter docValueFilter(passDocIds);
+    FilteredAndQueryExecutor *andExecutor = POOL_NEW_CLASS((&_pool), FilteredAndQueryExecutor);
+    andExecutor->addQueryExecutors({QueryExecutorConstructor::prepareTermQueryExecutor(
+                        &_pool, "ALIBABA", "phrase", _indexReaderWrapper.get())});
+    andExecutor->addFilter(&docValueFilter);
+    QueryExecutorPtr queryExecutor(andExecutor,
+                                   [](QueryExecutor *p) {
+                POOL_DELETE_CLASS(p);
+            });
+    QueryScanIterator scanIter (queryExecutor, {}, allocator, {}, layerMeta);
+    ASSERT_EQ(1, scanIter._docValueFilters.size());
+    vector<MatchDoc> matchDocVec;
+    bool ret = scanIter.batchSeek(100, matchDocVec);
+    ASSERT_TRUE(ret);
+    ASSERT_EQ(expect.size(), matchDocVec.size());
+    ASSERT_EQ(expect.size(), scanIter.getTotalScanCount());
+    size_t idx = 0;
+    for (auto docid : expect) {
+        ASSERT_EQ(docid, matchDocVec[idx++].getDocId());
+    }
+}
+
+TEST_F(QueryScanIteratorTest, testBatchSeekWithAndNotDocValueFilter) {
+    int32_t begin = 10;
+    int32_t end = 100;
+    LayerMetaPtr layerMeta(new LayerMeta(&_pool));
+    layerMeta->push_back(DocIdRangeMeta(begin, end, end - begin + 1));
+    MatchDocAllocatorPtr allocator(new MatchDocAllocator(&_pool));
+    set<int32_t> notDocIds{5, 10, 20, 55, 100, 200};
+    SetDocValueFilter docValueFilter(notDocIds);
+    FilteredAndNotQueryExecutor *andNotExecutor =
+        POOL_NEW_CLASS((&_pool), FilteredAndNotQueryExecutor);
+    andNotExecutor->addQueryExecutors(
+            QueryExecutorConstructor::prepareTermQueryExecutor(
+                    &_pool, "ALIBABA", "phrase", _indexReaderWrapper.get()),
+            QueryExecutorConstructor::prepareTermQueryExecutor(
+                    &_pool, "ALIBABA", "phrase", _indexReaderWrapper.get()));
+    andNotExecutor->setRightFilter(&docValueFilter);
+    QueryExecutorPtr queryExecutor(andNotExecutor,
+                                   [](QueryExecutor *p) {
+                POOL_DELETE_CLASS(p);
+            });
+    QueryScanIterator scanIter (queryExecutor, {}, allocator, {}, layerMeta);
+    ASSERT_EQ(1, scanIter._docValueNotFilters.size());
+    vector<MatchDoc> matchDocVec;
+    bool ret = scanIter.batchSeek(1000, matchDocVec);
+    ASSERT_TRUE(ret);
+    ASSERT_EQ(87, matchDocVec.size());
+    ASSERT_EQ(87, scanIter.getTotalScanCount());
+    size_t idx = 0;
+    for (int32_t docid = begin; docid <= end; ++docid) {
+        if (notDocIds.count(docid) == 0) {
+            ASSERT_EQ(docid, matchDocVec[idx++].getDocId());
+        }
+    }
+}
+
 TEST_F(QueryScanIteratorTest, testSeekTimeout) {
     int32_t begin = 10;
     int32_t end = 100;
@@ -565,4 +565,30 @@ TEST_F(ScanIteratorCreatorTest, testSplitLayerMeta) {
     }
 }
 
+TEST_F(ScanIteratorCreatorTest, testSplitLayerMetaBySegment) {
+    auto indexReaderWrapper = getIndexPartitionReaderWrapper();
+    ASSERT_TRUE(indexReaderWrapper != NULL);
+    auto layerMeta = ScanIteratorCreator::createLayerMeta(indexReaderWrapper, &_pool);
+    ASSERT_EQ(1, layerMeta->size());
+    for (uint32_t num : {1u, 2u, 3u, 8u}) {
+        // parts are disjoint, ascending and cover all docs
+        docid_t expectBegin = 0;
+        for (uint32_t index = 0; index < num; ++index) {
+            LayerMetaPtr partMeta = ScanIteratorCreator::splitLayerMetaBySegment(
+                    indexReaderWrapper, &_pool, layerMeta, index, num);
+            ASSERT_TRUE(partMeta);
+            ASSERT_EQ(QM_PER_LAYER, partMeta->quotaMode);
+            for (auto &rangeMeta : *partMeta) {
+                ASSERT_EQ(expectBegin, rangeMeta.begin);
+                ASSERT_LE(rangeMeta.begin, rangeMeta.end);
+                ASSERT_EQ(rangeMeta.end - rangeMeta.begin + 1, rangeMeta.quota);
+                expectBegin = rangeMeta.end + 1;
+            }
+        }
+        ASSERT_EQ(4, expectBegin);
+    }
+    ASSERT_FALSE(ScanIteratorCreator::splitLayerMetaBySegment(
+                    indexReaderWrapper, &_pool, layerMeta, 2, 2));
+}
+
 END_HA3_NAMESPACE();
@@ -54,5 +54,12 @@ int64_t SqlQueryResource::getStartTime() const {
     return _queryResource->startTime;
 }
 
+autil::mem_pool::Pool* SqlQueryResource::createExtraPool() {
+    std::shared_ptr<autil::mem_pool::Pool> pool(new autil::mem_pool::Pool());
+    autil::ScopedLock lock(_extraPoolLock);
+    _extraPools.push_back(pool);
+    return pool.get();
+}
+
 
 END_HA3_NAMESPACE(sql);
@@ -8,6 +8,8 @@
 #include <suez/turing/common/QueryResource.h>
 #include <ha3/sql/proto/SqlSearchInfoCollector.h>
 #include <multi_call/interface/QuerySession.h>
+#include <autil/Lock.h>
+#include <autil/mem_pool/Pool.h>
 
 BEGIN_HA3_NAMESPACE(sql);
 
@@ -36,11 +38,15 @@ public:
     int64_t getTimeoutMs() const {
         return _timeout;
     }
+    // pool released with this query, for work running beside the query pool in other threads
+    autil::mem_pool::Pool* createExtraPool();
 
 private:
     tensorflow::QueryResourcePtr _queryResource;
     SqlSearchInfoCollectorPtr _sqlSearchInfoCollector;
     int64_t _timeout;
+    autil::ThreadMutex _extraPoolLock;
+    std::vector<std::shared_ptr<autil::mem_pool::Pool> > _extraPools;
 };
 
 HA3_TYPEDEF_PTR(SqlQueryResource);
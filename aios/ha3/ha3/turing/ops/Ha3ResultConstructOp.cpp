@@ -108,6 +108,11 @@ public:
             versionid_t versionId = idxPartReaderWrapperPtr->getCurrentVersion();
             matchDocs->setGlobalIdInfo(searcherResource->getHashIdRange().from(),
                     versionId, searcherResource->getFullIndexVersion(), ip, phaseOneInfoMask);
+            if (request->getConfigClause()->getKVPairValue(
+                            common::COLUMNAR_MATCHDOCS_KEY) == "true")
+            {
+                matchDocs->setColumnarFormat(true);
+            }
         }
 
         const proto::PartitionID &partitionId = searcherResource->getPartitionId();
@@ -9,6 +9,7 @@
 #include <ha3/rank/RankProfileManager.h>
 #include <ha3/search/MatchDocSearcher.h>
 #include <ha3/search/SearchCommonResource.h>
+#include <ha3/search/QueryCostPredictor.h>
 #include <ha3/service/SearcherResource.h>
 #include <indexlib/partition/index_partition.h>
 #include <ha3/monitor/SessionMetricsCollector.h>
@@ -91,6 +92,9 @@ public:
         OP_REQUIRES(ctx, partitionResource, errors::Unavailable("create partition resource failed"));
 
 
+        adjustDegradeLevelByCost(request.get(), idxPartReaderWrapperPtr.get(),
+                                 searcherResource.get(), searcherQueryResource);
+
         SearchRuntimeResourcePtr runtimeResource =
             Ha3ResourceUtil::createSearchRuntimeResource(request.get(),
                 searcherResource, commonResource,
@@ -102,6 +106,33 @@ public:
         OP_REQUIRES(ctx, runtimeResource, errors::Unavailable("create runtime resource failed"));
     }
 
+private:
+    // runs before doc count limits are computed from the degrade level
+    void adjustDegradeLevelByCost(Request *request,
+                                  IndexPartitionReaderWrapper *readerWrapper,
+                                  HA3_NS(service)::SearcherResource *searcherResource,
+                                  SearcherQueryResource *searcherQueryResource)
+    {
+        HA3_NS(service)::ServiceDegradePtr serviceDegrade =
+            searcherResource->getServiceDegrade();
+        if (!serviceDegrade || !serviceDegrade->needPredictCost()) {
+            return;
+        }
+        float level;
+        uint32_t rankSize;
+        uint32_t rerankSize;
+        request->getDegradeLevel(level, rankSize, rerankSize);
+        QueryCostPredictor predictor;
+        double cost = predictor.predict(request, readerWrapper);
+        searcherQueryResource->predictedCost = cost;
+        float adjustedLevel = serviceDegrade->adjustDegradeLevel(level, cost);
+        if (adjustedLevel != level) {
+            request->setDegradeLevel(adjustedLevel, rankSize, rerankSize);
+        }
+        HA3_LOG(TRACE3, "predicted cost [%.0lf], posting count [%ld], match count [%d],"
+                " degrade level [%f] -> [%f]", cost, predictor.getPostingCount(),
+                predictor.getMatchCount(), level, adjustedLevel);
+    }
 private:
     HA3_LOG_DECLARE();
 
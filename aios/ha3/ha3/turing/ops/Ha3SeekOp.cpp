@@ -62,6 +62,9 @@ void Ha3SeekOp::seek(tensorflow::OpKernelContext* ctx,
 {
     search::InnerSearchResult innerResult(pool);
     bool ret = processRequest(request, rankProfile, searcherQueryResource, searcherResource, innerResult);
+    if (ret) {
+        reportCostPrediction(searcherQueryResource);
+    }
     outputResult(ctx, ret, innerResult, request, pool, searcherSessionResource, searcherQueryResource, searcherResource);
 }
 
@@ -150,6 +153,25 @@ bool Ha3SeekOp::processRequest(common::Request *request,
     return searcher.seek(request,searcherCacheInfo.get(), innerResult);
 }
 
+void Ha3SeekOp::reportCostPrediction(SearcherQueryResource *searcherQueryResource) {
+    double predictedCost = searcherQueryResource->predictedCost;
+    auto metricsCollector = searcherQueryResource->sessionMetricsCollector;
+    auto metricsReporter = searcherQueryResource->getQueryMetricsReporter();
+    if (predictedCost < 0 || !metricsCollector || !metricsReporter) {
+        return;
+    }
+    int32_t seekDocCount = metricsCollector->getSeekDocCount();
+    metricsReporter->report(predictedCost, "costPrediction.predictedCost",
+                            kmonitor::GAUGE, nullptr);
+    metricsReporter->report(seekDocCount, "costPrediction.seekDocCount",
+                            kmonitor::GAUGE, nullptr);
+    if (seekDocCount > 0) {
+        metricsReporter->report(predictedCost / seekDocCount,
+                                "costPrediction.predictedToActualRatio",
+                                kmonitor::GAUGE, nullptr);
+    }
+}
+
 common::ResultPtr Ha3SeekOp::constructErrorResult(common::Request *request,
         SearcherSessionResource *searcherSessionResource,
         SearcherQueryResource *searcherQueryResource,
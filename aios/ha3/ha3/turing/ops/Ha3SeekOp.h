@@ -42,6 +42,8 @@ public:
                              SearcherSessionResource *searcherSessionResource,
                              SearcherQueryResource *searcherQueryResource,
                              service::SearcherResource *searcherResource);
+    // predicted versus actual seek cost, for calibrating cost_threshold
+    static void reportCostPrediction(SearcherQueryResource *searcherQueryResource);
 private:
     void seek(tensorflow::OpKernelContext* ctx,
                      common::Request *request,
@@ -80,10 +80,15 @@ bool Ha3SeekParaOp::processRequest(common::Request *request,
     auto optimizerChainManager = searcherResource->getOptimizerChainManager().get();
     auto sorterManager = searcherResource->getSorterManager().get();
     auto searcherCache = searcherResource->getSearcherCache().get();
+    config::AggSamplerConfigInfo aggSamplerConfigInfo =
+        searcherResource->getAggSamplerConfigInfo();
+    if (aggSamplerConfigInfo.isParaSeekExactMode()) {
+        aggSamplerConfigInfo.setEnableSampling(false);
+    }
     search::MatchDocSearcher searcher(*commonResource, *partitionResource,
             *runtimeResource, rankProfileMgr,
             optimizerChainManager, sorterManager,
-            searcherResource->getAggSamplerConfigInfo(),
+            aggSamplerConfigInfo,
             searcherResource->getClusterConfig(),
             searcherResource->getPartCount(), searcherCache, rankProfile,
             layerMetas);
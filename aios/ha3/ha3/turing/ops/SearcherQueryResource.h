@@ -35,6 +35,8 @@ public:
     search::SearchPartitionResourcePtr partitionResource;
     search::SearchRuntimeResourcePtr runtimeResource;
     search::SearcherCacheInfoPtr searcherCacheInfo;
+    // seek cost predicted for cost based degradation, -1 if not predicted
+    double predictedCost = -1;
 private:
     common::TimeoutTerminatorPtr _seekTimeoutTerminator;
 private:
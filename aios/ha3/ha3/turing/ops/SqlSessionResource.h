@@ -8,6 +8,7 @@
 #include <build_service/analyzer/AnalyzerFactory.h>
 #include <ha3/config/QueryInfo.h>
 #include <navi/engine/Navi.h>
+#include <autil/ThreadPool.h>
 #include <ha3/sql/ops/agg/AggFuncManager.h>
 #include <ha3/sql/ops/tvf/TvfFuncManager.h>
 #include <ha3/proto/BasicDefs.pb.h>
@@ -32,6 +33,7 @@ public:
     sql::AggFuncManagerPtr aggFuncManager;
     sql::TvfFuncManagerPtr tvfFuncManager;
     proto::Range range;
+    std::shared_ptr<autil::ThreadPool> scanThreadPool;
 private:
     HA3_LOG_DECLARE();
 };
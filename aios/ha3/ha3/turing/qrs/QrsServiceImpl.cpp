@@ -2,6 +2,7 @@
 #include <autil/TimeUtility.h>
 #include <ha3/turing/qrs/SearchTuringClosure.h>
 #include <ha3/service/SessionWorkItem.h>
+#include <ha3/service/RequestCostEstimator.h>
 #include <ha3/worker/HaProtoJsonizer.h>
 #include <ha3/common/XMLResultFormatter.h>
 #include <ha3/monitor/QrsBizMetrics.h>
@@ -30,6 +31,7 @@ BEGIN_HA3_NAMESPACE(turing);
 HA3_LOG_SETUP(turing, QrsServiceImpl);
 
 static const std::string HA_SEARCH_THREAD_POOL_NAME = "ha_search";
+static const std::string WORK_STEALING_TASK_QUEUE_CONFIG = "workStealingTaskQueueConfig";
 
 QrsServiceImpl::QrsServiceImpl()
     : _enableSql(true)
@@ -151,11 +153,7 @@ void QrsServiceImpl::search(RPCController *controller,
         SessionWorkItem *item = new SessionWorkItem(arpcSession);
         arpcSession->setPoolCache(_poolCache);
         arpcSession->setRunIdAllocator(_runIdAllocator);
-        string taskQueueName = request->taskqueuename();
-        if (taskQueueName.empty()) {
-            taskQueueName = DEFAULT_TASK_QUEUE_NAME;
-        }
-        pushSearchItem(taskQueueName, item);
+        pushSearchItem(getSearchTaskQueueName(request), item);
     } else {
         processFailedSession(snapshot, controller, request, response, done);
     }
@@ -408,6 +406,12 @@ void QrsServiceImpl::doReportMetrics() {
                     thdPoolItem.second * 100.f / it->second);
         }
     }
+    std::map<std::string, int64_t> laneLatencyMap = _threadPoolManager->getLaneQueueLatency();
+    for (auto&& laneItem : laneLatencyMap) {
+        std::string queueLatencyMetric = std::string("worker.queue_latency_") + laneItem.first;
+        REPORT_USER_MUTABLE_METRIC(_workerMetricsReporter, queueLatencyMetric,
+                laneItem.second / 1000.0);
+    }
 }
 multi_call::QuerySessionPtr QrsServiceImpl::constructQuerySession(
         const std::string& zoneName,
@@ -546,8 +550,19 @@ bool QrsServiceImpl::initThreadPoolManager() {
         }
         HA3_LOG(INFO, "adjust thread number form [%d] to [%d]", _workerParam.threadNumber, threadNum);
     }
-    if (!_threadPoolManager->addThreadPool(DEFAULT_TASK_QUEUE_NAME,
-                    _workerParam.queueSize, threadNum))
+    // the default task queue is a plain pool unless it is a work stealing lane
+    string workStealingTaskQueueConfig = WorkerParam::getEnv(
+            WORK_STEALING_TASK_QUEUE_CONFIG, "");
+    if (!workStealingTaskQueueConfig.empty()
+        && !_threadPoolManager->addWorkStealingThreadPool(workStealingTaskQueueConfig))
+    {
+        HA3_LOG(ERROR, "addWorkStealingThreadPool failed, workStealingTaskQueueConfig [%s]",
+                workStealingTaskQueueConfig.c_str());
+        return false;
+    }
+    if (!_threadPoolManager->hasTaskQueue(DEFAULT_TASK_QUEUE_NAME)
+        && !_threadPoolManager->addThreadPool(DEFAULT_TASK_QUEUE_NAME,
+                _workerParam.queueSize, threadNum))
     {
         HA3_LOG(ERROR, "addThreadPool failed, queue name [%s]",
                 DEFAULT_TASK_QUEUE_NAME.c_str());
@@ -572,19 +587,46 @@ bool QrsServiceImpl::initThreadPoolManager() {
     return true;
 }
 
+// requests without an explicit task queue go to the cheapest work stealing
+// lane whose max cost covers their estimated cost
+string QrsServiceImpl::getSearchTaskQueueName(const proto::QrsRequest *request) const {
+    const string &taskQueueName = request->taskqueuename();
+    if (!taskQueueName.empty()) {
+        return taskQueueName;
+    }
+    if (_threadPoolManager->hasCostLane()) {
+        double cost = RequestCostEstimator::estimate(request->assemblyquery());
+        string laneName = _threadPoolManager->getLaneByCost(cost);
+        if (!laneName.empty()) {
+            return laneName;
+        }
+    }
+    return DEFAULT_TASK_QUEUE_NAME;
+}
+
 void QrsServiceImpl::pushSearchItem(const string& taskQueueName, autil::WorkItem *item)
 {
-    ThreadPool* threadPool = _threadPoolManager->getThreadPool(taskQueueName);
-    if (!threadPool) {
-        threadPool = _threadPoolManager->getThreadPool(DEFAULT_TASK_QUEUE_NAME);
-        if (!threadPool) {
-            HA3_LOG(WARN, "pushWorkItem failed, not found taskQueue[%s]",
-                    DEFAULT_TASK_QUEUE_NAME.c_str());
-            if (item) {
-                item->drop();
-            }
+    const string &queueName = _threadPoolManager->hasTaskQueue(taskQueueName) ?
+                              taskQueueName : DEFAULT_TASK_QUEUE_NAME;
+    size_t lane = 0;
+    WorkStealingThreadPool *stealingPool =
+        _threadPoolManager->getWorkStealingThreadPool(queueName, lane);
+    if (stealingPool && item) {
+        if (stealingPool->pushWorkItem(item, lane) != ThreadPool::ERROR_NONE) {
+            HA3_LOG(ERROR, "Failed to push item into work stealing lane [%s]",
+                    queueName.c_str());
+            item->drop();
+        }
         return;
+    }
+    ThreadPool* threadPool = _threadPoolManager->getThreadPool(queueName);
+    if (!threadPool) {
+        HA3_LOG(WARN, "pushWorkItem failed, not found taskQueue[%s]",
+                queueName.c_str());
+        if (item) {
+            item->drop();
         }
+        return;
     }
     if (!item) {
         HA3_LOG(ERROR, "worker item is NULL");
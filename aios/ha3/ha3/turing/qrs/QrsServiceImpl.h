@@ -50,6 +50,7 @@ protected:
 private:
     bool initThreadPoolManager();
     void pushSearchItem(const std::string& taskQueueName, autil::WorkItem *item);
+    std::string getSearchTaskQueueName(const proto::QrsRequest *request) const;
 
     service::QrsArpcSession *constructQrsArpcSession(
             const QrsServiceSnapshotPtr &snapshot,
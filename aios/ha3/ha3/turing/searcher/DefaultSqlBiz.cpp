@@ -32,6 +32,10 @@ DefaultSqlBiz::DefaultSqlBiz() {
 
 DefaultSqlBiz::~DefaultSqlBiz() {
     _naviPtr.reset();
+    if (_scanThreadPool) {
+        _scanThreadPool->stop();
+        _scanThreadPool.reset();
+    }
 }
 
 tensorflow::Status DefaultSqlBiz::init(const std::string &bizName,
@@ -52,6 +56,13 @@ tensorflow::Status DefaultSqlBiz::preloadBiz() {
         return errors::Internal("parse sql config failed.");
     }
     HA3_LOG(INFO, "sql config : %s", autil::legacy::ToJsonString(_sqlConfigPtr).c_str());
+    if (_sqlConfigPtr->scanThreadNum > 0 && !_scanThreadPool) {
+        _scanThreadPool.reset(new autil::ThreadPool(_sqlConfigPtr->scanThreadNum,
+                        DEFAULT_SCAN_THREAD_QUEUE_SIZE));
+        if (!_scanThreadPool->start()) {
+            return errors::Internal("start sql scan thread pool failed.");
+        }
+    }
     return Status::OK();
 }
 
@@ -81,6 +92,7 @@ SessionResourcePtr DefaultSqlBiz::createSessionResource(uint32_t count) {
 
     sqlResource->range = range;
     sqlResource->naviPtr = _naviPtr;
+    sqlResource->scanThreadPool = _scanThreadPool;
     string configPath = _bizMeta.getLocalConfigPath();
     build_service::config::ResourceReaderPtr resourceReader(
             new build_service::config::ResourceReader(configPath));
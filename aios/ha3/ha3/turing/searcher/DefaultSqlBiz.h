@@ -12,6 +12,7 @@
 #include <suez/turing/search/Biz.h>
 #include <suez/search/BizMeta.h>
 #include <navi/engine/Navi.h>
+#include <autil/ThreadPool.h>
 #include <ha3/proto/BasicDefs.pb.h>
 #include <suez/turing/expression/util/TableInfo.h>
 #include <ha3/summary/SummaryProfileManagerCreator.h>
@@ -56,6 +57,7 @@ private:
     HA3_NS(sql)::AggFuncManagerPtr _aggFuncManager;
     HA3_NS(sql)::TvfFuncManagerPtr _tvfFuncManager;
     config::ResourceReaderPtr _resourceReaderPtr;
+    std::shared_ptr<autil::ThreadPool> _scanThreadPool;
 private:
     HA3_LOG_DECLARE();
 };
@@ -0,0 +1,109 @@
+#ifndef ISEARCH_LOSERTREE_H
+#define ISEARCH_LOSERTREE_H
+
+#include <ha3/common.h>
+#include <ha3/isearch.h>
+#include <vector>
+
+BEGIN_HA3_NAMESPACE(util);
+
+// k-way merge of sorted runs. internal nodes keep the loser of each match,
+// so popping the winner only replays one leaf-to-root path (log k compares).
+// Less(a, b) returns true if a should be output before b, equal items are
+// output in the order of the runs they come from.
+template<typename T, typename Less>
+class LoserTree
+{
+public:
+    LoserTree(Less less)
+        : _less(less)
+    {
+    }
+    ~LoserTree() {}
+private:
+    LoserTree(const LoserTree &);
+    LoserTree& operator=(const LoserTree &);
+public:
+    // runs should be added before init
+    void addRun(T *begin, T *end) {
+        _cursors.push_back(begin);
+        _ends.push_back(end);
+    }
+    void init() {
+        size_t k = _cursors.size();
+        _tree.assign(k, 0);
+        if (k > 0) {
+            _tree[0] = build(1);
+        }
+    }
+    bool empty() const {
+        return _tree.empty() || exhausted(_tree[0]);
+    }
+    T &top() const {
+        assert(!empty());
+        return *_cursors[_tree[0]];
+    }
+    void pop() {
+        assert(!empty());
+        size_t winner = _tree[0];
+        ++_cursors[winner];
+        size_t k = _cursors.size();
+        for (size_t node = (winner + k) >> 1; node > 0; node >>= 1) {
+            if (beats(_tree[node], winner)) {
+                std::swap(_tree[node], winner);
+            }
+        }
+        _tree[0] = winner;
+    }
+    size_t getRunCount() const {
+        return _cursors.size();
+    }
+    // items of the run not output yet
+    T *getRunCursor(size_t run) const {
+        return _cursors[run];
+    }
+    T *getRunEnd(size_t run) const {
+        return _ends[run];
+    }
+private:
+    bool exhausted(size_t run) const {
+        return _cursors[run] == _ends[run];
+    }
+    bool beats(size_t a, size_t b) {
+        if (exhausted(a)) {
+            return false;
+        }
+        if (exhausted(b)) {
+            return true;
+        }
+        if (_less(*_cursors[a], *_cursors[b])) {
+            return true;
+        }
+        return a < b && !_less(*_cursors[b], *_cursors[a]);
+    }
+    // leaves of run i are node i + k, returns the winner of the subtree
+    size_t build(size_t node) {
+        size_t k = _cursors.size();
+        if (node >= k) {
+            return node - k;
+        }
+        size_t left = build(node << 1);
+        size_t right = build((node << 1) + 1);
+        if (beats(left, right)) {
+            _tree[node] = right;
+            return left;
+        }
+        _tree[node] = left;
+        return right;
+    }
+private:
+    Less _less;
+    std::vector<T*> _cursors;
+    std::vector<T*> _ends;
+    // _tree[0] is the winner, _tree[1, k) are losers of internal nodes
+    std::vector<size_t> _tree;
+};
+
+END_HA3_NAMESPACE(util);
+
+#endif //ISEARCH_LOSERTREE_H
@@ -0,0 +1,92 @@
+#include<unittest/unittest.h>
+#include <ha3/common.h>
+#include <ha3/isearch.h>
+#include <ha3/util/Log.h>
+#include <ha3/util/LoserTree.h>
+
+using namespace std;
+BEGIN_HA3_NAMESPACE(util);
+
+class LoserTreeTest : public TESTBASE {
+public:
+    void setUp();
+    void tearDown();
+protected:
+    typedef pair<int32_t, int32_t> Item;
+    struct ItemLess {
+        bool operator() (const Item &lft, const Item &rht) {
+            return lft.first < rht.first;
+        }
+    };
+    void checkMerge(vector<vector<Item> > runs);
+protected:
+    HA3_LOG_DECLARE();
+};
+
+HA3_LOG_SETUP(util, LoserTreeTest);
+
+void LoserTreeTest::setUp() {
+    HA3_LOG(DEBUG, "setUp!");
+}
+
+void LoserTreeTest::tearDown() {
+    HA3_LOG(DEBUG, "tearDown!");
+}
+
+void LoserTreeTest::checkMerge(vector<vector<Item> > runs) {
+    vector<Item> expected;
+    LoserTree<Item, ItemLess> loserTree((ItemLess()));
+    for (auto &run : runs) {
+        expected.insert(expected.end(), run.begin(), run.end());
+        loserTree.addRun(run.data(), run.data() + run.size());
+    }
+    std::stable_sort(expected.begin(), expected.end(), ItemLess());
+    loserTree.init();
+    vector<Item> actual;
+    while (!loserTree.empty()) {
+        actual.push_back(loserTree.top());
+        loserTree.pop();
+    }
+    ASSERT_EQ(expected, actual);
+}
+
+TEST_F(LoserTreeTest, testEmpty) {
+    LoserTree<Item, ItemLess> loserTree((ItemLess()));
+    loserTree.init();
+    ASSERT_TRUE(loserTree.empty());
+    ASSERT_NO_FATAL_FAILURE(checkMerge({{}, {}, {}}));
+}
+
+TEST_F(LoserTreeTest, testMerge) {
+    ASSERT_NO_FATAL_FAILURE(checkMerge({{{1, 0}, {3, 1}, {5, 2}}}));
+    ASSERT_NO_FATAL_FAILURE(checkMerge({{{1, 0}, {4, 1}}, {{2, 2}, {3, 3}}, {}}));
+    // equal items keep the order of runs
+    ASSERT_NO_FATAL_FAILURE(checkMerge({{{1, 0}, {2, 1}, {2, 2}},
+                        {{2, 3}, {7, 4}},
+                        {{0, 5}, {2, 6}, {9, 7}},
+                        {{2, 8}},
+                        {{1, 9}, {3, 10}}}));
+}
+
+TEST_F(LoserTreeTest, testPartialMerge) {
+    vector<vector<Item> > runs(3);
+    for (int32_t i = 0; i < 30; ++i) {
+        runs[i % 3].push_back(Item(i, i));
+    }
+    LoserTree<Item, ItemLess> loserTree((ItemLess()));
+    for (auto &run : runs) {
+        loserTree.addRun(run.data(), run.data() + run.size());
+    }
+    loserTree.init();
+    for (int32_t i = 0; i < 4; ++i) {
+        ASSERT_EQ(i, loserTree.top().first);
+        loserTree.pop();
+    }
+    ASSERT_EQ((size_t)3, loserTree.getRunCount());
+    ASSERT_EQ(6, loserTree.getRunCursor(0)->first);
+    ASSERT_EQ(runs[0].data() + runs[0].size(), loserTree.getRunEnd(0));
+    ASSERT_EQ(4, loserTree.getRunCursor(1)->first);
+    ASSERT_EQ(5, loserTree.getRunCursor(2)->first);
+}
+
+END_HA3_NAMESPACE(util);
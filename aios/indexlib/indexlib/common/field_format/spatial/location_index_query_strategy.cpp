@@ -64,4 +64,34 @@ void LocationIndexQueryStrategy::CalculateTerms(
     }
 }
 
+void LocationIndexQueryStrategy::CalculateBoundaryAndInteriorTerms(
+        const ShapePtr& shape, vector<dictkey_t>& boundaryTerms,
+        vector<dictkey_t>& interiorTerms)
+{
+    // a location doc is a point, hitting a cell inside shape means inside shape
+    // lines have no interior
+    if (shape->GetType() == Shape::LINE)
+    {
+        interiorTerms.clear();
+        CalculateTerms(shape, boundaryTerms);
+        return;
+    }
+    std::vector<dictkey_t> coverCells;
+    std::vector<bool> interiorFlags;
+    GetShapeCoverCells(shape, coverCells, &interiorFlags);
+    assert(interiorFlags.size() == coverCells.size());
+    for (size_t i = 0; i < coverCells.size(); i++)
+    {
+        Cell::RemoveLeafTag(coverCells[i]);
+        if (interiorFlags[i])
+        {
+            interiorTerms.push_back(coverCells[i]);
+        }
+        else
+        {
+            boundaryTerms.push_back(coverCells[i]);
+        }
+    }
+}
+
 IE_NAMESPACE_END(common);
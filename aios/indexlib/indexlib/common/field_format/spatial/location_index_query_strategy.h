@@ -21,6 +21,9 @@ public:
     void CalculateDetailSearchLevel(Shape::ShapeType shapeType,
                                     double distance, uint8_t& detailLevel) override;
     void CalculateTerms(const ShapePtr& shape, std::vector<dictkey_t>& terms) override;
+    void CalculateBoundaryAndInteriorTerms(const ShapePtr& shape,
+            std::vector<dictkey_t>& boundaryTerms,
+            std::vector<dictkey_t>& interiorTerms) override;
     void GetPointCoveredCells(const PointPtr& point, std::vector<uint64_t>& coverCells) override
     {
         mShapeCover.GetPointCoveredCells(point, coverCells, true);
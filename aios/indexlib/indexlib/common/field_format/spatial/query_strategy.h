@@ -29,13 +29,22 @@ public:
     
 public:
     virtual void CalculateTerms(const ShapePtr& shape, std::vector<dictkey_t>& terms) = 0;
+    // interiorTerms: cells fully inside shape, docs hit by them need no refine
+    virtual void CalculateBoundaryAndInteriorTerms(const ShapePtr& shape,
+            std::vector<dictkey_t>& boundaryTerms,
+            std::vector<dictkey_t>& interiorTerms)
+    {
+        interiorTerms.clear();
+        CalculateTerms(shape, boundaryTerms);
+    }
 
 protected:
     virtual void GetPointCoveredCells(const PointPtr& point,
                                       std::vector<uint64_t>& coverCells) = 0;
     virtual void CalculateDetailSearchLevel(Shape::ShapeType type,
                                             double distance, uint8_t& detailLevel) = 0;
-    void GetShapeCoverCells(const ShapePtr& shape, std::vector<dictkey_t>& cells);
+    void GetShapeCoverCells(const ShapePtr& shape, std::vector<dictkey_t>& cells,
+                            std::vector<bool>* interiorFlags = NULL);
 
 protected:
     std::string mIndexName;
@@ -53,7 +62,8 @@ DEFINE_SHARED_PTR(QueryStrategy);
 
 /////////////////////////////////////////////////////////
 inline void QueryStrategy::GetShapeCoverCells(
-    const ShapePtr& shape, std::vector<dictkey_t>& coverCells)
+    const ShapePtr& shape, std::vector<dictkey_t>& coverCells,
+    std::vector<bool>* interiorFlags)
 {
     assert(shape);
     coverCells.clear();
@@ -63,6 +73,10 @@ inline void QueryStrategy::GetShapeCoverCells(
     {
         PointPtr point = DYNAMIC_POINTER_CAST(Point, shape);
         GetPointCoveredCells(point, coverCells);
+        if (interiorFlags)
+        {
+            interiorFlags->assign(coverCells.size(), false);
+        }
     }
     else if (type == Shape::CIRCLE)
     {
@@ -74,6 +88,18 @@ inline void QueryStrategy::GetShapeCoverCells(
         assert(rectangle);
         mShapeCover.GetShapeCoveredCells(rectangle, mMaxSearchTerms,
                 detailLevel, coverCells);
+        if (interiorFlags)
+        {
+            // cells are covered for bounding box, check them against circle
+            interiorFlags->resize(coverCells.size());
+            for (size_t i = 0; i < coverCells.size(); i++)
+            {
+                dictkey_t cellId = coverCells[i];
+                Cell::RemoveLeafTag(cellId);
+                (*interiorFlags)[i] =
+                    circle->IsInnerRectangle(Cell(cellId).GetCellRectangle());
+            }
+        }
     }
     else
     {
@@ -82,7 +108,7 @@ inline void QueryStrategy::GetShapeCoverCells(
         CalculateDetailSearchLevel(shape->GetType(),
             rectangle->CalculateDiagonalLength(), detailLevel);
         mShapeCover.GetShapeCoveredCells(shape, mMaxSearchTerms,
-                detailLevel, coverCells);
+                detailLevel, coverCells, interiorFlags);
     }
 
 }
@@ -8,6 +8,36 @@ using namespace autil;
 IE_NAMESPACE_BEGIN(common);
 IE_LOG_SETUP(common, Circle);
 
+namespace {
+const double HALF_PI = M_PI / 2;
+
+// taylor series on [-pi/2, pi/2], error below 1e-11. plain arithmetic
+// instead of libm calls, so that loops over points can be vectorized
+inline double PolySin(double x)
+{
+    double x2 = x * x;
+    return x * (1 + x2 * (-1.0 / 6 + x2 * (1.0 / 120 + x2 * (-1.0 / 5040
+                    + x2 * (1.0 / 362880 + x2 * (-1.0 / 39916800
+                    + x2 * (1.0 / 6227020800.0 + x2 * (-1.0 / 1307674368000.0))))))));
+}
+
+inline double PolyCos(double x)
+{
+    double x2 = x * x;
+    return 1 + x2 * (-1.0 / 2 + x2 * (1.0 / 24 + x2 * (-1.0 / 720
+                    + x2 * (1.0 / 40320 + x2 * (-1.0 / 3628800
+                    + x2 * (1.0 / 479001600.0 + x2 * (-1.0 / 87178291200.0
+                    + x2 * (1.0 / 20922789888000.0))))))));
+}
+
+// sin(x) == sin(FoldSinArg(x)) for x in [-pi, pi]
+inline double FoldSinArg(double x)
+{
+    x = x > HALF_PI ? M_PI - x : x;
+    return x < -HALF_PI ? -M_PI - x : x;
+}
+}
+
 Shape::Relation Circle::GetRelation(const Rectangle* other,
                                     DisjointEdges& disjointEdges) const 
 {
@@ -118,6 +148,119 @@ void Circle::InitAccessoryRectangle()
     mInsideBox = box;
 }
 
+void Circle::InitHaversineThreshold()
+{
+    mCenterLonRad = DistanceUtil::ToRadians(mPoint->GetX());
+    mCenterLatRad = DistanceUtil::ToRadians(mPoint->GetY());
+    mCosCenterLat = cos(mCenterLatRad);
+    double halfRadians = DistanceUtil::Dist2Radians(
+            mRadius, DistanceUtil::EARTH_MEAN_RADIUS) * 0.5;
+    if (halfRadians >= M_PI / 2)
+    {
+        mMaxHaversine = 1.0;
+        return;
+    }
+    double hsin = sin(halfRadians);
+    mMaxHaversine = hsin * hsin;
+}
+
+double Circle::GetMeridianMaxDistance(
+        double lon, double minLat, double maxLat) const
+{
+    double maxDist = max(GetDistance(lon, minLat), GetDistance(lon, maxLat));
+    // on a meridian, haversine(lat) = C + a * cos(lat) + b * sin(lat),
+    // which peaks at atan2(b, a)
+    double hsinX = sin((DistanceUtil::ToRadians(lon) - mCenterLonRad) * 0.5);
+    double a = mCosCenterLat * (hsinX * hsinX - 0.5);
+    double b = -0.5 * sin(mCenterLatRad);
+    double peakLat = DistanceUtil::ToDegrees(atan2(b, a));
+    if (peakLat > minLat && peakLat < maxLat)
+    {
+        maxDist = max(maxDist, GetDistance(lon, peakLat));
+    }
+    return maxDist;
+}
+
+bool Circle::IsInnerRectangle(const Rectangle* rect) const
+{
+    assert(rect);
+    if (mInsideBox && mInsideBox->GetRelation(rect) == CONTAINS)
+    {
+        return true;
+    }
+    if (!mBoundingBox || mBoundingBox->GetMaxX() - mBoundingBox->GetMinX() >= 180
+        || mBoundingBox->GetRelation(rect) != CONTAINS)
+    {
+        return false;
+    }
+    // along a parallel the distance grows with the longitude gap to center,
+    // so the farthest coordinate of rect lies on one of its meridian edges
+    return GetMeridianMaxDistance(rect->GetMinX(), rect->GetMinY(), rect->GetMaxY()) <= mRadius
+        && GetMeridianMaxDistance(rect->GetMaxX(), rect->GetMinY(), rect->GetMaxY()) <= mRadius;
+}
+
+void Circle::CalculateHaversines(const double* lons, const double* lats, size_t stride,
+                                 size_t count, double* haversines) const
+{
+    // invalid coordinates give garbage, callers mask them by IsValidCoordinate
+    const double degToRad = DistanceUtil::DEGREES_TO_RADIANS;
+    for (size_t i = 0; i < count; i++)
+    {
+        double lonRad = lons[i * stride] * degToRad;
+        double latRad = lats[i * stride] * degToRad;
+        double hsinX = PolySin(FoldSinArg((lonRad - mCenterLonRad) * 0.5));
+        double hsinY = PolySin(FoldSinArg((latRad - mCenterLatRad) * 0.5));
+        haversines[i] = hsinY * hsinY + mCosCenterLat * PolyCos(latRad) * hsinX * hsinX;
+    }
+}
+
+size_t Circle::CheckInnerCoordinates(const double* lons, const double* lats,
+                                     size_t count, uint8_t* mask) const
+{
+    static const size_t BATCH_SIZE = 64;
+    double haversines[BATCH_SIZE];
+    size_t passCount = 0;
+    for (size_t begin = 0; begin < count; begin += BATCH_SIZE)
+    {
+        size_t blockSize = min(BATCH_SIZE, count - begin);
+        const double* blockLons = lons + begin;
+        const double* blockLats = lats + begin;
+        uint8_t* blockMask = mask + begin;
+        CalculateHaversines(blockLons, blockLats, 1, blockSize, haversines);
+        for (size_t i = 0; i < blockSize; i++)
+        {
+            blockMask[i] = (uint8_t)(haversines[i] <= mMaxHaversine)
+                           & (uint8_t)(blockLons[i] >= MIN_X) & (uint8_t)(blockLons[i] <= MAX_X)
+                           & (uint8_t)(blockLats[i] >= MIN_Y) & (uint8_t)(blockLats[i] <= MAX_Y);
+            passCount += blockMask[i];
+        }
+    }
+    return passCount;
+}
+
+bool Circle::CheckAnyInnerCoordinate(const double* lonLats, size_t pointCount) const
+{
+    // haversine over a block of points, kept apart from the validity check
+    // so that the compiler can vectorize it
+    static const size_t BATCH_SIZE = 16;
+    double haversines[BATCH_SIZE];
+    for (size_t begin = 0; begin < pointCount; begin += BATCH_SIZE)
+    {
+        size_t count = min(BATCH_SIZE, pointCount - begin);
+        const double* coords = lonLats + 2 * begin;
+        CalculateHaversines(coords, coords + 1, 2, count, haversines);
+        for (size_t i = 0; i < count; i++)
+        {
+            if (haversines[i] <= mMaxHaversine
+                && IsValidCoordinate(coords[2 * i], coords[2 * i + 1]))
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 bool Circle::CheckInnerCoordinate(double lon, double lat) const
 {
     if (!mOptInnerCheck)
@@ -22,6 +22,7 @@ public:
         , mOptInnerCheck(true)
     {
         InitAccessoryRectangle();
+        InitHaversineThreshold();
     }
 
     ~Circle() {}
@@ -36,16 +37,27 @@ public:
 public:
     PointPtr GetCenter() const { return mPoint; }
     double GetRadius() const { return mRadius; }
+    // return true when every coordinate of rect is in circle
+    bool IsInnerRectangle(const Rectangle* rect) const;
 
 public:
     static CirclePtr FromString(const std::string& shapeStr);
 
 protected:
     bool CheckInnerCoordinate(double lon, double lat) const override;
+    bool CheckAnyInnerCoordinate(const double* lonLats,
+                                 size_t pointCount) const override;
+    size_t CheckInnerCoordinates(const double* lons, const double* lats,
+                                 size_t count, uint8_t* mask) const override;
 
 private:
+    // haversine terms of (lons[i * stride], lats[i * stride]) to center
+    void CalculateHaversines(const double* lons, const double* lats, size_t stride,
+                             size_t count, double* haversines) const;
     double GetDistance(double lon, double lat) const;
+    double GetMeridianMaxDistance(double lon, double minLat, double maxLat) const;
     void InitAccessoryRectangle();
+    void InitHaversineThreshold();
     
 private:
     PointPtr mPoint;
@@ -53,6 +65,11 @@ private:
     RectanglePtr mInsideBox;
     RectanglePtr mBoundingBox;
     bool mOptInnerCheck;
+    // haversine term of mRadius, compared against points without asin/sqrt
+    double mCenterLonRad;
+    double mCenterLatRad;
+    double mCosCenterLat;
+    double mMaxHaversine;
     
 private:
     IE_LOG_DECLARE();
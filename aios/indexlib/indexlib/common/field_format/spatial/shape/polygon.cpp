@@ -216,5 +216,54 @@ bool Polygon::IsInPolygon(const Point& p) const
     return c;
 }
 
+bool Polygon::CheckAnyInnerCoordinate(const double* lonLats, size_t pointCount) const
+{
+    // same crossing rule as IsInPolygon, but edge major: each edge is tested
+    // against a block of points in a loop the compiler can vectorize
+    static const size_t BATCH_SIZE = 16;
+    RectanglePtr boundingBox = GetBoundingBox();
+    size_t edgeNum = mPointVec.size();
+    double xs[BATCH_SIZE];
+    double ys[BATCH_SIZE];
+    uint8_t crossings[BATCH_SIZE];
+    for (size_t begin = 0; begin < pointCount; begin += BATCH_SIZE)
+    {
+        size_t count = min(BATCH_SIZE, pointCount - begin);
+        for (size_t k = 0; k < count; k++)
+        {
+            xs[k] = lonLats[2 * (begin + k)];
+            ys[k] = lonLats[2 * (begin + k) + 1];
+            crossings[k] = 0;
+        }
+        for (size_t i = 0, j = edgeNum - 1; i < edgeNum; j = i++)
+        {
+            double pIx = mPointVec[i].GetX(), pIy = mPointVec[i].GetY();
+            double pJx = mPointVec[j].GetX(), pJy = mPointVec[j].GetY();
+            double xJ2I = pJx - pIx;
+            double yJ2I = pJy - pIy;
+            for (size_t k = 0; k < count; k++)
+            {
+                double y = ys[k];
+                bool straddle = (pIy > y) != (pJy > y);
+                // evaluated even when edge is horizontal, masked by straddle
+                bool left = xs[k] < xJ2I * (y - pIy) / yJ2I + pIx;
+                crossings[k] ^= (uint8_t)(straddle & left);
+            }
+        }
+        for (size_t k = 0; k < count; k++)
+        {
+            double x = xs[k], y = ys[k];
+            if (crossings[k]
+                && x >= boundingBox->GetMinX() && x <= boundingBox->GetMaxX()
+                && y >= boundingBox->GetMinY() && y <= boundingBox->GetMaxY()
+                && IsValidCoordinate(x, y))
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 IE_NAMESPACE_END(common);
 
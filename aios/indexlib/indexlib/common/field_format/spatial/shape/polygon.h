@@ -36,6 +36,8 @@ public:
     std::string ToString() const override;
     bool CheckInnerCoordinate(double lon, double lat) const override
     { return IsInPolygon(Point(lon, lat)); }
+    bool CheckAnyInnerCoordinate(const double* lonLats,
+                                 size_t pointCount) const override;
 
 public:
     bool IsInPolygon(const Point& p) const;
@@ -84,6 +84,25 @@ public:
         return CheckInnerCoordinate(lon, lat);
     }
 
+    // lonLats holds pointCount (lon, lat) pairs,
+    // return true when any of them is in shape
+    bool HasInnerCoordinate(const double* lonLats, size_t pointCount) const
+    {
+        if (pointCount == 1)
+        {
+            return IsInnerCoordinate(lonLats[0], lonLats[1]);
+        }
+        return CheckAnyInnerCoordinate(lonLats, pointCount);
+    }
+
+    // one point per doc, (lons[i], lats[i]) for i in [0, count),
+    // mask[i] is set to 1 when the point is in shape, return passed count
+    size_t BatchIsInnerCoordinate(const double* lons, const double* lats,
+                                  size_t count, uint8_t* mask) const
+    {
+        return CheckInnerCoordinates(lons, lats, count, mask);
+    }
+
 protected:
     static const double MAX_X;
     static const double MAX_Y;
@@ -102,6 +121,31 @@ protected:
 protected:
     // return true when point(lon, lat) in shape
     virtual bool CheckInnerCoordinate(double lon, double lat) const = 0;
+    // batch version of IsInnerCoordinate, shapes with a cheaper vectorizable
+    // test override it
+    virtual bool CheckAnyInnerCoordinate(const double* lonLats,
+                                         size_t pointCount) const
+    {
+        for (size_t i = 0; i < pointCount; i++)
+        {
+            if (IsInnerCoordinate(lonLats[2 * i], lonLats[2 * i + 1]))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+    virtual size_t CheckInnerCoordinates(const double* lons, const double* lats,
+                                         size_t count, uint8_t* mask) const
+    {
+        size_t passCount = 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            mask[i] = IsInnerCoordinate(lons[i], lats[i]) ? 1 : 0;
+            passCount += mask[i];
+        }
+        return passCount;
+    }
 
 protected:
     mutable RectanglePtr mBoundingBox;
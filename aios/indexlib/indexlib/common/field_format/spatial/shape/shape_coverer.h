@@ -24,16 +24,19 @@ public:
                               std::vector<uint64_t>& coverCell,
                               bool onlyGetDetailCell);
     //not support for point search
+    //interiorFlags[i] is set when coverCell[i] is fully contained by shape
     void GetShapeCoveredCells(const ShapePtr& shape,
                               size_t maxSearchTerms,
                               int8_t searchDetailLevel,
-                              std::vector<uint64_t>& coverCell);
+                              std::vector<uint64_t>& coverCell,
+                              std::vector<bool>* interiorFlags = NULL);
 private:
     void SearchSubCells(const ShapePtr& shape, 
                         const Cell& curCell,
                         std::queue<Cell>& searchCells,
                         std::vector<uint64_t>& resultCells,
-                        int8_t searchDetailLevel);
+                        int8_t searchDetailLevel,
+                        std::vector<bool>* interiorFlags);
     void HandleIntersectCell(Cell& curCell,
                              int8_t searchDetailLevel,
                              std::queue<Cell>& cellsToSearch, 
@@ -148,10 +151,15 @@ inline bool ShapeCoverer::NeedKeepSearch(
 
 inline void ShapeCoverer::GetShapeCoveredCells(
         const ShapePtr& shape, size_t maxSearchTerms,
-        int8_t searchDetailLevel, std::vector<uint64_t>& coverCells)
+        int8_t searchDetailLevel, std::vector<uint64_t>& coverCells,
+        std::vector<bool>* interiorFlags)
 {
     assert(shape->GetType() != Shape::POINT);
     coverCells.clear();
+    if (interiorFlags)
+    {
+        interiorFlags->clear();
+    }
     std::queue<Cell> searchCells; //search cells: intersect, contains shape
     searchCells.push(Cell(GeoHashUtil::ZERO_LEVEL_HASH_ID));
     while (NeedKeepSearch(searchCells, coverCells, maxSearchTerms))
@@ -159,7 +167,7 @@ inline void ShapeCoverer::GetShapeCoveredCells(
         Cell curSearchCell = searchCells.front();
         searchCells.pop();
         SearchSubCells(shape, curSearchCell, searchCells, 
-                       coverCells, searchDetailLevel);
+                       coverCells, searchDetailLevel, interiorFlags);
     }
 
     while (!searchCells.empty())
@@ -169,12 +177,17 @@ inline void ShapeCoverer::GetShapeCoveredCells(
         coverCells.push_back(cell.GetCellId());
         searchCells.pop();
     }
+    if (interiorFlags)
+    {
+        interiorFlags->resize(coverCells.size(), false);
+    }
 
 }
 
 inline void ShapeCoverer::SearchSubCells(const ShapePtr& shape, 
         const Cell& curCell, std::queue<Cell>& searchCells,
-        std::vector<uint64_t>& resultCells, int8_t searchDetailLevel)
+        std::vector<uint64_t>& resultCells, int8_t searchDetailLevel,
+        std::vector<bool>* interiorFlags)
 {
     std::vector<Cell> subCells;
     curCell.GetSubCells(subCells);
@@ -194,7 +207,13 @@ inline void ShapeCoverer::SearchSubCells(const ShapePtr& shape,
         }
         else if (relation == Shape::CONTAINS)
         {
+            size_t beginPos = resultCells.size();
             HandleContainsCell(curSubCell, resultCells);
+            if (interiorFlags)
+            {
+                interiorFlags->resize(beginPos, false);
+                interiorFlags->resize(resultCells.size(), true);
+            }
         }        
         else if (relation == Shape::INTERSECTS)
         {
@@ -180,5 +180,115 @@ void CircleTest::TestIsInnerCoordinate()
 
 
 
-IE_NAMESPACE_END(common);
+void CircleTest::TestIsInnerRectangle()
+{
+    PointPtr center(new Point(120.2, 30.25));
+    Circle circle(center, 5000);
+    Rectangle innerRect(120.19, 30.24, 120.21, 30.26);
+    ASSERT_TRUE(circle.IsInnerRectangle(&innerRect));
+    Rectangle crossRect(120.19, 30.24, 120.3, 30.26);
+    ASSERT_FALSE(circle.IsInnerRectangle(&crossRect));
+    Rectangle outerRect(121.0, 31.0, 121.1, 31.1);
+    ASSERT_FALSE(circle.IsInnerRectangle(&outerRect));
+
+    // every coordinate of an inner rectangle should be in circle
+    for (double radius = 100; radius <= 1000000; radius *= 10)
+    {
+        for (double lat = -80; lat <= 80; lat += 20)
+        {
+            Circle testCircle(PointPtr(new Point(10, lat)), radius);
+            RectanglePtr boundBox = testCircle.GetBoundingBox();
+            double step = (boundBox->GetMaxY() - boundBox->GetMinY()) / 8;
+            for (double x = boundBox->GetMinX(); x + step <= boundBox->GetMaxX(); x += step)
+            {
+                for (double y = boundBox->GetMinY(); y + step <= boundBox->GetMaxY(); y += step)
+                {
+                    RectanglePtr rect(new Rectangle(x, y, x + step, y + step));
+                    if (!testCircle.IsInnerRectangle(rect.get()))
+                    {
+                        continue;
+                    }
+                    RectanglePointIterator pointIter(rect, 0.1);
+                    for (RectanglePointIterator::Iterator iter = pointIter.Begin();
+                         iter != pointIter.End(); iter++)
+                    {
+                        ASSERT_TRUE(testCircle.IsInnerCoordinate(iter->first, iter->second))
+                            << testCircle.ToString() << "#" << rect->ToString();
+                    }
+                }
+            }
+        }
+    }
+}
 
+void CircleTest::TestCheckAnyInnerCoordinate()
+{
+    srand(100);
+    for (double radius = 100; radius <= 10000000; radius *= 10)
+    {
+        Circle circle(PointPtr(new Point(120.2, 30.25)), radius);
+        RectanglePtr boundBox = circle.GetBoundingBox();
+        double width = boundBox->GetMaxX() - boundBox->GetMinX();
+        double height = boundBox->GetMaxY() - boundBox->GetMinY();
+        for (size_t pointCount = 1; pointCount <= 40; pointCount++)
+        {
+            vector<double> lonLats;
+            bool expected = false;
+            for (size_t i = 0; i < pointCount; i++)
+            {
+                double lon = boundBox->GetMinX() - width / 2 + width * 2 * rand() / RAND_MAX;
+                double lat = boundBox->GetMinY() - height / 2 + height * 2 * rand() / RAND_MAX;
+                lonLats.push_back(lon);
+                lonLats.push_back(lat);
+                expected = expected || circle.IsInnerCoordinate(lon, lat);
+            }
+            ASSERT_EQ(expected, circle.HasInnerCoordinate(lonLats.data(), pointCount))
+                << circle.ToString() << "#" << pointCount;
+        }
+    }
+    // invalid coordinate never hits
+    Circle circle(PointPtr(new Point(180, 0)), 1000000);
+    double lonLats[] = { 181, 0, 181, 0 };
+    ASSERT_FALSE(circle.HasInnerCoordinate(lonLats, 2));
+}
+
+void CircleTest::TestBatchIsInnerCoordinate()
+{
+    srand(100);
+    for (double radius = 100; radius <= 10000000; radius *= 10)
+    {
+        Circle circle(PointPtr(new Point(120.2, 30.25)), radius);
+        RectanglePtr boundBox = circle.GetBoundingBox();
+        double width = boundBox->GetMaxX() - boundBox->GetMinX();
+        double height = boundBox->GetMaxY() - boundBox->GetMinY();
+        // cross the inner block size
+        size_t pointCount = 150;
+        vector<double> lons;
+        vector<double> lats;
+        size_t expectedCount = 0;
+        for (size_t i = 0; i < pointCount; i++)
+        {
+            lons.push_back(boundBox->GetMinX() - width / 2 + width * 2 * rand() / RAND_MAX);
+            lats.push_back(boundBox->GetMinY() - height / 2 + height * 2 * rand() / RAND_MAX);
+            expectedCount += circle.IsInnerCoordinate(lons[i], lats[i]) ? 1 : 0;
+        }
+        vector<uint8_t> mask(pointCount, 2);
+        ASSERT_EQ(expectedCount, circle.BatchIsInnerCoordinate(
+                        lons.data(), lats.data(), pointCount, mask.data()));
+        for (size_t i = 0; i < pointCount; i++)
+        {
+            ASSERT_EQ(circle.IsInnerCoordinate(lons[i], lats[i]) ? 1 : 0, (int)mask[i])
+                << circle.ToString() << "#" << i;
+        }
+    }
+    // invalid coordinate never hits
+    Circle circle(PointPtr(new Point(180, 0)), 1000000);
+    double lons[] = { 181, 180 };
+    double lats[] = { 0, 0 };
+    uint8_t mask[2];
+    ASSERT_EQ((size_t)1, circle.BatchIsInnerCoordinate(lons, lats, 2, mask));
+    ASSERT_EQ(0, (int)mask[0]);
+    ASSERT_EQ(1, (int)mask[1]);
+}
+
+IE_NAMESPACE_END(common);
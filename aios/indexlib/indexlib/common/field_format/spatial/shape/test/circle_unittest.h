@@ -23,6 +23,9 @@ public:
     void TestFromString();
     void TestInsideRectangle();
     void TestIsInnerCoordinate();
+    void TestIsInnerRectangle();
+    void TestCheckAnyInnerCoordinate();
+    void TestBatchIsInnerCoordinate();
     
 private:
     IE_LOG_DECLARE();
@@ -32,6 +35,9 @@ INDEXLIB_UNIT_TEST_CASE(CircleTest, TestGetBoundingBox);
 INDEXLIB_UNIT_TEST_CASE(CircleTest, TestFromString);
 INDEXLIB_UNIT_TEST_CASE(CircleTest, TestInsideRectangle);
 INDEXLIB_UNIT_TEST_CASE(CircleTest, TestIsInnerCoordinate);
+INDEXLIB_UNIT_TEST_CASE(CircleTest, TestIsInnerRectangle);
+INDEXLIB_UNIT_TEST_CASE(CircleTest, TestCheckAnyInnerCoordinate);
+INDEXLIB_UNIT_TEST_CASE(CircleTest, TestBatchIsInnerCoordinate);
 
 IE_NAMESPACE_END(common);
 
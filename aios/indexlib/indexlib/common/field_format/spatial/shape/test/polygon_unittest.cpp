@@ -98,6 +98,34 @@ void PolygonTest::TestIsInPolygon()
     ASSERT_FALSE(polygon->IsInPolygon(Point(0, 0)));
 }
 
+void PolygonTest::TestCheckAnyInnerCoordinate()
+{
+    // concave polygon with a horizontal edge
+    PolygonPtr polygon = Polygon::FromString(
+            "0 0,0 30,30 30,30 0,18 0,15 15,7 0,0 0");
+    ASSERT_TRUE(polygon);
+    srand(100);
+    for (size_t pointCount = 1; pointCount <= 40; pointCount++)
+    {
+        vector<double> lonLats;
+        bool expected = false;
+        for (size_t i = 0; i < pointCount; i++)
+        {
+            double lon = -10 + 50.0 * rand() / RAND_MAX;
+            double lat = -10 + 50.0 * rand() / RAND_MAX;
+            lonLats.push_back(lon);
+            lonLats.push_back(lat);
+            expected = expected || polygon->IsInnerCoordinate(lon, lat);
+        }
+        ASSERT_EQ(expected, polygon->HasInnerCoordinate(lonLats.data(), pointCount))
+            << pointCount;
+    }
+    double notInLonLats[] = { 15, 5, 35, 35, -1, 10 };
+    ASSERT_FALSE(polygon->HasInnerCoordinate(notInLonLats, 3));
+    double inLonLats[] = { 15, 5, 35, 35, 5, 10 };
+    ASSERT_TRUE(polygon->HasInnerCoordinate(inLonLats, 3));
+}
+
 void PolygonTest::TestGetRelationForConvex()
 {
     PolygonPtr polygon = Polygon::FromString(
@@ -21,6 +21,7 @@ public:
     void CaseTearDown() override;
     void TestFromString();
     void TestIsInPolygon();
+    void TestCheckAnyInnerCoordinate();
     void TestGetRelationForConvex();
     void TestGetRelationForConcave();
     void TestGetRelationForPole();
@@ -32,6 +33,7 @@ private:
 
 INDEXLIB_UNIT_TEST_CASE(PolygonTest, TestFromString);
 INDEXLIB_UNIT_TEST_CASE(PolygonTest, TestIsInPolygon);
+INDEXLIB_UNIT_TEST_CASE(PolygonTest, TestCheckAnyInnerCoordinate);
 INDEXLIB_UNIT_TEST_CASE(PolygonTest, TestGetRelationForConvex);
 INDEXLIB_UNIT_TEST_CASE(PolygonTest, TestGetRelationForConcave);
 INDEXLIB_UNIT_TEST_CASE(PolygonTest, TestGetRelationForPole);
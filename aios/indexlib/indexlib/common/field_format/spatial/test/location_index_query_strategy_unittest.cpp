@@ -95,6 +95,49 @@ void LocationIndexQueryStrategyTest::TestCalculateTerms()
     }
 }
 
+void LocationIndexQueryStrategyTest::TestCalculateBoundaryAndInteriorTerms()
+{
+    InnerTestBoundaryAndInteriorTerms("point", "120.2 30.25", false);
+    InnerTestBoundaryAndInteriorTerms("rectangle", "120.0 30.1,120.4 30.4", true);
+    InnerTestBoundaryAndInteriorTerms("circle", "120.2 30.25,10000", true);
+    InnerTestBoundaryAndInteriorTerms("polygon",
+            "120.0 30.1,120.0 30.4,120.2 30.3,120.4 30.4,120.4 30.1,120.0 30.1", true);
+    InnerTestBoundaryAndInteriorTerms("line", "120.0 30.1,120.4 30.4", false);
+}
+
+void LocationIndexQueryStrategyTest::InnerTestBoundaryAndInteriorTerms(
+        const string& shapeName, const string& shapeStr, bool expectInterior)
+{
+    ShapePtr shape = ShapeCreator::Create(shapeName, shapeStr);
+    ASSERT_TRUE(shape);
+    LocationIndexQueryStrategy strategy(4, 11, "", 0.05);
+    vector<dictkey_t> terms;
+    strategy.CalculateTerms(shape, terms);
+    vector<dictkey_t> boundaryTerms;
+    vector<dictkey_t> interiorTerms;
+    strategy.CalculateBoundaryAndInteriorTerms(shape, boundaryTerms, interiorTerms);
+    ASSERT_EQ(expectInterior, !interiorTerms.empty()) << shapeStr;
+
+    // split terms cover the same cells as CalculateTerms
+    set<dictkey_t> expectTerms(terms.begin(), terms.end());
+    set<dictkey_t> actualTerms(boundaryTerms.begin(), boundaryTerms.end());
+    actualTerms.insert(interiorTerms.begin(), interiorTerms.end());
+    ASSERT_EQ(terms.size(), boundaryTerms.size() + interiorTerms.size());
+    ASSERT_TRUE(expectTerms == actualTerms) << shapeStr;
+
+    for (size_t i = 0; i < interiorTerms.size(); i++)
+    {
+        Rectangle* rect = Cell(interiorTerms[i]).GetCellRectangle();
+        double midX = (rect->GetMinX() + rect->GetMaxX()) / 2;
+        double midY = (rect->GetMinY() + rect->GetMaxY()) / 2;
+        ASSERT_TRUE(shape->IsInnerCoordinate(rect->GetMinX(), rect->GetMinY()));
+        ASSERT_TRUE(shape->IsInnerCoordinate(rect->GetMinX(), rect->GetMaxY()));
+        ASSERT_TRUE(shape->IsInnerCoordinate(rect->GetMaxX(), rect->GetMinY()));
+        ASSERT_TRUE(shape->IsInnerCoordinate(rect->GetMaxX(), rect->GetMaxY()));
+        ASSERT_TRUE(shape->IsInnerCoordinate(midX, midY));
+    }
+}
+
 void LocationIndexQueryStrategyTest::ExtractExpectedTerms(
         const std::string& geoHashStr,
         std::set<uint64_t>& terms)
@@ -22,8 +22,11 @@ public:
     void TestSimpleProcess();
     void TestCircle();
     void TestCalculateTerms();
+    void TestCalculateBoundaryAndInteriorTerms();
 
 private:
+    void InnerTestBoundaryAndInteriorTerms(const std::string& shapeName,
+            const std::string& shapeStr, bool expectInterior);
     void InnerTestStrategy(const std::string& shapeName, 
                            const std::string& shapeStr,
                            const uint8_t expectDetailLevel);
@@ -38,6 +41,7 @@ private:
 INDEXLIB_UNIT_TEST_CASE(LocationIndexQueryStrategyTest, TestSimpleProcess);
 INDEXLIB_UNIT_TEST_CASE(LocationIndexQueryStrategyTest, TestCircle);
 INDEXLIB_UNIT_TEST_CASE(LocationIndexQueryStrategyTest, TestCalculateTerms);
+INDEXLIB_UNIT_TEST_CASE(LocationIndexQueryStrategyTest, TestCalculateBoundaryAndInteriorTerms);
 
 IE_NAMESPACE_END(common);
 
@@ -7,6 +7,7 @@
 #include "indexlib/config/index_partition_options.h"
 #include "indexlib/file_system/indexlib_file_system_creator.h"
 #include "indexlib/file_system/file_block_cache.h"
+#include "indexlib/file_system/access_profile.h"
 #include "indexlib/util/memory_control/partition_memory_quota_controller.h"
 #include "indexlib/util/memory_control/memory_quota_controller_creator.h"
 #include "indexlib/storage/file_system_wrapper.h"
@@ -21,10 +22,11 @@ public:
             const config::IndexPartitionOptions& options,
             misc::MetricProviderPtr metricProvider,
             const util::PartitionMemoryQuotaControllerPtr& controller,
-            const file_system::FileBlockCachePtr& fileBlockCache)
+            const file_system::FileBlockCachePtr& fileBlockCache,
+            const file_system::AccessProfilePtr& accessProfile = file_system::AccessProfilePtr())
     {
         file_system::FileSystemOptions fileSystemOptions = CreateFileSystemOptions(
-                rootDir, options, controller, fileBlockCache);
+                rootDir, options, controller, fileBlockCache, accessProfile);
         return file_system::IndexlibFileSystemCreator::Create(rootDir, secondaryRootDir,
                 metricProvider, fileSystemOptions);
     }
@@ -47,7 +49,8 @@ private:
             const std::string& rootDir,
             const config::IndexPartitionOptions& options,
             const util::PartitionMemoryQuotaControllerPtr& controller,
-            const file_system::FileBlockCachePtr& fileBlockCache)
+            const file_system::FileBlockCachePtr& fileBlockCache,
+            const file_system::AccessProfilePtr& accessProfile)
     {
         file_system::FileSystemOptions fileSystemOptions;
         const config::OnlineConfig& onlineConfig = options.GetOnlineConfig();
@@ -82,6 +85,7 @@ private:
 
         fileSystemOptions.memoryQuotaController = controller;
         fileSystemOptions.fileBlockCache = fileBlockCache;
+        fileSystemOptions.accessProfile = accessProfile;
         return fileSystemOptions;
     }
 };
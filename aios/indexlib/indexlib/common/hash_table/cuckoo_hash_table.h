@@ -52,6 +52,8 @@ public:
     static const uint32_t BLOCK_SIZE = 4;
     static const uint64_t MAX_NUM_BFS_TREE_NODE = 1048576UL; // 1 << 20
     static constexpr double STRETCH_MEM_RATIO = 0.01;
+    // keys prefetched together in BatchFind, bounded by outstanding cache misses
+    static const size_t BATCH_FIND_GROUP_SIZE = 16;
 
 public:
     typedef typename ClosedHashTableTraits<_KT, _VT, useCompactBucket>::Bucket Bucket;
@@ -88,6 +90,9 @@ public:
     bool Delete(const _KT& key, const _VT& value = _VT());
     misc::Status Find(const _KT& key, const _VT*& value) const;
     misc::Status FindForReadWrite(const _KT& key, _VT& value) const;
+    // same as Find for each key, both candidate blocks of all keys are prefetched first
+    void BatchFind(const _KT* keys, size_t count,
+                   const _VT** values, misc::Status* status) const;
     uint64_t Size() const { return Header()->keyCount; }
     uint64_t Capacity() const { return BucketCountToCapacity(mBucketCount, mOccupancyPct); }
     bool IsFull() const { return Size() >= Capacity(); }
@@ -131,6 +136,8 @@ private:
     static uint64_t BucketCountToCapacity(uint64_t bucketCount, int32_t occupancyPct);
     bool ReHash(uint64_t newBucketCount);
     const Bucket* FindBucketForRead(const _KT& key, uint8_t numHashFunc) const;
+    const Bucket* FindBucketInBlocks(const _KT& key, uint8_t numHashFunc,
+            uint64_t bucketId, uint64_t nextId) const;
     template <typename functor>
     bool InternalInsert(const _KT key, const _VT& value);
     Bucket* BFSFindBucket(TreeNodeVec& bfsTree);
@@ -402,6 +409,39 @@ inline misc::Status CuckooHashTable<_KT, _VT, HasSpecialKey, useCompactBucket>::
     return bucket->IsDeleted() ? misc::DELETED : misc::OK;
 }
 
+template<typename _KT, typename _VT, bool HasSpecialKey, bool useCompactBucket>
+inline void CuckooHashTable<_KT, _VT, HasSpecialKey, useCompactBucket>::BatchFind(
+        const _KT* keys, size_t count, const _VT** values, misc::Status* status) const
+{
+    uint64_t bucketIds[BATCH_FIND_GROUP_SIZE];
+    uint64_t nextIds[BATCH_FIND_GROUP_SIZE];
+    for (size_t begin = 0; begin < count; begin += BATCH_FIND_GROUP_SIZE)
+    {
+        size_t groupSize = (count - begin < BATCH_FIND_GROUP_SIZE) ?
+                           count - begin : BATCH_FIND_GROUP_SIZE;
+        const _KT* groupKeys = keys + begin;
+        for (size_t i = 0; i < groupSize; ++i)
+        {
+            bucketIds[i] = GetFirstBucketIdInBlock(CuckooHash(groupKeys[i], 0), mBlockCount);
+            __builtin_prefetch(&(mBucket[bucketIds[i]]), 0, 1);
+            nextIds[i] = GetFirstBucketIdInBlock(CuckooHash(groupKeys[i], 1), mBlockCount);
+            __builtin_prefetch(&(mBucket[nextIds[i]]), 0, 1);
+        }
+        for (size_t i = 0; i < groupSize; ++i)
+        {
+            const Bucket* bucket = FindBucketInBlocks(
+                    groupKeys[i], mNumHashFunc, bucketIds[i], nextIds[i]);
+            if (bucket == NULL)
+            {
+                status[begin + i] = misc::NOT_FOUND;
+                continue;
+            }
+            values[begin + i] = &(bucket->Value());
+            status[begin + i] = bucket->IsDeleted() ? misc::DELETED : misc::OK;
+        }
+    }
+}
+
 template<typename _KT, typename _VT, bool HasSpecialKey, bool useCompactBucket>
 inline misc::Status CuckooHashTable<_KT, _VT, HasSpecialKey, useCompactBucket>::FindForReadWrite(
         const _KT& key, _VT& value) const
@@ -809,6 +849,14 @@ CuckooHashTable<_KT, _VT, HasSpecialKey, useCompactBucket>::FindBucketForRead(
     const _KT& hash = CuckooHash(key, 1);
     uint64_t nextId = GetFirstBucketIdInBlock(hash, mBlockCount);
     __builtin_prefetch(&(mBucket[nextId]), 0, 1);
+    return FindBucketInBlocks(key, numHashFunc, bucketId, nextId);
+}
+
+template<typename _KT, typename _VT, bool HasSpecialKey, bool useCompactBucket>
+inline const typename CuckooHashTable<_KT, _VT, HasSpecialKey, useCompactBucket>::Bucket*
+CuckooHashTable<_KT, _VT, HasSpecialKey, useCompactBucket>::FindBucketInBlocks(
+        const _KT& key, uint8_t numHashFunc, uint64_t bucketId, uint64_t nextId) const
+{
     for (uint32_t inBlockId = 0; inBlockId < BLOCK_SIZE; ++inBlockId)
     {// line 1, hash = key
         const Bucket& curBucket = mBucket[bucketId + inBlockId];
@@ -1117,6 +1165,24 @@ public:
         return bucket->IsDeleted() ? misc::DELETED : misc::OK;
     }
 
+    void BatchFind(const _KT* keys, size_t count,
+                   const _VT** values, misc::Status* status) const
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (unlikely(Bucket::IsEmptyKey(keys[i]) || Bucket::IsDeleteKey(keys[i])))
+            {
+                // rare, special keys live out of bucket array
+                for (size_t j = 0; j < count; ++j)
+                {
+                    status[j] = Find(keys[j], values[j]);
+                }
+                return;
+            }
+        }
+        Base::BatchFind(keys, count, values, status);
+    }
+
     misc::Status FindForReadWrite(const _KT& key, _VT& value) const
     {
         if (likely(!Bucket::IsEmptyKey(key) && !Bucket::IsDeleteKey(key)))
@@ -2,6 +2,7 @@
 #define __INDEXLIB_CUCKOO_HASH_TABLE_FILE_READER_H
 
 #include <tr1/memory>
+#include <algorithm>
 #include <autil/mem_pool/Pool.h>
 #include "indexlib/indexlib.h"
 
@@ -99,10 +100,45 @@ public:
         file_system::ReadOption option;
         option.blockCounter = blockCounter;
         option.advice = storage::IO_ADVICE_LOW_LATENCY;        
+        uint64_t firstBucketId = HashTable::GetFirstBucketIdInBlock(
+                HashTable::CuckooHash(key, 0), mBlockCount);
+        return InternalFind(key, firstBucketId, value, option);
+    }
+
+    // same as Find for each key, keys are resolved in first block order
+    // so that file is read forward and shared blocks stay hot in cache
+    void BatchFind(const _KT* keys, size_t count, _VT* values, misc::Status* status,
+                   file_system::BlockAccessCounter* blockCounter) const
+    {
+        file_system::ReadOption option;
+        option.blockCounter = blockCounter;
+        option.advice = storage::IO_ADVICE_LOW_LATENCY;
+        std::vector<std::pair<uint64_t, uint32_t> > order(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            uint64_t firstBucketId = HashTable::GetFirstBucketIdInBlock(
+                    HashTable::CuckooHash(keys[i], 0), mBlockCount);
+            order[i] = std::make_pair(firstBucketId, (uint32_t)i);
+        }
+        std::sort(order.begin(), order.end());
+        for (size_t i = 0; i < count; ++i)
+        {
+            uint32_t idx = order[i].second;
+            status[idx] = InternalFind(keys[idx], order[i].first, values[idx], option);
+        }
+    }
+
+    uint64_t Size() const { return mKeyCount; }
+    bool IsFull() const { return true; }
+
+private:
+    misc::Status InternalFind(const _KT& key, uint64_t firstBucketId, _VT& value,
+                              file_system::ReadOption& option) const
+    {
         for (uint32_t hashCnt = 0; hashCnt < mNumHashFunc; ++hashCnt)
         {
-            const _KT& hash = HashTable::CuckooHash(key, hashCnt);
-            uint64_t bucketId = HashTable::GetFirstBucketIdInBlock(hash, mBlockCount);
+            uint64_t bucketId = (hashCnt == 0) ? firstBucketId :
+                HashTable::GetFirstBucketIdInBlock(HashTable::CuckooHash(key, hashCnt), mBlockCount);
             Bucket block[HashTable::BLOCK_SIZE];
             mFileReader->Read(
                 block, sizeof(block), sizeof(HashTableHeader) + bucketId * sizeof(Bucket), option);
@@ -123,8 +159,6 @@ public:
         }
         return misc::NOT_FOUND;
     }
-    uint64_t Size() const { return mKeyCount; }
-    bool IsFull() const { return true; }
 
 protected:
     file_system::SliceFileReaderPtr mHeaderReader;
@@ -155,6 +189,23 @@ private:
     using Base::mFileReader;
 
 public:
+    void BatchFind(const _KT* keys, size_t count, _VT* values, misc::Status* status,
+                   file_system::BlockAccessCounter* blockCounter) const
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (unlikely(Bucket::IsEmptyKey(keys[i]) || Bucket::IsDeleteKey(keys[i])))
+            {
+                for (size_t j = 0; j < count; ++j)
+                {
+                    status[j] = Find(keys[j], values[j], blockCounter);
+                }
+                return;
+            }
+        }
+        Base::BatchFind(keys, count, values, status, blockCounter);
+    }
+
     misc::Status Find(
         const _KT& key, _VT& value, file_system::BlockAccessCounter* blockCounter) const
     {
@@ -36,6 +36,8 @@ public:
 public:
     // higher OCCUPANCY_PCT causes to probe too much, though it saves memory
     static const int32_t OCCUPANCY_PCT = 50;
+    // keys probed together in BatchFind, bounded by outstanding cache misses
+    static const size_t BATCH_FIND_GROUP_SIZE = 32;
 
     // public for DenseHashTableFileIterator & DenseHashTableFileReader
     struct HashTableHeader
@@ -69,6 +71,9 @@ public:
     bool Delete(const _KT& key, const _VT& value = _VT());
     misc::Status Find(const _KT& key, const _VT*& value) const;
     misc::Status FindForReadWrite(const _KT& key, _VT& value) const;
+    // same as Find for each key, home buckets are prefetched before probing
+    void BatchFind(const _KT* keys, size_t count,
+                   const _VT** values, misc::Status* status) const;
     uint64_t Size() const { return Header()->keyCount; }
     uint64_t Capacity() const;
     bool IsFull() const { return Size() >= Capacity(); }
@@ -96,6 +101,8 @@ protected:
     bool InternalInsert(const _KT& key, const _VT& value);
     Bucket* InternalFindBucket(const _KT& key) const;
     misc::Status InternalFind(const _KT& key, const _VT*& value) const;
+    void InternalBatchFind(const _KT* keys, size_t count,
+                           const _VT** values, misc::Status* status) const;
 
 private:
     static uint64_t CapacityToBucketCount(uint64_t maxKeyCount,
@@ -264,6 +271,18 @@ inline misc::Status DenseHashTable<_KT, _VT, HasSpecialKey, useCompactBucket>::F
     return InternalFind(key, value);
 }
 
+template<typename _KT, typename _VT, bool HasSpecialKey, bool useCompactBucket>
+inline void DenseHashTable<_KT, _VT, HasSpecialKey, useCompactBucket>::BatchFind(
+        const _KT* keys, size_t count, const _VT** values, misc::Status* status) const
+{
+    for (size_t begin = 0; begin < count; begin += BATCH_FIND_GROUP_SIZE)
+    {
+        size_t groupSize = (count - begin < BATCH_FIND_GROUP_SIZE) ?
+                           count - begin : BATCH_FIND_GROUP_SIZE;
+        InternalBatchFind(keys + begin, groupSize, values + begin, status + begin);
+    }
+}
+
 template<typename _KT, typename _VT, bool HasSpecialKey, bool useCompactBucket>
 inline misc::Status DenseHashTable<_KT, _VT, HasSpecialKey, useCompactBucket>::FindForReadWrite(
         const _KT& key, _VT& value) const
@@ -482,6 +501,56 @@ inline misc::Status DenseHashTable<_KT, _VT, HasSpecialKey, useCompactBucket>::I
     return misc::NOT_FOUND;
 }
 
+template<typename _KT, typename _VT, bool HasSpecialKey, bool useCompactBucket>
+inline void DenseHashTable<_KT, _VT, HasSpecialKey, useCompactBucket>::InternalBatchFind(
+        const _KT* keys, size_t count, const _VT** values, misc::Status* status) const
+{
+    assert(count <= BATCH_FIND_GROUP_SIZE);
+    uint64_t bucketCount = mBucketCount;
+    uint64_t bucketIds[BATCH_FIND_GROUP_SIZE];
+    uint64_t probeCounts[BATCH_FIND_GROUP_SIZE];
+    uint32_t pending[BATCH_FIND_GROUP_SIZE];
+    // first pass: home buckets of all keys on the way
+    for (size_t i = 0; i < count; ++i)
+    {
+        bucketIds[i] = keys[i] % bucketCount;
+        probeCounts[i] = 0;
+        pending[i] = i;
+        __builtin_prefetch(&mBucket[bucketIds[i]], 0, 1);
+    }
+    // then probe one bucket of each pending key per round,
+    // next bucket of an unresolved key is prefetched while others are checked
+    size_t pendingCount = count;
+    while (pendingCount > 0)
+    {
+        size_t nextPendingCount = 0;
+        for (size_t j = 0; j < pendingCount; ++j)
+        {
+            uint32_t i = pending[j];
+            const Bucket& bucket = mBucket[bucketIds[i]];
+            if (bucket.IsEmpty()) // not found
+            {
+                status[i] = misc::NOT_FOUND;
+                continue;
+            }
+            if (bucket.IsEqual(keys[i])) // found it or deleted
+            {
+                values[i] = &(bucket.Value());
+                status[i] = bucket.IsDeleted() ? misc::DELETED : misc::OK;
+                continue;
+            }
+            if (unlikely(!Probe(keys[i], probeCounts[i], bucketIds[i], bucketCount)))
+            {
+                status[i] = misc::NOT_FOUND;
+                continue;
+            }
+            __builtin_prefetch(&mBucket[bucketIds[i]], 0, 1);
+            pending[nextPendingCount++] = i;
+        }
+        pendingCount = nextPendingCount;
+    }
+}
+
 template<typename _KT, typename _VT, bool HasSpecialKey, bool useCompactBucket>
 inline uint64_t DenseHashTable<_KT, _VT, HasSpecialKey, useCompactBucket>::CapacityToBucketCount(
         uint64_t maxKeyCount, int32_t occupancyPct)
@@ -678,6 +747,24 @@ public:
         return bucket->IsDeleted() ? misc::DELETED : misc::OK;
     }
 
+    void BatchFind(const _KT* keys, size_t count,
+                   const _VT** values, misc::Status* status) const
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (unlikely(Bucket::IsEmptyKey(keys[i]) || Bucket::IsDeleteKey(keys[i])))
+            {
+                // rare, special keys live out of bucket array
+                for (size_t j = 0; j < count; ++j)
+                {
+                    status[j] = Find(keys[j], values[j]);
+                }
+                return;
+            }
+        }
+        Base::BatchFind(keys, count, values, status);
+    }
+
     uint64_t MemoryUse() const
     { return Base::MemoryUse() + sizeof(SpecialBucket) * 2; }
 
@@ -2,6 +2,7 @@
 #define __INDEXLIB_DENSE_HASH_TABLE_FILE_READER_H
 
 #include <tr1/memory>
+#include <algorithm>
 #include <autil/mem_pool/Pool.h>
 #include "indexlib/indexlib.h"
 #include "indexlib/common_define.h"
@@ -99,16 +100,49 @@ public:
     misc::Status Find(
         const _KT& key, _VT& value, file_system::BlockAccessCounter* blockCounter) const
     {
-        uint64_t bucketCount = mBucketCount;
-        uint64_t bucketId = key % bucketCount;
-        uint64_t probeCount = 0;
         file_system::ReadOption option;
         option.blockCounter = blockCounter;
         option.advice = storage::IO_ADVICE_LOW_LATENCY;
+        util::BlockHandle handle;
+        size_t blockOffset = 0;
+        return InternalFind(key, key % mBucketCount, value, option, handle, blockOffset);
+    }
 
-        auto accessor = mFileNode->GetAccessor();
+    // same as Find for each key, keys are resolved in home bucket order
+    // so that one cache block is got only once for keys falling into it
+    void BatchFind(const _KT* keys, size_t count, _VT* values, misc::Status* status,
+                   file_system::BlockAccessCounter* blockCounter) const
+    {
+        file_system::ReadOption option;
+        option.blockCounter = blockCounter;
+        option.advice = storage::IO_ADVICE_LOW_LATENCY;
+        std::vector<std::pair<uint64_t, uint32_t> > order(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            order[i] = std::make_pair(keys[i] % mBucketCount, (uint32_t)i);
+        }
+        std::sort(order.begin(), order.end());
         util::BlockHandle handle;
         size_t blockOffset = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            uint32_t idx = order[i].second;
+            status[idx] = InternalFind(keys[idx], order[i].first, values[idx],
+                    option, handle, blockOffset);
+        }
+    }
+
+    uint64_t Size() const { return mKeyCount; }
+    bool IsFull() const { return true; }
+
+private:
+    misc::Status InternalFind(const _KT& key, uint64_t bucketId, _VT& value,
+                              file_system::ReadOption& option,
+                              util::BlockHandle& handle, size_t& blockOffset) const
+    {
+        uint64_t bucketCount = mBucketCount;
+        uint64_t probeCount = 0;
+        auto accessor = mFileNode->GetAccessor();
         while (true)
         {
             Bucket bucket;
@@ -154,8 +188,6 @@ public:
         }
         return misc::NOT_FOUND;
     }
-    uint64_t Size() const { return mKeyCount; }
-    bool IsFull() const { return true; }
 
 protected:
     file_system::SliceFileReaderPtr mHeaderReader;
@@ -184,6 +216,23 @@ private:
     using Base::mFileNode;
 
 public:
+    void BatchFind(const _KT* keys, size_t count, _VT* values, misc::Status* status,
+                   file_system::BlockAccessCounter* blockCounter) const
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (unlikely(Bucket::IsEmptyKey(keys[i]) || Bucket::IsDeleteKey(keys[i])))
+            {
+                for (size_t j = 0; j < count; ++j)
+                {
+                    status[j] = Find(keys[j], values[j], blockCounter);
+                }
+                return;
+            }
+        }
+        Base::BatchFind(keys, count, values, status, blockCounter);
+    }
+
     misc::Status Find(
         const _KT& key, _VT& value, file_system::BlockAccessCounter* blockCounter) const
     {
@@ -100,6 +100,8 @@ void CuckooHashTablePerfTest::TestInsertAndFind()
     FindSequential(hashTable2);// miss
     // for (uint8_t i = 0; i < 2; ++i)
     FindRandom(hashTable2);// hit
+    FindRandomBatch(hashTable2, 100);// hit
+    FindRandomBatch(hashTable2, 1000);// hit
     //for (uint8_t i = 0; i < 3; ++i) FindRandomRW(hashTable2);// hit
     //for (uint8_t i = 0; i < 3; ++i) FindMix(hashTable2);// hit
 }
@@ -225,6 +227,34 @@ void CuckooHashTablePerfTest::FindRandom(const HashTable& hashTable)
 }
 
 
+void CuckooHashTablePerfTest::FindRandomBatch(const HashTable& hashTable,
+                                              size_t batchSize)
+{
+    uint64_t maxKeyCount = hashTable.Size();
+    std::cerr << endl << "Find Random Batch: "
+              << maxKeyCount << "keys, batch size: " << batchSize << endl;
+    vector<const VT*> values(batchSize, NULL);
+    vector<misc::Status> status(batchSize, misc::NOT_FOUND);
+    Timer timer;
+    uint64_t res = 0;
+    for (size_t i = 0; i < maxKeyCount; i += batchSize)
+    {
+        size_t count = std::min(batchSize, (size_t)(maxKeyCount - i));
+        hashTable.BatchFind(&mRandomKeys[i], count, values.data(), status.data());
+        for (size_t j = 0; j < count; ++j)
+        {
+            if (likely(status[j] == misc::OK))
+            {
+                res += values[j]->Value();
+            }
+        }
+    }
+    int64_t duration = timer.Stop(); // 10-6sec
+    std::cerr << "Found:" << maxKeyCount << std::endl;
+    std::cerr << "check:" << res << std::endl;
+    std::cerr << "BatchFindQps: " << 1000000 * maxKeyCount / duration << endl;
+}
+
 void CuckooHashTablePerfTest::FindRandomRW(const HashTable& hashTable)
 {
     uint64_t maxKeyCount = hashTable.Size();
@@ -45,6 +45,7 @@ private:
     void InsertRandom(HashTable& hashTable);
     void FindSequential(const HashTable& hashTable);
     void FindRandom(const HashTable& hashTable);
+    void FindRandomBatch(const HashTable& hashTable, size_t batchSize);
     void FindRandomRW(const HashTable& hashTable);
     void FindMix(const HashTable& hashTable);
 
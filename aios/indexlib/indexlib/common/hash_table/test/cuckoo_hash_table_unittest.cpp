@@ -1150,6 +1150,78 @@ void CuckooHashTableTest::TestTableInsertManyMod16()
     }
 }
 
+void CuckooHashTableTest::TestBatchFind()
+{
+    typedef CuckooHashTableTraits<uint64_t, uint64_t, false> Traits;
+    typedef Traits::HashTable HashTable;
+    static const uint32_t TOTAL = 10000;
+    size_t size = HashTable::CapacityToTableMemory(TOTAL, 90);
+    unique_ptr<char[]> buffer(new char[size]);
+    HashTable hashTable;
+    ASSERT_TRUE(hashTable.MountForWrite(buffer.get(), size, 90));
+
+    // inserted, deleted, not exist and special keys
+    vector<uint64_t> keys;
+    uint64_t key = 1;
+    for (uint32_t i = 0; i < TOTAL / 2 && !hashTable.IsFull(); ++i)
+    {
+        key = key * 11 + 17;
+        if (key % 3 == 2)
+        {
+            ASSERT_TRUE(hashTable.Delete(key));
+        }
+        else
+        {
+            ASSERT_TRUE(hashTable.Insert(key, i));
+        }
+        keys.push_back(key);
+        keys.push_back(key + 1);
+    }
+    keys.push_back(HashTable::Bucket::EmptyKey());
+    keys.push_back(HashTable::Bucket::DeleteKey());
+
+    auto checkBatchFind = [&keys, &hashTable](size_t count) {
+        vector<const uint64_t*> values(count, NULL);
+        vector<Status> status(count, NOT_FOUND);
+        hashTable.BatchFind(keys.data(), count, values.data(), status.data());
+        for (size_t i = 0; i < count; ++i)
+        {
+            const uint64_t* expectValue = NULL;
+            ASSERT_EQ(hashTable.Find(keys[i], expectValue), status[i]) << "key:" << keys[i];
+            if (status[i] == OK)
+            {
+                ASSERT_EQ(*expectValue, *values[i]) << "key:" << keys[i];
+            }
+        }
+    };
+    checkBatchFind(1);
+    checkBatchFind(HashTable::BATCH_FIND_GROUP_SIZE + 1);
+    checkBatchFind(keys.size() - 2);
+    ASSERT_TRUE(hashTable.Delete(HashTable::Bucket::DeleteKey()));
+    checkBatchFind(keys.size());
+
+    const DirectoryPtr& directory = GET_SEGMENT_DIRECTORY();
+    FileWriterPtr fileWriter = directory->CreateFileWriter("batch_find_file");
+    fileWriter->Write(buffer.get(), hashTable.MemoryUse());
+    fileWriter->Close();
+    FileReaderPtr fileReader = directory->CreateFileReader("batch_find_file", FSOT_IN_MEM);
+    Traits::FileReader reader;
+    ASSERT_TRUE(reader.Init(directory, fileReader));
+
+    vector<uint64_t> values(keys.size());
+    vector<Status> status(keys.size(), NOT_FOUND);
+    reader.BatchFind(keys.data(), keys.size(), values.data(), status.data(), nullptr);
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        const uint64_t* expectValue = NULL;
+        ASSERT_EQ(hashTable.Find(keys[i], expectValue), status[i]) << "key:" << keys[i];
+        if (status[i] == OK)
+        {
+            ASSERT_EQ(*expectValue, values[i]) << "key:" << keys[i];
+        }
+    }
+}
+
 #undef CheckFind
 #undef InsertAndCheck
 
@@ -41,6 +41,7 @@ public:
     void TestCalculateDeleteCount();
 
     void TestInitNoIO();
+    void TestBatchFind();
 private:
     IE_LOG_DECLARE();
 };
@@ -64,6 +65,7 @@ INDEXLIB_UNIT_TEST_CASE(CuckooHashTableTest, TestBuildMemoryToCapacity);
 INDEXLIB_UNIT_TEST_CASE(CuckooHashTableTest, TestCompress);
 INDEXLIB_UNIT_TEST_CASE(CuckooHashTableTest, TestCalculateDeleteCount);
 INDEXLIB_UNIT_TEST_CASE(CuckooHashTableTest, TestInitNoIO);
+INDEXLIB_UNIT_TEST_CASE(CuckooHashTableTest, TestBatchFind);
 IE_NAMESPACE_END(common);
 
 #endif //__INDEXLIB_CUCKOOHASHTABLETEST_H
@@ -1469,6 +1469,78 @@ void DenseHashTableTest::TestInitNoIO(){
    ASSERT_EQ(hashTableReader1.mKeyCount, hashTableReader2.mKeyCount);   
 }
 
+void DenseHashTableTest::TestBatchFind()
+{
+    typedef DenseHashTableTraits<uint64_t, uint64_t, false> Traits;
+    typedef Traits::HashTable HashTable;
+    const uint64_t keyCount = 5000;
+    size_t memSize = HashTable::CapacityToTableMemory(keyCount, 50);
+    vector<char> buffer(memSize);
+    HashTable hashTable;
+    ASSERT_TRUE(hashTable.MountForWrite(buffer.data(), memSize, 50));
+
+    // keys with conflicts, deleted keys and special keys
+    vector<uint64_t> keys;
+    for (uint64_t i = 0; i < keyCount - 2; ++i)
+    {
+        uint64_t key = i * 7 + (i % 3) * 10000;
+        if (i % 5 == 0)
+        {
+            ASSERT_TRUE(hashTable.Delete(key));
+        }
+        else
+        {
+            ASSERT_TRUE(hashTable.Insert(key, i));
+        }
+        keys.push_back(key);
+        keys.push_back(key + 3); // maybe not exist
+    }
+    keys.push_back(HashTable::Bucket::EmptyKey());
+    keys.push_back(HashTable::Bucket::DeleteKey());
+
+    auto checkBatchFind = [&keys, &hashTable](size_t count) {
+        vector<const uint64_t*> values(count, NULL);
+        vector<misc::Status> status(count, NOT_FOUND);
+        hashTable.BatchFind(keys.data(), count, values.data(), status.data());
+        for (size_t i = 0; i < count; ++i)
+        {
+            const uint64_t* expectValue = NULL;
+            ASSERT_EQ(hashTable.Find(keys[i], expectValue), status[i]) << "key:" << keys[i];
+            if (status[i] == OK)
+            {
+                ASSERT_EQ(*expectValue, *values[i]) << "key:" << keys[i];
+            }
+        }
+    };
+    checkBatchFind(1);
+    checkBatchFind(HashTable::BATCH_FIND_GROUP_SIZE + 1);
+    checkBatchFind(keys.size() - 2);
+    ASSERT_TRUE(hashTable.Insert(HashTable::Bucket::EmptyKey(), 1));
+    checkBatchFind(keys.size());
+
+    auto dir = GET_SEGMENT_DIRECTORY();
+    FileWriterPtr fileWriter = dir->CreateFileWriter("batch_find_file");
+    fileWriter->Write(buffer.data(), hashTable.MemoryUse());
+    fileWriter->Close();
+    FileReaderPtr fileReader = dir->CreateFileReader("batch_find_file", FSOT_CACHE);
+    Traits::FileReader hashTableFileReader;
+    ASSERT_TRUE(hashTableFileReader.Init(dir, fileReader));
+
+    vector<uint64_t> values(keys.size());
+    vector<misc::Status> status(keys.size(), NOT_FOUND);
+    hashTableFileReader.BatchFind(keys.data(), keys.size(), values.data(),
+                                  status.data(), &mCounter);
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        const uint64_t* expectValue = NULL;
+        ASSERT_EQ(hashTable.Find(keys[i], expectValue), status[i]) << "key:" << keys[i];
+        if (status[i] == OK)
+        {
+            ASSERT_EQ(*expectValue, values[i]) << "key:" << keys[i];
+        }
+    }
+}
+
 #undef CheckFind
 #undef InsertAndCheck
 #undef DeleteAndCheck
@@ -65,6 +65,7 @@ public:
     void TestCalculateDeleteCount();
 
     void TestInitNoIO();
+    void TestBatchFind();
 private:
     file_system::BlockAccessCounter mCounter;
 
@@ -93,6 +94,7 @@ INDEXLIB_UNIT_TEST_CASE(DenseHashTableTest, TestOccupancyPct);
 INDEXLIB_UNIT_TEST_CASE(DenseHashTableTest, TestCompress);
 INDEXLIB_UNIT_TEST_CASE(DenseHashTableTest, TestCalculateDeleteCount);
 INDEXLIB_UNIT_TEST_CASE(DenseHashTableTest, TestInitNoIO);
+INDEXLIB_UNIT_TEST_CASE(DenseHashTableTest, TestBatchFind);
 
 IE_NAMESPACE_END(common);
 
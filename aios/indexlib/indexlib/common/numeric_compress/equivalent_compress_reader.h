@@ -2,6 +2,7 @@
 #define __INDEXLIB_EQUIVALENT_COMPRESS_READER_H
 
 #include <tr1/memory>
+#include <algorithm>
 #include <autil/LongHashValue.h>
 #include <autil/MultiValueType.h>
 #include <autil/CountedMultiValueType.h>
@@ -12,6 +13,7 @@
 #include "indexlib/util/slice_array/bytes_aligned_slice_array.h"
 #include "indexlib/common/numeric_compress/equivalent_compress_traits.h"
 #include "indexlib/common/numeric_compress/equivalent_compress_define.h"
+#include "indexlib/common/numeric_compress/equivalent_compress_unpack.h"
 
 DECLARE_REFERENCE_CLASS(file_system, FileReader);
 IE_NAMESPACE_BEGIN(common);
@@ -174,6 +176,8 @@ public:
         Iterator(const EquivalentCompressReader<T>* reader)
             : mReader(reader)
             , mCursor(0)
+            , mBufferBegin(0)
+            , mBufferEnd(0)
         {
         }
 
@@ -185,12 +189,23 @@ public:
         T Next()
         {
             assert(mReader);
-            return mReader->Get(mCursor++);
+            if (mCursor >= mBufferEnd)
+            {
+                mBufferBegin = mCursor;
+                mBufferEnd = std::min(mReader->Size(), mCursor + BUFFER_SIZE);
+                mReader->BatchGet(mBufferBegin, mBufferEnd - mBufferBegin, mBuffer);
+            }
+            return mBuffer[mCursor++ - mBufferBegin];
         }
 
     private:
+        static const uint32_t BUFFER_SIZE = 128;
+
         const EquivalentCompressReader<T>* mReader;
         uint32_t mCursor;
+        uint32_t mBufferBegin;
+        uint32_t mBufferEnd;
+        T mBuffer[BUFFER_SIZE];
     };
 
 public:
@@ -208,6 +223,12 @@ public:
     inline T Get(size_t pos) const __ALWAYS_INLINE
     { return (*this)[pos]; }
 
+    // decode values of [beginPos, beginPos + count) slot by slot,
+    // equal slots are filled directly and delta arrays are bulk unpacked
+    void BatchGet(size_t beginPos, size_t count, T* values) const;
+    // positions should be in ascending order for best performance
+    void BatchGet(const docid_t* positions, size_t count, T* values) const;
+
     bool Update(size_t pos, T value);
 
     Iterator CreateIterator() const
@@ -238,6 +259,15 @@ private:
 
     inline T ReadLongValueType(size_t pos) const __ALWAYS_INLINE;
 
+    // return true if all values in slot equal to baseValue
+    inline bool GetSlotDeltaArray(size_t slotIdx, UT& baseValue,
+                                  SlotItemType& slotType,
+                                  const uint8_t*& deltaArray) const __ALWAYS_INLINE;
+    inline bool GetLongSlotDeltaArray(size_t slotIdx, UT& baseValue,
+                                      SlotItemType& slotType,
+                                      const uint8_t*& deltaArray) const __ALWAYS_INLINE;
+    void BatchGetInSlot(size_t slotIdx, size_t valueIdx, size_t count, T* values) const;
+
     bool ExpandUpdateDeltaArray(uint8_t *slotItem, 
                                 uint8_t *slotData,
                                 size_t pos,
@@ -441,6 +471,18 @@ inline double EquivalentCompressSessionReader<double>::GetValueFromBuffer(size_t
     {                                                                   \
         assert(false);                                                  \
         return 0;                                                       \
+    }                                                                   \
+    template <>                                                         \
+    inline void EquivalentCompressReader<type>::BatchGet(               \
+            size_t beginPos, size_t count, type* values) const          \
+    {                                                                   \
+        assert(false);                                                  \
+    }                                                                   \
+    template <>                                                         \
+    inline void EquivalentCompressReader<type>::BatchGet(               \
+            const docid_t* positions, size_t count, type* values) const \
+    {                                                                   \
+        assert(false);                                                  \
     }
 
 DECLARE_UNSUPPORT_TYPE_IMPL(autil::uint128_t)
@@ -541,6 +583,185 @@ inline double EquivalentCompressReader<double>::operator[] (size_t pos) const
     return ReadLongValueType(pos);
 }
 
+template <typename T>
+inline bool EquivalentCompressReader<T>::GetSlotDeltaArray(
+        size_t slotIdx, UT& baseValue, SlotItemType& slotType,
+        const uint8_t*& deltaArray) const
+{
+    SlotItem slotItem = GetSlotItem(slotIdx);
+    if (slotItem.slotType == SIT_EQUAL)
+    {
+        baseValue = (UT)slotItem.value;
+        return true;
+    }
+    DeltaValueArray *valueArray = (DeltaValueArray*)GetDeltaBlockAddress(slotItem.value);
+    baseValue = valueArray->baseValue;
+    slotType = slotItem.slotType;
+    deltaArray = valueArray->delta;
+    return false;
+}
+
+template <typename T>
+inline bool EquivalentCompressReader<T>::GetLongSlotDeltaArray(
+        size_t slotIdx, UT& baseValue, SlotItemType& slotType,
+        const uint8_t*& deltaArray) const
+{
+    LongSlotItem slotItem = GetLongSlotItem(slotIdx);
+    if (slotItem.isValue == 1)
+    {
+        baseValue = (UT)slotItem.value;
+        return true;
+    }
+    uint8_t *valueItemsAddr = GetDeltaBlockAddress(slotItem.value);
+    LongValueArrayHeader *valueArray = (LongValueArrayHeader*)valueItemsAddr;
+    baseValue = valueArray->baseValue;
+    slotType = DeltaFlagToSlotItemType(valueArray->deltaType);
+    deltaArray = valueItemsAddr + sizeof(LongValueArrayHeader);
+    return false;
+}
+
+template <>
+inline bool EquivalentCompressReader<uint64_t>::GetSlotDeltaArray(
+        size_t slotIdx, UT& baseValue, SlotItemType& slotType,
+        const uint8_t*& deltaArray) const
+{
+    return GetLongSlotDeltaArray(slotIdx, baseValue, slotType, deltaArray);
+}
+
+template <>
+inline bool EquivalentCompressReader<int64_t>::GetSlotDeltaArray(
+        size_t slotIdx, UT& baseValue, SlotItemType& slotType,
+        const uint8_t*& deltaArray) const
+{
+    return GetLongSlotDeltaArray(slotIdx, baseValue, slotType, deltaArray);
+}
+
+template <>
+inline bool EquivalentCompressReader<double>::GetSlotDeltaArray(
+        size_t slotIdx, UT& baseValue, SlotItemType& slotType,
+        const uint8_t*& deltaArray) const
+{
+    return GetLongSlotDeltaArray(slotIdx, baseValue, slotType, deltaArray);
+}
+
+template <typename T>
+inline void EquivalentCompressReader<T>::BatchGetInSlot(
+        size_t slotIdx, size_t valueIdx, size_t count, T* values) const
+{
+    UT baseValue = 0;
+    SlotItemType slotType = SIT_EQUAL;
+    const uint8_t* deltaArray = NULL;
+    if (GetSlotDeltaArray(slotIdx, baseValue, slotType, deltaArray))
+    {
+        std::fill(values, values + count, ZigZagEncoder::Decode(baseValue));
+        return;
+    }
+
+    const size_t DECODE_BATCH_SIZE = 256;
+    UT deltaBuffer[DECODE_BATCH_SIZE];
+    while (count > 0)
+    {
+        size_t decodeCount = std::min(count, DECODE_BATCH_SIZE);
+        EquivalentCompressUnpack::Unpack(slotType, deltaArray, valueIdx,
+                decodeCount, deltaBuffer);
+        for (size_t i = 0; i < decodeCount; ++i)
+        {
+            values[i] = ZigZagEncoder::Decode(baseValue + deltaBuffer[i]);
+        }
+        values += decodeCount;
+        valueIdx += decodeCount;
+        count -= decodeCount;
+    }
+}
+
+template <typename T>
+inline void EquivalentCompressReader<T>::BatchGet(
+        size_t beginPos, size_t count, T* values) const
+{
+    assert(beginPos + count <= mItemCount);
+    if (!mValueBaseAddr)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            values[i] = Get(beginPos + i);
+        }
+        return;
+    }
+
+    size_t pos = beginPos;
+    size_t endPos = beginPos + count;
+    while (pos < endPos)
+    {
+        size_t slotIdx = pos >> mSlotBitNum;
+        size_t slotEndPos = std::min(endPos, (slotIdx + 1) << mSlotBitNum);
+        size_t decodeCount = slotEndPos - pos;
+        BatchGetInSlot(slotIdx, pos & mSlotMask, decodeCount, values);
+        values += decodeCount;
+        pos = slotEndPos;
+    }
+}
+
+template <typename T>
+inline void EquivalentCompressReader<T>::BatchGet(
+        const docid_t* positions, size_t count, T* values) const
+{
+    if (!mValueBaseAddr)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            values[i] = Get(positions[i]);
+        }
+        return;
+    }
+
+    // decode runs of ascending positions in one slot together
+    const size_t MIN_DENSE_RUN_LENGTH = 8;
+    const size_t DECODE_BATCH_SIZE = 256;
+    T slotValues[DECODE_BATCH_SIZE];
+    size_t i = 0;
+    while (i < count)
+    {
+        assert((size_t)positions[i] < mItemCount);
+        size_t slotIdx = (size_t)positions[i] >> mSlotBitNum;
+        size_t runEnd = i + 1;
+        while (runEnd < count
+               && ((size_t)positions[runEnd] >> mSlotBitNum) == slotIdx
+               && positions[runEnd] > positions[runEnd - 1]
+               && (size_t)(positions[runEnd] - positions[i]) < DECODE_BATCH_SIZE)
+        {
+            ++runEnd;
+        }
+
+        UT baseValue = 0;
+        SlotItemType slotType = SIT_EQUAL;
+        const uint8_t* deltaArray = NULL;
+        if (GetSlotDeltaArray(slotIdx, baseValue, slotType, deltaArray))
+        {
+            std::fill(values + i, values + runEnd, ZigZagEncoder::Decode(baseValue));
+        }
+        else if (runEnd - i >= MIN_DENSE_RUN_LENGTH)
+        {
+            size_t firstPos = positions[i];
+            size_t spanLen = positions[runEnd - 1] - firstPos + 1;
+            BatchGetInSlot(slotIdx, firstPos & mSlotMask, spanLen, slotValues);
+            for (size_t j = i; j < runEnd; ++j)
+            {
+                values[j] = slotValues[positions[j] - firstPos];
+            }
+        }
+        else
+        {
+            for (size_t j = i; j < runEnd; ++j)
+            {
+                UT deltaValue = GetDeltaValueBySlotType(
+                        slotType, (uint8_t*)deltaArray, positions[j] & mSlotMask);
+                values[j] = ZigZagEncoder::Decode(baseValue + deltaValue);
+            }
+        }
+        i = runEnd;
+    }
+}
+
 template <typename T>
 inline bool EquivalentCompressReader<T>::ExpandUpdateDeltaArray(
         uint8_t *slotItem, uint8_t *slotData, 
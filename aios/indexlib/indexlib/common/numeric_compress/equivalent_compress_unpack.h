@@ -0,0 +1,149 @@
+#ifndef __INDEXLIB_EQUIVALENT_COMPRESS_UNPACK_H
+#define __INDEXLIB_EQUIVALENT_COMPRESS_UNPACK_H
+
+#include <stdint.h>
+#include <string.h>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+#include "indexlib/indexlib.h"
+#include "indexlib/common/numeric_compress/equivalent_compress_define.h"
+
+IE_NAMESPACE_BEGIN(common);
+
+// batch decode of the delta array in one equivalent compress slot
+// bit packed deltas (1/2/4 bits) are stored MSB first in each byte
+class EquivalentCompressUnpack
+{
+public:
+    template <typename UT>
+    static inline void Unpack(SlotItemType slotType, const uint8_t* deltaArray,
+                              size_t beginIdx, size_t count, UT* dest);
+
+private:
+    template <uint32_t BitWidth, typename UT>
+    static inline void UnpackBits(const uint8_t* deltaArray,
+                                  size_t beginIdx, size_t count, UT* dest);
+
+    template <typename DeltaType, typename UT>
+    static inline void UnpackFixedWidth(const uint8_t* deltaArray,
+                                        size_t beginIdx, size_t count, UT* dest)
+    {
+        const DeltaType* src = (const DeltaType*)deltaArray + beginIdx;
+        for (size_t i = 0; i < count; ++i)
+        {
+            dest[i] = (UT)src[i];
+        }
+    }
+
+    template <uint32_t BitWidth>
+    static inline uint32_t DecodeOneBitValue(const uint8_t* deltaArray, size_t idx)
+        __ALWAYS_INLINE
+    {
+        const uint32_t itemPerByte = 8 / BitWidth;
+        uint8_t byteValue = deltaArray[idx / itemPerByte];
+        uint32_t bitMoveCount = 8 - ((idx % itemPerByte) + 1) * BitWidth;
+        return (byteValue >> bitMoveCount) & ((1U << BitWidth) - 1);
+    }
+
+    // unpack 8 values starting at a byte aligned position
+    template <uint32_t BitWidth, typename UT>
+    static inline void UnpackEight(const uint8_t* src, UT* dest) __ALWAYS_INLINE;
+};
+
+template <typename UT>
+inline void EquivalentCompressUnpack::Unpack(
+        SlotItemType slotType, const uint8_t* deltaArray,
+        size_t beginIdx, size_t count, UT* dest)
+{
+    switch (slotType)
+    {
+    case SIT_DELTA_BIT1:
+        UnpackBits<1>(deltaArray, beginIdx, count, dest);
+        break;
+    case SIT_DELTA_BIT2:
+        UnpackBits<2>(deltaArray, beginIdx, count, dest);
+        break;
+    case SIT_DELTA_BIT4:
+        UnpackBits<4>(deltaArray, beginIdx, count, dest);
+        break;
+    case SIT_DELTA_UINT8:
+        UnpackFixedWidth<uint8_t>(deltaArray, beginIdx, count, dest);
+        break;
+    case SIT_DELTA_UINT16:
+        UnpackFixedWidth<uint16_t>(deltaArray, beginIdx, count, dest);
+        break;
+    case SIT_DELTA_UINT32:
+        UnpackFixedWidth<uint32_t>(deltaArray, beginIdx, count, dest);
+        break;
+    case SIT_DELTA_UINT64:
+        UnpackFixedWidth<uint64_t>(deltaArray, beginIdx, count, dest);
+        break;
+    default:
+        assert(false);
+    }
+}
+
+template <uint32_t BitWidth, typename UT>
+inline void EquivalentCompressUnpack::UnpackBits(
+        const uint8_t* deltaArray, size_t beginIdx, size_t count, UT* dest)
+{
+    size_t idx = beginIdx;
+    size_t endIdx = beginIdx + count;
+    // head: until 8 values share whole bytes
+    while (idx < endIdx && (idx & 7) != 0)
+    {
+        *dest++ = (UT)DecodeOneBitValue<BitWidth>(deltaArray, idx++);
+    }
+    while (idx + 8 <= endIdx)
+    {
+        UnpackEight<BitWidth>(deltaArray + idx * BitWidth / 8, dest);
+        dest += 8;
+        idx += 8;
+    }
+    while (idx < endIdx)
+    {
+        *dest++ = (UT)DecodeOneBitValue<BitWidth>(deltaArray, idx++);
+    }
+}
+
+template <uint32_t BitWidth, typename UT>
+inline void EquivalentCompressUnpack::UnpackEight(const uint8_t* src, UT* dest)
+{
+    // 8 values take BitWidth bytes, load them big endian so that
+    // the i-th value is at bits [32 - (i + 1) * BitWidth, 32 - i * BitWidth)
+    uint32_t word = 0;
+    for (uint32_t i = 0; i < BitWidth; ++i)
+    {
+        word |= (uint32_t)src[i] << (24 - 8 * i);
+    }
+#ifdef __AVX2__
+    const __m256i shifts = _mm256_setr_epi32(
+            32 - 1 * BitWidth, 32 - 2 * BitWidth, 32 - 3 * BitWidth, 32 - 4 * BitWidth,
+            32 - 5 * BitWidth, 32 - 6 * BitWidth, 32 - 7 * BitWidth, 32 - 8 * BitWidth);
+    const __m256i mask = _mm256_set1_epi32((1U << BitWidth) - 1);
+    __m256i values = _mm256_and_si256(
+            _mm256_srlv_epi32(_mm256_set1_epi32(word), shifts), mask);
+    if (sizeof(UT) == sizeof(uint32_t))
+    {
+        _mm256_storeu_si256((__m256i*)dest, values);
+        return;
+    }
+    uint32_t buffer[8];
+    _mm256_storeu_si256((__m256i*)buffer, values);
+    for (uint32_t i = 0; i < 8; ++i)
+    {
+        dest[i] = (UT)buffer[i];
+    }
+#else
+    const uint32_t mask = (1U << BitWidth) - 1;
+    for (uint32_t i = 0; i < 8; ++i)
+    {
+        dest[i] = (UT)((word >> (32 - (i + 1) * BitWidth)) & mask);
+    }
+#endif
+}
+
+IE_NAMESPACE_END(common);
+
+#endif //__INDEXLIB_EQUIVALENT_COMPRESS_UNPACK_H
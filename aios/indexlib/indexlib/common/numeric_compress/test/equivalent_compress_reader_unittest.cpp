@@ -804,5 +804,25 @@ void EquivalentCompressReaderTest::DoRead(int *status)
     }
 }
 
-IE_NAMESPACE_END(common);
+void EquivalentCompressReaderTest::TestBatchGet()
+{
+    uint64_t maxDeltas[] = { 1, 3, 15, 255, 65535, 1000000 };
+    for (auto maxDelta : maxDeltas)
+    {
+        InnerTestBatchGet<uint32_t>(maxDelta);
+        InnerTestBatchGet<int32_t>(maxDelta);
+        InnerTestBatchGet<uint64_t>(maxDelta);
+        InnerTestBatchGet<int64_t>(maxDelta);
+        InnerTestBatchGet<float>(maxDelta);
+        if (maxDelta <= 255)
+        {
+            InnerTestBatchGet<uint8_t>(maxDelta);
+        }
+        if (maxDelta <= 65535)
+        {
+            InnerTestBatchGet<int16_t>(maxDelta);
+        }
+    }
+}
 
+IE_NAMESPACE_END(common);
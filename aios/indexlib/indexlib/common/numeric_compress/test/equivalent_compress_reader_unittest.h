@@ -44,8 +44,65 @@ public:
     void TestReadLegacyData();
 
     void TestExpandUpdateMultiThread();
+    void TestBatchGet();
 
 private:
+    template <typename T>
+    void InnerTestBatchGet(uint64_t maxDelta)
+    {
+        const size_t COUNT = 1000;
+        std::mt19937 random(maxDelta);
+        std::vector<T> values(COUNT);
+        for (size_t i = 0; i < COUNT; ++i)
+        {
+            // runs of equal slots mixed with delta slots
+            bool equalSlot = (i / 64) % 3 == 0;
+            values[i] = equalSlot ? (T)7 : (T)(10 + random() % (maxDelta + 1));
+        }
+
+        EquivalentCompressWriter<T> writer;
+        writer.Init(64);
+        size_t compressLength = writer.CalculateCompressLength(values.data(), COUNT, 64);
+        std::vector<uint8_t> buffer(compressLength);
+        writer.CompressData(values.data(), COUNT);
+        writer.DumpBuffer(buffer.data(), compressLength);
+        EquivalentCompressReader<T> reader(buffer.data());
+
+        size_t ranges[][2] = { {0, COUNT}, {0, 1}, {3, 61}, {63, 2},
+                               {64, 64}, {65, 300}, {999, 1}, {130, 700} };
+        for (auto& range : ranges)
+        {
+            std::vector<T> result(range[1]);
+            reader.BatchGet(range[0], range[1], result.data());
+            for (size_t i = 0; i < range[1]; ++i)
+            {
+                ASSERT_EQ(values[range[0] + i], result[i]) << range[0] + i;
+            }
+        }
+
+        std::vector<docid_t> positions;
+        for (docid_t docId = 0; docId < (docid_t)COUNT; docId += 1 + random() % 5)
+        {
+            positions.push_back(docId);
+        }
+        positions.push_back(3);
+        positions.push_back(3);
+        std::vector<T> result(positions.size());
+        reader.BatchGet(positions.data(), positions.size(), result.data());
+        for (size_t i = 0; i < positions.size(); ++i)
+        {
+            ASSERT_EQ(values[positions[i]], result[i]) << positions[i];
+        }
+
+        auto iter = reader.CreateIterator();
+        for (size_t i = 0; i < COUNT; ++i)
+        {
+            ASSERT_TRUE(iter.HasNext());
+            ASSERT_EQ(values[i], iter.Next());
+        }
+        ASSERT_FALSE(iter.HasNext());
+    }
+
     template <typename T>
     void InnerTestInplaceUpdate(T initValue, T updateValue)
     {
@@ -632,6 +689,7 @@ INDEXLIB_UNIT_TEST_CASE(EquivalentCompressReaderTest, TestExpandUpdatePerf);
 INDEXLIB_UNIT_TEST_CASE(EquivalentCompressReaderTest, TestRandomUpdateLongCaseTest);
 INDEXLIB_UNIT_TEST_CASE(EquivalentCompressReaderTest, TestReadLegacyData);
 INDEXLIB_UNIT_TEST_CASE(EquivalentCompressReaderTest, TestExpandUpdateMultiThread);
+INDEXLIB_UNIT_TEST_CASE(EquivalentCompressReaderTest, TestBatchGet);
 IE_NAMESPACE_END(common);
 
 #endif //__INDEXLIB_EQUIVALENTCOMPRESSREADERTEST_H
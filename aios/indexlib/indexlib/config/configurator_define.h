@@ -103,6 +103,7 @@ static const std::string INDEX_COMPRESS_MODE_REFERENCE = "reference";
 static const std::string USE_TRUNCATE_PROFILES = "use_truncate_profiles";
 static const std::string USE_TRUNCATE_PROFILES_SEPRATOR = ";";
 static const std::string USE_HASH_DICTIONARY = "use_hash_typed_dictionary";
+static const std::string HAS_ORDERED_TERM_DICTIONARY = "has_ordered_term_dictionary";
 static const std::string TRUNCATE_INDEX_NAME_MAPPER = "truncate_index_name_mapper";
 static const std::string USE_NUMBER_PK_HASH = "use_number_pk_hash";
 static const std::string PRIMARY_KEY_STORAGE_TYPE = "pk_storage_type";
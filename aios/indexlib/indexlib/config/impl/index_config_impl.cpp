@@ -189,6 +189,11 @@ void IndexConfigImpl::Jsonize(autil::legacy::Jsonizable::JsonWrapper& json)
         {
             json.Jsonize(USE_HASH_DICTIONARY, mIsHashTypedDictionary);
         }
+
+        if (mHasOrderedTermDictionary)
+        {
+            json.Jsonize(HAS_ORDERED_TERM_DICTIONARY, mHasOrderedTermDictionary);
+        }
         
         if (mCustomizedConfigs.size() > 1)
         {
@@ -227,6 +232,8 @@ void IndexConfigImpl::Jsonize(autil::legacy::Jsonizable::JsonWrapper& json)
         json.Jsonize(INDEX_COMPRESS_MODE, compressMode, INDEX_COMPRESS_MODE_PFOR_DELTA);
         mIsReferenceCompress = (compressMode == INDEX_COMPRESS_MODE_REFERENCE) ? true : false;
         json.Jsonize(USE_HASH_DICTIONARY, mIsHashTypedDictionary, mIsHashTypedDictionary);
+        json.Jsonize(HAS_ORDERED_TERM_DICTIONARY, mHasOrderedTermDictionary,
+                     mHasOrderedTermDictionary);
 
         auto iter = jsonMap.find(CUSTOMIZED_CONFIG);
         if (iter != jsonMap.end())
@@ -288,6 +295,20 @@ void IndexConfigImpl::Check() const
         INDEXLIB_FATAL_ERROR(Schema,
                              "reference_compress does not support tf(not tf_bitmap)");
     }
+
+    if (mHasOrderedTermDictionary && mIndexType != it_text && mIndexType != it_pack
+        && mIndexType != it_expack && mIndexType != it_string)
+    {
+        INDEXLIB_FATAL_ERROR(Schema, "has_ordered_term_dictionary only support "
+                             "text, pack, expack and string index");
+    }
+
+    if (mHasOrderedTermDictionary && mDictConfig && mHighFreqencyTermPostingType != hp_both)
+    {
+        // bitmap only terms have no posting to be looked up by key
+        INDEXLIB_FATAL_ERROR(Schema, "has_ordered_term_dictionary needs "
+                             "high_frequency_term_posting_type both");
+    }
 }
 
 bool IndexConfigImpl::HasTruncateProfile(const std::string& truncateProfileName) const
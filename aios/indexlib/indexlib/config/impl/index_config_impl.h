@@ -38,6 +38,7 @@ public:
         , mShardingType(IndexConfig::IST_NO_SHARDING)
         , mIsReferenceCompress(false)
         , mIsHashTypedDictionary(false)
+        , mHasOrderedTermDictionary(false)
         , mStatus(is_normal)
         , mOwnerOpId(INVALID_SCHEMA_OP_ID)
     {}
@@ -54,6 +55,7 @@ public:
         , mShardingType(IndexConfig::IST_NO_SHARDING)
         , mIsReferenceCompress(false)
         , mIsHashTypedDictionary(false)          
+        , mHasOrderedTermDictionary(false)
         , mStatus(is_normal)
         , mOwnerOpId(INVALID_SCHEMA_OP_ID)          
     {}
@@ -72,6 +74,7 @@ public:
         , mShardingType(other.mShardingType)
         , mIsReferenceCompress(other.mIsReferenceCompress)
         , mIsHashTypedDictionary(other.mIsHashTypedDictionary)          
+        , mHasOrderedTermDictionary(other.mHasOrderedTermDictionary)
         , mStatus(other.mStatus)
         , mOwnerOpId(other.mOwnerOpId)
     {}
@@ -133,6 +136,10 @@ public:
     { mIsHashTypedDictionary = isHashType; }
     bool IsHashTypedDictionary() const { return mIsHashTypedDictionary; }
 
+    void SetHasOrderedTermDictionary(bool flag)
+    { mHasOrderedTermDictionary = flag; }
+    bool HasOrderedTermDictionary() const { return mHasOrderedTermDictionary; }
+
     // Truncate
     void SetHasTruncateFlag(bool flag) { mHasTruncate = flag; }
     bool HasTruncate() const { return mHasTruncate; }
@@ -221,6 +228,7 @@ protected:
     IndexConfig::IndexShardingType mShardingType;
     bool mIsReferenceCompress;
     bool mIsHashTypedDictionary;
+    bool mHasOrderedTermDictionary;
     std::vector<IndexConfigPtr> mShardingIndexConfigs;
     //customized config
     CustomizedConfigVector mCustomizedConfigs;
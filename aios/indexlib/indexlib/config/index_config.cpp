@@ -112,6 +112,16 @@ bool IndexConfig::IsHashTypedDictionary() const
     return mImpl->IsHashTypedDictionary();    
 }
 
+void IndexConfig::SetHasOrderedTermDictionary(bool flag)
+{
+    mImpl->SetHasOrderedTermDictionary(flag);
+}
+
+bool IndexConfig::HasOrderedTermDictionary() const
+{
+    return mImpl->HasOrderedTermDictionary();
+}
+
 // Truncate
 void IndexConfig::SetHasTruncateFlag(bool flag)
 {
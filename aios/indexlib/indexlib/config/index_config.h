@@ -118,6 +118,10 @@ public:
     void SetHashTypedDictionary(bool isHashType);
     bool IsHashTypedDictionary() const;
 
+    // term text sorted dictionary for prefix, range and fuzzy term lookup
+    void SetHasOrderedTermDictionary(bool flag);
+    bool HasOrderedTermDictionary() const;
+
     // Truncate
     void SetHasTruncateFlag(bool flag);
     bool HasTruncate() const;
@@ -35,6 +35,7 @@ OnlineConfigBase::OnlineConfigBase()
     , enableForceOpen(true)
     , disableLoadCustomizedIndex(false)
     , loadPatchThreadNum(DEFAULT_LOAD_PATCH_THREAD_NUM)
+    , enableReuseReaderOnReopen(false)
     , maxReopenMemoryUse(INVALID_MAX_REOPEN_MEMORY_USE)
     , needReadRemoteIndex(false)
     , needDeployIndex(true)
@@ -102,6 +103,8 @@ void OnlineConfigBase::Jsonize(Jsonizable::JsonWrapper& json)
     json.Jsonize("enable_force_open", enableForceOpen, enableForceOpen);
     json.Jsonize("disable_load_customized_index", disableLoadCustomizedIndex, disableLoadCustomizedIndex);
     json.Jsonize("load_patch_thread_num", loadPatchThreadNum, loadPatchThreadNum);
+    json.Jsonize("enable_reuse_reader_on_reopen", enableReuseReaderOnReopen,
+                 enableReuseReaderOnReopen);
     if (json.GetMode() == TO_JSON)
     {
         loadConfigList.Jsonize(json);
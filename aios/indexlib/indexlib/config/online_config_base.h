@@ -87,6 +87,7 @@ public:
     bool enableForceOpen;  // when forceReopen failed, this option will drop building realtime data and trigger open
     bool disableLoadCustomizedIndex;
     uint32_t loadPatchThreadNum;
+    bool enableReuseReaderOnReopen; // share unchanged segment readers with last reader
 private:
     int64_t maxReopenMemoryUse;
     bool needReadRemoteIndex;
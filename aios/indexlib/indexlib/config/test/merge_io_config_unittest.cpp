@@ -26,6 +26,8 @@ void MergeIOConfigTest::TestJsonize()
     MergeIOConfig mergeIOConfig;  
     INDEXLIB_TEST_EQUAL(false, mergeIOConfig.enableAsyncRead);
     INDEXLIB_TEST_EQUAL(false, mergeIOConfig.enableAsyncWrite);
+    INDEXLIB_TEST_EQUAL(false, mergeIOConfig.enableDirectWrite);
+    INDEXLIB_TEST_EQUAL(false, mergeIOConfig.enableDropCacheRead);
     INDEXLIB_TEST_EQUAL(MergeIOConfig::DEFAULT_READ_BUFFER_SIZE, mergeIOConfig.readBufferSize);
     INDEXLIB_TEST_EQUAL(MergeIOConfig::DEFAULT_WRITE_BUFFER_SIZE, mergeIOConfig.writeBufferSize);
     INDEXLIB_TEST_EQUAL(MergeIOConfig::DEFAULT_READ_THREAD_NUM, mergeIOConfig.readThreadNum);
@@ -36,6 +38,8 @@ void MergeIOConfigTest::TestJsonize()
     string jsonStr = "{"
         "\"enable_async_read\" : true,"
         "\"enable_async_write\" : false,"
+        "\"enable_direct_write\" : true,"
+        "\"enable_drop_cache_read\" : true,"
         "\"read_buffer_size\" : 1,"
         "\"write_buffer_size\" : 10,"
         "\"read_thread_num\" : 20,"
@@ -47,6 +51,8 @@ void MergeIOConfigTest::TestJsonize()
     FromJsonString(mergeIOConfig, jsonStr);
     INDEXLIB_TEST_EQUAL(true, mergeIOConfig.enableAsyncRead);
     INDEXLIB_TEST_EQUAL(false, mergeIOConfig.enableAsyncWrite);
+    INDEXLIB_TEST_EQUAL(true, mergeIOConfig.enableDirectWrite);
+    INDEXLIB_TEST_EQUAL(true, mergeIOConfig.enableDropCacheRead);
     INDEXLIB_TEST_EQUAL((uint32_t)1, mergeIOConfig.readBufferSize);
     INDEXLIB_TEST_EQUAL((uint32_t)10, mergeIOConfig.writeBufferSize);
     INDEXLIB_TEST_EQUAL((uint32_t)20, mergeIOConfig.readThreadNum);
@@ -59,6 +65,8 @@ void MergeIOConfigTest::TestJsonize()
     FromJsonString(mergeIOConfigNew, jsonStr);
     INDEXLIB_TEST_EQUAL(true, mergeIOConfigNew.enableAsyncRead);
     INDEXLIB_TEST_EQUAL(false, mergeIOConfigNew.enableAsyncWrite);
+    INDEXLIB_TEST_EQUAL(true, mergeIOConfigNew.enableDirectWrite);
+    INDEXLIB_TEST_EQUAL(true, mergeIOConfigNew.enableDropCacheRead);
     INDEXLIB_TEST_EQUAL((uint32_t)1, mergeIOConfigNew.readBufferSize);
     INDEXLIB_TEST_EQUAL((uint32_t)10, mergeIOConfigNew.writeBufferSize);
     INDEXLIB_TEST_EQUAL((uint32_t)20, mergeIOConfigNew.readThreadNum);
@@ -153,6 +153,11 @@ DocumentPtr KvDocumentParser::CreateDocument(const IndexlibExtendDocumentPtr &do
     indexDoc->SetDocOperateType(opType);
     indexDoc->SetRegionId(document->getRegionId());
     
+    // binary_version=8 only adds term texts, which are not carried here
+    if (indexDoc->GetSerializedVersion() == 8)
+    {
+        indexDoc->SetSerializedVersion(7);
+    }
     // attention: make binary_version=7 document not used for docTrace,
     // atomicly serialize to version6, to make online compitable
     // remove this code when binary version 6 is useless
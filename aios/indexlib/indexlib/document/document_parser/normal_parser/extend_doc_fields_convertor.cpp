@@ -207,6 +207,8 @@ bool ExtendDocFieldsConvertor::addSection(
         IE_LOG(DEBUG, "Failed to create new section.");
         return false;
     }
+    IndexDocument *termTextDoc = _fieldTermTextVec[fieldId] ?
+                                 classifiedDoc->getIndexDocument().get() : NULL;
     TokenizeSection::Iterator it = tokenizeSection->createIterator();
     section_len_t nowSectionLen = 0;
     section_len_t maxSectionLen = classifiedDoc->getMaxSectionLenght();
@@ -229,11 +231,13 @@ bool ExtendDocFieldsConvertor::addSection(
             curPos++;
         }
         curPos++;
-        if (!addToken(indexSection, *it, pool, fieldId, lastTokenPos, curPos)) {
+        if (!addToken(indexSection, *it, pool, fieldId, lastTokenPos, curPos,
+                          termTextDoc)) {
             break;
         }
         while (it.nextExtend()) {
-            if (!addToken(indexSection, *it, pool, fieldId, lastTokenPos, curPos)) {
+            if (!addToken(indexSection, *it, pool, fieldId, lastTokenPos, curPos,
+                          termTextDoc)) {
                 break;
             }
         }
@@ -248,7 +252,8 @@ bool ExtendDocFieldsConvertor::addSection(
 
 bool ExtendDocFieldsConvertor::addToken(
         Section *indexSection, const AnalyzerToken *token,
-        Pool *pool, fieldid_t fieldId, pos_t &lastTokenPos, pos_t &curPos)
+        Pool *pool, fieldid_t fieldId, pos_t &lastTokenPos, pos_t &curPos,
+        IndexDocument *termTextDoc)
 {
     if (token->isSpace() || token->isStopWord()) {
         //do nothing
@@ -261,6 +266,9 @@ bool ExtendDocFieldsConvertor::addToken(
     if (!hasher->GetHashKey(text.c_str(), hashKey)) {
         return true;
     }
+    if (termTextDoc) {
+        termTextDoc->SetTermText(hashKey, ConstString(text));
+    }
     return addHashToken(indexSection, hashKey, pool, fieldId,
                         token->getPosPayLoad(), lastTokenPos, curPos);
 }
@@ -304,6 +312,7 @@ void ExtendDocFieldsConvertor::initFieldTokenHasherVector() {
         return;
     }
     _fieldTokenHasherVec.resize(fieldSchemaPtr->GetFieldCount());
+    _fieldTermTextVec.resize(fieldSchemaPtr->GetFieldCount(), false);
     for (FieldSchema::Iterator it = fieldSchemaPtr->Begin();
          it != fieldSchemaPtr->End(); ++it)
     {
@@ -316,6 +325,13 @@ void ExtendDocFieldsConvertor::initFieldTokenHasherVector() {
         KeyHasher *hasher = KeyHasherFactory::CreateByFieldType(fieldType);
         assert(hasher);
         _fieldTokenHasherVec[fieldId] = hasher;
+        const vector<indexid_t> &indexIds = indexSchemaPtr->GetIndexIdList(fieldId);
+        for (size_t i = 0; i < indexIds.size(); ++i) {
+            const IndexConfigPtr &indexConfig = indexSchemaPtr->GetIndexConfig(indexIds[i]);
+            if (indexConfig && indexConfig->HasOrderedTermDictionary()) {
+                _fieldTermTextVec[fieldId] = true;
+            }
+        }
     }
 }
 
@@ -54,7 +54,8 @@ private:
                     pos_t &lastTokenPos, pos_t &curPos);
     bool addToken(Section *indexSection, const AnalyzerToken *token,
                   autil::mem_pool::Pool *pool,
-                  fieldid_t fieldId, pos_t &lastTokenPos, pos_t &curPos);
+                  fieldid_t fieldId, pos_t &lastTokenPos, pos_t &curPos,
+                  IndexDocument *termTextDoc);
     bool addHashToken(Section *indexSection,
                       uint64_t hashKey, autil::mem_pool::Pool *pool,
                       fieldid_t fieldId, pospayload_t posPayload,
@@ -70,6 +71,8 @@ private:
 private:
     AttributeConvertorVector _attrConvertVec;
     HasherVector _fieldTokenHasherVec;
+    // field in index with ordered term dictionary, keep term text
+    std::vector<bool> _fieldTermTextVec;
     config::IndexPartitionSchemaPtr _schema;
     regionid_t _regionId;
     common::SpatialFieldEncoderPtr _spatialFieldEncoder;
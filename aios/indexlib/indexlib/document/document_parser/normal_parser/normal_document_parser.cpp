@@ -15,6 +15,26 @@ IE_NAMESPACE_USE(common);
 IE_NAMESPACE_BEGIN(document);
 IE_LOG_SETUP(document, NormalDocumentParser);
 
+namespace {
+bool HasTermTexts(const NormalDocumentPtr& doc)
+{
+    const IndexDocumentPtr& indexDoc = doc->GetIndexDocument();
+    if (indexDoc && indexDoc->GetTermTextCount() > 0)
+    {
+        return true;
+    }
+    const NormalDocument::DocumentVector& subDocs = doc->GetSubDocuments();
+    for (size_t i = 0; i < subDocs.size(); ++i)
+    {
+        if (HasTermTexts(subDocs[i]))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+}
+
 string NormalDocumentParser::ATTRIBUTE_CONVERT_ERROR_COUNTER_NAME = "bs.processor.attributeConvertError";
 
 NormalDocumentParser::NormalDocumentParser(const IndexPartitionSchemaPtr& schema)
@@ -102,6 +122,13 @@ DocumentPtr NormalDocumentParser::Parse(const IndexlibExtendDocumentPtr& documen
         IE_INCREASE_QPS(UselessUpdateQps);
     }
 
+    // binary_version=8 only adds term texts for ordered term dictionary,
+    // serialize to version7 without them
+    if (indexDoc->GetSerializedVersion() == 8 && !HasTermTexts(indexDoc))
+    {
+        indexDoc->SetSerializedVersion(7);
+    }
+
     // attention: make binary_version=7 document not used for modify operation and docTrace,
     // atomicly serialize to version6, to make online compitable
     // remove this code when binary version 6 is useless
@@ -15,6 +15,7 @@ IndexDocument::IndexDocument(Pool* pool)
     , mPool(pool)
     , mPayloads(mPool, HASH_MAP_INIT_ELEM_COUNT)
     , mTermPayloads(mPool, HASH_MAP_INIT_ELEM_COUNT)
+    , mTermTexts(mPool, HASH_MAP_INIT_ELEM_COUNT)
 {
 }
 
@@ -98,6 +99,7 @@ void IndexDocument::ClearData()
     mSectionAttributeVec.clear();
     mPayloads.Clear();
     mTermPayloads.Clear();
+    mTermTexts.Clear();
     mPrimaryKey.clear();
 }
 
@@ -253,6 +255,48 @@ const ConstString& IndexDocument::GetSectionAttribute(indexid_t indexId) const
     return mSectionAttributeVec[indexId];
 }
 
+void IndexDocument::SetTermText(uint64_t intKey, const ConstString& termText)
+{
+    if (mTermTexts.Find(intKey))
+    {
+        return;
+    }
+    mTermTexts.Insert(intKey, ConstString(termText.data(), termText.size(), mPool));
+}
+
+ConstString IndexDocument::GetTermText(uint64_t intKey) const
+{
+    const ConstString* termText = mTermTexts.Find(intKey);
+    return termText ? *termText : ConstString::EMPTY_STRING;
+}
+
+void IndexDocument::SerializeTermTexts(DataBuffer &dataBuffer) const
+{
+    TermTextMap::Iterator it = mTermTexts.CreateIterator();
+    dataBuffer.write(mTermTexts.Size());
+    while (it.HasNext())
+    {
+        TermTextMap::KeyValuePair &p = it.Next();
+        dataBuffer.write(p.first);
+        dataBuffer.write(p.second);
+    }
+}
+
+void IndexDocument::DeserializeTermTexts(DataBuffer &dataBuffer)
+{
+    size_t size;
+    dataBuffer.read(size);
+    mTermTexts.Clear();
+    while (size--)
+    {
+        uint64_t intKey;
+        ConstString termText;
+        dataBuffer.read(intKey);
+        dataBuffer.read(termText, mPool);
+        mTermTexts.FindAndInsert(intKey, termText);
+    }
+}
+
 void IndexDocument::serialize(DataBuffer &dataBuffer) const
 {
     SerializeFieldVector(dataBuffer, mFields);
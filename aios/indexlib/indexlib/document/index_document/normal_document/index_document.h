@@ -136,6 +136,14 @@ public:
     void SetDocPayload(uint64_t intKey, docpayload_t docPayload);
     void SetDocPayload(const std::string& termText, docpayload_t docPayload);
 
+    // term text of hash key, carried only for indexes with ordered term
+    // dictionary, serialized in the zone of document binary version 8
+    void SetTermText(uint64_t intKey, const autil::ConstString& termText);
+    autil::ConstString GetTermText(uint64_t intKey) const;
+    size_t GetTermTextCount() const { return mTermTexts.Size(); }
+    void SerializeTermTexts(autil::DataBuffer &dataBuffer) const;
+    void DeserializeTermTexts(autil::DataBuffer &dataBuffer);
+
     void Reserve(uint32_t fieldNum) { mFields.reserve(fieldNum); }
 
     Iterator CreateIterator() const { return Iterator(*this); }
@@ -211,9 +219,11 @@ private:
 
     typedef util::HashMap<uint64_t, docpayload_t> DocPayloadMap;
     typedef util::HashMap<uint64_t, termpayload_t> TermPayloadMap;
+    typedef util::HashMap<uint64_t, autil::ConstString> TermTextMap;
 
     DocPayloadMap mPayloads;
     TermPayloadMap mTermPayloads;
+    TermTextMap mTermTexts;
     SectionAttributeVector mSectionAttributeVec;
     
 private:
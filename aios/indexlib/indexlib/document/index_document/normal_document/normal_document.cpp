@@ -146,17 +146,26 @@ bool NormalDocument::operator==(const NormalDocument& doc) const
 
 void NormalDocument::DoSerialize(DataBuffer &dataBuffer, uint32_t serializedVersion) const
 {
-    if (serializedVersion != DOCUMENT_BINARY_VERSION)
+    for (size_t i = 0; i < mSubDocuments.size(); ++i)
     {
-        for (size_t i = 0; i < mSubDocuments.size(); ++i)
+        // sub documents are inline, a v7 reader only skips the v8 zone at
+        // the end of the main document, so sub documents without term texts
+        // are kept in version 7
+        uint32_t subVersion = serializedVersion;
+        if (serializedVersion == DOCUMENT_BINARY_VERSION
+            && !mSubDocuments[i]->HasTermTexts())
         {
-            mSubDocuments[i]->SetSerializedVersion(serializedVersion);
+            subVersion = 7;
         }
+        mSubDocuments[i]->SetSerializedVersion(subVersion);
     }
     
     switch (serializedVersion)
     {
     case DOCUMENT_BINARY_VERSION:
+        serializeVersion8(dataBuffer);
+        break;
+    case 7:
         serializeVersion7(dataBuffer);
         break;
     case 6:
@@ -296,6 +305,18 @@ void NormalDocument::serializeVersion7(DataBuffer &dataBuffer) const
     dataBuffer.write(mTrace);
 }
 
+void NormalDocument::serializeVersion8(DataBuffer &dataBuffer) const
+{
+    // add term texts of index document
+    serializeVersion7(dataBuffer);
+    bool hasTermTexts = HasTermTexts();
+    dataBuffer.write(hasTermTexts);
+    if (hasTermTexts)
+    {
+        mIndexDocument->SerializeTermTexts(dataBuffer);
+    }
+}
+
 void NormalDocument::deserializeVersion3(DataBuffer &dataBuffer)
 {
     assert(mPool);
@@ -457,6 +478,22 @@ void NormalDocument::deserializeVersion7(DataBuffer &dataBuffer)
     dataBuffer.read(mTrace);
 }
 
+void NormalDocument::deserializeVersion8(DataBuffer &dataBuffer)
+{
+    deserializeVersion7(dataBuffer);
+    bool hasTermTexts;
+    dataBuffer.read(hasTermTexts);
+    if (hasTermTexts)
+    {
+        if (!mIndexDocument)
+        {
+            INDEXLIB_THROW(misc::DocumentDeserializeException,
+                           "term texts without index document");
+        }
+        mIndexDocument->DeserializeTermTexts(dataBuffer);
+    }
+}
+
 void NormalDocument::DoDeserialize(DataBuffer &dataBuffer,
                                    uint32_t serializedVersion)
 {
@@ -465,13 +502,16 @@ void NormalDocument::DoDeserialize(DataBuffer &dataBuffer,
     // fields in different version were stored in different zone
     // -----v7----|---v8--
     // [f1, f2, f3][f4, f5]
-    if (serializedVersion >= 7 && DOCUMENT_BINARY_VERSION == 7) {
-        deserializeVersion7(dataBuffer);
+    if (serializedVersion >= 8 && DOCUMENT_BINARY_VERSION == 8) {
+        deserializeVersion8(dataBuffer);
         return;
     }
     switch (serializedVersion)
     {
     case DOCUMENT_BINARY_VERSION:
+        deserializeVersion8(dataBuffer);
+        break;
+    case 7:
         deserializeVersion7(dataBuffer);
         break;
     case 6:
@@ -246,12 +246,17 @@ private:
     void deserializeVersion5(autil::DataBuffer &dataBuffer);
     void deserializeVersion6(autil::DataBuffer &dataBuffer);
     void deserializeVersion7(autil::DataBuffer &dataBuffer);    
+    void deserializeVersion8(autil::DataBuffer &dataBuffer);
 
     void serializeVersion3(autil::DataBuffer &dataBuffer) const;
     void serializeVersion4(autil::DataBuffer &dataBuffer) const;
     void serializeVersion5(autil::DataBuffer &dataBuffer) const;
     void serializeVersion6(autil::DataBuffer &dataBuffer) const;
     void serializeVersion7(autil::DataBuffer &dataBuffer) const;    
+    void serializeVersion8(autil::DataBuffer &dataBuffer) const;
+
+    bool HasTermTexts() const
+    { return mIndexDocument && mIndexDocument->GetTermTextCount() > 0; }
 
 private:
     IndexDocumentPtr mIndexDocument;
@@ -271,6 +276,7 @@ private:
     KVIndexDocumentPtr mKVIndexDocument;
 private:
     friend class DocumentTest;
+    friend class NormalDocumentTest;
     IE_LOG_DECLARE();
 };
 
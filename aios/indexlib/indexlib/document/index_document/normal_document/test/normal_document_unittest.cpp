@@ -74,7 +74,7 @@ void NormalDocumentTest::TestCaseForCompatibleHighVersion()
     // for compatibility
     uint32_t serializeVersion = DOCUMENT_BINARY_VERSION + 1;
     autil::DataBuffer dataBuffer;
-    originalDoc->serializeVersion7(dataBuffer);
+    originalDoc->serializeVersion8(dataBuffer);
     string appendValue = "appendField";
     dataBuffer.write(appendValue);
     dataBuffer.write(appendValue);
@@ -117,6 +117,78 @@ void NormalDocumentTest::TestCaseSerializeDocument()
     }
 }
 
+void NormalDocumentTest::TestCaseSerializeTermTexts()
+{
+    IndexPartitionSchemaPtr schema = SchemaMaker::MakeSchema(
+            "pk:string;string1:string", "pk:primarykey64:pk;index1:string:string1", "", "");
+    string docString = "cmd=add,pk=pk0,string1=world,ts=1";
+    NormalDocumentPtr doc = DYNAMIC_POINTER_CAST(NormalDocument,
+            DocumentCreator::CreateDocument(schema, docString));
+    ASSERT_TRUE(doc);
+    doc->GetIndexDocument()->SetTermText(1, ConstString("world"));
+    doc->GetIndexDocument()->SetTermText(2, ConstString("hello"));
+    doc->GetIndexDocument()->SetTermText(1, ConstString("ignored"));
+    ASSERT_EQ(size_t(2), doc->GetIndexDocument()->GetTermTextCount());
+
+    autil::DataBuffer dataBuffer;
+    dataBuffer.write(doc);
+    NormalDocumentPtr newDoc;
+    dataBuffer.read(newDoc);
+    ASSERT_TRUE(*doc == *newDoc);
+    ASSERT_EQ(size_t(2), newDoc->GetIndexDocument()->GetTermTextCount());
+    ASSERT_EQ(string("world"), newDoc->GetIndexDocument()->GetTermText(1).toString());
+    ASSERT_EQ(string("hello"), newDoc->GetIndexDocument()->GetTermText(2).toString());
+    ASSERT_TRUE(newDoc->GetIndexDocument()->GetTermText(3).empty());
+
+    // version 7 has no term texts
+    doc->SetSerializedVersion(7);
+    autil::DataBuffer legacyDataBuffer;
+    legacyDataBuffer.write(doc);
+    NormalDocumentPtr legacyDoc;
+    legacyDataBuffer.read(legacyDoc);
+    ASSERT_EQ(size_t(0), legacyDoc->GetIndexDocument()->GetTermTextCount());
+}
+
+void NormalDocumentTest::TestCaseSerializeSubDocTermTexts()
+{
+    IndexPartitionSchemaPtr schema = SchemaMaker::MakeSchema(
+            "pk:string;string1:string", "pk:primarykey64:pk;index1:string:string1", "", "");
+    NormalDocumentPtr doc = DYNAMIC_POINTER_CAST(NormalDocument,
+            DocumentCreator::CreateDocument(schema, "cmd=add,pk=pk0,string1=world,ts=1"));
+    ASSERT_TRUE(doc);
+    doc->GetIndexDocument()->SetTermText(1, ConstString("world"));
+    for (size_t i = 0; i < 2; ++i)
+    {
+        NormalDocumentPtr subDoc(new NormalDocument);
+        IndexDocumentPtr subIndexDoc(new IndexDocument(subDoc->GetPool()));
+        subIndexDoc->SetPrimaryKey("sub" + StringUtil::toString(i));
+        subDoc->SetIndexDocument(subIndexDoc);
+        doc->AddSubDocument(subDoc);
+    }
+    doc->GetSubDocuments()[1]->GetIndexDocument()->SetTermText(2, ConstString("hello"));
+
+    autil::DataBuffer dataBuffer;
+    doc->serialize(dataBuffer);
+
+    // read as a v7 reader does: the main document version is 8, its v8
+    // zone at the end is skipped, sub documents are read by their version
+    uint32_t serializedVersion = 0;
+    dataBuffer.read(serializedVersion);
+    ASSERT_EQ(DOCUMENT_BINARY_VERSION, serializedVersion);
+    NormalDocumentPtr legacyDoc(new NormalDocument);
+    legacyDoc->deserializeVersion7(dataBuffer);
+    ASSERT_EQ(doc->GetTimestamp(), legacyDoc->GetTimestamp());
+    ASSERT_EQ(doc->GetDocOperateType(), legacyDoc->GetDocOperateType());
+    const NormalDocument::DocumentVector& subDocs = legacyDoc->GetSubDocuments();
+    ASSERT_EQ(size_t(2), subDocs.size());
+    // no term texts, readable by a v7 reader
+    ASSERT_EQ(7u, subDocs[0]->GetSerializedVersion());
+    ASSERT_EQ(string("sub0"), subDocs[0]->GetIndexDocument()->GetPrimaryKey());
+    ASSERT_EQ(size_t(0), subDocs[0]->GetIndexDocument()->GetTermTextCount());
+    ASSERT_EQ(DOCUMENT_BINARY_VERSION, subDocs[1]->GetSerializedVersion());
+    ASSERT_EQ(string("hello"), subDocs[1]->GetIndexDocument()->GetTermText(2).toString());
+}
+
 void NormalDocumentTest::TestCaseSerializeDocumentWithIndexRawFields()
 {
     IndexPartitionSchemaPtr schema = SchemaMaker::MakeSchema(
@@ -24,6 +24,8 @@ public:
     void TestCaseForOperatorEqual();
     void TestCaseSerializeDocument();
     void TestCaseSerializeDocumentWithIndexRawFields();
+    void TestCaseSerializeTermTexts();
+    void TestCaseSerializeSubDocTermTexts();
     void TestCaseForDeserializeLegacyDocument();
     void TestCaseForCompatibleHighVersion();
     void TestAddTag();
@@ -47,6 +49,8 @@ private:
 INDEXLIB_UNIT_TEST_CASE(NormalDocumentTest, TestCaseForOperatorEqual);
 INDEXLIB_UNIT_TEST_CASE(NormalDocumentTest, TestCaseSerializeDocument);
 INDEXLIB_UNIT_TEST_CASE(NormalDocumentTest, TestCaseSerializeDocumentWithIndexRawFields);
+INDEXLIB_UNIT_TEST_CASE(NormalDocumentTest, TestCaseSerializeTermTexts);
+INDEXLIB_UNIT_TEST_CASE(NormalDocumentTest, TestCaseSerializeSubDocTermTexts);
 INDEXLIB_UNIT_TEST_CASE(NormalDocumentTest, TestCaseForDeserializeLegacyDocument);
 INDEXLIB_UNIT_TEST_CASE(NormalDocumentTest, TestCaseForCompatibleHighVersion);
 INDEXLIB_UNIT_TEST_CASE(NormalDocumentTest, TestAddTag);
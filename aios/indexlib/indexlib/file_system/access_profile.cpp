@@ -0,0 +1,402 @@
+#include <sys/mman.h>
+#include <unistd.h>
+#include <algorithm>
+#include <autil/StringUtil.h>
+#include "indexlib/file_system/access_profile.h"
+#include "indexlib/storage/file_system_wrapper.h"
+#include "indexlib/misc/exception.h"
+#include "indexlib/index_define.h"
+
+using namespace std;
+using namespace autil;
+using namespace autil::legacy;
+IE_NAMESPACE_USE(storage);
+IE_NAMESPACE_USE(misc);
+
+IE_NAMESPACE_BEGIN(file_system);
+IE_LOG_SETUP(file_system, AccessProfile);
+
+namespace {
+const string ACCESS_PROFILE_FILE_NAME_PREFIX = "access_profile.";
+
+bool CompareRange(const AccessProfile::AccessRange& left,
+                  const AccessProfile::AccessRange& right)
+{
+    if (left.hotness != right.hotness)
+    {
+        return left.hotness > right.hotness;
+    }
+    return left.offset < right.offset;
+}
+
+bool IsDigits(const string& str, size_t begin, size_t end)
+{
+    if (begin >= end)
+    {
+        return false;
+    }
+    for (size_t i = begin; i < end; ++i)
+    {
+        if (str[i] < '0' || str[i] > '9')
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// segment_<id> or segment_<id>_level_<level>
+bool IsSegmentDirName(const string& path, size_t begin, size_t end)
+{
+    static const string SEGMENT_PREFIX = string(SEGMENT_FILE_NAME_PREFIX) + "_";
+    static const string LEVEL_PREFIX = "_level_";
+    if (path.compare(begin, SEGMENT_PREFIX.size(), SEGMENT_PREFIX) != 0)
+    {
+        return false;
+    }
+    begin += SEGMENT_PREFIX.size();
+    size_t levelPos = path.find(LEVEL_PREFIX, begin);
+    if (levelPos == string::npos || levelPos >= end)
+    {
+        return IsDigits(path, begin, end);
+    }
+    return IsDigits(path, begin, levelPos)
+        && IsDigits(path, levelPos + LEVEL_PREFIX.size(), end);
+}
+}
+
+AccessProfile::AccessProfile(size_t chunkSize)
+    : mChunkSize(chunkSize)
+    , mSegmentFilesDirty(false)
+{
+    if (mChunkSize == 0)
+    {
+        INDEXLIB_FATAL_ERROR(BadParameter, "access profile chunk size is zero");
+    }
+}
+
+AccessProfile::~AccessProfile()
+{
+}
+
+void AccessProfile::Jsonize(JsonWrapper& json)
+{
+    // file path -> [[chunk idx, hotness], ...]
+    typedef map<string, vector<vector<uint32_t> > > JsonFileChunkMap;
+    typedef map<string, int64_t> JsonFileLengthMap;
+    json.Jsonize("chunk_size", mChunkSize, mChunkSize);
+    if (mChunkSize == 0)
+    {
+        INDEXLIB_FATAL_ERROR(IndexCollapsed, "access profile chunk size is zero");
+    }
+    if (json.GetMode() == TO_JSON)
+    {
+        JsonFileChunkMap jsonFileChunks;
+        for (FileChunkMap::const_iterator it = mFileChunks.begin();
+             it != mFileChunks.end(); ++it)
+        {
+            vector<vector<uint32_t> >& chunks = jsonFileChunks[it->first];
+            for (ChunkHotnessMap::const_iterator chunkIt = it->second.begin();
+                 chunkIt != it->second.end(); ++chunkIt)
+            {
+                vector<uint32_t> chunk;
+                chunk.push_back(chunkIt->first);
+                chunk.push_back(chunkIt->second);
+                chunks.push_back(chunk);
+            }
+        }
+        json.Jsonize("files", jsonFileChunks);
+        JsonFileLengthMap jsonFileLengths(mFileLengths.begin(), mFileLengths.end());
+        json.Jsonize("file_lengths", jsonFileLengths);
+        return;
+    }
+    JsonFileChunkMap jsonFileChunks;
+    json.Jsonize("files", jsonFileChunks, jsonFileChunks);
+    // not in profiles stored before file lengths were recorded
+    JsonFileLengthMap jsonFileLengths;
+    json.Jsonize("file_lengths", jsonFileLengths, jsonFileLengths);
+    mFileLengths.clear();
+    mFileLengths.insert(jsonFileLengths.begin(), jsonFileLengths.end());
+    mFileChunks.clear();
+    mSegmentFilesDirty = true;
+    for (JsonFileChunkMap::const_iterator it = jsonFileChunks.begin();
+         it != jsonFileChunks.end(); ++it)
+    {
+        ChunkHotnessMap& chunks = mFileChunks[it->first];
+        for (size_t i = 0; i < it->second.size(); ++i)
+        {
+            const vector<uint32_t>& chunk = it->second[i];
+            if (chunk.size() != 2)
+            {
+                INDEXLIB_FATAL_ERROR(IndexCollapsed, "bad access profile chunk of file [%s]",
+                        it->first.c_str());
+            }
+            chunks[chunk[0]] = chunk[1];
+        }
+    }
+}
+
+void AccessProfile::Sample(const string& filePath, const void* base, size_t length)
+{
+    if (!base || length == 0)
+    {
+        return;
+    }
+    static const size_t PAGE_SIZE = getpagesize();
+    // files in package are not page aligned
+    size_t addr = (size_t)base;
+    size_t delta = addr % PAGE_SIZE;
+    size_t pageCount = (length + delta + PAGE_SIZE - 1) / PAGE_SIZE;
+    vector<unsigned char> residency(pageCount, 0);
+    if (mincore((void*)(addr - delta), length + delta, residency.data()) < 0)
+    {
+        IE_LOG(WARN, "mincore file [%s] failed, errno [%d]", filePath.c_str(), errno);
+        return;
+    }
+
+    ScopedLock lock(mLock);
+    size_t fileCount = mFileChunks.size();
+    ChunkHotnessMap& chunks = mFileChunks[filePath];
+    int64_t lastChunkIdx = -1;
+    for (size_t i = 0; i < pageCount; ++i)
+    {
+        if (!(residency[i] & 1))
+        {
+            continue;
+        }
+        size_t offset = i * PAGE_SIZE > delta ? i * PAGE_SIZE - delta : 0;
+        int64_t chunkIdx = offset / mChunkSize;
+        if (chunkIdx == lastChunkIdx)
+        {
+            continue;
+        }
+        ++chunks[chunkIdx];
+        lastChunkIdx = chunkIdx;
+    }
+    if (chunks.empty())
+    {
+        mFileChunks.erase(filePath);
+        return;
+    }
+    mFileLengths[filePath] = length;
+    if (mFileChunks.size() != fileCount)
+    {
+        mSegmentFilesDirty = true;
+    }
+}
+
+void AccessProfile::AddChunk(const string& filePath, size_t offset, uint32_t hotness)
+{
+    ScopedLock lock(mLock);
+    size_t fileCount = mFileChunks.size();
+    mFileChunks[filePath][offset / mChunkSize] += hotness;
+    if (mFileChunks.size() != fileCount)
+    {
+        mSegmentFilesDirty = true;
+    }
+}
+
+AccessProfile::AccessRangeVec AccessProfile::GetRanges(
+        const string& filePath, size_t fileLength) const
+{
+    ScopedLock lock(mLock);
+    FileChunkMap::const_iterator it = mFileChunks.find(filePath);
+    if (it != mFileChunks.end())
+    {
+        return MakeRanges(it->second, fileLength);
+    }
+    ChunkHotnessMap chunks;
+    GetSegmentFileChunks(filePath, fileLength, chunks);
+    return MakeRanges(chunks, fileLength);
+}
+
+void AccessProfile::GetSegmentFileChunks(const string& filePath, size_t fileLength,
+        ChunkHotnessMap& chunks) const
+{
+    string key;
+    if (fileLength == 0 || !ExtractSegmentFileKey(filePath, key))
+    {
+        return;
+    }
+    if (mSegmentFilesDirty)
+    {
+        RebuildSegmentFiles();
+    }
+    SegmentFileMap::const_iterator it = mSegmentFiles.find(key);
+    if (it == mSegmentFiles.end())
+    {
+        return;
+    }
+    // a hot chunk of a source file warms the same relative part of the new
+    // file, so the new file is warmed by the hot ratio of its sources
+    const vector<string>& srcFiles = it->second;
+    for (size_t i = 0; i < srcFiles.size(); ++i)
+    {
+        const ChunkHotnessMap& srcChunks = mFileChunks.find(srcFiles[i])->second;
+        size_t srcLength = GetProfileFileLength(srcFiles[i], srcChunks);
+        double scale = (double)fileLength / srcLength;
+        for (ChunkHotnessMap::const_iterator chunkIt = srcChunks.begin();
+             chunkIt != srcChunks.end(); ++chunkIt)
+        {
+            size_t srcBegin = (size_t)chunkIt->first * mChunkSize;
+            if (srcBegin >= srcLength)
+            {
+                break;
+            }
+            size_t srcEnd = min(srcBegin + mChunkSize, srcLength);
+            size_t begin = min((size_t)(srcBegin * scale), fileLength - 1);
+            size_t end = max(min((size_t)(srcEnd * scale), fileLength), begin + 1);
+            for (size_t chunkIdx = begin / mChunkSize;
+                 chunkIdx <= (end - 1) / mChunkSize; ++chunkIdx)
+            {
+                chunks[chunkIdx] += chunkIt->second;
+            }
+        }
+    }
+}
+
+size_t AccessProfile::GetProfileFileLength(const string& filePath,
+        const ChunkHotnessMap& chunks) const
+{
+    FileLengthMap::const_iterator it = mFileLengths.find(filePath);
+    if (it != mFileLengths.end() && it->second > 0)
+    {
+        return it->second;
+    }
+    return ((size_t)chunks.rbegin()->first + 1) * mChunkSize;
+}
+
+void AccessProfile::RebuildSegmentFiles() const
+{
+    mSegmentFiles.clear();
+    string key;
+    for (FileChunkMap::const_iterator it = mFileChunks.begin();
+         it != mFileChunks.end(); ++it)
+    {
+        if (!it->second.empty() && ExtractSegmentFileKey(it->first, key))
+        {
+            mSegmentFiles[key].push_back(it->first);
+        }
+    }
+    mSegmentFilesDirty = false;
+}
+
+bool AccessProfile::ExtractSegmentFileKey(const string& filePath, string& key)
+{
+    size_t begin = 0;
+    while (begin < filePath.size())
+    {
+        size_t end = filePath.find('/', begin);
+        if (end == string::npos)
+        {
+            // the file itself
+            return false;
+        }
+        if (IsSegmentDirName(filePath, begin, end))
+        {
+            key = filePath.substr(0, begin) + "*" + filePath.substr(end);
+            return true;
+        }
+        begin = end + 1;
+    }
+    return false;
+}
+
+AccessProfile::AccessRangeVec AccessProfile::MakeRanges(
+        const ChunkHotnessMap& chunks, size_t fileLength) const
+{
+    AccessRangeVec ranges;
+    for (ChunkHotnessMap::const_iterator chunkIt = chunks.begin();
+         chunkIt != chunks.end(); ++chunkIt)
+    {
+        size_t offset = (size_t)chunkIt->first * mChunkSize;
+        if (offset >= fileLength)
+        {
+            // file rewritten with the same path, stale chunks
+            break;
+        }
+        size_t length = min(mChunkSize, fileLength - offset);
+        if (!ranges.empty())
+        {
+            AccessRange& last = ranges.back();
+            if (last.offset + last.length == offset && last.hotness == chunkIt->second)
+            {
+                last.length += length;
+                continue;
+            }
+        }
+        ranges.push_back(AccessRange(offset, length, chunkIt->second));
+    }
+    sort(ranges.begin(), ranges.end(), CompareRange);
+    return ranges;
+}
+
+bool AccessProfile::HasFile(const string& filePath) const
+{
+    ScopedLock lock(mLock);
+    return mFileChunks.find(filePath) != mFileChunks.end();
+}
+
+size_t AccessProfile::GetFileCount() const
+{
+    ScopedLock lock(mLock);
+    return mFileChunks.size();
+}
+
+void AccessProfile::Store(const string& profilePath) const
+{
+    string content;
+    {
+        ScopedLock lock(mLock);
+        content = ToJsonString(*this);
+    }
+    FileSystemWrapper::AtomicStoreIgnoreExist(profilePath, content);
+    IE_LOG(INFO, "store access profile [%s], file count [%lu]",
+           profilePath.c_str(), GetFileCount());
+}
+
+bool AccessProfile::Load(const string& profilePath)
+{
+    string content;
+    if (!FileSystemWrapper::AtomicLoad(profilePath, content, true))
+    {
+        IE_LOG(INFO, "access profile [%s] not exist", profilePath.c_str());
+        return false;
+    }
+    AccessProfile profile;
+    FromJsonString(profile, content);
+    ScopedLock lock(mLock);
+    mChunkSize = profile.mChunkSize;
+    mFileChunks.swap(profile.mFileChunks);
+    mFileLengths.swap(profile.mFileLengths);
+    mSegmentFilesDirty = true;
+    IE_LOG(INFO, "load access profile [%s], file count [%lu]",
+           profilePath.c_str(), mFileChunks.size());
+    return true;
+}
+
+void AccessProfile::Clear()
+{
+    ScopedLock lock(mLock);
+    mFileChunks.clear();
+    mFileLengths.clear();
+    mSegmentFiles.clear();
+    mSegmentFilesDirty = false;
+}
+
+string AccessProfile::GetProfileFileName(versionid_t versionId)
+{
+    return ACCESS_PROFILE_FILE_NAME_PREFIX + StringUtil::toString(versionId);
+}
+
+bool AccessProfile::ExtractVersionId(const string& fileName, versionid_t& versionId)
+{
+    if (!StringUtil::startsWith(fileName, ACCESS_PROFILE_FILE_NAME_PREFIX))
+    {
+        return false;
+    }
+    return StringUtil::fromString(
+            fileName.substr(ACCESS_PROFILE_FILE_NAME_PREFIX.size()), versionId);
+}
+
+IE_NAMESPACE_END(file_system);
@@ -0,0 +1,106 @@
+#ifndef __INDEXLIB_ACCESS_PROFILE_H
+#define __INDEXLIB_ACCESS_PROFILE_H
+
+#include <tr1/memory>
+#include <map>
+#include <vector>
+#include <autil/Lock.h>
+#include "autil/legacy/jsonizable.h"
+#include "indexlib/indexlib.h"
+#include "indexlib/common_define.h"
+
+IE_NAMESPACE_BEGIN(file_system);
+
+// hot ranges of the files of the live version, sampled by page residency
+// (mincore) in chunks of mChunkSize, every sample a chunk is resident in
+// adds one to its hotness. a new version warms the ranges of the files it
+// carries over (same path) hottest first, see WARMUP_PROFILE. files of new
+// (merged or inc) segments are not in the profile, they are warmed at the
+// relative offsets hot in the files of the same name in the profiled segments
+class AccessProfile : public autil::legacy::Jsonizable
+{
+public:
+    struct AccessRange
+    {
+        AccessRange(size_t offset_ = 0, size_t length_ = 0, uint32_t hotness_ = 0)
+            : offset(offset_)
+            , length(length_)
+            , hotness(hotness_)
+        {}
+        size_t offset;
+        size_t length;
+        uint32_t hotness;
+    };
+    typedef std::vector<AccessRange> AccessRangeVec;
+
+private:
+    // chunk idx -> hotness
+    typedef std::map<uint32_t, uint32_t> ChunkHotnessMap;
+    typedef std::map<std::string, ChunkHotnessMap> FileChunkMap;
+    typedef std::map<std::string, size_t> FileLengthMap;
+    // file path with segment dir name masked -> file paths in profile
+    typedef std::map<std::string, std::vector<std::string> > SegmentFileMap;
+
+public:
+    AccessProfile(size_t chunkSize = DEFAULT_CHUNK_SIZE);
+    ~AccessProfile();
+
+public:
+    void Jsonize(autil::legacy::Jsonizable::JsonWrapper& json) override;
+
+public:
+    // base should be page aligned, as returned by mmap
+    void Sample(const std::string& filePath, const void* base, size_t length);
+    void AddChunk(const std::string& filePath, size_t offset, uint32_t hotness = 1);
+
+    // adjacent chunks merged, hottest first, then by offset. a file not in
+    // profile gets the ranges mapped from the same name files of other segments
+    AccessRangeVec GetRanges(const std::string& filePath, size_t fileLength) const;
+    bool HasFile(const std::string& filePath) const;
+    size_t GetFileCount() const;
+    size_t GetChunkSize() const { return mChunkSize; }
+
+    void Store(const std::string& profilePath) const;
+    // return false if profile not exist
+    bool Load(const std::string& profilePath);
+    void Clear();
+
+public:
+    // profile stored with a version in the index root, access_profile.<versionId>
+    static std::string GetProfileFileName(versionid_t versionId);
+    static bool ExtractVersionId(const std::string& fileName, versionid_t& versionId);
+
+private:
+    void GetSegmentFileChunks(const std::string& filePath, size_t fileLength,
+                              ChunkHotnessMap& chunks) const;
+    size_t GetProfileFileLength(const std::string& filePath,
+                                const ChunkHotnessMap& chunks) const;
+    void RebuildSegmentFiles() const;
+    AccessRangeVec MakeRanges(const ChunkHotnessMap& chunks, size_t fileLength) const;
+
+    // eg: root/segment_1_level_0/index/pk/data -> root/*/index/pk/data
+    static bool ExtractSegmentFileKey(const std::string& filePath, std::string& key);
+
+public:
+    static const size_t DEFAULT_CHUNK_SIZE = 256 * 1024;
+
+private:
+    mutable autil::ThreadMutex mLock;
+    size_t mChunkSize;
+    FileChunkMap mFileChunks;
+    // length of sampled files, chunks of files added without it are
+    // mapped by the end of their last chunk
+    FileLengthMap mFileLengths;
+    mutable SegmentFileMap mSegmentFiles;
+    mutable bool mSegmentFilesDirty;
+
+private:
+    IE_LOG_DECLARE();
+    friend class AccessProfileTest;
+};
+
+DEFINE_SHARED_PTR(AccessProfile);
+
+IE_NAMESPACE_END(file_system);
+
+#endif //__INDEXLIB_ACCESS_PROFILE_H
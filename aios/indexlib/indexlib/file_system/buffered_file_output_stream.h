@@ -25,11 +25,11 @@ public:
     virtual ~BufferedFileOutputStream() {}
 
 public:
-    void Open(const std::string&path);
-    size_t Write(const void* buffer, size_t length);
+    virtual void Open(const std::string&path);
+    virtual size_t Write(const void* buffer, size_t length);
     virtual void Close();
 
-    size_t GetLength() const;
+    virtual size_t GetLength() const;
 
 private:
     void InitFileNode(bool onClose) ;
@@ -39,9 +39,10 @@ protected:
     // for mock
     virtual BufferedFileNode* CreateFileNode() const;
 
-private:
+protected:
     storage::RaidConfigPtr mRaidConfig;
     bool mUseRaid;
+private:
     std::string mPath;
     std::unique_ptr<BufferedFileNode> mFileNode;
     std::unique_ptr<storage::FileBuffer> mBuffer;
@@ -6,6 +6,9 @@
 #include "indexlib/util/thread_pool.h"
 #include "indexlib/storage/file_buffer.h"
 #include "indexlib/storage/file_system_wrapper.h"
+#include "indexlib/util/path_util.h"
+#include <fcntl.h>
+#include <unistd.h>
 
 using namespace std;
 using namespace autil;
@@ -23,6 +26,8 @@ BufferedFileReader::BufferedFileReader(const FileNodePtr& fileNode,
     , mCurBlock(-1)
     , mBuffer(NULL)
     , mSwitchBuffer(NULL)
+    , mDropCacheFd(-1)
+    , mDroppedOffset(0)
 {
     assert(fileNode);
     ResetBufferParam(bufferSize, false);
@@ -35,6 +40,8 @@ BufferedFileReader::BufferedFileReader(uint32_t bufferSize, bool asyncRead)
     , mCurBlock(-1)
     , mBuffer(new FileBuffer(bufferSize))
     , mSwitchBuffer(NULL)
+    , mDropCacheFd(-1)
+    , mDroppedOffset(0)
 {
     if (asyncRead)
     {
@@ -54,6 +61,7 @@ BufferedFileReader::~BufferedFileReader()
         catch(...)
         {}
     }
+    CloseDropCacheFile();
     DELETE_AND_SET_NULL(mBuffer);
     DELETE_AND_SET_NULL(mSwitchBuffer); 
 }
@@ -65,7 +73,8 @@ void BufferedFileReader::Open(const std::string& filePath)
     mFileLength = mFileNode->GetLength();
 }
 
-void BufferedFileReader::ResetBufferParam(size_t bufferSize, bool asyncRead)
+void BufferedFileReader::ResetBufferParam(size_t bufferSize, bool asyncRead,
+                                          bool dropCacheAfterRead)
 {
     DELETE_AND_SET_NULL(mBuffer);
     DELETE_AND_SET_NULL(mSwitchBuffer);
@@ -82,6 +91,66 @@ void BufferedFileReader::ResetBufferParam(size_t bufferSize, bool asyncRead)
 
     mOffset = 0;
     mCurBlock = -1;
+    CloseDropCacheFile();
+    if (dropCacheAfterRead)
+    {
+        OpenDropCacheFile();
+    }
+}
+
+void BufferedFileReader::OpenDropCacheFile()
+{
+    assert(mFileNode);
+    const string& path = mFileNode->GetPath();
+    if (mFileNode->IsInPackage() || PathUtil::IsInDfs(path))
+    {
+        IE_LOG(DEBUG, "file [%s] not support drop cache", path.c_str());
+        return;
+    }
+    // page cache is shared by inode, a separate fd is enough for fadvise
+    string localPath = PathUtil::GetRelativePath(path);
+    mDropCacheFd = ::open(localPath.c_str(), O_RDONLY);
+    if (mDropCacheFd < 0)
+    {
+        IE_LOG(WARN, "open file [%s] for drop cache failed, %s",
+               path.c_str(), strerror(errno));
+        return;
+    }
+    ::posix_fadvise(mDropCacheFd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    mDroppedOffset = 0;
+}
+
+void BufferedFileReader::CloseDropCacheFile()
+{
+    if (mDropCacheFd < 0)
+    {
+        return;
+    }
+    ::posix_fadvise(mDropCacheFd, 0, 0, POSIX_FADV_DONTNEED);
+    ::close(mDropCacheFd);
+    mDropCacheFd = -1;
+}
+
+void BufferedFileReader::AdvisePageCache(int64_t blockNum)
+{
+    if (mDropCacheFd < 0)
+    {
+        return;
+    }
+    int64_t bufferSize = mBuffer->GetBufferSize();
+    int64_t blockBegin = blockNum * bufferSize;
+    if (blockBegin > mDroppedOffset)
+    {
+        ::posix_fadvise(mDropCacheFd, mDroppedOffset,
+                        blockBegin - mDroppedOffset, POSIX_FADV_DONTNEED);
+        mDroppedOffset = blockBegin;
+    }
+    if (!mThreadPool && blockBegin + bufferSize < mFileLength)
+    {
+        // async mode prefetches next block by itself
+        ::posix_fadvise(mDropCacheFd, blockBegin + bufferSize,
+                        bufferSize, POSIX_FADV_WILLNEED);
+    }
 }
 
 size_t BufferedFileReader::Read(void* buffer, size_t length, size_t offset, ReadOption option)
@@ -164,6 +233,7 @@ void BufferedFileReader::Close()
         mThreadPool->CheckException();
         mThreadPool.reset();
     }
+    CloseDropCacheFile();
 }
 
 void BufferedFileReader::LoadBuffer(int64_t blockNum, ReadOption option)
@@ -199,6 +269,7 @@ void BufferedFileReader::SyncLoadBuffer(int64_t blockNum, ReadOption option)
                              readSize, readLen);
     }
     mCurBlock = blockNum;
+    AdvisePageCache(blockNum);
 }
 
 void BufferedFileReader::AsyncLoadBuffer(int64_t blockNum, ReadOption option)
@@ -220,6 +291,7 @@ void BufferedFileReader::AsyncLoadBuffer(int64_t blockNum, ReadOption option)
         PrefetchBlock(blockNum + 1, option);
     }
     mCurBlock = blockNum;
+    AdvisePageCache(blockNum);
 }
 
 size_t BufferedFileReader::DoRead(void* buffer, size_t length, size_t offset, ReadOption option)
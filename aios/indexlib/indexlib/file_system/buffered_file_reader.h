@@ -56,7 +56,10 @@ public:
 
     int64_t Tell() const { return mOffset; }
 
-    void ResetBufferParam(size_t bufferSize, bool asyncRead);
+    // dropCacheAfterRead: readahead next block and evict consumed blocks
+    // from page cache, used by merge to read large sequential inputs
+    void ResetBufferParam(size_t bufferSize, bool asyncRead,
+                          bool dropCacheAfterRead = false);
 
 private:
     virtual void LoadBuffer(int64_t blockNum, ReadOption option);
@@ -65,6 +68,9 @@ private:
     void AsyncLoadBuffer(int64_t blockNum, ReadOption option);
     void PrefetchBlock(int64_t blockNum, ReadOption option);
     void IOCtlPrefetch(size_t blockSize);
+    void OpenDropCacheFile();
+    void CloseDropCacheFile();
+    void AdvisePageCache(int64_t blockNum);
 
 public:
     // public for test
@@ -78,10 +84,13 @@ private:
     storage::FileBuffer *mBuffer;
     storage::FileBuffer *mSwitchBuffer;
     util::ThreadPoolPtr mThreadPool;
+    int mDropCacheFd;
+    int64_t mDroppedOffset;
 
 private:
     IE_LOG_DECLARE();
     friend class MockBufferedFileReader;
+    friend class BufferedFileReaderTest;
 };
 
 DEFINE_SHARED_PTR(BufferedFileReader);
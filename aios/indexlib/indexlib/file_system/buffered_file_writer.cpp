@@ -4,6 +4,7 @@
 #include "indexlib/file_system/buffered_file_node.h"
 #include "indexlib/file_system/file_work_item.h"
 #include "indexlib/file_system/buffered_file_output_stream.h"
+#include "indexlib/file_system/direct_io_file_output_stream.h"
 #include "indexlib/storage/file_system_wrapper.h"
 #include "indexlib/storage/file_buffer.h"
 #include "indexlib/util/thread_pool.h"
@@ -23,12 +24,12 @@ BufferedFileWriter::BufferedFileWriter(const FSWriterParam& param)
     : FileWriter(param)
     , mLength(0)
     , mIsClosed(0)
-    , mBuffer(new FileBuffer(param.bufferSize))
+    , mBuffer(CreateFileBuffer(param.bufferSize))
     , mSwitchBuffer(NULL)
 {
     if (param.asyncDump)
     {
-        mSwitchBuffer = new FileBuffer(param.bufferSize);
+        mSwitchBuffer = CreateFileBuffer(param.bufferSize);
         mThreadPool = FileSystemWrapper::GetThreadPool(fslib::WRITE);
     }
 
@@ -57,10 +58,10 @@ void BufferedFileWriter::ResetBufferParam(size_t bufferSize, bool asyncWrite)
 
     DELETE_AND_SET_NULL(mBuffer);
     DELETE_AND_SET_NULL(mSwitchBuffer);
-    mBuffer = new FileBuffer(bufferSize);
+    mBuffer = CreateFileBuffer(bufferSize);
     if (asyncWrite)
     {
-        mSwitchBuffer = new FileBuffer(bufferSize);
+        mSwitchBuffer = CreateFileBuffer(bufferSize);
         mThreadPool = FileSystemWrapper::GetThreadPool(fslib::WRITE);
     }
     else
@@ -72,7 +73,7 @@ void BufferedFileWriter::ResetBufferParam(size_t bufferSize, bool asyncWrite)
 void BufferedFileWriter::OpenWithoutCheck(const string& path)
 {
     mFilePath = path;
-    mStream.reset(new BufferedFileOutputStream(mWriterParam.raidConfig));
+    mStream.reset(CreateOutputStream());
     string dumpPath = GetDumpPath();
     mStream->Open(dumpPath);
     mIsClosed = false;
@@ -87,6 +88,26 @@ string BufferedFileWriter::GetDumpPath() const
     return mFilePath;
 }
 
+BufferedFileOutputStream* BufferedFileWriter::CreateOutputStream() const
+{
+    if (mWriterParam.directIO)
+    {
+        return new DirectIOFileOutputStream(mWriterParam.raidConfig);
+    }
+    return new BufferedFileOutputStream(mWriterParam.raidConfig);
+}
+
+FileBuffer* BufferedFileWriter::CreateFileBuffer(size_t bufferSize) const
+{
+    if (mWriterParam.directIO)
+    {
+        // full buffers can be written through without copy when aligned
+        return new FileBuffer(DirectIOFileOutputStream::AlignUp(bufferSize),
+                              DirectIOFileOutputStream::ALIGNMENT);
+    }
+    return new FileBuffer(bufferSize);
+}
+
 void BufferedFileWriter::Open(const string& path)
 {
     mFilePath = path;
@@ -96,7 +117,7 @@ void BufferedFileWriter::Open(const string& path)
         IE_LOG(WARN, "file: %s already exists and will be removed", dumpPath.c_str());
         FileSystemWrapper::DeleteFile(dumpPath);
     }
-    mStream.reset(new BufferedFileOutputStream(mWriterParam.raidConfig));
+    mStream.reset(CreateOutputStream());
     mStream->Open(dumpPath);
     mIsClosed = false;
 }
@@ -35,6 +35,8 @@ protected:
     
 private:
     std::string GetDumpPath() const;
+    BufferedFileOutputStream* CreateOutputStream() const;
+    storage::FileBuffer* CreateFileBuffer(size_t bufferSize) const;
 
 protected:
     BufferedFileOutputStreamPtr mStream;
@@ -48,6 +50,7 @@ protected:
 private:
     IE_LOG_DECLARE();
     friend class BufferedFileWriterTest;
+    friend class DirectIOFileOutputStreamTest;
     friend class PartitionResourceProviderInteTest;
 };
 
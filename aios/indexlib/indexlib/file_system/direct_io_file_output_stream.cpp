@@ -0,0 +1,223 @@
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+#include <fslib/fs/FileSystem.h>
+#include "indexlib/file_system/direct_io_file_output_stream.h"
+#include "indexlib/storage/file_buffer.h"
+#include "indexlib/misc/exception.h"
+#include "indexlib/util/path_util.h"
+
+using namespace std;
+using namespace fslib::fs;
+IE_NAMESPACE_USE(storage);
+IE_NAMESPACE_USE(util);
+
+IE_NAMESPACE_BEGIN(file_system);
+IE_LOG_SETUP(file_system, DirectIOFileOutputStream);
+
+const size_t DirectIOFileOutputStream::ALIGNMENT;
+const uint32_t DirectIOFileOutputStream::STAGING_BUFFER_SIZE;
+const size_t DirectIOFileOutputStream::DROP_CACHE_STEP;
+
+DirectIOFileOutputStream::DirectIOFileOutputStream(const RaidConfigPtr& raidConfig)
+    : BufferedFileOutputStream(raidConfig)
+    , mFd(-1)
+    , mDirectIO(false)
+    , mLength(0)
+    , mFlushedLength(0)
+    , mDroppedLength(0)
+{
+}
+
+DirectIOFileOutputStream::~DirectIOFileOutputStream() 
+{
+    if (mFd >= 0)
+    {
+        ::close(mFd);
+        mFd = -1;
+    }
+}
+
+void DirectIOFileOutputStream::Open(const string& path)
+{
+    mFilePath = path;
+    if (mUseRaid || FileSystem::getFsType(path) != FSLIB_FS_LOCAL_FILESYSTEM_NAME)
+    {
+        IE_LOG(DEBUG, "file [%s] not support direct io, use buffered output",
+               path.c_str());
+        BufferedFileOutputStream::Open(path);
+        return;
+    }
+
+    string localPath = PathUtil::GetRelativePath(path);
+    mFd = ::open(localPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_DIRECT, 0644);
+    mDirectIO = (mFd >= 0);
+    if (mFd < 0 && errno == EINVAL)
+    {
+        IE_LOG(INFO, "file [%s] not support O_DIRECT, use fadvise instead",
+               path.c_str());
+        mFd = ::open(localPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    }
+    if (mFd < 0)
+    {
+        INDEXLIB_FATAL_ERROR(FileIO, "open file [%s] failed, %s",
+                             path.c_str(), strerror(errno));
+    }
+    mStagingBuffer.reset(new FileBuffer(STAGING_BUFFER_SIZE, ALIGNMENT));
+    mLength = 0;
+    mFlushedLength = 0;
+    mDroppedLength = 0;
+}
+
+size_t DirectIOFileOutputStream::Write(const void* buffer, size_t length)
+{
+    if (mFd < 0)
+    {
+        return BufferedFileOutputStream::Write(buffer, length);
+    }
+
+    const char* cursor = (const char*)buffer;
+    size_t leftLen = length;
+    if (mStagingBuffer->GetCursor() == 0 && IsAligned(cursor, leftLen))
+    {
+        // BufferedFileWriter hands over whole aligned buffers, write through
+        DoWrite(cursor, leftLen);
+        mLength += length;
+        return length;
+    }
+
+    while (leftLen > 0)
+    {
+        size_t copyLen = min(leftLen, mStagingBuffer->GetFreeSpace());
+        mStagingBuffer->CopyToBuffer(cursor, copyLen);
+        cursor += copyLen;
+        leftLen -= copyLen;
+        if (mStagingBuffer->GetFreeSpace() == 0)
+        {
+            FlushStagingBuffer(false);
+        }
+    }
+    mLength += length;
+    return length;
+}
+
+void DirectIOFileOutputStream::Close()
+{
+    if (mFd < 0)
+    {
+        BufferedFileOutputStream::Close();
+        return;
+    }
+
+    FlushStagingBuffer(true);
+    if (mDirectIO)
+    {
+        // tail may be written with zero padding for alignment
+        assert(mFlushedLength == mLength);
+        if (::ftruncate(mFd, mLength) != 0)
+        {
+            INDEXLIB_FATAL_ERROR(FileIO, "truncate file [%s] to [%lu] failed, %s",
+                    mFilePath.c_str(), mLength, strerror(errno));
+        }
+    }
+    DropWrittenPages(true);
+    int ret = ::close(mFd);
+    mFd = -1;
+    mStagingBuffer.reset();
+    if (ret != 0)
+    {
+        INDEXLIB_FATAL_ERROR(FileIO, "close file [%s] failed, %s",
+                             mFilePath.c_str(), strerror(errno));
+    }
+}
+
+size_t DirectIOFileOutputStream::GetLength() const
+{
+    if (mStagingBuffer)
+    {
+        return mLength;
+    }
+    return BufferedFileOutputStream::GetLength();
+}
+
+void DirectIOFileOutputStream::FlushStagingBuffer(bool onClose)
+{
+    uint32_t dataLen = mStagingBuffer->GetCursor();
+    if (dataLen == 0)
+    {
+        return;
+    }
+    char* baseAddr = mStagingBuffer->GetBaseAddr();
+    if (!mDirectIO)
+    {
+        DoWrite(baseAddr, dataLen);
+        mStagingBuffer->SetCursor(0);
+        return;
+    }
+
+    size_t alignedLen = dataLen & ~(ALIGNMENT - 1);
+    if (onClose && alignedLen != dataLen)
+    {
+        alignedLen = AlignUp(dataLen);
+        assert(alignedLen <= mStagingBuffer->GetBufferSize());
+        memset(baseAddr + dataLen, 0, alignedLen - dataLen);
+        DoWrite(baseAddr, alignedLen);
+        mFlushedLength -= (alignedLen - dataLen);
+        mStagingBuffer->SetCursor(0);
+        return;
+    }
+    DoWrite(baseAddr, alignedLen);
+    size_t leftLen = dataLen - alignedLen;
+    memmove(baseAddr, baseAddr + alignedLen, leftLen);
+    mStagingBuffer->SetCursor(leftLen);
+}
+
+void DirectIOFileOutputStream::DoWrite(const char* buffer, size_t length)
+{
+    size_t totalWriteLen = 0;
+    while (totalWriteLen < length)
+    {
+        ssize_t writeLen = ::pwrite(mFd, buffer + totalWriteLen,
+                                    length - totalWriteLen,
+                                    mFlushedLength + totalWriteLen);
+        if (writeLen < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            INDEXLIB_FATAL_ERROR(FileIO, "write file [%s] failed, offset [%lu], %s",
+                    mFilePath.c_str(), mFlushedLength + totalWriteLen, strerror(errno));
+        }
+        totalWriteLen += writeLen;
+    }
+    mFlushedLength += length;
+    DropWrittenPages(false);
+}
+
+void DirectIOFileOutputStream::DropWrittenPages(bool onClose)
+{
+    if (mDirectIO)
+    {
+        return;
+    }
+    if (!onClose && mFlushedLength - mDroppedLength < DROP_CACHE_STEP)
+    {
+        return;
+    }
+    // DONTNEED only evicts clean pages, write back the range first
+    off_t offset = mDroppedLength;
+    off_t len = mFlushedLength - mDroppedLength;
+    if (::sync_file_range(mFd, offset, len, SYNC_FILE_RANGE_WAIT_BEFORE |
+                          SYNC_FILE_RANGE_WRITE | SYNC_FILE_RANGE_WAIT_AFTER) != 0)
+    {
+        IE_LOG(WARN, "sync file [%s] range [%ld, %ld) failed, %s",
+               mFilePath.c_str(), offset, offset + len, strerror(errno));
+        return;
+    }
+    ::posix_fadvise(mFd, offset, len, POSIX_FADV_DONTNEED);
+    mDroppedLength = mFlushedLength;
+}
+
+IE_NAMESPACE_END(file_system);
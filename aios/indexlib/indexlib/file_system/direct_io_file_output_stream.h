@@ -0,0 +1,74 @@
+#ifndef __INDEXLIB_DIRECT_IO_FILE_OUTPUT_STREAM_H
+#define __INDEXLIB_DIRECT_IO_FILE_OUTPUT_STREAM_H
+
+#include <memory>
+#include "indexlib/indexlib.h"
+#include "indexlib/common_define.h"
+#include "indexlib/file_system/buffered_file_output_stream.h"
+
+DECLARE_REFERENCE_CLASS(storage, FileBuffer);
+
+IE_NAMESPACE_BEGIN(file_system);
+
+// write local file without polluting page cache:
+// 1. open with O_DIRECT, aligned data is written through, unaligned tail
+//    is padded on close and truncated to the real length
+// 2. fall back to buffered write + fadvise(DONTNEED) when O_DIRECT is not
+//    supported by the underlying file system (eg. tmpfs)
+// non-local file or raid path works the same as BufferedFileOutputStream
+class DirectIOFileOutputStream : public BufferedFileOutputStream
+{
+public:
+    DirectIOFileOutputStream(const storage::RaidConfigPtr& raidConfig);
+    ~DirectIOFileOutputStream();
+
+public:
+    void Open(const std::string& path) override;
+    size_t Write(const void* buffer, size_t length) override;
+    void Close() override;
+    size_t GetLength() const override;
+
+public:
+    bool IsDirectIO() const { return mFd >= 0 && mDirectIO; }
+    bool IsPageCacheBypassed() const { return mFd >= 0; }
+
+public:
+    static bool IsAligned(const void* buffer, size_t length)
+    {
+        return ((size_t)buffer & (ALIGNMENT - 1)) == 0
+            && (length & (ALIGNMENT - 1)) == 0;
+    }
+    static size_t AlignUp(size_t size)
+    {
+        return (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+    }
+
+private:
+    void DoWrite(const char* buffer, size_t length);
+    void FlushStagingBuffer(bool onClose);
+    void DropWrittenPages(bool onClose);
+    
+public:
+    static const size_t ALIGNMENT = 4096;
+    static const uint32_t STAGING_BUFFER_SIZE = 1024 * 1024;
+    static const size_t DROP_CACHE_STEP = 8 * 1024 * 1024;
+
+private:
+    std::string mFilePath;
+    int mFd;
+    bool mDirectIO;
+    size_t mLength;
+    size_t mFlushedLength;
+    size_t mDroppedLength;
+    std::unique_ptr<storage::FileBuffer> mStagingBuffer;
+
+private:
+    IE_LOG_DECLARE();
+    friend class DirectIOFileOutputStreamTest;
+};
+
+using DirectIOFileOutputStreamPtr = std::shared_ptr<DirectIOFileOutputStream>;
+
+IE_NAMESPACE_END(file_system);
+
+#endif //__INDEXLIB_DIRECT_IO_FILE_OUTPUT_STREAM_H
@@ -85,7 +85,7 @@ void DiskStorage::DoInitDefaultFileNodeCreator(FileNodeCreatorMap& creatorMap,
     creatorMap[FSOT_IN_MEM] = inMemFileNodeCreator;
 
     FileNodeCreatorPtr mmapFileNodeCreator(
-            new MmapFileNodeCreator());
+            new MmapFileNodeCreator(mOptions.accessProfile));
     mmapFileNodeCreator->Init(loadConfig, mMemController);
 
     creatorMap[FSOT_MMAP] = mmapFileNodeCreator; 
@@ -370,7 +370,7 @@ FileNodeCreator* DiskStorage::CreateMmapFileNodeCreator(const LoadConfig& loadCo
 {
     if (mSupportMmap)
     {
-        return new MmapFileNodeCreator();
+        return new MmapFileNodeCreator(mOptions.accessProfile);
     }
     return new InMemFileNodeCreator();
 }
@@ -26,6 +26,7 @@ struct FSDumpParam
 struct FSWriterParam : public FSDumpParam
 {
     bool asyncDump;
+    bool directIO;   // bypass page cache, only effective for local file
     uint32_t bufferSize;
     static const uint32_t DEFAULT_BUFFER_SIZE = 2 * 1024 * 1024; //2M, for BufferedFileWriter
 
@@ -36,6 +37,7 @@ struct FSWriterParam : public FSDumpParam
                   uint32_t bufferSize_ = DEFAULT_BUFFER_SIZE)
         : FSDumpParam(atomicDump_, copyOnDump_, prohibitInMemDump_)
         , asyncDump(asyncDump_)
+        , directIO(false)
         , bufferSize(bufferSize_) {}
     FSWriterParam(uint32_t bufferSize_, bool asyncDump_)
         : FSWriterParam(true, false, false, asyncDump_, bufferSize_) {}
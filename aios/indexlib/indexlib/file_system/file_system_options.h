@@ -9,6 +9,7 @@
 
 DECLARE_REFERENCE_CLASS(util, PartitionMemoryQuotaController);
 DECLARE_REFERENCE_CLASS(file_system, FileBlockCache);
+DECLARE_REFERENCE_CLASS(file_system, AccessProfile);
 
 IE_NAMESPACE_BEGIN(file_system);
 
@@ -25,12 +26,15 @@ public:
         , prohibitInMemDump(false)
         , enablePathMetaContainer(false)
         , isOffline(false)
+        , useDirectIOWrite(false)
     {}
 
 public:
     LoadConfigList loadConfigList;
     FSMetricPreference metricPref;
     FileBlockCachePtr fileBlockCache;
+    // hot ranges of the last version, for WARMUP_PROFILE
+    AccessProfilePtr accessProfile;
     util::PartitionMemoryQuotaControllerPtr memoryQuotaController;
     storage::RaidConfigPtr raidConfig;
     bool needFlush;
@@ -41,6 +45,7 @@ public:
     bool prohibitInMemDump;
     bool enablePathMetaContainer;
     bool isOffline;
+    bool useDirectIOWrite;
 };
 
 DEFINE_SHARED_PTR(FileSystemOptions);
@@ -156,7 +156,7 @@ FileNodeCreator* HybridStorage::CreateMmapFileNodeCreator(const LoadConfig& load
                    loadConfig.GetName().c_str(), mSecondaryRootPath.c_str());
             return new InMemFileNodeCreator();
         }
-        return new MmapFileNodeCreator();
+        return new MmapFileNodeCreator(mOptions.accessProfile);
     }
     return DiskStorage::CreateMmapFileNodeCreator(loadConfig);
 }
@@ -194,6 +194,12 @@ void InMemFileNode::DoOpenFromDisk(
 void InMemFileNode::LoadData(const FileWrapperPtr& file, int64_t offset, int64_t length)
 {
     mData = (uint8_t*) mPool->allocate(length);
+    bool needPlace = mLoadStrategy && !mLoadStrategy->GetMemoryPlacement().IsDefault();
+    if (needPlace)
+    {
+        // pool memory is anonymous mmap, hugetlb works as transparent
+        mLoadStrategy->GetMemoryPlacement().Apply(mData, length);
+    }
     if (!mLoadStrategy || mLoadStrategy->GetInterval() == 0)
     {
         file->PRead(mData, length, offset);
@@ -207,6 +213,11 @@ void InMemFileNode::LoadData(const FileWrapperPtr& file, int64_t offset, int64_t
             usleep(mLoadStrategy->GetInterval() * 1000);
         }
     }
+    if (needPlace)
+    {
+        mNodeMemoryUse = MemoryPlacement::SampleNodeMemoryUse(mData, length);
+        MemoryPlacement::IncreaseNodeMemoryUse(mNodeMemoryUse);
+    }
  }
 
 FSFileType InMemFileNode::GetType() const
@@ -278,6 +289,8 @@ void InMemFileNode::Close()
     {
         mPool->deallocate(mData, mCapacity);
         mMemController->Free(mMemPeak);
+        MemoryPlacement::DecreaseNodeMemoryUse(mNodeMemoryUse);
+        mNodeMemoryUse.clear();
         mMemPeak = 0;
         mCapacity = 0;
         mLength = 0;
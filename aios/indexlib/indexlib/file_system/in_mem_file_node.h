@@ -79,6 +79,7 @@ private:
     bool mPopulated;
     util::SimpleMemoryQuotaControllerPtr mMemController;
     InMemLoadStrategyPtr mLoadStrategy;
+    std::vector<int64_t> mNodeMemoryUse;
     SessionFileCachePtr mFileCache;
 private:
     IE_LOG_DECLARE();
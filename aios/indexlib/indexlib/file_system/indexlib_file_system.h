@@ -89,6 +89,8 @@ public:
     virtual const StorageMetrics& GetStorageMetrics(FSStorageType type) const = 0;
     virtual IndexlibFileSystemMetrics GetFileSystemMetrics() const = 0;
     virtual void ReportMetrics() = 0;
+    // sample hot ranges of local mmap files into FileSystemOptions::accessProfile
+    virtual void SampleAccessProfile() = 0;
     virtual util::MemoryReserverPtr CreateMemoryReserver(const std::string& name) = 0;
 
     virtual const std::string& GetRootPath() const = 0;
@@ -6,6 +6,7 @@
 #include "indexlib/file_system/file_system_define.h"
 #include "indexlib/file_system/file_node_cache.h"
 #include "indexlib/file_system/in_mem_file_node.h"
+#include "indexlib/file_system/load_config/memory_placement.h"
 #include "indexlib/file_system/hybrid_storage.h"
 #include "indexlib/file_system/swap_mmap_file_reader.h"
 #include "indexlib/file_system/swap_mmap_file_writer.h"
@@ -118,6 +119,7 @@ FileWriterPtr IndexlibFileSystemImpl::CreateFileWriter(
 
     FSWriterParam writerParam = param;
     writerParam.prohibitInMemDump = param.prohibitInMemDump || mOptions.prohibitInMemDump;
+    writerParam.directIO = param.directIO || mOptions.useDirectIOWrite;
     if (!writerParam.raidConfig)
     {
         writerParam.raidConfig = mOptions.raidConfig;
@@ -638,8 +640,9 @@ IndexlibFileSystemMetrics IndexlibFileSystemImpl::GetFileSystemMetrics() const
     const StorageMetrics& inMemStorageMetrics = GetStorageMetrics(FSST_IN_MEM);
     const StorageMetrics& localStorageMetrics = GetStorageMetrics(FSST_LOCAL);
     
-    return IndexlibFileSystemMetrics(
-            inMemStorageMetrics, localStorageMetrics);
+    IndexlibFileSystemMetrics metrics(inMemStorageMetrics, localStorageMetrics);
+    metrics.SetNumaNodeMemoryUse(MemoryPlacement::GetNodeMemoryUse());
+    return metrics;
 }
 
 void IndexlibFileSystemImpl::ReportMetrics()
@@ -651,6 +654,18 @@ void IndexlibFileSystemImpl::ReportMetrics()
     }
 }
 
+void IndexlibFileSystemImpl::SampleAccessProfile()
+{
+    if (!mOptions.accessProfile)
+    {
+        return;
+    }
+    ScopedLock lock(mLock);
+    const DiskStoragePtr& diskStorage = mMountTable->GetDiskStorage();
+    assert(diskStorage);
+    diskStorage->SampleAccessProfile(*mOptions.accessProfile);
+}
+
 PackageFileWriterPtr IndexlibFileSystemImpl::CreatePackageFileWriter(
         const string& filePath)
 {
@@ -82,6 +82,7 @@ public:
     const StorageMetrics& GetStorageMetrics(FSStorageType type) const override;
     IndexlibFileSystemMetrics GetFileSystemMetrics() const override;
     void ReportMetrics() override;
+    void SampleAccessProfile() override;
     size_t EstimateFileLockMemoryUse(
         const std::string& filePath, FSOpenType type) override;
     util::MemoryReserverPtr CreateMemoryReserver(const std::string& name) override
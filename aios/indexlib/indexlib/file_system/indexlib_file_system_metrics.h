@@ -2,6 +2,7 @@
 #define __INDEXLIB_INDEXLIB_FILE_SYSTEM_METRICS_H
 
 #include <tr1/memory>
+#include <vector>
 #include "indexlib/indexlib.h"
 #include "indexlib/common_define.h"
 #include "indexlib/file_system/storage_metrics.h"
@@ -22,10 +23,16 @@ public:
     { return mInMemStorageMetrics; }
     const StorageMetrics& GetLocalStorageMetrics() const
     { return mLocalStorageMetrics; }
+    // placed index memory on each numa node, see MemoryPlacement
+    const std::vector<int64_t>& GetNumaNodeMemoryUse() const
+    { return mNumaNodeMemoryUse; }
+    void SetNumaNodeMemoryUse(const std::vector<int64_t>& numaNodeMemoryUse)
+    { mNumaNodeMemoryUse = numaNodeMemoryUse; }
 
 private:
     StorageMetrics mInMemStorageMetrics;
     StorageMetrics mLocalStorageMetrics;
+    std::vector<int64_t> mNumaNodeMemoryUse;
 
 private:
     IE_LOG_DECLARE();
@@ -2,8 +2,10 @@
 #include "indexlib/file_system/file_system_define.h"
 #include "indexlib/misc/indexlib_metric_control.h"
 #include "indexlib/misc/exception.h"
+#include <autil/StringUtil.h>
 
 using namespace std;
+using namespace autil;
 IE_NAMESPACE_USE(misc);
 
 IE_NAMESPACE_BEGIN(file_system);
@@ -40,6 +42,7 @@ void IndexlibFileSystemMetricsReporter::DeclareStorageMetrics(
         INIT_FILE_SYSTEM_METRIC(BlockFileLength, "byte");
         INIT_FILE_SYSTEM_METRIC(SliceFileLength, "byte");
         INIT_FILE_SYSTEM_METRIC(BufferFileLength, "byte");
+        INIT_FILE_SYSTEM_METRIC(NumaNodeMemoryUse, "byte");
     }
             
     INIT_FILE_SYSTEM_METRIC(InMemFileLength, "byte");
@@ -72,6 +75,18 @@ void IndexlibFileSystemMetricsReporter::ReportMetrics(
 {
     ReportStorageMetrics(metrics.GetInMemStorageMetrics(),
                          metrics.GetLocalStorageMetrics());   
+    ReportNumaNodeMemoryUse(metrics.GetNumaNodeMemoryUse());
+}
+
+void IndexlibFileSystemMetricsReporter::ReportNumaNodeMemoryUse(
+        const vector<int64_t>& numaNodeMemoryUse)
+{
+    for (size_t i = 0; i < numaNodeMemoryUse.size(); ++i)
+    {
+        kmonitor::MetricsTags tags;
+        tags.AddTag("numa_node", StringUtil::toString(i));
+        IE_REPORT_METRIC_WITH_TAGS(NumaNodeMemoryUse, &tags, numaNodeMemoryUse[i]);
+    }
 }
 
 void IndexlibFileSystemMetricsReporter::ReportMemoryQuotaUse(size_t memoryQuotaUse)
@@ -31,6 +31,7 @@ private:
     void DeclareStorageMetrics(FSMetricPreference metricPref);
     void ReportStorageMetrics(const StorageMetrics& inMemMetrics,
                               const StorageMetrics& localMetrics);
+    void ReportNumaNodeMemoryUse(const std::vector<int64_t>& numaNodeMemoryUse);
 
 public:
     // for test
@@ -79,6 +80,7 @@ private:
     IE_DECLARE_METRIC(InMemStorageFlushMemoryUse);
 
     IE_DECLARE_METRIC(MemoryQuotaUse);
+    IE_DECLARE_METRIC(NumaNodeMemoryUse);
 
     MetricSamplerVec mCacheHitRatioVec;
     MetricSamplerVec mCacheLast1000AccessHitRatio;
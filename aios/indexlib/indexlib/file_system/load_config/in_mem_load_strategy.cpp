@@ -9,9 +9,11 @@ IE_NAMESPACE_BEGIN(file_system);
 IE_LOG_SETUP(file_system, InMemLoadStrategy);
 
 InMemLoadStrategy::InMemLoadStrategy(uint32_t slice, uint32_t interval,
-                                     const LoadSpeedLimitSwitchPtr& loadSpeedLimitSwitch)
+                                     const LoadSpeedLimitSwitchPtr& loadSpeedLimitSwitch,
+                                     const MemoryPlacement& memoryPlacement)
     : mSlice(slice)
     , mInterval(interval)
+    , mMemoryPlacement(memoryPlacement)
     , mLoadSpeedLimitSwitch(loadSpeedLimitSwitch)
 {
 }
@@ -32,7 +34,8 @@ bool InMemLoadStrategy::EqualWith(const LoadStrategyPtr& loadStrategy) const
     assert(right);
 
     return  mSlice == right->mSlice
-        && mInterval == right->mInterval;
+        && mInterval == right->mInterval
+        && mMemoryPlacement == right->mMemoryPlacement;
 }
 
 void InMemLoadStrategy::Check()
@@ -5,6 +5,7 @@
 #include "indexlib/indexlib.h"
 #include "indexlib/common_define.h"
 #include "indexlib/file_system/load_config/load_strategy.h"
+#include "indexlib/file_system/load_config/memory_placement.h"
 
 IE_NAMESPACE_BEGIN(file_system);
 
@@ -12,7 +13,8 @@ class InMemLoadStrategy : public LoadStrategy
 {
 public:
     InMemLoadStrategy(uint32_t slice, uint32_t interval,
-                      const LoadSpeedLimitSwitchPtr& loadSpeedLimitSwitch = LoadSpeedLimitSwitchPtr());
+                      const LoadSpeedLimitSwitchPtr& loadSpeedLimitSwitch = LoadSpeedLimitSwitchPtr(),
+                      const MemoryPlacement& memoryPlacement = MemoryPlacement());
     ~InMemLoadStrategy();
 
 public:
@@ -21,12 +23,14 @@ public:
 
     uint32_t GetSlice() const { return mSlice; }
     uint32_t GetInterval() const;
+    const MemoryPlacement& GetMemoryPlacement() const { return mMemoryPlacement; }
 
     void Check() override;
 
 private:
     uint32_t mSlice;
     uint32_t mInterval;
+    MemoryPlacement mMemoryPlacement;
     LoadSpeedLimitSwitchPtr mLoadSpeedLimitSwitch;
 
 private:
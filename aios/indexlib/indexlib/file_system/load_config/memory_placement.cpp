@@ -0,0 +1,306 @@
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/mempolicy.h>
+#include <unistd.h>
+#include <atomic>
+#include "indexlib/file_system/load_config/memory_placement.h"
+#include "indexlib/misc/exception.h"
+
+using namespace std;
+using namespace autil::legacy;
+IE_NAMESPACE_USE(misc);
+
+IE_NAMESPACE_BEGIN(file_system);
+IE_LOG_SETUP(file_system, MemoryPlacement);
+
+static const string HUGE_PAGE_NONE_STRING = string("none");
+static const string HUGE_PAGE_TRANSPARENT_STRING = string("transparent");
+static const string HUGE_PAGE_HUGETLB_STRING = string("hugetlb");
+static const string NUMA_POLICY_DEFAULT_STRING = string("default");
+static const string NUMA_POLICY_INTERLEAVE_STRING = string("interleave");
+static const string NUMA_POLICY_BIND_STRING = string("bind");
+
+const size_t MemoryPlacement::HUGE_PAGE_SIZE;
+const size_t MemoryPlacement::MAX_NUMA_NODE_COUNT;
+const size_t MemoryPlacement::SAMPLE_PAGE_COUNT;
+
+namespace {
+std::atomic<int64_t> gNodeMemoryUse[MemoryPlacement::MAX_NUMA_NODE_COUNT];
+}
+
+MemoryPlacement::MemoryPlacement()
+    : mHugePageType(HPT_NONE)
+    , mNumaPolicy(NP_DEFAULT)
+{
+}
+
+MemoryPlacement::~MemoryPlacement()
+{
+}
+
+void MemoryPlacement::Jsonize(JsonWrapper& json)
+{
+    if (json.GetMode() == TO_JSON)
+    {
+        string hugePage = HUGE_PAGE_NONE_STRING;
+        if (mHugePageType == HPT_TRANSPARENT)
+        {
+            hugePage = HUGE_PAGE_TRANSPARENT_STRING;
+        }
+        else if (mHugePageType == HPT_HUGETLB)
+        {
+            hugePage = HUGE_PAGE_HUGETLB_STRING;
+        }
+        string numaPolicy = NUMA_POLICY_DEFAULT_STRING;
+        if (mNumaPolicy == NP_INTERLEAVE)
+        {
+            numaPolicy = NUMA_POLICY_INTERLEAVE_STRING;
+        }
+        else if (mNumaPolicy == NP_BIND)
+        {
+            numaPolicy = NUMA_POLICY_BIND_STRING;
+        }
+        // keep the json of load strategies without placement unchanged
+        if (mHugePageType != HPT_NONE)
+        {
+            json.Jsonize("huge_page", hugePage);
+        }
+        if (mNumaPolicy != NP_DEFAULT)
+        {
+            json.Jsonize("numa_policy", numaPolicy);
+        }
+        if (!mNumaNodes.empty())
+        {
+            json.Jsonize("numa_nodes", mNumaNodes);
+        }
+        return;
+    }
+
+    string hugePage;
+    string numaPolicy;
+    json.Jsonize("huge_page", hugePage, HUGE_PAGE_NONE_STRING);
+    json.Jsonize("numa_policy", numaPolicy, NUMA_POLICY_DEFAULT_STRING);
+    json.Jsonize("numa_nodes", mNumaNodes, vector<uint32_t>());
+    if (hugePage == HUGE_PAGE_NONE_STRING)
+    {
+        mHugePageType = HPT_NONE;
+    }
+    else if (hugePage == HUGE_PAGE_TRANSPARENT_STRING)
+    {
+        mHugePageType = HPT_TRANSPARENT;
+    }
+    else if (hugePage == HUGE_PAGE_HUGETLB_STRING)
+    {
+        mHugePageType = HPT_HUGETLB;
+    }
+    else
+    {
+        INDEXLIB_THROW(misc::BadParameterException, "unsupported huge page type [ %s ]",
+                       hugePage.c_str());
+    }
+    if (numaPolicy == NUMA_POLICY_DEFAULT_STRING)
+    {
+        mNumaPolicy = NP_DEFAULT;
+    }
+    else if (numaPolicy == NUMA_POLICY_INTERLEAVE_STRING)
+    {
+        mNumaPolicy = NP_INTERLEAVE;
+    }
+    else if (numaPolicy == NUMA_POLICY_BIND_STRING)
+    {
+        mNumaPolicy = NP_BIND;
+    }
+    else
+    {
+        INDEXLIB_THROW(misc::BadParameterException, "unsupported numa policy [ %s ]",
+                       numaPolicy.c_str());
+    }
+}
+
+void MemoryPlacement::Check() const
+{
+    if (mNumaPolicy != NP_DEFAULT && mNumaNodes.empty())
+    {
+        INDEXLIB_THROW(misc::BadParameterException, "numa_nodes is empty for numa policy");
+    }
+    for (size_t i = 0; i < mNumaNodes.size(); ++i)
+    {
+        if (mNumaNodes[i] >= MAX_NUMA_NODE_COUNT)
+        {
+            INDEXLIB_THROW(misc::BadParameterException, "numa node [%u] exceeds [%lu]",
+                           mNumaNodes[i], MAX_NUMA_NODE_COUNT);
+        }
+    }
+}
+
+bool MemoryPlacement::operator==(const MemoryPlacement& other) const
+{
+    return mHugePageType == other.mHugePageType
+        && mNumaPolicy == other.mNumaPolicy
+        && mNumaNodes == other.mNumaNodes;
+}
+
+void* MemoryPlacement::Allocate(size_t length, size_t& mappedLength) const
+{
+    void* addr = MAP_FAILED;
+    if (mHugePageType == HPT_HUGETLB)
+    {
+        mappedLength = (length + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+        addr = mmap(NULL, mappedLength, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (addr == MAP_FAILED)
+        {
+            IE_LOG(WARN, "mmap hugetlb of [%lu] bytes failed, errno [%d], "
+                   "use transparent huge page", mappedLength, errno);
+        }
+        else
+        {
+            // MADV_HUGEPAGE fails with EINVAL on hugetlb mapping
+            ApplyNumaPolicy(addr, mappedLength);
+            return addr;
+        }
+    }
+    if (addr == MAP_FAILED)
+    {
+        mappedLength = length;
+        addr = mmap(NULL, mappedLength, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (addr == MAP_FAILED)
+        {
+            INDEXLIB_FATAL_ERROR(OutOfMemory, "mmap anonymous memory of [%lu] bytes failed, "
+                    "errno [%d]", length, errno);
+        }
+    }
+    Apply(addr, mappedLength);
+    return addr;
+}
+
+void MemoryPlacement::Free(void* addr, size_t mappedLength)
+{
+    if (addr && munmap(addr, mappedLength) < 0)
+    {
+        IE_LOG(ERROR, "munmap [%lu] bytes failed, errno [%d]", mappedLength, errno);
+    }
+}
+
+void MemoryPlacement::Apply(void* addr, size_t length) const
+{
+    if (mHugePageType != HPT_NONE)
+    {
+        // for hugetlb fallback and memory not mapped by Allocate
+        if (madvise(addr, length, MADV_HUGEPAGE) < 0)
+        {
+            IE_LOG(WARN, "madvise huge page failed, errno [%d]", errno);
+        }
+    }
+    ApplyNumaPolicy(addr, length);
+}
+
+void MemoryPlacement::ApplyNumaPolicy(void* addr, size_t length) const
+{
+    if (mNumaPolicy == NP_DEFAULT)
+    {
+        return;
+    }
+    unsigned long nodeMask[MAX_NUMA_NODE_COUNT / (sizeof(unsigned long) * 8)] = { 0 };
+    for (size_t i = 0; i < mNumaNodes.size(); ++i)
+    {
+        uint32_t node = mNumaNodes[i];
+        nodeMask[node / (sizeof(unsigned long) * 8)] |= 1UL << (node % (sizeof(unsigned long) * 8));
+    }
+    int mode = mNumaPolicy == NP_INTERLEAVE ? MPOL_INTERLEAVE : MPOL_BIND;
+    // the kernel ignores the last bit of maxnode
+    if (syscall(SYS_mbind, addr, length, mode, nodeMask, MAX_NUMA_NODE_COUNT + 1, 0) < 0)
+    {
+        IE_LOG(WARN, "mbind numa policy [%d] failed, errno [%d]", mode, errno);
+    }
+}
+
+vector<int64_t> MemoryPlacement::SampleNodeMemoryUse(const void* addr, size_t length)
+{
+    vector<int64_t> nodeMemoryUse;
+    static const size_t PAGE_SIZE = getpagesize();
+    if (!addr || length == 0)
+    {
+        return nodeMemoryUse;
+    }
+    size_t pageCount = (length + PAGE_SIZE - 1) / PAGE_SIZE;
+    size_t sampleCount = min(pageCount, SAMPLE_PAGE_COUNT);
+    size_t step = pageCount / sampleCount;
+    vector<void*> pages(sampleCount);
+    for (size_t i = 0; i < sampleCount; ++i)
+    {
+        pages[i] = (char*)addr + i * step * PAGE_SIZE;
+    }
+    vector<int> status(sampleCount, -1);
+    // query the node of pages without moving
+    if (syscall(SYS_move_pages, 0, sampleCount, pages.data(), NULL, status.data(), 0) < 0)
+    {
+        IE_LOG(DEBUG, "move_pages query failed, errno [%d]", errno);
+        return nodeMemoryUse;
+    }
+    vector<size_t> nodeSampleCount(MAX_NUMA_NODE_COUNT, 0);
+    size_t validCount = 0;
+    for (size_t i = 0; i < sampleCount; ++i)
+    {
+        if (status[i] >= 0 && status[i] < (int)MAX_NUMA_NODE_COUNT)
+        {
+            ++nodeSampleCount[status[i]];
+            ++validCount;
+        }
+    }
+    if (validCount == 0)
+    {
+        return nodeMemoryUse;
+    }
+    nodeMemoryUse.resize(MAX_NUMA_NODE_COUNT, 0);
+    int64_t assigned = 0;
+    size_t lastNode = 0;
+    for (size_t i = 0; i < MAX_NUMA_NODE_COUNT; ++i)
+    {
+        nodeMemoryUse[i] = (int64_t)(length * nodeSampleCount[i] / validCount);
+        assigned += nodeMemoryUse[i];
+        if (nodeSampleCount[i] > 0)
+        {
+            lastNode = i;
+        }
+    }
+    nodeMemoryUse[lastNode] += (int64_t)length - assigned;
+    while (!nodeMemoryUse.empty() && nodeMemoryUse.back() == 0)
+    {
+        nodeMemoryUse.pop_back();
+    }
+    return nodeMemoryUse;
+}
+
+void MemoryPlacement::IncreaseNodeMemoryUse(const vector<int64_t>& nodeMemoryUse)
+{
+    for (size_t i = 0; i < nodeMemoryUse.size() && i < MAX_NUMA_NODE_COUNT; ++i)
+    {
+        gNodeMemoryUse[i].fetch_add(nodeMemoryUse[i], memory_order_relaxed);
+    }
+}
+
+void MemoryPlacement::DecreaseNodeMemoryUse(const vector<int64_t>& nodeMemoryUse)
+{
+    for (size_t i = 0; i < nodeMemoryUse.size() && i < MAX_NUMA_NODE_COUNT; ++i)
+    {
+        gNodeMemoryUse[i].fetch_sub(nodeMemoryUse[i], memory_order_relaxed);
+    }
+}
+
+vector<int64_t> MemoryPlacement::GetNodeMemoryUse()
+{
+    vector<int64_t> nodeMemoryUse(MAX_NUMA_NODE_COUNT, 0);
+    for (size_t i = 0; i < MAX_NUMA_NODE_COUNT; ++i)
+    {
+        nodeMemoryUse[i] = gNodeMemoryUse[i].load(memory_order_relaxed);
+    }
+    while (!nodeMemoryUse.empty() && nodeMemoryUse.back() == 0)
+    {
+        nodeMemoryUse.pop_back();
+    }
+    return nodeMemoryUse;
+}
+
+IE_NAMESPACE_END(file_system);
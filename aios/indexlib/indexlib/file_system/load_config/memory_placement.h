@@ -0,0 +1,87 @@
+#ifndef __INDEXLIB_MEMORY_PLACEMENT_H
+#define __INDEXLIB_MEMORY_PLACEMENT_H
+
+#include <tr1/memory>
+#include <vector>
+#include "autil/legacy/jsonizable.h"
+#include "indexlib/indexlib.h"
+#include "indexlib/common_define.h"
+
+IE_NAMESPACE_BEGIN(file_system);
+
+// huge page and numa placement of locked index memory, the data is
+// copied to anonymous memory placed as configured
+class MemoryPlacement : public autil::legacy::Jsonizable
+{
+public:
+    enum HugePageType
+    {
+        HPT_NONE,
+        HPT_TRANSPARENT, // madvise(MADV_HUGEPAGE)
+        HPT_HUGETLB      // MAP_HUGETLB, needs reserved huge pages
+    };
+    enum NumaPolicy
+    {
+        NP_DEFAULT,
+        NP_INTERLEAVE,
+        NP_BIND
+    };
+
+public:
+    MemoryPlacement();
+    ~MemoryPlacement();
+
+public:
+    void Jsonize(autil::legacy::Jsonizable::JsonWrapper& json) override;
+    void Check() const;
+    bool operator==(const MemoryPlacement& other) const;
+
+    bool IsDefault() const
+    { return mHugePageType == HPT_NONE && mNumaPolicy == NP_DEFAULT; }
+    HugePageType GetHugePageType() const { return mHugePageType; }
+    NumaPolicy GetNumaPolicy() const { return mNumaPolicy; }
+    const std::vector<uint32_t>& GetNumaNodes() const { return mNumaNodes; }
+
+    void SetHugePageType(HugePageType type) { mHugePageType = type; }
+    void SetNumaPolicy(NumaPolicy policy, const std::vector<uint32_t>& nodes)
+    { mNumaPolicy = policy; mNumaNodes = nodes; }
+
+public:
+    // anonymous memory placed by Apply, mappedLength is rounded up to
+    // huge page size for hugetlb
+    void* Allocate(size_t length, size_t& mappedLength) const;
+    static void Free(void* addr, size_t mappedLength);
+    // should be called before the anonymous memory is touched
+    void Apply(void* addr, size_t length) const;
+
+public:
+    // bytes of [addr, addr + length) on each numa node, estimated by the
+    // node of at most SAMPLE_PAGE_COUNT pages, empty if not supported
+    static std::vector<int64_t> SampleNodeMemoryUse(const void* addr, size_t length);
+    static void IncreaseNodeMemoryUse(const std::vector<int64_t>& nodeMemoryUse);
+    static void DecreaseNodeMemoryUse(const std::vector<int64_t>& nodeMemoryUse);
+    // placed index memory of the process on each numa node
+    static std::vector<int64_t> GetNodeMemoryUse();
+
+private:
+    void ApplyNumaPolicy(void* addr, size_t length) const;
+
+public:
+    static const size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+    static const size_t MAX_NUMA_NODE_COUNT = 64;
+    static const size_t SAMPLE_PAGE_COUNT = 1024;
+
+private:
+    HugePageType mHugePageType;
+    NumaPolicy mNumaPolicy;
+    std::vector<uint32_t> mNumaNodes;
+
+private:
+    IE_LOG_DECLARE();
+};
+
+DEFINE_SHARED_PTR(MemoryPlacement);
+
+IE_NAMESPACE_END(file_system);
+
+#endif //__INDEXLIB_MEMORY_PLACEMENT_H
@@ -33,7 +33,7 @@ MmapLoadStrategy::~MmapLoadStrategy()
 
 InMemLoadStrategy* MmapLoadStrategy::CreateInMemLoadStrategy() const
 {
-    return new InMemLoadStrategy(mSlice, mInterval, mLoadSpeedLimitSwitch);
+    return new InMemLoadStrategy(mSlice, mInterval, mLoadSpeedLimitSwitch, mMemoryPlacement);
 }
 
 uint32_t MmapLoadStrategy::GetInterval() const 
@@ -56,6 +56,12 @@ void MmapLoadStrategy::Check()
         INDEXLIB_THROW(misc::BadParameterException, 
                        "slice must be the multiple of page size[%d]", getpagesize());
     }
+    mMemoryPlacement.Check();
+    if (!mIsLock && !mMemoryPlacement.IsDefault())
+    {
+        INDEXLIB_THROW(misc::BadParameterException,
+                       "huge_page and numa_policy only work with lock");
+    }
 }
 
 void MmapLoadStrategy::Jsonize(autil::legacy::Jsonizable::JsonWrapper& json)
@@ -65,6 +71,7 @@ void MmapLoadStrategy::Jsonize(autil::legacy::Jsonizable::JsonWrapper& json)
     json.Jsonize("advise_random", mAdviseRandom, false);
     json.Jsonize("slice", mSlice, (uint32_t)(4 * 1024 * 1024));
     json.Jsonize("interval", mInterval, (uint32_t)0);
+    mMemoryPlacement.Jsonize(json);
 }
 
 bool MmapLoadStrategy::EqualWith(const LoadStrategyPtr& loadStrategy) const
@@ -87,7 +94,8 @@ bool MmapLoadStrategy::operator==(const MmapLoadStrategy& loadStrategy) const
         && mIsPartialLock == loadStrategy.mIsPartialLock
         && mAdviseRandom == loadStrategy.mAdviseRandom
         && mSlice == loadStrategy.mSlice
-        && mInterval == loadStrategy.mInterval;
+        && mInterval == loadStrategy.mInterval
+        && mMemoryPlacement == loadStrategy.mMemoryPlacement;
 }
 
 IE_NAMESPACE_END(file_system);
@@ -6,6 +6,7 @@
 #include "indexlib/common_define.h"
 #include "indexlib/file_system/load_config/load_strategy.h"
 #include "indexlib/file_system/load_config/in_mem_load_strategy.h"
+#include "indexlib/file_system/load_config/memory_placement.h"
 
 IE_NAMESPACE_BEGIN(file_system);
 
@@ -27,6 +28,11 @@ public:
 
     uint32_t GetInterval() const;
 
+    // only for lock
+    const MemoryPlacement& GetMemoryPlacement() const { return mMemoryPlacement; }
+    void SetMemoryPlacement(const MemoryPlacement& memoryPlacement)
+    { mMemoryPlacement = memoryPlacement; }
+
     const std::string& GetLoadStrategyName() const { return READ_MODE_MMAP; }
 
     void Check();
@@ -48,6 +54,7 @@ private:
     bool mAdviseRandom;
     uint32_t mSlice;
     uint32_t mInterval;
+    MemoryPlacement mMemoryPlacement;
     LoadSpeedLimitSwitchPtr mLoadSpeedLimitSwitch;
 
 private:
@@ -0,0 +1,118 @@
+#include "indexlib/file_system/load_config/test/memory_placement_unittest.h"
+#include "indexlib/file_system/load_config/mmap_load_strategy.h"
+
+using namespace std;
+
+IE_NAMESPACE_BEGIN(file_system);
+IE_LOG_SETUP(file_system, MemoryPlacementTest);
+
+MemoryPlacementTest::MemoryPlacementTest()
+{
+}
+
+MemoryPlacementTest::~MemoryPlacementTest()
+{
+}
+
+void MemoryPlacementTest::CaseSetUp()
+{
+}
+
+void MemoryPlacementTest::CaseTearDown()
+{
+}
+
+void MemoryPlacementTest::TestParse()
+{
+    {
+        MemoryPlacement placement;
+        FromJsonString(placement, "{}");
+        ASSERT_TRUE(placement.IsDefault());
+        // default placement is not jsonized
+        ASSERT_EQ(string::npos, ToJsonString(placement).find("huge_page"));
+        ASSERT_EQ(string::npos, ToJsonString(placement).find("numa"));
+        MmapLoadStrategy loadStrategy;
+        ASSERT_EQ(string::npos, ToJsonString(loadStrategy).find("huge_page"));
+        MemoryPlacement resultPlacement;
+        FromJsonString(resultPlacement, ToJsonString(placement));
+        ASSERT_TRUE(placement == resultPlacement);
+    }
+    {
+        string jsonStr = R"({
+             "lock" : true,
+             "huge_page" : "hugetlb",
+             "numa_policy" : "interleave",
+             "numa_nodes" : [0, 1]
+        })";
+        MmapLoadStrategy loadStrategy;
+        FromJsonString(loadStrategy, jsonStr);
+        const MemoryPlacement& placement = loadStrategy.GetMemoryPlacement();
+        ASSERT_EQ(MemoryPlacement::HPT_HUGETLB, placement.GetHugePageType());
+        ASSERT_EQ(MemoryPlacement::NP_INTERLEAVE, placement.GetNumaPolicy());
+        ASSERT_EQ((size_t)2, placement.GetNumaNodes().size());
+        ASSERT_NO_THROW(loadStrategy.Check());
+
+        MmapLoadStrategy resultLoadStrategy;
+        FromJsonString(resultLoadStrategy, ToJsonString(loadStrategy));
+        ASSERT_TRUE(loadStrategy == resultLoadStrategy);
+        ASSERT_TRUE(loadStrategy.GetMemoryPlacement() ==
+                    resultLoadStrategy.GetMemoryPlacement());
+
+        InMemLoadStrategyPtr inMemLoadStrategy(loadStrategy.CreateInMemLoadStrategy());
+        ASSERT_TRUE(placement == inMemLoadStrategy->GetMemoryPlacement());
+    }
+    {
+        MemoryPlacement placement;
+        ASSERT_THROW(FromJsonString(placement, R"({"huge_page" : "2m"})"),
+                     misc::BadParameterException);
+        ASSERT_THROW(FromJsonString(placement, R"({"numa_policy" : "local"})"),
+                     misc::BadParameterException);
+    }
+}
+
+void MemoryPlacementTest::TestCheck()
+{
+    MemoryPlacement placement;
+    ASSERT_NO_THROW(placement.Check());
+    placement.SetNumaPolicy(MemoryPlacement::NP_BIND, vector<uint32_t>());
+    ASSERT_THROW(placement.Check(), misc::BadParameterException);
+    placement.SetNumaPolicy(MemoryPlacement::NP_BIND, vector<uint32_t>(1, 64));
+    ASSERT_THROW(placement.Check(), misc::BadParameterException);
+    placement.SetNumaPolicy(MemoryPlacement::NP_BIND, vector<uint32_t>(1, 0));
+    ASSERT_NO_THROW(placement.Check());
+
+    MmapLoadStrategy loadStrategy;
+    loadStrategy.SetMemoryPlacement(placement);
+    ASSERT_THROW(loadStrategy.Check(), misc::BadParameterException);
+}
+
+void MemoryPlacementTest::TestAllocate()
+{
+    MemoryPlacement placement;
+    placement.SetHugePageType(MemoryPlacement::HPT_TRANSPARENT);
+    placement.SetNumaPolicy(MemoryPlacement::NP_BIND, vector<uint32_t>(1, 0));
+
+    size_t length = 3 * 1024 * 1024 + 100;
+    size_t mappedLength = 0;
+    char* data = (char*)placement.Allocate(length, mappedLength);
+    ASSERT_TRUE(data != NULL);
+    ASSERT_EQ(length, mappedLength);
+    memset(data, 1, length);
+
+    vector<int64_t> nodeMemoryUse = MemoryPlacement::SampleNodeMemoryUse(data, length);
+    int64_t totalUse = 0;
+    for (size_t i = 0; i < nodeMemoryUse.size(); ++i)
+    {
+        totalUse += nodeMemoryUse[i];
+    }
+    // empty if move_pages is not supported
+    ASSERT_TRUE(nodeMemoryUse.empty() || totalUse == (int64_t)length);
+
+    vector<int64_t> before = MemoryPlacement::GetNodeMemoryUse();
+    MemoryPlacement::IncreaseNodeMemoryUse(nodeMemoryUse);
+    MemoryPlacement::DecreaseNodeMemoryUse(nodeMemoryUse);
+    ASSERT_EQ(before, MemoryPlacement::GetNodeMemoryUse());
+    MemoryPlacement::Free(data, mappedLength);
+}
+
+IE_NAMESPACE_END(file_system);
@@ -0,0 +1,34 @@
+#ifndef __INDEXLIB_MEMORYPLACEMENTTEST_H
+#define __INDEXLIB_MEMORYPLACEMENTTEST_H
+
+#include "indexlib/common_define.h"
+
+#include "indexlib/test/test.h"
+#include "indexlib/test/unittest.h"
+#include "indexlib/file_system/load_config/memory_placement.h"
+
+IE_NAMESPACE_BEGIN(file_system);
+
+class MemoryPlacementTest : public INDEXLIB_TESTBASE {
+public:
+    MemoryPlacementTest();
+    ~MemoryPlacementTest();
+
+    DECLARE_CLASS_NAME(MemoryPlacementTest);
+public:
+    void CaseSetUp() override;
+    void CaseTearDown() override;
+    void TestParse();
+    void TestCheck();
+    void TestAllocate();
+private:
+    IE_LOG_DECLARE();
+};
+
+INDEXLIB_UNIT_TEST_CASE(MemoryPlacementTest, TestParse);
+INDEXLIB_UNIT_TEST_CASE(MemoryPlacementTest, TestCheck);
+INDEXLIB_UNIT_TEST_CASE(MemoryPlacementTest, TestAllocate);
+
+IE_NAMESPACE_END(file_system);
+
+#endif //__INDEXLIB_MEMORYPLACEMENTTEST_H
@@ -27,6 +27,8 @@ void WarmupStrategyTest::TestFromTypeString()
                         WarmupStrategy::FromTypeString("none"));
     INDEXLIB_TEST_EQUAL(WarmupStrategy::WARMUP_SEQUENTIAL,
                         WarmupStrategy::FromTypeString("sequential"));
+    INDEXLIB_TEST_EQUAL(WarmupStrategy::WARMUP_PROFILE,
+                        WarmupStrategy::FromTypeString("profile"));
 }
 
 void WarmupStrategyTest::TestToTypeString()
@@ -35,6 +37,8 @@ void WarmupStrategyTest::TestToTypeString()
                         WarmupStrategy::ToTypeString(WarmupStrategy::WARMUP_NONE));
     INDEXLIB_TEST_EQUAL("sequential",
                         WarmupStrategy::ToTypeString(WarmupStrategy::WARMUP_SEQUENTIAL));
+    INDEXLIB_TEST_EQUAL("profile",
+                        WarmupStrategy::ToTypeString(WarmupStrategy::WARMUP_PROFILE));
 }
 IE_NAMESPACE_END(file_system);
 
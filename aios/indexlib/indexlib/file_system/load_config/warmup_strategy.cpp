@@ -9,6 +9,7 @@ IE_LOG_SETUP(file_system, WarmupStrategy);
 
 static const string WARMUP_NONE_TYPE_STRING = string("none");
 static const string WARMUP_SEQUENTIAL_TYPE_STRING = string("sequential");
+static const string WARMUP_PROFILE_TYPE_STRING = string("profile");
 
 WarmupStrategy::WarmupStrategy() 
     : mWarmupType(WARMUP_NONE)
@@ -30,6 +31,10 @@ WarmupStrategy::WarmupType WarmupStrategy::FromTypeString(
     {
         return WarmupStrategy::WARMUP_SEQUENTIAL;
     }
+    if (typeStr == WARMUP_PROFILE_TYPE_STRING)
+    {
+        return WarmupStrategy::WARMUP_PROFILE;
+    }
     INDEXLIB_THROW(misc::BadParameterException, "unsupported warmup strategy [ %s ]",
                    typeStr.c_str());
     return WarmupStrategy::WARMUP_NONE;
@@ -45,6 +50,10 @@ string WarmupStrategy::ToTypeString(const WarmupType& type)
     {
         return WARMUP_SEQUENTIAL_TYPE_STRING;
     }
+    if (type == WARMUP_PROFILE)
+    {
+        return WARMUP_PROFILE_TYPE_STRING;
+    }
     INDEXLIB_THROW(misc::BadParameterException, "unsupported enum warmup type [ %d ]", type);
     return WARMUP_NONE_TYPE_STRING;
 }
@@ -13,7 +13,9 @@ public:
     enum WarmupType
     {
         WARMUP_NONE,
-        WARMUP_SEQUENTIAL
+        WARMUP_SEQUENTIAL,
+        // hot ranges recorded in AccessProfile only, hottest first
+        WARMUP_PROFILE
     };
 
 public:
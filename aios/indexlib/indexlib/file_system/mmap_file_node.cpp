@@ -20,7 +20,8 @@ IE_LOG_SETUP(file_system, MmapFileNode);
 
 MmapFileNode::MmapFileNode(const LoadConfig& loadConfig,
                            const util::BlockMemoryQuotaControllerPtr& memController,
-                           bool readOnly)
+                           bool readOnly,
+                           const AccessProfilePtr& accessProfile)
     : mLoadStrategy(DYNAMIC_POINTER_CAST(MmapLoadStrategy, loadConfig.GetLoadStrategy()))
     , mData(NULL)
     , mLength(0)
@@ -32,6 +33,11 @@ MmapFileNode::MmapFileNode(const LoadConfig& loadConfig,
     assert(mLoadStrategy);
     assert(mLoadStrategy->GetSlice() != 0);
     mMemController.reset(new util::SimpleMemoryQuotaController(memController));
+    if (loadConfig.GetWarmupStrategy().GetWarmupType() == WarmupStrategy::WARMUP_PROFILE)
+    {
+        // without profile, warmup as sequential
+        mAccessProfile = accessProfile;
+    }
 }
 
 MmapFileNode::~MmapFileNode() 
@@ -174,6 +180,20 @@ void MmapFileNode::Populate()
     if (mDependFileNode)
     {
         mDependFileNode->Populate();
+        MmapFileNodePtr dependFileNode = DYNAMIC_POINTER_CAST(MmapFileNode, mDependFileNode);
+        if (dependFileNode && dependFileNode->mPlacedData)
+        {
+            size_t offset = (uint8_t*)mData - (uint8_t*)mFile->getBaseAddress();
+            mPlacedData = dependFileNode->mPlacedData;
+            mData = mPlacedData.get() + offset;
+        }
+        mPopulated = true;
+        return;
+    }
+    if (mLoadStrategy->IsLock() && !mLoadStrategy->GetMemoryPlacement().IsDefault()
+        && mLength > 0 && -1 != mFile->getFd())
+    {
+        LoadPlacedData();
         mPopulated = true;
         return;
     }
@@ -209,7 +229,14 @@ void MmapFileNode::Populate()
 
     if (mWarmup)
     {
-        LoadData();
+        if (mAccessProfile && !mLoadStrategy->IsLock())
+        {
+            LoadProfileData();
+        }
+        else
+        {
+            LoadData();
+        }
     }
     mPopulated = true;
 }
@@ -286,6 +313,7 @@ void MmapFileNode::Close()
     mPopulated = false;
     mFile.reset();
     mDependFileNode.reset();
+    mPlacedData.reset();
 }
 
 void MmapFileNode::LoadData()
@@ -315,6 +343,93 @@ void MmapFileNode::LoadData()
     IE_LOG(DEBUG, "End load.");
 }
 
+void MmapFileNode::LoadPlacedData()
+{
+    const MemoryPlacement& placement = mLoadStrategy->GetMemoryPlacement();
+    const char *base = (const char *)mData;
+    size_t mappedLength = 0;
+    char *data = (char *)placement.Allocate(mLength, mappedLength);
+    // mLength is charged on open, hugetlb memory is rounded up to huge pages
+    mMemController->Allocate(mappedLength - mLength);
+    IE_LOG(DEBUG, "Begin load file [%s] to placed memory, length [%ldB], "
+           "huge page [%d], numa policy [%d], slice [%uB], interval [%ums].",
+           GetPath().c_str(), mLength, placement.GetHugePageType(),
+           placement.GetNumaPolicy(), mLoadStrategy->GetSlice(),
+           mLoadStrategy->GetInterval());
+
+    for (int64_t offset = 0; offset < (int64_t)mLength; offset += mLoadStrategy->GetSlice())
+    {
+        int64_t copyLen = min((int64_t)mLength - offset, (int64_t)mLoadStrategy->GetSlice());
+        memcpy(data + offset, base + offset, copyLen);
+        usleep(mLoadStrategy->GetInterval() * 1000);
+    }
+    if (mlock(data, mLength) < 0)
+    {
+        int lockErrno = errno;
+        MemoryPlacement::Free(data, mappedLength);
+        mMemController->Free(mappedLength - mLength);
+        INDEXLIB_FATAL_ERROR(FileIO, "lock file: [%s] FAILED"
+                             ", errno: %d, errmsg: %s",
+                             GetPath().c_str(), lockErrno, strerror(lockErrno));
+    }
+
+    vector<int64_t> nodeMemoryUse = MemoryPlacement::SampleNodeMemoryUse(data, mLength);
+    MemoryPlacement::IncreaseNodeMemoryUse(nodeMemoryUse);
+    mPlacedData.reset(data, [mappedLength, nodeMemoryUse](char* addr) {
+                MemoryPlacement::DecreaseNodeMemoryUse(nodeMemoryUse);
+                MemoryPlacement::Free(addr, mappedLength);
+            });
+    mData = data;
+    IE_LOG(DEBUG, "End load.");
+}
+
+void MmapFileNode::LoadProfileData()
+{
+    static const size_t PAGE_SIZE = getpagesize();
+    const char *base = (const char *)mData;
+    AccessProfile::AccessRangeVec ranges = mAccessProfile->GetRanges(GetPath(), mLength);
+    IE_LOG(DEBUG, "Begin load profile ranges of file [%s], length [%ldB], "
+           "range count [%lu], slice [%uB], interval [%ums].",
+           GetPath().c_str(), mLength, ranges.size(), mLoadStrategy->GetSlice(),
+           mLoadStrategy->GetInterval());
+
+    // read ahead all ranges first, so the io of later ranges goes on
+    // while the hotter ones are touched
+    for (size_t i = 0; i < ranges.size(); ++i)
+    {
+        size_t addr = (size_t)(base + ranges[i].offset);
+        size_t delta = addr % PAGE_SIZE;
+        if (madvise((void*)(addr - delta), ranges[i].length + delta, MADV_WILLNEED) < 0)
+        {
+            IE_LOG(WARN, "madvise willneed failed! errno:%d", errno);
+            break;
+        }
+    }
+    for (size_t i = 0; i < ranges.size(); ++i)
+    {
+        int64_t endOffset = ranges[i].offset + ranges[i].length;
+        for (int64_t offset = ranges[i].offset; offset < endOffset;
+             offset += mLoadStrategy->GetSlice())
+        {
+            int64_t len = min(endOffset - offset, (int64_t)mLoadStrategy->GetSlice());
+            (void)WarmUp(base + offset, len);
+            usleep(mLoadStrategy->GetInterval() * 1000);
+        }
+    }
+
+    IE_LOG(DEBUG, "End load.");
+}
+
+void MmapFileNode::SampleAccess(AccessProfile& profile) const
+{
+    ScopedLock lock(mLock);
+    if (!mFile || !mData || mLength == 0 || -1 == mFile->getFd())
+    {
+        return;
+    }
+    profile.Sample(GetPath(), mData, mLength);
+}
+
 uint8_t MmapFileNode::WarmUp(const char *addr, int64_t len)
 {
     static int WARM_UP_PAGE_SIZE = getpagesize();
@@ -10,6 +10,7 @@
 #include "indexlib/file_system/load_config/mmap_load_strategy.h"
 #include "indexlib/file_system/file_node.h"
 #include "indexlib/file_system/file_system_define.h"
+#include "indexlib/file_system/access_profile.h"
 #include "indexlib/util/memory_control/simple_memory_quota_controller.h"
 
 IE_NAMESPACE_BEGIN(file_system);
@@ -19,7 +20,8 @@ class MmapFileNode : public FileNode
 public:
     MmapFileNode(const LoadConfig& loadConfig,
                  const util::BlockMemoryQuotaControllerPtr& memController,
-                 bool readOnly);
+                 bool readOnly,
+                 const AccessProfilePtr& accessProfile = AccessProfilePtr());
     ~MmapFileNode();
 
 public:
@@ -38,8 +40,13 @@ public:
 
     bool ReadOnly() const override { return mReadOnly; };
 
+    // record the resident pages of the file into profile
+    void SampleAccess(AccessProfile& profile) const;
+
 protected:
     void LoadData();
+    void LoadProfileData();
+    void LoadPlacedData();
     void DoOpen(const std::string& path, FSOpenType openType) override;
 
 private:
@@ -62,6 +69,9 @@ protected:
     util::SimpleMemoryQuotaControllerPtr mMemController;
     MmapLoadStrategyPtr mLoadStrategy;
     FileNodePtr mDependFileNode; // dcache, for hold shared package file
+    AccessProfilePtr mAccessProfile; // only for WARMUP_PROFILE
+    // locked copy placed by MemoryPlacement, shared with files in package
+    std::shared_ptr<char> mPlacedData;
     void* mData;
     size_t mLength;
     FSFileType mType;
@@ -72,6 +82,7 @@ protected:
 private:
     IE_LOG_DECLARE();
     friend class MmapFileNodeTest;
+    friend class AccessProfileTest;
 };
 
 DEFINE_SHARED_PTR(MmapFileNode);
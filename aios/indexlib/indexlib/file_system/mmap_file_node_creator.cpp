@@ -11,8 +11,9 @@ IE_NAMESPACE_USE(storage);
 IE_NAMESPACE_BEGIN(file_system);
 IE_LOG_SETUP(file_system, MmapFileNodeCreator);
 
-MmapFileNodeCreator::MmapFileNodeCreator()
-    : mFullMemory(false)
+MmapFileNodeCreator::MmapFileNodeCreator(const AccessProfilePtr& accessProfile)
+    : mAccessProfile(accessProfile)
+    , mFullMemory(false)
 {
 }
 
@@ -41,7 +42,8 @@ FileNodePtr MmapFileNodeCreator::CreateFileNode(
     const string& filePath, FSOpenType type, bool readOnly)
 {
     assert(type == FSOT_MMAP || type == FSOT_LOAD_CONFIG);
-    MmapFileNodePtr mmapFileNode(new MmapFileNode(mLoadConfig, mMemController, readOnly));
+    MmapFileNodePtr mmapFileNode(new MmapFileNode(
+                    mLoadConfig, mMemController, readOnly, mAccessProfile));
     return mmapFileNode;
 }
 
@@ -6,13 +6,14 @@
 #include "indexlib/common_define.h"
 #include "indexlib/file_system/file_system_define.h"
 #include "indexlib/file_system/file_node_creator.h"
+#include "indexlib/file_system/access_profile.h"
 
 IE_NAMESPACE_BEGIN(file_system);
 
 class MmapFileNodeCreator : public FileNodeCreator
 {
 public:
-    MmapFileNodeCreator();
+    MmapFileNodeCreator(const AccessProfilePtr& accessProfile = AccessProfilePtr());
     ~MmapFileNodeCreator();
 
 public:
@@ -32,6 +33,7 @@ public:
 
 private:
     LoadConfig mLoadConfig;
+    AccessProfilePtr mAccessProfile;
     bool mLock;
     bool mFullMemory;
 
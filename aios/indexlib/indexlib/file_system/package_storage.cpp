@@ -1,6 +1,7 @@
 #include "indexlib/file_system/package_storage.h"
 #include "indexlib/file_system/buffered_package_file_writer.h"
 #include "indexlib/file_system/buffered_file_node.h"
+#include "indexlib/file_system/direct_io_file_output_stream.h"
 #include "indexlib/file_system/versioned_package_file_meta.h"
 
 using namespace std;
@@ -341,7 +342,15 @@ pair<uint32_t, BufferedFileOutputStreamPtr> PackageStorage::DoAllocatePhysicalSt
     }
     if (freeIt->second.empty())
     {
-        BufferedFileOutputStreamPtr stream(new BufferedFileOutputStream(mOptions.raidConfig));
+        BufferedFileOutputStreamPtr stream;
+        if (mOptions.useDirectIOWrite)
+        {
+            stream.reset(new DirectIOFileOutputStream(mOptions.raidConfig));
+        }
+        else
+        {
+            stream.reset(new BufferedFileOutputStream(mOptions.raidConfig));
+        }
         uint32_t fileId = unit.physicalStreams.size();
         string physicalFileName =
             VersionedPackageFileMeta::GetPackageDataFileName(mDescription, fileId);
@@ -4,6 +4,7 @@
 #include "indexlib/file_system/slice_file.h"
 #include "indexlib/file_system/directory_map_iterator.h"
 #include "indexlib/file_system/buffered_file_writer.h"
+#include "indexlib/file_system/mmap_file_node.h"
 #include "indexlib/util/path_util.h"
 #include "indexlib/misc/exception.h"
 
@@ -484,6 +485,26 @@ void Storage::CleanCache()
     mFileNodeCache->Clean();
 }
 
+void Storage::SampleAccessProfile(AccessProfile& profile) const
+{
+    ScopedLock lock(*mFileNodeCache->GetCacheLock());
+    FileNodeCache::ConstIterator it = mFileNodeCache->Begin();
+    for (; it != mFileNodeCache->End(); ++it)
+    {
+        const FileNodePtr& fileNode = it->second;
+        if (fileNode->GetType() != FSFT_MMAP)
+        {
+            // mmap lock, in mem files are always resident
+            continue;
+        }
+        MmapFileNodePtr mmapFileNode = DYNAMIC_POINTER_CAST(MmapFileNode, fileNode);
+        if (mmapFileNode)
+        {
+            mmapFileNode->SampleAccess(profile);
+        }
+    }
+}
+
 bool Storage::MountPackageFile(const string& filePath)
 {
     return mPackageFileMountTable.MountPackageFile(filePath, this);
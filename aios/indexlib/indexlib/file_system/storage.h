@@ -23,6 +23,7 @@
 #include "indexlib/file_system/path_meta_container.h"
 #include "indexlib/file_system/lifecycle_table.h"
 #include "indexlib/file_system/file_system_options.h"
+#include "indexlib/file_system/access_profile.h"
 
 IE_NAMESPACE_BEGIN(file_system);
 
@@ -67,6 +68,8 @@ public:
 
 public:
     bool MountPackageFile(const std::string& filePath);
+    // sample the resident pages of cached mmap files
+    void SampleAccessProfile(AccessProfile& profile) const;
     
     SliceFilePtr CreateSliceFile(const std::string& path, 
                                  uint64_t sliceLen, int32_t sliceNum);
@@ -0,0 +1,205 @@
+#include <sys/mman.h>
+#include "indexlib/file_system/test/access_profile_unittest.h"
+#include "indexlib/file_system/mmap_file_node.h"
+#include "indexlib/file_system/test/load_config_list_creator.h"
+#include "indexlib/file_system/test/file_system_test_util.h"
+#include "indexlib/util/memory_control/memory_quota_controller_creator.h"
+
+using namespace std;
+IE_NAMESPACE_USE(util);
+
+IE_NAMESPACE_BEGIN(file_system);
+IE_LOG_SETUP(file_system, AccessProfileTest);
+
+AccessProfileTest::AccessProfileTest()
+{
+}
+
+AccessProfileTest::~AccessProfileTest()
+{
+}
+
+void AccessProfileTest::CaseSetUp()
+{
+    mRootDir = GET_TEST_DATA_PATH();
+}
+
+void AccessProfileTest::CaseTearDown()
+{
+}
+
+void AccessProfileTest::TestSample()
+{
+    size_t pageSize = getpagesize();
+    size_t length = pageSize * 16;
+    // anonymous pages are not resident until touched
+    char* base = (char*)mmap(NULL, length, PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    ASSERT_TRUE(base != MAP_FAILED);
+    base[pageSize * 1] = 1;
+    base[pageSize * 2] = 1;
+    base[pageSize * 9] = 1;
+
+    AccessProfile profile(pageSize * 2);
+    profile.Sample("file", base, length);
+    profile.Sample("file", base, length);
+    // file not aligned to page, as in package
+    profile.Sample("inner_file", base + pageSize * 8 + 1, pageSize * 2);
+    munmap(base, length);
+
+    AccessProfile::AccessRangeVec ranges = profile.GetRanges("file", length);
+    ASSERT_EQ((size_t)2, ranges.size());
+    ASSERT_EQ(0u, ranges[0].offset);
+    ASSERT_EQ(pageSize * 4, ranges[0].length);
+    ASSERT_EQ(2u, ranges[0].hotness);
+    ASSERT_EQ(pageSize * 8, ranges[1].offset);
+    ASSERT_EQ(pageSize * 2, ranges[1].length);
+
+    ranges = profile.GetRanges("inner_file", pageSize * 2);
+    ASSERT_EQ((size_t)1, ranges.size());
+    ASSERT_EQ(0u, ranges[0].offset);
+    ASSERT_EQ(1u, ranges[0].hotness);
+    ASSERT_EQ((size_t)2, profile.GetFileCount());
+}
+
+void AccessProfileTest::TestGetRanges()
+{
+    AccessProfile profile(100);
+    profile.AddChunk("file", 0, 1);
+    profile.AddChunk("file", 150, 3);
+    profile.AddChunk("file", 250, 3);
+    profile.AddChunk("file", 400, 2);
+    profile.AddChunk("file", 1000, 5);
+
+    // chunk beyond file length is ignored, last chunk is cut by file length
+    AccessProfile::AccessRangeVec ranges = profile.GetRanges("file", 450);
+    ASSERT_EQ((size_t)3, ranges.size());
+    ASSERT_EQ(100u, ranges[0].offset);
+    ASSERT_EQ(200u, ranges[0].length);
+    ASSERT_EQ(3u, ranges[0].hotness);
+    ASSERT_EQ(400u, ranges[1].offset);
+    ASSERT_EQ(50u, ranges[1].length);
+    ASSERT_EQ(0u, ranges[2].offset);
+    ASSERT_EQ(100u, ranges[2].length);
+
+    ASSERT_TRUE(profile.GetRanges("not_exist", 450).empty());
+    ASSERT_FALSE(profile.HasFile("not_exist"));
+}
+
+void AccessProfileTest::TestStoreAndLoad()
+{
+    string profilePath = mRootDir + "access_profile";
+    AccessProfile profile(100);
+    ASSERT_FALSE(profile.Load(profilePath));
+    profile.AddChunk("segment_0/index/posting", 0, 1);
+    profile.AddChunk("segment_0/index/posting", 300, 4);
+    profile.AddChunk("segment_1/attribute/data", 100, 2);
+    profile.Store(profilePath);
+    // overwrite the last profile
+    profile.Store(profilePath);
+
+    AccessProfile loadProfile;
+    ASSERT_TRUE(loadProfile.Load(profilePath));
+    ASSERT_EQ((size_t)100, loadProfile.GetChunkSize());
+    ASSERT_EQ((size_t)2, loadProfile.GetFileCount());
+    AccessProfile::AccessRangeVec ranges =
+        loadProfile.GetRanges("segment_0/index/posting", 1000);
+    ASSERT_EQ((size_t)2, ranges.size());
+    ASSERT_EQ(300u, ranges[0].offset);
+    ASSERT_EQ(4u, ranges[0].hotness);
+    ASSERT_EQ(0u, ranges[1].offset);
+    ASSERT_TRUE(loadProfile.HasFile("segment_1/attribute/data"));
+}
+
+void AccessProfileTest::TestSegmentFileRanges()
+{
+    AccessProfile profile(100);
+    // no file length, mapped by the end of the last chunk: 400 and 200
+    profile.AddChunk("root/segment_0_level_0/index/pk/data", 0, 2);
+    profile.AddChunk("root/segment_0_level_0/index/pk/data", 300, 1);
+    profile.AddChunk("root/segment_1_level_0/index/pk/data", 100, 1);
+
+    // chunks of both segments at the same relative offsets, hotness added
+    AccessProfile::AccessRangeVec ranges =
+        profile.GetRanges("root/segment_2_level_0/index/pk/data", 800);
+    ASSERT_EQ((size_t)3, ranges.size());
+    ASSERT_EQ(0u, ranges[0].offset);
+    ASSERT_EQ(200u, ranges[0].length);
+    ASSERT_EQ(2u, ranges[0].hotness);
+    ASSERT_EQ(600u, ranges[1].offset);
+    ASSERT_EQ(200u, ranges[1].length);
+    ASSERT_EQ(2u, ranges[1].hotness);
+    ASSERT_EQ(400u, ranges[2].offset);
+    ASSERT_EQ(200u, ranges[2].length);
+    ASSERT_EQ(1u, ranges[2].hotness);
+
+    // smaller file, the hot chunks of the sources still warm part of it
+    ranges = profile.GetRanges("root/segment_2/index/pk/data", 100);
+    ASSERT_EQ((size_t)1, ranges.size());
+    ASSERT_EQ(0u, ranges[0].offset);
+    ASSERT_EQ(100u, ranges[0].length);
+
+    ASSERT_TRUE(profile.GetRanges("root/segment_2_level_0/sub_segment/index/pk/data", 800).empty());
+    ASSERT_TRUE(profile.GetRanges("other/segment_2_level_0/index/pk/data", 800).empty());
+    ASSERT_TRUE(profile.GetRanges("root/segment_a_level_0/index/pk/data", 800).empty());
+    ASSERT_TRUE(profile.GetRanges("root/segment_2_level_0/index/pk/data", 0).empty());
+
+    // sampled file length is kept through store and load
+    size_t pageSize = getpagesize();
+    char* base = (char*)mmap(NULL, pageSize * 4, PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    ASSERT_TRUE(base != MAP_FAILED);
+    base[0] = 1;
+    AccessProfile sampleProfile(pageSize);
+    sampleProfile.Sample("root/segment_3/attribute/a/data", base, pageSize * 4);
+    munmap(base, pageSize * 4);
+    string profilePath = mRootDir + "access_profile";
+    sampleProfile.Store(profilePath);
+    AccessProfile loadProfile;
+    ASSERT_TRUE(loadProfile.Load(profilePath));
+    ranges = loadProfile.GetRanges("root/segment_4/attribute/a/data", pageSize * 8);
+    ASSERT_EQ((size_t)1, ranges.size());
+    ASSERT_EQ(0u, ranges[0].offset);
+    ASSERT_EQ(pageSize * 2, ranges[0].length);
+}
+
+void AccessProfileTest::TestProfileWarmup()
+{
+    string filePath = mRootDir + "data";
+    string content(10000, 'a');
+    FileSystemTestUtil::CreateDiskFile(filePath, content);
+
+    LoadConfig loadConfig = LoadConfigListCreator::MakeMmapLoadConfig(false, false, false, 1024, 0);
+    WarmupStrategy warmupStrategy;
+    warmupStrategy.SetWarmupType(WarmupStrategy::WARMUP_PROFILE);
+    loadConfig.SetWarmupStrategy(warmupStrategy);
+    BlockMemoryQuotaControllerPtr memController =
+        MemoryQuotaControllerCreator::CreateBlockMemoryController();
+
+    AccessProfilePtr profile(new AccessProfile(4096));
+    MmapFileNodePtr fileNode(new MmapFileNode(loadConfig, memController, true, profile));
+    fileNode->Open(filePath, FSOT_MMAP);
+    profile->AddChunk(fileNode->GetPath(), 8192, 1);
+    fileNode->Populate();
+    ASSERT_TRUE(fileNode->mWarmup);
+    ASSERT_TRUE(fileNode->mAccessProfile);
+    char buffer[10];
+    ASSERT_EQ((size_t)10, fileNode->Read(buffer, 10, 9990));
+    ASSERT_EQ(string(10, 'a'), string(buffer, 10));
+
+    AccessProfile sampleProfile(4096);
+    fileNode->SampleAccess(sampleProfile);
+    ASSERT_TRUE(sampleProfile.HasFile(fileNode->GetPath()));
+    fileNode->Close();
+
+    // lock always loads the whole file
+    LoadConfig lockLoadConfig = LoadConfigListCreator::MakeMmapLoadConfig(false, true, false, 1024, 0);
+    lockLoadConfig.SetWarmupStrategy(warmupStrategy);
+    fileNode.reset(new MmapFileNode(lockLoadConfig, memController, true, profile));
+    fileNode->Open(filePath, FSOT_MMAP);
+    fileNode->Populate();
+    ASSERT_EQ(FSFT_MMAP_LOCK, fileNode->GetType());
+    fileNode->Close();
+}
+
+IE_NAMESPACE_END(file_system);
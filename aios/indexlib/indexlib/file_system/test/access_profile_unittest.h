@@ -0,0 +1,45 @@
+#ifndef __INDEXLIB_ACCESSPROFILETEST_H
+#define __INDEXLIB_ACCESSPROFILETEST_H
+
+#include "indexlib/common_define.h"
+
+#include "indexlib/test/test.h"
+#include "indexlib/test/unittest.h"
+#include "indexlib/file_system/access_profile.h"
+
+IE_NAMESPACE_BEGIN(file_system);
+
+class AccessProfileTest : public INDEXLIB_TESTBASE
+{
+public:
+    AccessProfileTest();
+    ~AccessProfileTest();
+
+    DECLARE_CLASS_NAME(AccessProfileTest);
+
+public:
+    void CaseSetUp() override;
+    void CaseTearDown() override;
+
+    void TestSample();
+    void TestGetRanges();
+    void TestStoreAndLoad();
+    void TestSegmentFileRanges();
+    void TestProfileWarmup();
+
+private:
+    std::string mRootDir;
+
+private:
+    IE_LOG_DECLARE();
+};
+
+INDEXLIB_UNIT_TEST_CASE(AccessProfileTest, TestSample);
+INDEXLIB_UNIT_TEST_CASE(AccessProfileTest, TestGetRanges);
+INDEXLIB_UNIT_TEST_CASE(AccessProfileTest, TestStoreAndLoad);
+INDEXLIB_UNIT_TEST_CASE(AccessProfileTest, TestSegmentFileRanges);
+INDEXLIB_UNIT_TEST_CASE(AccessProfileTest, TestProfileWarmup);
+
+IE_NAMESPACE_END(file_system);
+
+#endif //__INDEXLIB_ACCESSPROFILETEST_H
@@ -169,6 +169,36 @@ void BufferedFileReaderTest::TestCaseForReadBigFile()
     delete []buf;
 }
 
+void BufferedFileReaderTest::TestCaseForDropCacheRead()
+{
+    string answer;
+    MakeFileData(100, answer);
+    BufferedFileNodePtr fileNode(new BufferedFileNode());
+    fileNode->Open(mFilePath, FSOT_BUFFERED);
+    BufferedFileReader reader(fileNode, 20);
+    INDEXLIB_TEST_EQUAL(-1, reader.mDropCacheFd);
+
+    reader.ResetBufferParam(20, false, true);
+    INDEXLIB_TEST_TRUE(reader.mDropCacheFd >= 0);
+    INDEXLIB_TEST_EQUAL((int64_t)0, reader.mDroppedOffset);
+    CheckFileReader(reader, answer);
+    // blocks before the last loaded one are evicted
+    INDEXLIB_TEST_EQUAL((int64_t)80, reader.mDroppedOffset);
+
+    reader.ResetBufferParam(20, false);
+    INDEXLIB_TEST_EQUAL(-1, reader.mDropCacheFd);
+    CheckFileReader(reader, answer);
+
+    reader.ResetBufferParam(8, true, true);
+    INDEXLIB_TEST_TRUE(reader.mDropCacheFd >= 0);
+    INDEXLIB_TEST_EQUAL((int64_t)0, reader.mDroppedOffset);
+    CheckFileReader(reader, answer);
+    INDEXLIB_TEST_EQUAL((int64_t)96, reader.mDroppedOffset);
+
+    reader.Close();
+    INDEXLIB_TEST_EQUAL(-1, reader.mDropCacheFd);
+}
+
 void BufferedFileReaderTest::ForReadCase(uint32_t bufferSize, 
         uint32_t dataLength, bool async)
 {
@@ -26,6 +26,7 @@ public:
     void TestCaseForRevertReadAllFileWithOffset();
     void TestCaseForSeqReadAllFileWithOffset();
     void TestCaseForReadBigFile();
+    void TestCaseForDropCacheRead();
 
 private:
     void ForReadCase(uint32_t bufferSize, uint32_t dataLength, bool async);
@@ -49,6 +50,7 @@ INDEXLIB_UNIT_TEST_CASE(BufferedFileReaderTest, TestCaseForSkipForwardThenBackwa
 INDEXLIB_UNIT_TEST_CASE(BufferedFileReaderTest, TestCaseForRevertReadAllFileWithOffset);
 INDEXLIB_UNIT_TEST_CASE(BufferedFileReaderTest, TestCaseForSeqReadAllFileWithOffset);
 INDEXLIB_UNIT_TEST_CASE(BufferedFileReaderTest, TestCaseForReadBigFile);
+INDEXLIB_UNIT_TEST_CASE(BufferedFileReaderTest, TestCaseForDropCacheRead);
 
 IE_NAMESPACE_END(file_system);
 
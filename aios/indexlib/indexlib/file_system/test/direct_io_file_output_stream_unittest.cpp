@@ -0,0 +1,127 @@
+#include <fstream>
+#include <autil/StringUtil.h>
+#include "indexlib/file_system/test/direct_io_file_output_stream_unittest.h"
+#include "indexlib/file_system/buffered_file_writer.h"
+#include "indexlib/storage/file_buffer.h"
+#include "indexlib/util/path_util.h"
+
+using namespace std;
+IE_NAMESPACE_USE(util);
+IE_NAMESPACE_USE(storage);
+
+IE_NAMESPACE_BEGIN(file_system);
+IE_LOG_SETUP(file_system, DirectIOFileOutputStreamTest);
+
+DirectIOFileOutputStreamTest::DirectIOFileOutputStreamTest()
+{
+}
+
+DirectIOFileOutputStreamTest::~DirectIOFileOutputStreamTest()
+{
+}
+
+void DirectIOFileOutputStreamTest::CaseSetUp()
+{
+}
+
+void DirectIOFileOutputStreamTest::CaseTearDown()
+{
+}
+
+void DirectIOFileOutputStreamTest::TestSimpleProcess()
+{
+    string fileName = PathUtil::JoinPath(GET_TEST_DATA_PATH(), "direct_io_file");
+    string content = MakeContent(DirectIOFileOutputStream::STAGING_BUFFER_SIZE * 2 + 123);
+
+    DirectIOFileOutputStream stream(RaidConfigPtr());
+    stream.Open(fileName);
+    ASSERT_TRUE(stream.IsPageCacheBypassed());
+    size_t cursor = 0;
+    size_t step = 1;
+    while (cursor < content.size())
+    {
+        size_t len = min(step, content.size() - cursor);
+        ASSERT_EQ(len, stream.Write(content.data() + cursor, len));
+        cursor += len;
+        step = step * 3 + 7;
+        ASSERT_EQ(cursor, stream.GetLength());
+    }
+    stream.Close();
+    CheckFile(fileName, content);
+}
+
+void DirectIOFileOutputStreamTest::TestWriteAlignedBuffer()
+{
+    string fileName = PathUtil::JoinPath(GET_TEST_DATA_PATH(), "direct_io_file");
+    size_t bufferSize = DirectIOFileOutputStream::ALIGNMENT * 4;
+    FileBuffer buffer(bufferSize, DirectIOFileOutputStream::ALIGNMENT);
+    string content = MakeContent(bufferSize);
+    buffer.CopyToBuffer(content.data(), content.size());
+
+    DirectIOFileOutputStream stream(RaidConfigPtr());
+    stream.Open(fileName);
+    stream.Write(buffer.GetBaseAddr(), buffer.GetCursor());
+    stream.Write(buffer.GetBaseAddr(), buffer.GetCursor());
+    stream.Write("abc", 3);
+    ASSERT_EQ(bufferSize * 2 + 3, stream.GetLength());
+    stream.Close();
+    CheckFile(fileName, content + content + "abc");
+}
+
+void DirectIOFileOutputStreamTest::TestWriteWithBufferedFileWriter()
+{
+    string content = MakeContent(1024 * 1024 + 17);
+    for (size_t i = 0; i < 2; ++i)
+    {
+        bool asyncDump = (i == 1);
+        string fileName = PathUtil::JoinPath(GET_TEST_DATA_PATH(),
+                "buffered_file_" + autil::StringUtil::toString(i));
+        FSWriterParam param(true, false, false, asyncDump, 10000);
+        param.directIO = true;
+        BufferedFileWriterPtr writer(new BufferedFileWriter(param));
+        writer->Open(fileName);
+        ASSERT_EQ((uint32_t)0, writer->mBuffer->GetBufferSize() % DirectIOFileOutputStream::ALIGNMENT);
+        writer->Write(content.data(), content.size());
+        writer->Close();
+        ASSERT_EQ(content.size(), writer->GetLength());
+        writer.reset();
+        CheckFile(fileName, content);
+    }
+}
+
+void DirectIOFileOutputStreamTest::TestEmptyFile()
+{
+    string fileName = PathUtil::JoinPath(GET_TEST_DATA_PATH(), "direct_io_file");
+    DirectIOFileOutputStream stream(RaidConfigPtr());
+    stream.Open(fileName);
+    stream.Close();
+    CheckFile(fileName, "");
+}
+
+string DirectIOFileOutputStreamTest::MakeContent(size_t length) const
+{
+    string content(length, '\0');
+    for (size_t i = 0; i < length; ++i)
+    {
+        content[i] = 'a' + (i * 7 + i / 13) % 26;
+    }
+    return content;
+}
+
+void DirectIOFileOutputStreamTest::CheckFile(const string& fileName, const string& content)
+{
+    ifstream in(fileName.c_str());
+    ASSERT_TRUE(static_cast<bool>(in));
+
+    in.seekg(0, in.end);
+    size_t size = in.tellg();
+    in.seekg(0, in.beg);
+    ASSERT_EQ(content.size(), size);
+
+    string data(size, '\0');
+    in.read(&data[0], size);
+    in.close();
+    ASSERT_EQ(content, data);
+}
+
+IE_NAMESPACE_END(file_system);
@@ -0,0 +1,41 @@
+#ifndef __INDEXLIB_DIRECTIOFILEOUTPUTSTREAMTEST_H
+#define __INDEXLIB_DIRECTIOFILEOUTPUTSTREAMTEST_H
+
+#include "indexlib/common_define.h"
+#include "indexlib/test/test.h"
+#include "indexlib/test/unittest.h"
+#include "indexlib/file_system/direct_io_file_output_stream.h"
+
+IE_NAMESPACE_BEGIN(file_system);
+
+class DirectIOFileOutputStreamTest : public INDEXLIB_TESTBASE
+{
+public:
+    DirectIOFileOutputStreamTest();
+    ~DirectIOFileOutputStreamTest();
+
+    DECLARE_CLASS_NAME(DirectIOFileOutputStreamTest);
+public:
+    void CaseSetUp() override;
+    void CaseTearDown() override;
+    void TestSimpleProcess();
+    void TestWriteAlignedBuffer();
+    void TestWriteWithBufferedFileWriter();
+    void TestEmptyFile();
+
+private:
+    std::string MakeContent(size_t length) const;
+    void CheckFile(const std::string& fileName, const std::string& content);
+
+private:
+    IE_LOG_DECLARE();
+};
+
+INDEXLIB_UNIT_TEST_CASE(DirectIOFileOutputStreamTest, TestSimpleProcess);
+INDEXLIB_UNIT_TEST_CASE(DirectIOFileOutputStreamTest, TestWriteAlignedBuffer);
+INDEXLIB_UNIT_TEST_CASE(DirectIOFileOutputStreamTest, TestWriteWithBufferedFileWriter);
+INDEXLIB_UNIT_TEST_CASE(DirectIOFileOutputStreamTest, TestEmptyFile);
+
+IE_NAMESPACE_END(file_system);
+
+#endif //__INDEXLIB_DIRECTIOFILEOUTPUTSTREAMTEST_H
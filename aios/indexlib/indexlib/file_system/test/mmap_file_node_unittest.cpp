@@ -161,6 +161,51 @@ void MmapFileNodeTest::TestCaseForWrite()
     ASSERT_THROW(mmapFile.Write(buffer, 3), UnSupportedException);
 }
 
+void MmapFileNodeTest::TestCaseForMemoryPlacement()
+{
+    string filePath = mRootDir + "data";
+    vector<uint8_t> answer;
+    answer.resize(TOTAL_BYTE);
+    MakeData(filePath, answer);
+
+    MemoryPlacement placement;
+    placement.SetHugePageType(MemoryPlacement::HPT_TRANSPARENT);
+    placement.SetNumaPolicy(MemoryPlacement::NP_INTERLEAVE, vector<uint32_t>(1, 0));
+    {
+        // placement only works with lock
+        mLoadConfig = LoadConfigListCreator::MakeMmapLoadConfig(false, false);
+        MmapLoadStrategyPtr loadStrategy = DYNAMIC_POINTER_CAST(
+                MmapLoadStrategy, mLoadConfig.GetLoadStrategy());
+        loadStrategy->SetMemoryPlacement(placement);
+        ASSERT_THROW(loadStrategy->Check(), misc::BadParameterException);
+    }
+    mLoadConfig = LoadConfigListCreator::MakeMmapLoadConfig(false, true);
+    MmapLoadStrategyPtr loadStrategy = DYNAMIC_POINTER_CAST(
+            MmapLoadStrategy, mLoadConfig.GetLoadStrategy());
+    loadStrategy->SetMemoryPlacement(placement);
+    ASSERT_NO_THROW(loadStrategy->Check());
+
+    MmapFileNodePtr fileNode = CreateFileNode(filePath, FSOT_MMAP);
+    ASSERT_EQ(FSFT_MMAP_LOCK, fileNode->GetType());
+    ASSERT_TRUE(fileNode->mPlacedData);
+    ASSERT_EQ(fileNode->mPlacedData.get(), fileNode->GetBaseAddress());
+    Check(fileNode, answer.data(), 100);
+    ASSERT_EQ((int64_t)TOTAL_BYTE, fileNode->mMemController->GetUsedQuota());
+    fileNode->Close();
+    ASSERT_FALSE(fileNode->mPlacedData);
+
+    // hugetlb memory is charged by huge pages, falls back to transparent
+    // if no huge page is reserved
+    placement.SetHugePageType(MemoryPlacement::HPT_HUGETLB);
+    loadStrategy->SetMemoryPlacement(placement);
+    fileNode = CreateFileNode(filePath, FSOT_MMAP);
+    Check(fileNode, answer.data(), 100);
+    int64_t usedQuota = fileNode->mMemController->GetUsedQuota();
+    ASSERT_TRUE(usedQuota == (int64_t)TOTAL_BYTE
+                || usedQuota == (int64_t)MemoryPlacement::HUGE_PAGE_SIZE) << usedQuota;
+    fileNode->Close();
+}
+
 void MmapFileNodeTest::MakeData(const string& filePath, vector<uint8_t>& answer)
 {
     File* file = FileSystem::openFile(filePath, WRITE);
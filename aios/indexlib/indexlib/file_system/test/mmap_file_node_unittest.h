@@ -30,6 +30,7 @@ public:
     void TestCaseForLock();
     void TestCaseForWrite();
     void TestCaseForCloseBeforeOpen();
+    void TestCaseForMemoryPlacement();
 
 private:
     void MakeData(const std::string& filePath, std::vector<uint8_t>& answer);
@@ -55,6 +56,7 @@ INDEXLIB_UNIT_TEST_CASE(MmapFileNodeTest, TestCaseForReadEmptyFile);
 INDEXLIB_UNIT_TEST_CASE(MmapFileNodeTest, TestCaseForLock);
 INDEXLIB_UNIT_TEST_CASE(MmapFileNodeTest, TestCaseForWrite);
 INDEXLIB_UNIT_TEST_CASE(MmapFileNodeTest, TestCaseForCloseBeforeOpen);
+INDEXLIB_UNIT_TEST_CASE(MmapFileNodeTest, TestCaseForMemoryPlacement);
 
 IE_NAMESPACE_END(file_system);
 
@@ -31,6 +31,10 @@ MaxMinSegmentMetricsUpdater::MaxMinSegmentMetricsUpdater()
     , mMaxDocInfo(nullptr)
     , mFieldType(ft_unknown)
     , mReference(nullptr)
+    , mBlockSize(0)
+    , mBlockDocCount(0)
+    , mBlockMinDocInfo(nullptr)
+    , mBlockMaxDocInfo(nullptr)
 {
 }
 
@@ -102,6 +106,21 @@ bool MaxMinSegmentMetricsUpdater::Init(const config::IndexPartitionSchemaPtr& sc
     evaluator->Init(attributeConfig->GetFieldConfig(), mReference);
     mEvaluator.reset(evaluator);
     mCurDocInfo = mDocInfoAllocator.Allocate();
+
+    iterator = parameters.find("block_size");
+    if (iterator != parameters.end())
+    {
+        if (!StringUtil::fromString(iterator->second, mBlockSize))
+        {
+            IE_LOG(ERROR, "invalid block_size [%s]", iterator->second.c_str());
+            return false;
+        }
+        if (mBlockSize > 0)
+        {
+            mBlockMinDocInfo = mDocInfoAllocator.Allocate();
+            mBlockMaxDocInfo = mDocInfoAllocator.Allocate();
+        }
+    }
     return true;
 }
 
@@ -128,11 +147,13 @@ void MaxMinSegmentMetricsUpdater::Update(const document::DocumentPtr& doc)
         mMinDocInfo = mDocInfoAllocator.Allocate();
         Evaluate(doc, mMaxDocInfo);
         Evaluate(doc, mMinDocInfo);
+        UpdateBlock(mMaxDocInfo);
         return;
     }
     assert(mMaxDocInfo);
     assert(mMinDocInfo);
     Evaluate(doc, mCurDocInfo);
+    UpdateBlock(mCurDocInfo);
 
     DoUpdate();
 }
@@ -167,6 +188,7 @@ void MaxMinSegmentMetricsUpdater::UpdateForMerge(segmentid_t oldSegId, docid_t o
     }
 #undef FILL_REF
 
+    UpdateBlock(mCurDocInfo);
     DoUpdate();
 }
 
@@ -205,6 +227,63 @@ void MaxMinSegmentMetricsUpdater::DoUpdate()
     }
 }
 
+void MaxMinSegmentMetricsUpdater::UpdateBlock(const DocInfo* docInfo)
+{
+    if (mBlockSize == 0)
+    {
+        return;
+    }
+    size_t docInfoSize = mDocInfoAllocator.GetDocInfoSize();
+    if (mBlockDocCount == 0)
+    {
+        memcpy(mBlockMinDocInfo, docInfo, docInfoSize);
+        memcpy(mBlockMaxDocInfo, docInfo, docInfoSize);
+    }
+    else if (mComparator->LessThan(docInfo, mBlockMinDocInfo))
+    {
+        memcpy(mBlockMinDocInfo, docInfo, docInfoSize);
+    }
+    else if (mComparator->LessThan(mBlockMaxDocInfo, docInfo))
+    {
+        memcpy(mBlockMaxDocInfo, docInfo, docInfoSize);
+    }
+    if (++mBlockDocCount == mBlockSize)
+    {
+        FillBlockValues(mBlockMaxValues, mBlockMinValues);
+        mBlockDocCount = 0;
+    }
+}
+
+void MaxMinSegmentMetricsUpdater::FillBlockValues(
+    json::JsonArray& maxValues, json::JsonArray& minValues) const
+{
+#define FILL_BLOCK_VALUES(fieldType)                                                              \
+    case fieldType:                                                                               \
+        FillBlockValues<FieldTypeTraits<fieldType>::AttrItemType>(maxValues, minValues);          \
+        break;
+
+    switch (mFieldType)
+    {
+        NUMBER_FIELD_MACRO_HELPER(FILL_BLOCK_VALUES);
+    default:
+        assert(false);
+        INDEXLIB_FATAL_ERROR(Runtime, "invalid field type [%d]", mFieldType);
+    }
+#undef FILL_BLOCK_VALUES
+}
+
+template <typename T>
+void MaxMinSegmentMetricsUpdater::FillBlockValues(
+    json::JsonArray& maxValues, json::JsonArray& minValues) const
+{
+    auto typedRefer = static_cast<ReferenceTyped<T>*>(mReference);
+    assert(typedRefer);
+    T value = T();
+    typedRefer->Get(mBlockMaxDocInfo, value);
+    maxValues.push_back(value);
+    typedRefer->Get(mBlockMinDocInfo, value);
+    minValues.push_back(value);
+}
 
 json::JsonMap MaxMinSegmentMetricsUpdater::Dump() const
 {
@@ -230,6 +309,20 @@ json::JsonMap MaxMinSegmentMetricsUpdater::Dump() const
 #undef FILL_JSONMAP
     string attrKey = GetAttrKey(mAttrName);
     jsonMap[attrKey] = valueMap;
+    if (mBlockSize > 0)
+    {
+        json::JsonArray blockMaxValues = mBlockMaxValues;
+        json::JsonArray blockMinValues = mBlockMinValues;
+        if (mBlockDocCount > 0)
+        {
+            FillBlockValues(blockMaxValues, blockMinValues);
+        }
+        json::JsonMap blockMap;
+        blockMap["block_size"] = mBlockSize;
+        blockMap["max"] = blockMaxValues;
+        blockMap["min"] = blockMinValues;
+        jsonMap[GetBlockAttrKey(mAttrName)] = blockMap;
+    }
     return jsonMap;
 }
 
@@ -51,11 +51,21 @@ public:
     {
         return ATTRIBUTE_IDENTIFIER + ":" + attrName;
     }
+    static std::string GetBlockAttrKey(const std::string& attrName)
+    {
+        return GetAttrKey(attrName) + ":block";
+    }
 
     template <typename T>
     static bool GetAttrValues(index_base::SegmentGroupMetricsPtr segmentGroupMetrics,
         const std::string& attrName, T& maxValue, T& minValue);
 
+    // max/min of every block_size docs in local docid order, the last block may be partial
+    template <typename T>
+    static bool GetBlockAttrValues(index_base::SegmentGroupMetricsPtr segmentGroupMetrics,
+        const std::string& attrName, uint32_t& blockSize,
+        std::vector<T>& maxValues, std::vector<T>& minValues);
+
 public:
     std::string GetAttrName() const { return mAttrName; }
     FieldType GetFieldType() const { return mFieldType; }
@@ -65,6 +75,11 @@ public:
 
 private:
     template <typename T> void FillJsonMap(autil::legacy::json::JsonMap& jsonMap) const;
+    template <typename T> void FillBlockValues(autil::legacy::json::JsonArray& maxValues,
+        autil::legacy::json::JsonArray& minValues) const;
+    void FillBlockValues(autil::legacy::json::JsonArray& maxValues,
+        autil::legacy::json::JsonArray& minValues) const;
+    void UpdateBlock(const index::DocInfo* docInfo);
     void Evaluate(const document::DocumentPtr& document, index::DocInfo* docInfo);
 
     template <typename T>
@@ -86,6 +101,12 @@ private:
     SortValueEvaluatorPtr mEvaluator;
     index::OfflineAttributeSegmentReaderContainerPtr mReaderContainer;
     std::unordered_map<segmentid_t, index::AttributeSegmentReaderPtr> mSegReaderMap;
+    uint32_t mBlockSize;
+    uint32_t mBlockDocCount;
+    index::DocInfo* mBlockMinDocInfo;
+    index::DocInfo* mBlockMaxDocInfo;
+    autil::legacy::json::JsonArray mBlockMaxValues;
+    autil::legacy::json::JsonArray mBlockMinValues;
 
 private:
     IE_LOG_DECLARE();
@@ -116,6 +137,29 @@ bool MaxMinSegmentMetricsUpdater::GetAttrValues(
     return true;
 }
 
+template <typename T>
+bool MaxMinSegmentMetricsUpdater::GetBlockAttrValues(
+    index_base::SegmentGroupMetricsPtr segmentGroupMetrics, const std::string& attrName,
+    uint32_t& blockSize, std::vector<T>& maxValues, std::vector<T>& minValues)
+{
+    autil::legacy::json::JsonMap blockMap;
+    if (!segmentGroupMetrics->Get(GetBlockAttrKey(attrName), blockMap))
+    {
+        return false;
+    }
+    auto sizeIter = blockMap.find("block_size");
+    auto maxIter = blockMap.find("max");
+    auto minIter = blockMap.find("min");
+    if (sizeIter == blockMap.end() || maxIter == blockMap.end() || minIter == blockMap.end())
+    {
+        return false;
+    }
+    autil::legacy::FromJson(blockSize, sizeIter->second);
+    autil::legacy::FromJson(maxValues, maxIter->second);
+    autil::legacy::FromJson(minValues, minIter->second);
+    return blockSize > 0 && maxValues.size() == minValues.size();
+}
+
 template <typename T>
 bool MaxMinSegmentMetricsUpdater::GetAttrValues(T& maxValue, T& minValue) const
 {
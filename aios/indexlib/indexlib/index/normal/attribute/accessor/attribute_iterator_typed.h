@@ -3,6 +3,7 @@
 #define __INDEXLIB_ATTRIBUTE_ITERATOR_TYPED_H
 
 #include <tr1/memory>
+#include <algorithm>
 #include "indexlib/indexlib.h"
 #include "indexlib/common_define.h"
 #include "indexlib/index/normal/attribute/accessor/attribute_iterator_base.h"
@@ -37,6 +38,11 @@ public:
     template <typename ValueType>
     inline bool Seek(docid_t docId, ValueType& value) __ALWAYS_INLINE;
     
+    // values of docs not found are set to T(), runs of docIds in
+    // one built segment are read in batch by the segment reader
+    inline void BatchSeek(const docid_t* docIds, size_t count,
+                          T* values, bool* exists);
+
     inline const char* GetBaseAddress(docid_t docId) __ALWAYS_INLINE;
 
     inline bool UpdateValue(docid_t docId, const T &value);
@@ -138,6 +144,51 @@ inline bool AttributeIteratorTyped<T, ReaderTraits>::Seek(docid_t docId, ValueTy
     return SeekInRandomMode(docId, value);
 }
 
+template<typename T, typename ReaderTraits>
+inline void AttributeIteratorTyped<T, ReaderTraits>::BatchSeek(
+        const docid_t* docIds, size_t count, T* values, bool* exists)
+{
+    static const size_t MAX_RUN_LENGTH = 64;
+    docid_t localIds[MAX_RUN_LENGTH];
+    size_t i = 0;
+    while (i < count)
+    {
+        // seek the first doc of a run to position the segment cursor
+        values[i] = T();
+        exists[i] = Seek(docIds[i], values[i]);
+        bool inBuiltSegment = exists[i] && docIds[i] >= mCurrentSegmentBaseDocId
+                              && docIds[i] < mCurrentSegmentEndDocId;
+        ++i;
+        if (!inBuiltSegment)
+        {
+            continue;
+        }
+        size_t runLength = 0;
+        while (i + runLength < count && runLength < MAX_RUN_LENGTH)
+        {
+            docid_t docId = docIds[i + runLength];
+            if (docId < mCurrentSegmentBaseDocId || docId >= mCurrentSegmentEndDocId)
+            {
+                break;
+            }
+            localIds[runLength++] = docId - mCurrentSegmentBaseDocId;
+        }
+        if (mSegmentReaders[mSegmentCursor]->BatchRead(localIds, runLength, values + i))
+        {
+            std::fill(exists + i, exists + i + runLength, true);
+        }
+        else
+        {
+            for (size_t j = i; j < i + runLength; ++j)
+            {
+                values[j] = T();
+                exists[j] = Seek(docIds[j], values[j]);
+            }
+        }
+        i += runLength;
+    }
+}
+
 template<typename T, typename ReaderTraits>
 inline const char* AttributeIteratorTyped<T, ReaderTraits>::GetBaseAddress(docid_t docId)
 {
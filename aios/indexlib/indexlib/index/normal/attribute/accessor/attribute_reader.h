@@ -39,6 +39,13 @@ public:
     virtual bool Open(const config::AttributeConfigPtr& attrConfig,
                       const index_base::PartitionDataPtr& partitionData) = 0;
 
+    // hintReader: reader of the same attribute in last partition reader,
+    // segment readers of unchanged segments may be shared with it
+    virtual bool Open(const config::AttributeConfigPtr& attrConfig,
+                      const index_base::PartitionDataPtr& partitionData,
+                      const AttributeReader* hintReader)
+    { return Open(attrConfig, partitionData); }
+
     virtual bool IsLazyLoad() const { return false; }
     
     // TODO: remove
@@ -31,7 +31,8 @@ AttributeReaderContainer::~AttributeReaderContainer()
 void AttributeReaderContainer::Init(const PartitionDataPtr& partitionData,
                                     AttributeMetrics* attrMetrics,
                                     bool lazyLoad, bool needPackAttributeReaders,
-                                    int32_t initReaderThreadCount)
+                                    int32_t initReaderThreadCount,
+                                    const AttributeReaderContainerPtr& hintContainer)
 {
     IE_LOG(INFO, "InitAttributeReaders begin");
         
@@ -40,7 +41,8 @@ void AttributeReaderContainer::Init(const PartitionDataPtr& partitionData,
     {
         mAttrReaders.reset(new MultiFieldAttributeReader(
                         attrSchema, attrMetrics, lazyLoad, initReaderThreadCount));
-        mAttrReaders->Open(partitionData);
+        mAttrReaders->Open(partitionData,
+                           hintContainer ? hintContainer->mAttrReaders.get() : NULL);
     }
 
     const AttributeSchemaPtr& virtualAttrSchema = mSchema->GetVirtualAttributeSchema();
@@ -24,9 +24,12 @@ public:
     AttributeReaderContainer(const IE_NAMESPACE(config)::IndexPartitionSchemaPtr& schema);
     ~AttributeReaderContainer();
 public:
+    // hintContainer: container of last reader, unchanged attribute segment
+    // readers are shared with it
     void Init(const index_base::PartitionDataPtr& partitionData,
               AttributeMetrics* attrMetrics,
-              bool lazyLoad, bool needPackAttributeReaders, int32_t initReaderThreadCount);
+              bool lazyLoad, bool needPackAttributeReaders, int32_t initReaderThreadCount,
+              const AttributeReaderContainerPtr& hintContainer = AttributeReaderContainerPtr());
     void InitAttributeReader(const index_base::PartitionDataPtr& partitionData,
                              bool lazyLoadAttribute,
                              const std::string& field);
@@ -177,7 +177,8 @@ AttributeReader* AttributeReaderFactory::CreateAttributeReader(
 AttributeReaderPtr AttributeReaderFactory::CreateAttributeReader(
             const AttributeConfigPtr& attrConfig,
             const PartitionDataPtr& partitionData,
-            AttributeMetrics* metrics)
+            AttributeMetrics* metrics,
+            const AttributeReader* hintReader)
 {
     AttributeReaderPtr attrReader(
             AttributeReaderFactory::GetInstance()->CreateAttributeReader(
@@ -187,7 +188,7 @@ AttributeReaderPtr AttributeReaderFactory::CreateAttributeReader(
         return AttributeReaderPtr();
     }
 
-    if (!attrReader->Open(attrConfig, partitionData))
+    if (!attrReader->Open(attrConfig, partitionData, hintReader))
     {
         return AttributeReaderPtr();
     }
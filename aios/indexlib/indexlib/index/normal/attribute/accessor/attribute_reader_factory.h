@@ -45,7 +45,8 @@ public:
     static AttributeReaderPtr CreateAttributeReader(
             const config::AttributeConfigPtr& attrConfig,
             const index_base::PartitionDataPtr& partitionData,
-            AttributeMetrics* metrics = NULL);
+            AttributeMetrics* metrics = NULL,
+            const AttributeReader* hintReader = NULL);
 
 protected:
 #ifdef ATTRIBUTE_READER_FACTORY_UNITTEST
@@ -42,6 +42,12 @@ public:
     { return idx < mBaseDocIds.size() ? mBaseDocIds[idx] : INVALID_DOCID; }
 
     size_t Size() const { return mBaseDocIds.size(); }
+
+    const InMemSegmentReaderPtr& GetSegmentReader(size_t idx) const
+    {
+        assert(idx < mSegmentReaders.size());
+        return mSegmentReaders[idx];
+    }
     
 private:
     std::vector<docid_t> mBaseDocIds;
@@ -7,6 +7,7 @@
 #include "indexlib/common_define.h"
 #include "indexlib/common/typed_slice_list.h"
 #include "indexlib/index/normal/attribute/accessor/attribute_segment_reader.h"
+#include "indexlib/index/normal/attribute/accessor/single_value_block_max_min.h"
 #include "indexlib/common/field_format/pack_attribute/float_compress_convertor.h"
 
 IE_NAMESPACE_BEGIN(index);
@@ -17,7 +18,8 @@ class InMemSingleValueAttributeReader : public AttributeSegmentReader
 public:
     inline InMemSingleValueAttributeReader(common::TypedSliceListBase* data,
                                     const config::CompressTypeOption& compress = 
-                                    config::CompressTypeOption());
+                                    config::CompressTypeOption(),
+                                    SingleValueBlockMaxMin<T>* blockMaxMin = NULL);
     ~InMemSingleValueAttributeReader();
 
 public:
@@ -42,6 +44,10 @@ public:
         }
         common::TypedSliceList<T>* typedData = static_cast<common::TypedSliceList<T>*>(mData);
         assert(typedData != NULL);
+        if (mBlockMaxMin)
+        {
+            mBlockMaxMin->Update(docId, *(T*)buf);
+        }
         typedData->Update(docId, *(T*)buf);
         return true;
     }
@@ -82,6 +88,10 @@ public:
     const common::TypedSliceListBase* GetAttributeData() const
     { return mData; }
 
+    // NULL if block max/min is not kept for this attribute
+    const SingleValueBlockMaxMin<T>* GetBlockMaxMin() const
+    { return mBlockMaxMin; }
+
 private:
     bool CheckDocId(docid_t docId) const 
     {
@@ -91,6 +101,7 @@ private:
 private:
     common::TypedSliceListBase* mData;
     config::CompressTypeOption mCompressType;
+    SingleValueBlockMaxMin<T>* mBlockMaxMin;
     uint8_t mDataSize;
     IE_LOG_DECLARE();
 };
@@ -103,9 +114,11 @@ IE_LOG_SETUP_TEMPLATE(index, InMemSingleValueAttributeReader);
 template<typename T>
 inline InMemSingleValueAttributeReader<T>::InMemSingleValueAttributeReader(
         common::TypedSliceListBase* data,
-        const config::CompressTypeOption& compress) 
+        const config::CompressTypeOption& compress,
+        SingleValueBlockMaxMin<T>* blockMaxMin) 
     : mData(data)
     , mCompressType(compress)
+    , mBlockMaxMin(blockMaxMin)
 {
     mDataSize = sizeof(T);
 }
@@ -113,9 +126,11 @@ inline InMemSingleValueAttributeReader<T>::InMemSingleValueAttributeReader(
 template<>
 inline InMemSingleValueAttributeReader<float>::InMemSingleValueAttributeReader(
         common::TypedSliceListBase* data,
-        const config::CompressTypeOption& compress) 
+        const config::CompressTypeOption& compress,
+        SingleValueBlockMaxMin<float>* blockMaxMin) 
     : mData(data)
     , mCompressType(compress)
+    , mBlockMaxMin(blockMaxMin)
 {
     mDataSize = common::FloatCompressConvertor::GetSingleValueCompressLen(mCompressType);
 }
@@ -152,6 +167,10 @@ inline bool InMemSingleValueAttributeReader<float>::UpdateField(
     common::TypedSliceList<float>* typedData = 
         static_cast<common::TypedSliceList<float>*>(mData);
     assert(typedData != NULL);
+    if (mBlockMaxMin)
+    {
+        mBlockMaxMin->Update(docId, *(float*)buf);
+    }
     typedData->Update(docId, *(float*)buf);
     return true;
 }
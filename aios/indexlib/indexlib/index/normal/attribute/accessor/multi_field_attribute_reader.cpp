@@ -34,9 +34,10 @@ MultiFieldAttributeReader::~MultiFieldAttributeReader()
 }
 
 void MultiFieldAttributeReader::Open(
-        const PartitionDataPtr& partitionData)
+        const PartitionDataPtr& partitionData,
+        const MultiFieldAttributeReader* hintReader)
 {
-    InitAttributeReaders(partitionData);
+    InitAttributeReaders(partitionData, hintReader);
 }
 
 const AttributeReaderPtr& MultiFieldAttributeReader::GetAttributeReader(
@@ -56,7 +57,8 @@ const AttributeReaderPtr& MultiFieldAttributeReader::GetAttributeReader(
 }
 
 void MultiFieldAttributeReader::MultiThreadInitAttributeReaders(
-        const PartitionDataPtr& partitionData, int32_t threadNum)
+        const PartitionDataPtr& partitionData, int32_t threadNum,
+        const MultiFieldAttributeReader* hintReader)
 {
     IE_LOG(INFO, "MultiThread InitAttributeReaders begin, threadNum[%d], mAttrReaderMap[%lu]",
            threadNum, mAttrReaderMap.size());
@@ -85,9 +87,10 @@ void MultiFieldAttributeReader::MultiThreadInitAttributeReaders(
         }
         ++actualCount;
         auto* workItem = util::makeLambdaWorkItem(
-                [this, &attrConfig, &partitionData, &attrReaderMapLock]() {
+                [this, &attrConfig, &partitionData, hintReader, &attrReaderMapLock]() {
                     const string& attrName = attrConfig->GetAttrName();
-                    AttributeReaderPtr attrReader = CreateAttributeReader(attrConfig, partitionData);
+                    AttributeReaderPtr attrReader =
+                        CreateAttributeReader(attrConfig, partitionData, hintReader);
                     if (attrReader)
                     {
                         IE_LOG(INFO, "MultiThread InitAttribute [%s]", attrName.c_str());
@@ -104,11 +107,13 @@ void MultiFieldAttributeReader::MultiThreadInitAttributeReaders(
 }
 
 void MultiFieldAttributeReader::InitAttributeReaders(
-        const PartitionDataPtr& partitionData)
+        const PartitionDataPtr& partitionData,
+        const MultiFieldAttributeReader* hintReader)
 {
     if (mInitReaderThreadCount > 1)
     {
-        return MultiThreadInitAttributeReaders(partitionData, mInitReaderThreadCount);
+        return MultiThreadInitAttributeReaders(
+                partitionData, mInitReaderThreadCount, hintReader);
     }
     if (mAttrSchema)
     {
@@ -121,14 +126,15 @@ void MultiFieldAttributeReader::InitAttributeReaders(
             {
                 continue;
             }
-            InitAttributeReader(attrConfig, partitionData);
+            InitAttributeReader(attrConfig, partitionData, hintReader);
         }
     }
 }
 
 AttributeReaderPtr MultiFieldAttributeReader::CreateAttributeReader(
         const AttributeConfigPtr& attrConfig,
-        const PartitionDataPtr& partitionData)
+        const PartitionDataPtr& partitionData,
+        const MultiFieldAttributeReader* hintReader)
 {
     AttributeReaderPtr attrReader;
     if (mLazyLoad)
@@ -138,18 +144,30 @@ AttributeReaderPtr MultiFieldAttributeReader::CreateAttributeReader(
     }
     else
     {
+        const AttributeReader* hintAttrReader = NULL;
+        if (hintReader)
+        {
+            AttributeReaderMap::const_iterator it =
+                hintReader->mAttrReaderMap.find(attrConfig->GetAttrName());
+            if (it != hintReader->mAttrReaderMap.end())
+            {
+                hintAttrReader = it->second.get();
+            }
+        }
         attrReader = AttributeReaderFactory::CreateAttributeReader(
-            attrConfig, partitionData, mAttributeMetrics);
+            attrConfig, partitionData, mAttributeMetrics, hintAttrReader);
     }
     return attrReader;
 }
 
 void MultiFieldAttributeReader::InitAttributeReader(
         const AttributeConfigPtr& attrConfig,
-        const PartitionDataPtr& partitionData)
+        const PartitionDataPtr& partitionData,
+        const MultiFieldAttributeReader* hintReader)
 {
     const string& attrName = attrConfig->GetAttrName();
-    AttributeReaderPtr attrReader = CreateAttributeReader(attrConfig, partitionData);
+    AttributeReaderPtr attrReader =
+        CreateAttributeReader(attrConfig, partitionData, hintReader);
     if (attrReader)
     {
         mAttrReaderMap.insert(make_pair(attrName, attrReader));
@@ -24,7 +24,9 @@ public:
     virtual ~MultiFieldAttributeReader();
 
 public:
-    void Open(const index_base::PartitionDataPtr& partitionData);
+    // attribute readers in hintReader are used to share unchanged segment readers
+    void Open(const index_base::PartitionDataPtr& partitionData,
+              const MultiFieldAttributeReader* hintReader = NULL);
 
     const AttributeReaderPtr& GetAttributeReader(const std::string& field) const;
     void EnableAccessCountors() { mEnableAccessCountors = true; }
@@ -40,14 +42,17 @@ public:
     { return mAttrReaderMap; }
 
     void InitAttributeReader(const config::AttributeConfigPtr& attrConfig,
-                             const index_base::PartitionDataPtr& partitionData);
+                             const index_base::PartitionDataPtr& partitionData,
+                             const MultiFieldAttributeReader* hintReader = NULL);
 
 private:
-    void InitAttributeReaders(const index_base::PartitionDataPtr& partitionData);
+    void InitAttributeReaders(const index_base::PartitionDataPtr& partitionData,
+                              const MultiFieldAttributeReader* hintReader);
     void MultiThreadInitAttributeReaders(const index_base::PartitionDataPtr& partitionData,
-            int32_t threadNum);
+            int32_t threadNum, const MultiFieldAttributeReader* hintReader);
     AttributeReaderPtr CreateAttributeReader(const config::AttributeConfigPtr& attrConfig,
-            const index_base::PartitionDataPtr& partitionData);
+            const index_base::PartitionDataPtr& partitionData,
+            const MultiFieldAttributeReader* hintReader);
 
 private:
     config::AttributeSchemaPtr mAttrSchema;
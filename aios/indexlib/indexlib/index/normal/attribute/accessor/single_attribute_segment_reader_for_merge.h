@@ -78,6 +78,7 @@ protected:
     int32_t mValueCountInBuffer;
 
     EquivalentCompressReaderPtr mCompressReader;
+    std::vector<T> mDecodeBuffer;
     SingleValueAttributePatchReader<T> mPatchReader;
     IE_LOG_DECLARE();
 private:
@@ -221,7 +222,18 @@ bool SingleAttributeSegmentReaderForMerge<T>::ReadCompressData(docid_t docId, T&
     {
         return true;
     }
-    value = mCompressReader->Get(docId);
+    // merge reads docs in order, decode a window of values in bulk
+    docid_t offsetInBuffer = docId - mStartDocId;
+    if (offsetInBuffer < 0 || offsetInBuffer >= (docid_t)mValueCountInBuffer)
+    {
+        size_t decodeCount = std::min((size_t)BUFFER_SIZE, (size_t)(mDocCount - docId));
+        mDecodeBuffer.resize(BUFFER_SIZE);
+        mCompressReader->BatchGet(docId, decodeCount, mDecodeBuffer.data());
+        mStartDocId = docId;
+        mValueCountInBuffer = decodeCount;
+        offsetInBuffer = 0;
+    }
+    value = mDecodeBuffer[offsetInBuffer];
     return true;
 }
 
@@ -286,6 +298,7 @@ inline int64_t SingleAttributeSegmentReaderForMerge<T>::EstimateMemoryUse(
     else
     {
         size += docCount * sizeof(T); // the worst situation, no value equal, maybe we should use fileLen
+        size += BUFFER_SIZE * sizeof(T); // decode buffer
     }
     return size;
 }
@@ -2,6 +2,7 @@
 #define __INDEXLIB_SINGLE_VALUE_ATTRIBUTE_READER_H
 
 #include <iomanip>
+#include <typeinfo>
 #include <tr1/memory>
 #include "indexlib/indexlib.h"
 #include "indexlib/common/field_format/attribute/type_info.h"
@@ -64,7 +65,12 @@ public:
     DECLARE_ATTRIBUTE_READER_IDENTIFIER(single);    
 public:
     bool Open(const config::AttributeConfigPtr& attrConfig,
-              const index_base::PartitionDataPtr& partitionData) override;
+              const index_base::PartitionDataPtr& partitionData) override
+    { return Open(attrConfig, partitionData, NULL); }
+
+    bool Open(const config::AttributeConfigPtr& attrConfig,
+              const index_base::PartitionDataPtr& partitionData,
+              const AttributeReader* hintReader) override;
 
     bool Read(docid_t docId, std::string& attrValue,
               autil::mem_pool::Pool* pool = NULL) const override;
@@ -89,11 +95,13 @@ public:
 
     AttributeSegmentReaderPtr GetSegmentReader(docid_t docId) const;
 
+    // reader of built segment segmentId, NULL if it is empty or not loaded
+    SegmentReaderPtr GetSegmentReaderBySegmentId(segmentid_t segmentId) const;
+
 public:
     inline bool Read(docid_t docId, T& attrValue,
                      autil::mem_pool::Pool* pool = NULL) const __ALWAYS_INLINE;
 
-    // for test
     BuildingAttributeReaderPtr GetBuildingAttributeReader() const
     { return mBuildingAttributeReader; }
 
@@ -107,6 +115,9 @@ private:
     template <typename Compare>
     bool Search(T value, DocIdRange rangeLimit, docid_t& docId) const;
 
+    SegmentReaderPtr GetHintSegmentReader(const AttributeReader* hintReader,
+            const index_base::SegmentData& segData) const;
+
     virtual SegmentReaderPtr CreateSegmentReader(
             const config::AttributeConfigPtr& attrConfig,
             AttributeMetrics* attrMetrics = NULL)
@@ -144,7 +155,8 @@ IE_LOG_SETUP_TEMPLATE(index, SingleValueAttributeReader);
 template<typename T>
 bool SingleValueAttributeReader<T>::Open(
         const config::AttributeConfigPtr& attrConfig,
-        const index_base::PartitionDataPtr& partitionData)
+        const index_base::PartitionDataPtr& partitionData,
+        const AttributeReader* hintReader)
 {
     mAttrConfig = attrConfig;
 
@@ -171,9 +183,22 @@ bool SingleValueAttributeReader<T>::Open(
 
         try
         {
-            SegmentReaderPtr segReader = CreateSegmentReader(mAttrConfig, mAttributeMetrics);
-            file_system::DirectoryPtr attrDirectory = GetAttributeDirectory(segData, mAttrConfig);
-            segReader->Open(segData, attrDirectory);
+            SegmentReaderPtr segReader = GetHintSegmentReader(hintReader, segData);
+            if (segReader)
+            {
+                segReader->ReportMetricsForReuse();
+                if (mAttributeMetrics)
+                {
+                    mAttributeMetrics->IncreaseReusedSegmentReaderCountValue(1);
+                }
+            }
+            else
+            {
+                segReader = CreateSegmentReader(mAttrConfig, mAttributeMetrics);
+                file_system::DirectoryPtr attrDirectory =
+                    GetAttributeDirectory(segData, mAttrConfig);
+                segReader->Open(segData, attrDirectory);
+            }
             mSegmentReaders.push_back(segReader);
             mSegmentInfos.push_back(segmentInfo);
             mSegmentIds.push_back(segData.GetSegmentId());
@@ -205,6 +230,40 @@ bool SingleValueAttributeReader<T>::Open(
     return true;
 }
 
+template<typename T>
+typename SingleValueAttributeReader<T>::SegmentReaderPtr
+SingleValueAttributeReader<T>::GetHintSegmentReader(
+        const AttributeReader* hintReader,
+        const index_base::SegmentData& segData) const
+{
+    // built segment is immutable except for patches, which are updated
+    // inplace into the shared segment reader, so it can be reused
+    // when its segment id and doc count are unchanged
+    if (!hintReader || typeid(*hintReader) != typeid(*this))
+    {
+        return SegmentReaderPtr();
+    }
+    const SingleValueAttributeReader<T>* typedHintReader =
+        static_cast<const SingleValueAttributeReader<T>*>(hintReader);
+    if (typedHintReader->mAttrConfig != mAttrConfig)
+    {
+        return SegmentReaderPtr();
+    }
+    for (size_t i = 0; i < typedHintReader->mSegmentIds.size(); ++i)
+    {
+        if (typedHintReader->mSegmentIds[i] == segData.GetSegmentId())
+        {
+            if (typedHintReader->mSegmentInfos[i].docCount
+                == segData.GetSegmentInfo().docCount)
+            {
+                return typedHintReader->mSegmentReaders[i];
+            }
+            break;
+        }
+    }
+    return SegmentReaderPtr();
+}
+
 template<typename T>
 file_system::DirectoryPtr SingleValueAttributeReader<T>::GetAttributeDirectory(
         const index_base::SegmentData& segData,
@@ -475,6 +534,20 @@ AttributeSegmentReaderPtr SingleValueAttributeReader<T>::GetSegmentReader(
     return AttributeSegmentReaderPtr();
 }
 
+template <typename T>
+typename SingleValueAttributeReader<T>::SegmentReaderPtr
+SingleValueAttributeReader<T>::GetSegmentReaderBySegmentId(segmentid_t segmentId) const
+{
+    for (size_t i = 0; i < mSegmentIds.size(); i++)
+    {
+        if (mSegmentIds[i] == segmentId)
+        {
+            return mSegmentReaders[i];
+        }
+    }
+    return SegmentReaderPtr();
+}
+
 template <typename T>
 std::string SingleValueAttributeReader<T>::GetAttributeName() const
 {
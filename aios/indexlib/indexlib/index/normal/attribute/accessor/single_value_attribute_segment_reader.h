@@ -75,12 +75,31 @@ public:
     inline bool Read(docid_t docId, T& value,
                      autil::mem_pool::Pool* pool = NULL) const __ALWAYS_INLINE;
 
+    // docIds should be ascending for compressed data to decode in bulk
+    bool BatchRead(const docid_t* docIds, size_t count, T* values) const;
+
     const file_system::FileReaderPtr& GetDataFile() const { return mDataFile; }
 
     uint8_t* GetDataBaseAddr() const { return mData; }
 
+    // local docid range [beginDocId, endDocId) and value range of docs
+    // changed by patches and updates since open, false if none is changed
+    bool GetUpdatedRange(docid_t& beginDocId, docid_t& endDocId,
+                         T& minValue, T& maxValue) const;
+
+    // attribute metrics are reset for each new partition reader,
+    // report again when this segment reader is shared by a new one
+    void ReportMetricsForReuse()
+    {
+        if (mCompressReader)
+        {
+            InitAttributeMetrics();
+        }
+    }
+
 private:
     void InitFormmater();
+    void ExtendUpdatedRange(docid_t docId, const T& value);
     virtual file_system::FileReaderPtr CreateFileReader(
             const file_system::DirectoryPtr& directory,
             const std::string& fileName) const;
@@ -134,6 +153,13 @@ protected:
     common::EquivalentCompressUpdateMetrics mCompressMetrics;
     uint8_t mDataSize;
 
+    // only widened, set before the updated value is written
+    volatile bool mHasUpdated;
+    docid_t mUpdatedBeginDocId;
+    docid_t mUpdatedEndDocId;
+    T mUpdatedMinValue;
+    T mUpdatedMaxValue;
+
 private:
     IE_LOG_DECLARE();
     friend class SingleValueAttributeSegmentReaderTest;
@@ -153,6 +179,11 @@ inline SingleValueAttributeSegmentReader<T>::SingleValueAttributeSegmentReader(
     , mData(NULL)
     , mSliceFileLen(0)
     , mAttrConfig(config)
+    , mHasUpdated(false)
+    , mUpdatedBeginDocId(INVALID_DOCID)
+    , mUpdatedEndDocId(INVALID_DOCID)
+    , mUpdatedMinValue(T())
+    , mUpdatedMaxValue(T())
 {
     if (AttributeCompressInfo::NeedCompressData(mAttrConfig))
     {
@@ -317,6 +348,7 @@ inline bool SingleValueAttributeSegmentReader<T>::UpdateField(docid_t docId,
         return false;
     }
 
+    ExtendUpdatedRange(docId, *(T*)buf);
     if (mCompressReader)
     {
         assert(bufLen == sizeof(T));
@@ -329,6 +361,54 @@ inline bool SingleValueAttributeSegmentReader<T>::UpdateField(docid_t docId,
     return true;
 }
 
+template<typename T>
+inline void SingleValueAttributeSegmentReader<T>::ExtendUpdatedRange(
+        docid_t docId, const T& value)
+{
+    if (!mHasUpdated)
+    {
+        mUpdatedBeginDocId = docId;
+        mUpdatedEndDocId = docId + 1;
+        mUpdatedMinValue = value;
+        mUpdatedMaxValue = value;
+        MEMORY_BARRIER();
+        mHasUpdated = true;
+        return;
+    }
+    if (docId < mUpdatedBeginDocId)
+    {
+        mUpdatedBeginDocId = docId;
+    }
+    if (docId >= mUpdatedEndDocId)
+    {
+        mUpdatedEndDocId = docId + 1;
+    }
+    if (value < mUpdatedMinValue)
+    {
+        mUpdatedMinValue = value;
+    }
+    if (mUpdatedMaxValue < value)
+    {
+        mUpdatedMaxValue = value;
+    }
+    MEMORY_BARRIER();
+}
+
+template<typename T>
+inline bool SingleValueAttributeSegmentReader<T>::GetUpdatedRange(
+        docid_t& beginDocId, docid_t& endDocId, T& minValue, T& maxValue) const
+{
+    if (!mHasUpdated)
+    {
+        return false;
+    }
+    beginDocId = mUpdatedBeginDocId;
+    endDocId = mUpdatedEndDocId;
+    minValue = mUpdatedMinValue;
+    maxValue = mUpdatedMaxValue;
+    return true;
+}
+
 template<typename T>
 inline bool SingleValueAttributeSegmentReader<T>::Read(
         docid_t docId, T& value, autil::mem_pool::Pool* pool) const
@@ -348,6 +428,29 @@ inline bool SingleValueAttributeSegmentReader<T>::Read(
     return true;
 }
 
+template<typename T>
+inline bool SingleValueAttributeSegmentReader<T>::BatchRead(
+        const docid_t* docIds, size_t count, T* values) const
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (docIds[i] < 0 || docIds[i] >= (docid_t)mDocCount)
+        {
+            return false;
+        }
+    }
+    if (mCompressReader)
+    {
+        mCompressReader->BatchGet(docIds, count, values);
+        return true;
+    }
+    for (size_t i = 0; i < count; ++i)
+    {
+        mFormatter.Get(docIds[i], mData, values[i]);
+    }
+    return true;
+}
+
 template<typename T>
 template<class Compare>
 void SingleValueAttributeSegmentReader<T>::Search(
@@ -12,6 +12,7 @@
 #include "indexlib/common/field_format/attribute/type_info.h"
 #include "indexlib/index/normal/attribute/equal_value_compress_dumper.h"
 #include "indexlib/index/normal/attribute/accessor/in_mem_single_value_attribute_reader.h"
+#include "indexlib/index/normal/attribute/accessor/single_value_block_max_min.h"
 #include "indexlib/index/normal/attribute/accessor/attribute_compress_info.h"
 #include "indexlib/util/simple_pool.h"
 
@@ -24,6 +25,7 @@ public:
     SingleValueAttributeWriter(const config::AttributeConfigPtr& attrConfig)
         : AttributeWriter(attrConfig)
         , mData(NULL)
+        , mBlockMaxMin(NULL)
         , mIsDataFileCopyOnDump(false)
     {
     }
@@ -96,6 +98,7 @@ private:
     const static uint32_t SLICE_LEN  = 16 * 1024;
     const static uint32_t SLOT_NUM  = 64;
     common::TypedSliceList<T>* mData;
+    SingleValueBlockMaxMin<T>* mBlockMaxMin;
     bool mIsDataFileCopyOnDump;
 
 private:
@@ -144,6 +147,8 @@ inline void SingleValueAttributeWriter<T>::Init(
     assert(mPool);
     void* buffer = mPool->allocate(sizeof(common::TypedSliceList<T>));
     mData = new (buffer) common::TypedSliceList<T>(SLOT_NUM, SLICE_LEN, mPool.get());
+    buffer = mPool->allocate(sizeof(SingleValueBlockMaxMin<T>));
+    mBlockMaxMin = new (buffer) SingleValueBlockMaxMin<T>(mPool.get());
     mIsDataFileCopyOnDump =
         mFsWriterParamDecider->MakeParam(ATTRIBUTE_DATA_FILE_NAME).copyOnDump;
     UpdateBuildResourceMetrics();
@@ -169,6 +174,7 @@ template<typename T>
 inline void SingleValueAttributeWriter<T>::AddField(docid_t docId,
         const T& value)
 {
+    mBlockMaxMin->Append(mData->Size(), value);
     mData->PushBack(value);
     UpdateBuildResourceMetrics();    
 }
@@ -185,6 +191,7 @@ inline bool SingleValueAttributeWriter<T>::UpdateField(docid_t docId,
         return false;
     }
     common::AttrValueMeta meta = mAttrConvertor->Decode(attributeValue);
+    mBlockMaxMin->Update(docId, *((T*)meta.data.data()));
     mData->Update(docId, *((T*)meta.data.data()));
     UpdateBuildResourceMetrics(); 
     return true;
@@ -206,7 +213,8 @@ inline void SingleValueAttributeWriter<T>::Dump(
 template<typename T>
 inline const AttributeSegmentReaderPtr SingleValueAttributeWriter<T>::CreateInMemReader() const
 {
-    return AttributeSegmentReaderPtr(new InMemSingleValueAttributeReader<T>(mData));
+    return AttributeSegmentReaderPtr(new InMemSingleValueAttributeReader<T>(
+                    mData, config::CompressTypeOption(), mBlockMaxMin));
 }
 
 template<>
@@ -217,7 +225,8 @@ inline const AttributeSegmentReaderPtr SingleValueAttributeWriter<int16_t>::Crea
     {
         return AttributeSegmentReaderPtr(new InMemSingleValueAttributeReader<float>(mData, compress));
     }
-    return AttributeSegmentReaderPtr(new InMemSingleValueAttributeReader<int16_t>(mData));
+    return AttributeSegmentReaderPtr(new InMemSingleValueAttributeReader<int16_t>(
+                    mData, config::CompressTypeOption(), mBlockMaxMin));
 }
 
 template<>
@@ -228,7 +237,8 @@ inline const AttributeSegmentReaderPtr SingleValueAttributeWriter<int8_t>::Creat
     {
         return AttributeSegmentReaderPtr(new InMemSingleValueAttributeReader<float>(mData, compress));
     }
-    return AttributeSegmentReaderPtr(new InMemSingleValueAttributeReader<int8_t>(mData));
+    return AttributeSegmentReaderPtr(new InMemSingleValueAttributeReader<int8_t>(
+                    mData, config::CompressTypeOption(), mBlockMaxMin));
 }
 
 template<typename T>
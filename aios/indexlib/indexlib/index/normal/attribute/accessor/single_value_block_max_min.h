@@ -0,0 +1,89 @@
+#ifndef __INDEXLIB_SINGLE_VALUE_BLOCK_MAX_MIN_H
+#define __INDEXLIB_SINGLE_VALUE_BLOCK_MAX_MIN_H
+
+#include <tr1/memory>
+#include "indexlib/indexlib.h"
+#include "indexlib/common_define.h"
+#include "indexlib/common/typed_slice_list.h"
+
+IE_NAMESPACE_BEGIN(index);
+
+// max/min of every BLOCK_SIZE docs of a building single value attribute,
+// kept by the attribute writer and widened by in place updates. values are
+// widened before they are written, so a reader never sees a doc value out
+// of its block range
+template<typename T>
+class SingleValueBlockMaxMin
+{
+public:
+    typedef autil::mem_pool::Pool Pool;
+
+public:
+    SingleValueBlockMaxMin(Pool* pool)
+        : mMinValues(SLOT_NUM, SLICE_LEN, pool)
+        , mMaxValues(SLOT_NUM, SLICE_LEN, pool)
+    {}
+    ~SingleValueBlockMaxMin() {}
+
+public:
+    // docId should be the doc count before the value is appended
+    void Append(docid_t docId, const T& value)
+    {
+        uint32_t blockIdx = docId / BLOCK_SIZE;
+        if (blockIdx >= mMinValues.Size())
+        {
+            mMinValues.PushBack(value);
+            mMaxValues.PushBack(value);
+            return;
+        }
+        Update(docId, value);
+    }
+
+    void Update(docid_t docId, const T& value)
+    {
+        uint32_t blockIdx = docId / BLOCK_SIZE;
+        assert(blockIdx < mMinValues.Size());
+        T* minValue;
+        T* maxValue;
+        mMinValues.Read(blockIdx, minValue);
+        mMaxValues.Read(blockIdx, maxValue);
+        if (value < *minValue)
+        {
+            *minValue = value;
+        }
+        if (*maxValue < value)
+        {
+            *maxValue = value;
+        }
+    }
+
+    uint32_t GetBlockSize() const { return BLOCK_SIZE; }
+    uint64_t GetBlockCount() const { return mMinValues.Size(); }
+
+    bool Get(uint32_t blockIdx, T& minValue, T& maxValue) const
+    {
+        if (blockIdx >= mMaxValues.Size())
+        {
+            return false;
+        }
+        mMinValues.Read(blockIdx, minValue);
+        mMaxValues.Read(blockIdx, maxValue);
+        return true;
+    }
+
+private:
+    const static uint32_t BLOCK_SIZE = 128;
+    const static uint32_t SLICE_LEN = 1024;
+    const static uint32_t SLOT_NUM = 64;
+
+private:
+    common::TypedSliceList<T> mMinValues;
+    common::TypedSliceList<T> mMaxValues;
+
+private:
+    friend class SingleValueBlockMaxMinTest;
+};
+
+IE_NAMESPACE_END(index);
+
+#endif //__INDEXLIB_SINGLE_VALUE_BLOCK_MAX_MIN_H
@@ -33,6 +33,7 @@ void AttributeMetrics::RegisterMetrics(TableType tableType)
     INIT_ATTRIBUTE_METRIC(EqualCompressWastedBytes, "byte");
     INIT_ATTRIBUTE_METRIC(EqualCompressInplaceUpdateCount, "count");
     INIT_ATTRIBUTE_METRIC(EqualCompressExpandUpdateCount, "count");
+    INIT_ATTRIBUTE_METRIC(ReusedSegmentReaderCount, "count");
 #undef INIT_ATTRIBUTE_METRIC
 
     mReclaimedSliceCountMetric = NULL;
@@ -49,6 +50,7 @@ void AttributeMetrics::ReportMetrics()
     IE_REPORT_METRIC(EqualCompressWastedBytes, mEqualCompressWastedBytes);
     IE_REPORT_METRIC(EqualCompressInplaceUpdateCount, mEqualCompressInplaceUpdateCount);
     IE_REPORT_METRIC(EqualCompressExpandUpdateCount, mEqualCompressExpandUpdateCount);
+    IE_REPORT_METRIC(ReusedSegmentReaderCount, mReusedSegmentReaderCount);
 }
 
 void AttributeMetrics::ResetMetricsForNewReader()
@@ -57,6 +59,7 @@ void AttributeMetrics::ResetMetricsForNewReader()
     SetCurReaderReclaimableBytesValue(0);
     SetEqualCompressExpandFileLenValue(0);
     SetEqualCompressWastedBytesValue(0);
+    SetReusedSegmentReaderCountValue(0);
 }
 
 IE_NAMESPACE_END(index);
@@ -36,6 +36,8 @@ private:
     IE_DECLARE_PARAM_METRIC(uint32_t, EqualCompressInplaceUpdateCount);
     IE_DECLARE_PARAM_METRIC(uint32_t, EqualCompressExpandUpdateCount);
     IE_DECLARE_PARAM_METRIC(int64_t, PackAttributeReaderBufferSize);
+    // segment readers shared with last reader on reopen
+    IE_DECLARE_PARAM_METRIC(int64_t, ReusedSegmentReaderCount);
 
 private:
     IE_LOG_DECLARE();
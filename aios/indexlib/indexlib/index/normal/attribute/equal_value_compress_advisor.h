@@ -40,6 +40,8 @@ public:
         , mOffsetInBlock(0)
         , mBlockSize(maxStepLen)
         , mStepedBlocks(0)
+        , mBufferBegin(0)
+        , mBufferEnd(0)
     {
         assert(reader.Size() > 0);
         uint32_t totalBlocks = (reader.Size() + maxStepLen - 1) / maxStepLen;
@@ -61,8 +63,16 @@ public:
 
     T Next()
     {
-        assert(mBeginOffset + mOffsetInBlock < mReader.Size());
-        T value = mReader[mBeginOffset + mOffsetInBlock];
+        uint32_t pos = mBeginOffset + mOffsetInBlock;
+        assert(pos < mReader.Size());
+        if (pos < mBufferBegin || pos >= mBufferEnd)
+        {
+            uint32_t blockEnd = std::min(mBeginOffset + mBlockSize, mReader.Size());
+            mBufferBegin = pos;
+            mBufferEnd = std::min(blockEnd, pos + BUFFER_SIZE);
+            mReader.BatchGet(mBufferBegin, mBufferEnd - mBufferBegin, mBuffer);
+        }
+        T value = mBuffer[pos - mBufferBegin];
 
         if (++mOffsetInBlock == mBlockSize)
         {
@@ -73,11 +83,16 @@ public:
     }
 
 private:
+    static const uint32_t BUFFER_SIZE = 128;
+
     const common::EquivalentCompressReader<T>& mReader;
     uint32_t mBeginOffset;
     uint32_t mOffsetInBlock;
     uint32_t mBlockSize;
     uint32_t mStepedBlocks;
+    uint32_t mBufferBegin;
+    uint32_t mBufferEnd;
+    T mBuffer[BUFFER_SIZE];
 };
 
 /////////////////////////////////////////////////////////////
@@ -22,6 +22,18 @@ public:
         value = mDataVector[docId];
         return true;
     }
+
+    bool BatchRead(const docid_t* docIds, size_t count, int32_t* values)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            values[i] = mDataVector[docIds[i]];
+        }
+        mBatchReadDocCount += count;
+        return true;
+    }
+public:
+    size_t mBatchReadDocCount = 0;
 private:
     const vector<int32_t> mDataVector;
 };
@@ -187,6 +199,47 @@ public:
         INDEXLIB_TEST_TRUE(!iterator->SeekInRandomMode(100, value));
     }
 
+    void TestBatchSeek()
+    {
+        vector<uint32_t> docCountPerSegment;
+        docCountPerSegment.push_back(10);
+        docCountPerSegment.push_back(0); // empty segment
+        docCountPerSegment.push_back(100);
+        docCountPerSegment.push_back(5); // building segment
+
+        vector<int32_t> dataVector;
+        Int32AttrIteratorPtr iterator = PrepareAttrIterator(docCountPerSegment, dataVector, true);
+
+        vector<docid_t> docIds;
+        for (docid_t docId = 0; docId < 115; docId += 2)
+        {
+            docIds.push_back(docId);
+        }
+        docIds.push_back(200); // out of range
+        docIds.push_back(3); // seek back
+        docIds.push_back(4);
+
+        vector<int32_t> values(docIds.size());
+        bool exists[64];
+        assert(docIds.size() <= 64);
+        iterator->BatchSeek(docIds.data(), docIds.size(), values.data(), exists);
+        for (size_t i = 0; i < docIds.size(); ++i)
+        {
+            if (docIds[i] >= (docid_t)dataVector.size())
+            {
+                INDEXLIB_TEST_TRUE(!exists[i]);
+                INDEXLIB_TEST_EQUAL(0, values[i]);
+                continue;
+            }
+            INDEXLIB_TEST_TRUE(exists[i]);
+            INDEXLIB_TEST_EQUAL(dataVector[docIds[i]], values[i]);
+        }
+        // all docs in built segments except the first one of each run,
+        // doc 4 after seeking back to doc 3 is batch read too
+        INDEXLIB_TEST_EQUAL((size_t)5, mSegReaders[0]->mBatchReadDocCount);
+        INDEXLIB_TEST_EQUAL((size_t)49, mSegReaders[2]->mBatchReadDocCount);
+    }
+
 private:
     void CreateOneSegmentData(vector<int32_t>& dataVector, uint32_t docCount)
     {
@@ -304,5 +357,6 @@ INDEXLIB_UNIT_TEST_CASE(AttributeIteratorTypedTest, TestRandomSeekForOneSegment)
 INDEXLIB_UNIT_TEST_CASE(AttributeIteratorTypedTest, TestRandomSeekForMultiSegments);
 INDEXLIB_UNIT_TEST_CASE(AttributeIteratorTypedTest, TestSeekOutOfRange);
 INDEXLIB_UNIT_TEST_CASE(AttributeIteratorTypedTest, TestSeekWithBuildingReader);
+INDEXLIB_UNIT_TEST_CASE(AttributeIteratorTypedTest, TestBatchSeek);
 
 IE_NAMESPACE_END(index);
@@ -35,6 +35,35 @@ public:
         Check(reader, answer);
     }
 
+    void TestCaseForBlockMaxMin()
+    {
+        common::TypedSliceList<uint32_t> data(4, 2, &mPool);
+        SingleValueBlockMaxMin<uint32_t> blockMaxMin(&mPool);
+        uint32_t blockSize = blockMaxMin.GetBlockSize();
+        for (uint32_t i = 0; i < blockSize + 2; ++i)
+        {
+            uint32_t value = i + 10;
+            blockMaxMin.Append(data.Size(), value);
+            data.PushBack(value);
+        }
+        INDEXLIB_TEST_EQUAL(2u, blockMaxMin.GetBlockCount());
+
+        UInt32Reader reader(&data, config::CompressTypeOption(), &blockMaxMin);
+        INDEXLIB_TEST_EQUAL(&blockMaxMin, reader.GetBlockMaxMin());
+        uint32_t value = 1;
+        INDEXLIB_TEST_TRUE(reader.UpdateField(blockSize, (uint8_t*)&value, sizeof(value)));
+        uint32_t minValue = 0;
+        uint32_t maxValue = 0;
+        INDEXLIB_TEST_TRUE(blockMaxMin.Get(0, minValue, maxValue));
+        INDEXLIB_TEST_EQUAL(10u, minValue);
+        INDEXLIB_TEST_EQUAL(blockSize + 9, maxValue);
+        // updated value widens its block, the old value is still covered
+        INDEXLIB_TEST_TRUE(blockMaxMin.Get(1, minValue, maxValue));
+        INDEXLIB_TEST_EQUAL(1u, minValue);
+        INDEXLIB_TEST_EQUAL(blockSize + 11, maxValue);
+        INDEXLIB_TEST_TRUE(!blockMaxMin.Get(2, minValue, maxValue));
+    }
+
 private:
     void BuildData(common::TypedSliceList<uint32_t>& data, 
                    vector<uint32_t>& answer)
@@ -62,5 +91,6 @@ private:
 };
 
 INDEXLIB_UNIT_TEST_CASE(InMemSingleValueAttributeReaderTest, TestCaseForRead);
+INDEXLIB_UNIT_TEST_CASE(InMemSingleValueAttributeReaderTest, TestCaseForBlockMaxMin);
 
 IE_NAMESPACE_END(index);
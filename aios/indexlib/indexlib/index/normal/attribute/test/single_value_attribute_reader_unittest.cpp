@@ -9,6 +9,7 @@
 #include "indexlib/index/normal/attribute/test/attribute_writer_helper.h"
 #include "indexlib/index/normal/attribute/accessor/single_value_attribute_reader.h"
 #include "indexlib/index/normal/attribute/accessor/single_value_attribute_writer.h"
+#include "indexlib/index/normal/attribute/attribute_metrics.h"
 #include "indexlib/common/field_format/attribute/attribute_convertor_factory.h"
 #include "indexlib/partition/patch_loader.h"
 #include "indexlib/test/single_field_partition_data_provider.h"
@@ -208,6 +209,43 @@ public:
         ASSERT_FALSE(reader.Read(1, strValue));
     }
 
+    void TestOpenWithHintReader()
+    {
+        SingleFieldPartitionDataProvider provider;
+        provider.Init(mRoot, "uint32", SFP_ATTRIBUTE);
+        provider.Build("1,2,3", SFP_OFFLINE);
+        AttributeConfigPtr attrConfig = provider.GetAttributeConfig();
+        SingleValueAttributeReader<uint32_t> hintReader;
+        hintReader.Open(attrConfig, provider.GetPartitionData());
+
+        provider.Build("4,5", SFP_OFFLINE);
+        AttributeMetrics metrics;
+        SingleValueAttributeReader<uint32_t> reader(&metrics);
+        reader.Open(attrConfig, provider.GetPartitionData(), &hintReader);
+        ASSERT_EQ((size_t)2, reader.mSegmentReaders.size());
+        ASSERT_EQ(hintReader.mSegmentReaders[0], reader.mSegmentReaders[0]);
+        ASSERT_EQ((int64_t)1, metrics.GetReusedSegmentReaderCountValue());
+
+        uint32_t actualValue;
+        ASSERT_TRUE(reader.Read(1, actualValue));
+        ASSERT_EQ((uint32_t)2, actualValue);
+        ASSERT_TRUE(reader.Read(4, actualValue));
+        ASSERT_EQ((uint32_t)5, actualValue);
+
+        // update on new reader is applied to the shared segment reader
+        uint32_t updateValue = 10;
+        ASSERT_TRUE(reader.UpdateField(1, (uint8_t*)&updateValue, sizeof(uint32_t)));
+        ASSERT_TRUE(hintReader.Read(1, actualValue));
+        ASSERT_EQ(updateValue, actualValue);
+
+        // reader of other type is not used as hint
+        SingleValueAttributeReader<uint32_t> noHintReader(&metrics);
+        SingleValueAttributeReader<int32_t> otherTypeReader;
+        noHintReader.Open(attrConfig, provider.GetPartitionData(), &otherTypeReader);
+        ASSERT_NE(hintReader.mSegmentReaders[0], noHintReader.mSegmentReaders[0]);
+        ASSERT_EQ((int64_t)1, metrics.GetReusedSegmentReaderCountValue());
+    }
+
     void TestCaseForUpdateBuildingSegmentReader()
     {
         SingleFieldPartitionDataProvider provider;
@@ -502,5 +540,6 @@ INDEXLIB_UNIT_TEST_CASE(SingleValueAttributeReaderTest, TestCaseForUpdateFieldWi
 INDEXLIB_UNIT_TEST_CASE(SingleValueAttributeReaderTest, TestCaseForUpdateFieldWithPatch);
 INDEXLIB_UNIT_TEST_CASE(SingleValueAttributeReaderTest, TestCaseForReadBuildingSegmentReader);
 INDEXLIB_UNIT_TEST_CASE(SingleValueAttributeReaderTest, TestCaseForUpdateBuildingSegmentReader);
+INDEXLIB_UNIT_TEST_CASE(SingleValueAttributeReaderTest, TestOpenWithHintReader);
     
 IE_NAMESPACE_END(index);
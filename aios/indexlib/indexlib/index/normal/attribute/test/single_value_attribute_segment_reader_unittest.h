@@ -165,6 +165,14 @@ void SingleValueAttributeSegmentReaderTest::UpdateAndCheck(uint32_t segCount,
     std::map<docid_t, T> toUpdateDocs;
     MakeUpdateData(toUpdateDocs);
 
+    docid_t beginDocId = INVALID_DOCID;
+    docid_t endDocId = INVALID_DOCID;
+    T minValue = T();
+    T maxValue = T();
+    // patches are loaded by update field
+    INDEXLIB_TEST_EQUAL(segCount > 1, segReader.GetUpdatedRange(
+                    beginDocId, endDocId, minValue, maxValue));
+
     // update field
     typename std::map<docid_t, T>::iterator it = toUpdateDocs.begin();
     for (; it != toUpdateDocs.end(); it++)
@@ -176,6 +184,20 @@ void SingleValueAttributeSegmentReaderTest::UpdateAndCheck(uint32_t segCount,
     }
 
     CheckRead(expectedData, segReader);
+
+    INDEXLIB_TEST_TRUE(segReader.GetUpdatedRange(
+                    beginDocId, endDocId, minValue, maxValue));
+    INDEXLIB_TEST_TRUE(beginDocId <= toUpdateDocs.begin()->first);
+    INDEXLIB_TEST_TRUE(endDocId > toUpdateDocs.rbegin()->first);
+    for (it = toUpdateDocs.begin(); it != toUpdateDocs.end(); it++)
+    {
+        INDEXLIB_TEST_TRUE(minValue <= it->second && it->second <= maxValue);
+    }
+    if (segCount == 1)
+    {
+        INDEXLIB_TEST_EQUAL(toUpdateDocs.begin()->first, beginDocId);
+        INDEXLIB_TEST_EQUAL(toUpdateDocs.rbegin()->first + 1, endDocId);
+    }
 }
 
 template<typename T>
@@ -371,12 +393,27 @@ template<typename T>
 void SingleValueAttributeSegmentReaderTest::CheckRead(const std::vector<T>& expectedData, 
                const SingleValueAttributeSegmentReader<T>& segReader)
 {
+    std::vector<docid_t> docIds;
     for (size_t i = 0; i < expectedData.size(); i++)
     {
         T value;
         segReader.Read(i, value);
         INDEXLIB_TEST_EQUAL(expectedData[i], value);
+        if (i % 3 != 1)
+        {
+            docIds.push_back(i);
+        }
+    }
+
+    std::vector<T> values(docIds.size());
+    INDEXLIB_TEST_TRUE(segReader.BatchRead(docIds.data(), docIds.size(), values.data()));
+    for (size_t i = 0; i < docIds.size(); i++)
+    {
+        INDEXLIB_TEST_EQUAL(expectedData[docIds[i]], values[i]);
     }
+    docIds.push_back(expectedData.size());
+    values.resize(docIds.size());
+    INDEXLIB_TEST_TRUE(!segReader.BatchRead(docIds.data(), docIds.size(), values.data()));
 }
 
 template<typename T>
@@ -97,6 +97,96 @@ uint32_t DeletionMapReader::GetDeletedDocCount(segmentid_t segId) const
     return 0;
 }
 
+size_t DeletionMapReader::GetUndeletedDocIds(
+        docid_t beginDocId, docid_t endDocId, docid_t* docIds) const
+{
+    size_t count = 0;
+    docid_t bitmapEnd = min(endDocId, mInMemBaseDocId);
+    docid_t docId = beginDocId;
+    if (docId < bitmapEnd)
+    {
+        // one slot (32 docs) at a time: skip fully deleted slots,
+        // emit fully undeleted slots as a sequence, extract set bits otherwise
+        const uint32_t* data = mBitmap->GetData();
+        while (docId < bitmapEnd)
+        {
+            uint32_t slot = (uint32_t)docId >> Bitmap::SLOT_SIZE_BIT_NUM;
+            docid_t slotBase = (docid_t)(slot << Bitmap::SLOT_SIZE_BIT_NUM);
+            uint32_t lo = docId - slotBase;
+            uint32_t hi = min(bitmapEnd - slotBase, (docid_t)Bitmap::SLOT_SIZE);
+            uint32_t mask = (0xFFFFFFFF >> lo);
+            if (hi < Bitmap::SLOT_SIZE)
+            {
+                mask &= ~(0xFFFFFFFF >> hi);
+            }
+            uint32_t undeleted = ~data[slot] & mask;
+            if (undeleted == mask)
+            {
+                for (uint32_t i = lo; i < hi; ++i)
+                {
+                    docIds[count++] = slotBase + i;
+                }
+            }
+            else
+            {
+                while (undeleted)
+                {
+                    uint32_t pos = __builtin_clz(undeleted);
+                    docIds[count++] = slotBase + pos;
+                    undeleted &= ~(0x80000000 >> pos);
+                }
+            }
+            docId = slotBase + hi;
+        }
+    }
+    for (; docId < endDocId; ++docId)
+    {
+        docIds[count] = docId;
+        count += !IsDeleted(docId);
+    }
+    return count;
+}
+
+docid_t DeletionMapReader::NextUndeleted(docid_t docId) const
+{
+    if (docId < mInMemBaseDocId)
+    {
+        // skip fully deleted slots (32 docs) by one word compare
+        const uint32_t* data = mBitmap->GetData();
+        uint32_t slot = (uint32_t)docId >> Bitmap::SLOT_SIZE_BIT_NUM;
+        uint32_t slotCount = ((uint32_t)mInMemBaseDocId + Bitmap::SLOT_SIZE - 1)
+                             >> Bitmap::SLOT_SIZE_BIT_NUM;
+        uint32_t undeleted = ~data[slot] & (0xFFFFFFFF >> (docId & Bitmap::SLOT_SIZE_BIT_MASK));
+        while (!undeleted && ++slot < slotCount)
+        {
+            undeleted = ~data[slot];
+        }
+        if (undeleted)
+        {
+            docid_t nextDocId = (docid_t)(slot << Bitmap::SLOT_SIZE_BIT_NUM)
+                                + __builtin_clz(undeleted);
+            // bits beyond bitmap item count are not docs
+            if (nextDocId < mInMemBaseDocId)
+            {
+                return nextDocId;
+            }
+        }
+        docId = mInMemBaseDocId;
+    }
+    if (mInMemDeletionMapReader)
+    {
+        docid_t endDocId = mInMemBaseDocId + mInMemDeletionMapReader->GetDocCount();
+        for (; docId < endDocId; ++docId)
+        {
+            if (!IsDeleted(docId))
+            {
+                return docId;
+            }
+        }
+    }
+    return INVALID_DOCID;
+}
+
 const ExpandableBitmap* DeletionMapReader::GetSegmentDeletionMap(segmentid_t segId) const
 {
     return mWriter.GetSegmentDeletionMap(segId);
@@ -29,10 +29,23 @@ public:
 
     uint32_t GetDeletedDocCount() const;
     virtual uint32_t GetDeletedDocCount(segmentid_t segId) const;
+    // global bitmap copied from segment deletion maps, owned by this reader
+    size_t GetUsedBytes() const { return mBitmap ? mBitmap->Size() : 0; }
 
     inline bool Delete(docid_t docId);
     inline bool IsDeleted(docid_t docId) const;
 
+    // write undeleted docids in [beginDocId, endDocId) to docIds in ascending order,
+    // docIds should have room for (endDocId - beginDocId) docids, return written count
+    size_t GetUndeletedDocIds(docid_t beginDocId, docid_t endDocId,
+                              docid_t* docIds) const;
+    // return the first undeleted docid not less than docId,
+    // INVALID_DOCID if all docs from docId on are deleted
+    docid_t NextUndeleted(docid_t docId) const;
+    // remove deleted docids from docIds in place, keep the original order,
+    // return remaining count
+    inline size_t FilterDeleted(docid_t* docIds, size_t count) const;
+
 public:
     inline bool Delete(segmentid_t segId, docid_t localDocId);
     inline bool IsDeleted(segmentid_t segId, docid_t localDocId) const;
@@ -91,6 +104,30 @@ inline bool DeletionMapReader::IsDeleted(docid_t docId) const
     return mBitmap->Test(docId);
 }
 
+inline size_t DeletionMapReader::FilterDeleted(docid_t* docIds, size_t count) const
+{
+    const uint32_t* data = mBitmap ? mBitmap->GetData() : NULL;
+    size_t left = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        docid_t docId = docIds[i];
+        bool deleted;
+        if (likely(docId < mInMemBaseDocId))
+        {
+            deleted = (data[docId >> util::Bitmap::SLOT_SIZE_BIT_NUM]
+                       << (docId & util::Bitmap::SLOT_SIZE_BIT_MASK)) & 0x80000000;
+        }
+        else
+        {
+            deleted = IsDeleted(docId);
+        }
+        // branchless compaction, docIds[left] is overwritten by next doc when deleted
+        docIds[left] = docId;
+        left += !deleted;
+    }
+    return left;
+}
+
 inline bool DeletionMapReader::IsDeleted(
         segmentid_t segId, docid_t localDocId) const
 {
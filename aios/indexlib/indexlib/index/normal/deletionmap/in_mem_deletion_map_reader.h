@@ -45,6 +45,9 @@ public:
     segmentid_t GetInMemSegmentId() const
     { return mSegId; }
 
+    uint32_t GetDocCount() const
+    { return mSegmentInfo->docCount; }
+
     util::ExpandableBitmap* GetBitmap() const { return mBitmap; }
 
 private:
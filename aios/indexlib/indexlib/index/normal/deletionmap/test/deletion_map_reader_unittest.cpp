@@ -147,6 +147,102 @@ void DeletionMapReaderTest::TestCaseForMultiInMemorySegments()
                 "0:true;1:true;2:false;3:true;4:false;5:false;6:false;7:false;8:true;9:false");
 }
 
+void DeletionMapReaderTest::TestGetUndeletedDocIds()
+{
+    // docs [0, 100) in bitmap, docs >= 100 are treated as deleted
+    DeletionMapReader reader(100);
+    // slot 1 [32, 64) is fully deleted
+    for (docid_t docId = 32; docId < 64; ++docId)
+    {
+        reader.mBitmap->Set(docId);
+    }
+    reader.mBitmap->Set(3);
+    reader.mBitmap->Set(31);
+    reader.mBitmap->Set(64);
+    reader.mBitmap->Set(99);
+
+    vector<docid_t> expectDocIds;
+    vector<docid_t> docIds(200);
+    for (docid_t begin = 0; begin < 110; begin += 7)
+    {
+        for (docid_t end = begin; end < 110; end += 5)
+        {
+            expectDocIds.clear();
+            for (docid_t docId = begin; docId < end; ++docId)
+            {
+                if (!reader.IsDeleted(docId))
+                {
+                    expectDocIds.push_back(docId);
+                }
+            }
+            size_t count = reader.GetUndeletedDocIds(begin, end, docIds.data());
+            ASSERT_EQ(expectDocIds,
+                      vector<docid_t>(docIds.begin(), docIds.begin() + count))
+                << begin << "," << end;
+        }
+    }
+
+    size_t count = reader.GetUndeletedDocIds(0, 100, docIds.data());
+    ASSERT_EQ((size_t)(100 - 36), count);
+    ASSERT_EQ((docid_t)2, docIds[2]);
+    ASSERT_EQ((docid_t)4, docIds[3]);
+    ASSERT_EQ((docid_t)30, docIds[29]);
+    ASSERT_EQ((docid_t)65, docIds[30]);
+    ASSERT_EQ((docid_t)98, docIds[count - 1]);
+}
+
+void DeletionMapReaderTest::TestNextUndeleted()
+{
+    // docs [0, 100) in bitmap, docs >= 100 are treated as deleted
+    DeletionMapReader reader(100);
+    // slot 1 [32, 64) is fully deleted, so is [96, 100)
+    for (docid_t docId = 32; docId < 64; ++docId)
+    {
+        reader.mBitmap->Set(docId);
+    }
+    for (docid_t docId = 96; docId < 100; ++docId)
+    {
+        reader.mBitmap->Set(docId);
+    }
+    reader.mBitmap->Set(3);
+    reader.mBitmap->Set(30);
+    reader.mBitmap->Set(31);
+    reader.mBitmap->Set(64);
+
+    for (docid_t docId = 0; docId < 110; ++docId)
+    {
+        docid_t expectDocId = docId;
+        while (expectDocId < 100 && reader.IsDeleted(expectDocId))
+        {
+            ++expectDocId;
+        }
+        if (expectDocId >= 100)
+        {
+            expectDocId = INVALID_DOCID;
+        }
+        ASSERT_EQ(expectDocId, reader.NextUndeleted(docId)) << docId;
+    }
+    ASSERT_EQ((docid_t)65, reader.NextUndeleted(30));
+    ASSERT_EQ(INVALID_DOCID, reader.NextUndeleted(96));
+}
+
+void DeletionMapReaderTest::TestFilterDeleted()
+{
+    DeletionMapReader reader(100);
+    reader.mBitmap->Set(0);
+    reader.mBitmap->Set(33);
+    reader.mBitmap->Set(50);
+
+    docid_t docIds[] = { 0, 1, 33, 34, 50, 50, 99, 100, 120 };
+    size_t count = reader.FilterDeleted(docIds, sizeof(docIds) / sizeof(docIds[0]));
+    // docs not in bitmap and without building segment are deleted
+    ASSERT_EQ((size_t)3, count);
+    ASSERT_EQ((docid_t)1, docIds[0]);
+    ASSERT_EQ((docid_t)34, docIds[1]);
+    ASSERT_EQ((docid_t)99, docIds[2]);
+    ASSERT_EQ((size_t)0, reader.FilterDeleted(docIds, 0));
+}
+
 void DeletionMapReaderTest::InnerTestDeletionmapReadAndWrite(
         uint32_t segmentDocCount, const string& toDeleteDocs,
         const string& deletedDocs, const PartitionDataPtr& partitionData)
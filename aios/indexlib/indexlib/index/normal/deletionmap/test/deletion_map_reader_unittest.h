@@ -26,6 +26,9 @@ public:
     void TestCaseForGetDeletedDocCount();
     void TestCaseForReaderDelete();
     void TestCaseForMultiInMemorySegments();
+    void TestGetUndeletedDocIds();
+    void TestNextUndeleted();
+    void TestFilterDeleted();
 
 private:
     void InnerTestDeletionmapReadAndWrite(
@@ -51,6 +54,9 @@ INDEXLIB_UNIT_TEST_CASE(DeletionMapReaderTest, TestCaseForReadAndWrite);
 INDEXLIB_UNIT_TEST_CASE(DeletionMapReaderTest, TestCaseForGetDeletedDocCount);
 INDEXLIB_UNIT_TEST_CASE(DeletionMapReaderTest, TestCaseForReaderDelete);
 INDEXLIB_UNIT_TEST_CASE(DeletionMapReaderTest, TestCaseForMultiInMemorySegments);
+INDEXLIB_UNIT_TEST_CASE(DeletionMapReaderTest, TestGetUndeletedDocIds);
+INDEXLIB_UNIT_TEST_CASE(DeletionMapReaderTest, TestNextUndeleted);
+INDEXLIB_UNIT_TEST_CASE(DeletionMapReaderTest, TestFilterDeleted);
 
 IE_NAMESPACE_END(index);
 
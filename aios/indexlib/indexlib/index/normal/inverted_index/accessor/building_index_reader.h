@@ -6,6 +6,8 @@
 #include "indexlib/common_define.h"
 #include "indexlib/index/normal/inverted_index/accessor/index_segment_reader.h"
 #include "indexlib/index/normal/inverted_index/accessor/segment_posting.h"
+#include "indexlib/index/normal/inverted_index/accessor/segment_postings.h"
+#include "indexlib/index/normal/inverted_index/format/dictionary/ordered_term_iterator.h"
 #include "indexlib/index/normal/inverted_index/format/posting_format_option.h"
 
 IE_NAMESPACE_BEGIN(index);
@@ -44,6 +46,42 @@ public:
         }
     }
 
+    // one SegmentPostings of all the keys per segment
+    void GetSegmentPostings(const std::vector<dictkey_t>& keys,
+                            SegmentPostingsVec& segPostingsVec,
+                            autil::mem_pool::Pool* sessionPool) const
+    {
+        for (size_t i = 0; i < mInnerSegReaders.size(); ++i)
+        {
+            SegmentPostingsPtr segPostings(new SegmentPostings);
+            for (size_t j = 0; j < keys.size(); ++j)
+            {
+                index::SegmentPosting segPosting(mPostingFormatOption);
+                if (mInnerSegReaders[i].second->GetSegmentPosting(
+                                keys[j], mInnerSegReaders[i].first, segPosting, sessionPool))
+                {
+                    segPostings->AddSegmentPosting(segPosting);
+                }
+            }
+            if (!segPostings->GetSegmentPostings().empty())
+            {
+                segPostingsVec.push_back(segPostings);
+            }
+        }
+    }
+
+    void CreateOrderedTermIterators(std::vector<OrderedTermIteratorPtr>& iters) const
+    {
+        for (size_t i = 0; i < mInnerSegReaders.size(); ++i)
+        {
+            OrderedTermIteratorPtr iter = mInnerSegReaders[i].second->CreateOrderedTermIterator();
+            if (iter)
+            {
+                iters.push_back(iter);
+            }
+        }
+    }
+
     size_t GetSegmentCount() const { return mInnerSegReaders.size(); }
 
 protected:
@@ -18,6 +18,18 @@ public:
     virtual ~DocValueFilter() {}
 public:
     virtual bool Test(docid_t docid) = 0;
+    // test docIds[0, count), mask[i] is set to 1 if docIds[i] passes,
+    // return passed count
+    virtual size_t BatchTest(const docid_t* docIds, size_t count, uint8_t* mask)
+    {
+        size_t passCount = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            mask[i] = Test(docIds[i]) ? 1 : 0;
+            passCount += mask[i];
+        }
+        return passCount;
+    }
     virtual DocValueFilter* Clone() const = 0;
     autil::mem_pool::Pool* GetSessionPool() const {
         return mSessionPool;
@@ -85,6 +97,38 @@ public:
         }
         return mLeft <= (int64_t)value && (int64_t)value <= mRight;
     }
+
+    size_t BatchTest(const docid_t* docIds, size_t count, uint8_t* mask) override
+    {
+        if (!mAttrIter)
+        {
+            memset(mask, 0, count);
+            return 0;
+        }
+        // values are gathered first, then compared without branch
+        // block by block, so that the compare loop can be vectorized
+        T values[BATCH_BLOCK_SIZE];
+        bool exists[BATCH_BLOCK_SIZE];
+        size_t passCount = 0;
+        for (size_t begin = 0; begin < count; begin += BATCH_BLOCK_SIZE)
+        {
+            size_t blockSize = count - begin;
+            if (blockSize > BATCH_BLOCK_SIZE)
+            {
+                blockSize = BATCH_BLOCK_SIZE;
+            }
+            mAttrIter->BatchSeek(docIds + begin, blockSize, values, exists);
+            uint8_t* blockMask = mask + begin;
+            for (size_t i = 0; i < blockSize; ++i)
+            {
+                int64_t value = (int64_t)values[i];
+                blockMask[i] = (uint8_t)exists[i] & (uint8_t)(mLeft <= value)
+                               & (uint8_t)(value <= mRight);
+                passCount += blockMask[i];
+            }
+        }
+        return passCount;
+    }
     
     DocValueFilter* Clone() const override
     {
@@ -92,6 +136,9 @@ public:
             mSessionPool, NumberDocValueFilterTyped<T>, *this);
     }
     
+private:
+    static const size_t BATCH_BLOCK_SIZE = 64;
+
 private:
     int64_t mLeft;
     int64_t mRight;
@@ -5,6 +5,7 @@
 #include "indexlib/index/normal/inverted_index/accessor/posting_writer.h"
 #include "indexlib/index/normal/inverted_index/accessor/index_writer.h"
 #include "indexlib/index/normal/inverted_index/accessor/segment_posting.h"
+#include "indexlib/index/normal/inverted_index/format/dictionary/in_mem_ordered_term_dictionary.h"
 
 using namespace std;
 using namespace autil::mem_pool;
@@ -49,5 +50,14 @@ bool InMemNormalIndexSegmentReader::GetSegmentPosting(
     return true; 
 }
 
+OrderedTermIteratorPtr InMemNormalIndexSegmentReader::CreateOrderedTermIterator() const
+{
+    if (!mOrderedTermDictionary)
+    {
+        return OrderedTermIteratorPtr();
+    }
+    return mOrderedTermDictionary->CreateIterator();
+}
+
 IE_NAMESPACE_END(index);
 
@@ -9,6 +9,7 @@
 #include "indexlib/util/hash_map.h"
 
 DECLARE_REFERENCE_CLASS(index, PostingWriter);
+DECLARE_REFERENCE_CLASS(index, InMemOrderedTermDictionary);
 
 IE_NAMESPACE_BEGIN(index);
 
@@ -37,11 +38,17 @@ public:
                            index::SegmentPosting &segPosting,
                            autil::mem_pool::Pool* sessionPool) const override;
 
+    index::OrderedTermIteratorPtr CreateOrderedTermIterator() const override;
+
+    void SetOrderedTermDictionary(const index::InMemOrderedTermDictionaryPtr& dictionary)
+    { mOrderedTermDictionary = dictionary; }
+
 private:
     const PostingTable* mPostingTable;
     index::AttributeSegmentReaderPtr mSectionSegmentReader;
     index::InMemBitmapIndexSegmentReaderPtr mBitmapSegmentReader;
     index::IndexFormatOption mIndexFormatOption;
+    index::InMemOrderedTermDictionaryPtr mOrderedTermDictionary;
     
 private:
     friend class InMemNormalIndexSegmentReaderTest;
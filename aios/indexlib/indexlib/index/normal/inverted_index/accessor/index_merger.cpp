@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <unordered_set>
 #include "indexlib/index/normal/inverted_index/accessor/index_merger.h"
 #include "indexlib/index/segment_directory_base.h"
@@ -7,6 +8,9 @@
 #include "indexlib/index/normal/inverted_index/format/dictionary/dictionary_creator.h"
 #include "indexlib/index/normal/inverted_index/format/short_list_optimize_util.h"
 #include "indexlib/index/normal/inverted_index/format/dictionary/dictionary_typed_factory.h"
+#include "indexlib/index/normal/inverted_index/format/dictionary/ordered_term_dictionary_reader.h"
+#include "indexlib/index/normal/inverted_index/format/dictionary/ordered_term_dictionary_writer.h"
+#include "indexlib/index/normal/inverted_index/format/dictionary/ordered_term_matcher.h"
 #include "indexlib/index/normal/inverted_index/format/posting_format.h"
 #include "indexlib/index/normal/inverted_index/truncate/truncate_posting_iterator_creator.h"
 #include "indexlib/index/normal/inverted_index/builtin_index/bitmap/bitmap_posting_merger.h"
@@ -288,6 +292,112 @@ void IndexMerger::InnerMerge(const index::MergerResource& resource,
         mTermExtender.reset();
     }
     EndMerge();
+    if (mIndexConfig->HasOrderedTermDictionary())
+    {
+        MergeOrderedTermDictionary(segMergeInfos, outputSegMergeInfos);
+    }
+}
+
+void IndexMerger::MergeOrderedTermDictionary(
+        const SegmentMergeInfos& segMergeInfos,
+        const OutputSegmentMergeInfos& outputSegMergeInfos)
+{
+    vector<OrderedTermDictionaryReaderPtr> readers;
+    vector<OrderedTermIteratorPtr> iters;
+    const index_base::PartitionDataPtr& partData = mSegmentDirectory->GetPartitionData();
+    for (size_t i = 0; i < segMergeInfos.size(); ++i)
+    {
+        if (segMergeInfos[i].segmentInfo.docCount == 0)
+        {
+            continue;
+        }
+        index_base::SegmentData segData = partData->GetSegmentData(segMergeInfos[i].segmentId);
+        DirectoryPtr indexDirectory = segData.GetIndexDirectory(mIndexConfig->GetIndexName(), false);
+        if (!indexDirectory || !indexDirectory->IsExist(ORDERED_TERM_DICTIONARY_FILE_NAME))
+        {
+            continue;
+        }
+        OrderedTermDictionaryReaderPtr reader(new OrderedTermDictionaryReader);
+        reader->Open(indexDirectory, ORDERED_TERM_DICTIONARY_FILE_NAME);
+        OrderedTermIteratorPtr iter = reader->CreateIterator();
+        if (iter->IsValid())
+        {
+            readers.push_back(reader);
+            iters.push_back(iter);
+        }
+    }
+
+    for (size_t i = 0; i < outputSegMergeInfos.size(); ++i)
+    {
+        DirectoryPtr mergeDir = GetMergeDir(outputSegMergeInfos[i].directory, false);
+        if (!mergeDir->IsExist(DICTIONARY_FILE_NAME))
+        {
+            continue;
+        }
+        // disk dictionary readers only support iterating, keys are kept
+        // in a sorted vector, 8 bytes per key, see EstimateMemoryUse
+        vector<dictkey_t> outputKeys;
+        unique_ptr<DictionaryReader> dictReader(DictionaryCreator::CreateDiskReader(mIndexConfig));
+        dictReader->Open(mergeDir, DICTIONARY_FILE_NAME);
+        DictionaryIteratorPtr dictIter = dictReader->CreateIterator();
+        dictkey_t key;
+        dictvalue_t value;
+        while (dictIter->HasNext())
+        {
+            dictIter->Next(key, value);
+            outputKeys.push_back(key);
+        }
+        dictIter.reset();
+        dictReader.reset();
+        // tiered dictionary is already sorted by key, hash dictionary is not
+        if (!is_sorted(outputKeys.begin(), outputKeys.end()))
+        {
+            sort(outputKeys.begin(), outputKeys.end());
+        }
+
+        for (size_t j = 0; j < iters.size(); ++j)
+        {
+            iters[j]->Seek(ConstString());
+        }
+        OrderedTermDictionaryWriter writer;
+        writer.Open(mergeDir, ORDERED_TERM_DICTIONARY_FILE_NAME);
+        while (true)
+        {
+            // k-way merge, source segments are few
+            int minIdx = -1;
+            for (size_t j = 0; j < iters.size(); ++j)
+            {
+                if (iters[j]->IsValid() && (minIdx < 0 ||
+                        OrderedTermMatcher::Compare(iters[j]->GetTerm(),
+                                iters[minIdx]->GetTerm()) < 0))
+                {
+                    minIdx = j;
+                }
+            }
+            if (minIdx < 0)
+            {
+                break;
+            }
+            ConstString minTerm = iters[minIdx]->GetTerm();
+            string term(minTerm.data(), minTerm.size());
+            dictkey_t termKey = iters[minIdx]->GetKey();
+            for (size_t j = 0; j < iters.size(); ++j)
+            {
+                while (iters[j]->IsValid() &&
+                       OrderedTermMatcher::Compare(iters[j]->GetTerm(), ConstString(term)) == 0)
+                {
+                    iters[j]->Next();
+                }
+            }
+            if (binary_search(outputKeys.begin(), outputKeys.end(), termKey))
+            {
+                writer.AddTerm(ConstString(term), termKey);
+            }
+        }
+        writer.Close();
+        IE_LOG(INFO, "merge ordered term dictionary of index [%s], term count [%u]",
+               mIndexConfig->GetIndexName().c_str(), writer.GetTermCount());
+    }
 }
 
 void IndexMerger::EndMerge()
@@ -344,6 +454,14 @@ int64_t IndexMerger::EstimateMemoryUse(
     {
         size += GetHashDictMaxMemoryUse(segDir, segMergeInfos);
     }
+
+    if (mIndexConfig->HasOrderedTermDictionary())
+    {
+        int64_t orderedTermDictMemUse = GetOrderedTermDictMemoryUse(segDir, segMergeInfos);
+        size += orderedTermDictMemUse;
+        IE_LOG(INFO, "IndexMerger EstimateMemoryUse: orderedTermDictMemUse [%f MB]",
+               (double)orderedTermDictMemUse/1024/1024);
+    }
     
     if (!mTruncateIndexWriter && !mAdaptiveBitmapIndexWriter)
     {
@@ -403,6 +521,40 @@ int64_t IndexMerger::GetHashDictMaxMemoryUse(
     return size;
 }
 
+int64_t IndexMerger::GetOrderedTermDictMemoryUse(
+        const SegmentDirectoryBasePtr& segDir,
+        const index_base::SegmentMergeInfos& segMergeInfos) const
+{
+    // source ordered term dictionaries may be read into memory, and the
+    // sorted keys of an output dictionary take at most half of the source
+    // dictionaries, whose items are at least a 8 byte key and a 8 byte value
+    int64_t size = 0;
+    const index_base::PartitionDataPtr& partData = segDir->GetPartitionData();
+    for (uint32_t i = 0; i < segMergeInfos.size(); i++)
+    {
+        if (segMergeInfos[i].segmentInfo.docCount == 0)
+        {
+            continue;
+        }
+        index_base::SegmentData segData = partData->GetSegmentData(segMergeInfos[i].segmentId);
+        file_system::DirectoryPtr indexDirectory =
+            segData.GetIndexDirectory(mIndexConfig->GetIndexName(), false);
+        if (!indexDirectory)
+        {
+            continue;
+        }
+        if (indexDirectory->IsExist(ORDERED_TERM_DICTIONARY_FILE_NAME))
+        {
+            size += indexDirectory->GetFileLength(ORDERED_TERM_DICTIONARY_FILE_NAME);
+        }
+        if (indexDirectory->IsExist(DICTIONARY_FILE_NAME))
+        {
+            size += indexDirectory->GetFileLength(DICTIONARY_FILE_NAME) / 2;
+        }
+    }
+    return size;
+}
+
 int64_t IndexMerger::GetMaxLengthOfPosting(
         const index_base::SegmentData& segData) const
 {
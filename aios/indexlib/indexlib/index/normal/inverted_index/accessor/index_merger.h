@@ -131,6 +131,9 @@ protected:
     int64_t GetHashDictMaxMemoryUse(const SegmentDirectoryBasePtr& segDir,
                                     const index_base::SegmentMergeInfos& segMergeInfos) const;
 
+    int64_t GetOrderedTermDictMemoryUse(const SegmentDirectoryBasePtr& segDir,
+            const index_base::SegmentMergeInfos& segMergeInfos) const;
+
     // virtual void SetMergeIOConfig(const config::MergeIOConfig &ioConfig)
     // {
     //     mIOConfig = ioConfig;
@@ -186,6 +189,11 @@ protected:
 
     size_t GetDictKeyCount(const index_base::SegmentMergeInfos& segMergeInfos) const;
 
+    // after postings are merged, keep the source terms whose key is in the
+    // dictionary of each output segment
+    void MergeOrderedTermDictionary(const index_base::SegmentMergeInfos& segMergeInfos,
+            const index_base::OutputSegmentMergeInfos& outputSegMergeInfos);
+
 protected:
     SegmentDirectoryBasePtr mSegmentDirectory;
     config::IndexConfigPtr mIndexConfig;
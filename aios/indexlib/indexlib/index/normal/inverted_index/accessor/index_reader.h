@@ -40,6 +40,13 @@ public:
                       const index_base::PartitionDataPtr& partitionData)
     { assert(false); }
 
+    // hintReader: reader of the same index in last partition reader,
+    // segment readers of unchanged segments may be shared with it
+    virtual void Open(const config::IndexConfigPtr& indexConfig,
+                      const index_base::PartitionDataPtr& partitionData,
+                      const IndexReader* hintReader)
+    { Open(indexConfig, partitionData); }
+
     /**
      * Lookup a term in inverted index
      * @param term term to lookup
@@ -8,6 +8,7 @@
 DECLARE_REFERENCE_CLASS(index, InMemBitmapIndexSegmentReader);
 DECLARE_REFERENCE_CLASS(index, SegmentPosting);
 DECLARE_REFERENCE_CLASS(index, AttributeSegmentReader);
+DECLARE_REFERENCE_CLASS(index, OrderedTermIterator);
 
 IE_NAMESPACE_BEGIN(index);
 
@@ -28,6 +29,10 @@ public:
                                    autil::mem_pool::Pool* sessionPool) const
     { return false; }
 
+    // null if the index has no ordered term dictionary
+    virtual index::OrderedTermIteratorPtr CreateOrderedTermIterator() const
+    { return index::OrderedTermIteratorPtr(); }
+
 private:
     IE_LOG_DECLARE();
 };
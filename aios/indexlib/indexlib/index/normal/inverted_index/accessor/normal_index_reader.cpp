@@ -7,6 +7,7 @@
 #include "indexlib/index/normal/inverted_index/accessor/building_index_reader.h"
 #include "indexlib/index/normal/inverted_index/accessor/index_accessory_reader.h"
 #include "indexlib/index/normal/inverted_index/accessor/doc_range_partitioner.h"
+#include "indexlib/index/normal/inverted_index/accessor/range_posting_iterator.h"
 #include "indexlib/index/normal/inverted_index/builtin_index/bitmap/bitmap_index_reader.h"
 #include "indexlib/index/normal/attribute/accessor/section_attribute_reader_impl.h"
 #include "indexlib/index_base/partition_data.h"
@@ -17,6 +18,7 @@
 #include "indexlib/misc/exception.h"
 #include "indexlib/util/future_executor.h"
 #include <future_lite/MoveWrapper.h>
+#include <typeinfo>
 
 using namespace std;
 using namespace autil;
@@ -40,6 +42,7 @@ NormalIndexReader::NormalIndexReader()
     : mBitmapIndexReader(NULL)
     , mMultiFieldIndexReader(NULL)
     , mExecutor(nullptr)
+    , mHintReader(NULL)
 {
 }
 
@@ -65,6 +68,7 @@ NormalIndexReader::NormalIndexReader(const NormalIndexReader& other)
     }
     mMultiFieldIndexReader = NULL;
     mBuildingIndexReader = other.mBuildingIndexReader;
+    mHintReader = NULL;
 }
 
 NormalIndexReader::~NormalIndexReader()
@@ -539,6 +543,44 @@ void NormalIndexReader::Open(const config::IndexConfigPtr& indexConfig,
     }
 }
 
+void NormalIndexReader::Open(const config::IndexConfigPtr& indexConfig,
+                             const index_base::PartitionDataPtr& partitionData,
+                             const IndexReader* hintReader)
+{
+    // subclasses extend Open without hint reader, keep the hint for
+    // LoadSegments while going through it
+    if (hintReader && typeid(*hintReader) == typeid(*this))
+    {
+        mHintReader = static_cast<const NormalIndexReader*>(hintReader);
+    }
+    Open(indexConfig, partitionData);
+    mHintReader = NULL;
+}
+
+NormalIndexSegmentReaderPtr NormalIndexReader::GetHintSegmentReader(
+        const SegmentData& segData) const
+{
+    // built segment index is immutable, so it can be reused
+    // when its segment id and doc count are unchanged
+    if (!mHintReader || mHintReader->mIndexConfig != mIndexConfig)
+    {
+        return NormalIndexSegmentReaderPtr();
+    }
+    for (size_t i = 0; i < mHintReader->mSegmentReaders.size(); ++i)
+    {
+        const SegmentData& hintSegData = mHintReader->mSegmentReaders[i]->GetSegmentData();
+        if (hintSegData.GetSegmentId() == segData.GetSegmentId())
+        {
+            if (hintSegData.GetSegmentInfo().docCount == segData.GetSegmentInfo().docCount)
+            {
+                return mHintReader->mSegmentReaders[i];
+            }
+            break;
+        }
+    }
+    return NormalIndexSegmentReaderPtr();
+}
+
 bool NormalIndexReader::LoadSegments(const index_base::PartitionDataPtr& partitionData,
                                      vector<NormalIndexSegmentReaderPtr>& segmentReaders)
 {
@@ -554,7 +596,14 @@ bool NormalIndexReader::LoadSegments(const index_base::PartitionDataPtr& partiti
                 iter->MoveToNext();
                 continue;
             }
-            NormalIndexSegmentReaderPtr segmentReader = CreateSegmentReader();
+            NormalIndexSegmentReaderPtr segmentReader = GetHintSegmentReader(segData);
+            if (segmentReader)
+            {
+                segmentReaders.push_back(segmentReader);
+                iter->MoveToNext();
+                continue;
+            }
+            segmentReader = CreateSegmentReader();
             try
             {
                 segmentReader->Open(mIndexConfig, segData);
@@ -620,5 +669,128 @@ NormalIndexSegmentReaderPtr NormalIndexReader::CreateSegmentReader()
     return NormalIndexSegmentReaderPtr(new NormalIndexSegmentReader);
 }
 
+bool NormalIndexReader::MatchTerms(const TermMatchFunction& matchFunc, size_t maxTerms,
+                                   OrderedTermMatcher::TermKeyVector& terms) const
+{
+    vector<OrderedTermIteratorPtr> iters;
+    for (size_t i = 0; i < mSegmentReaders.size(); ++i)
+    {
+        OrderedTermIteratorPtr iter = mSegmentReaders[i]->CreateOrderedTermIterator();
+        if (iter)
+        {
+            iters.push_back(iter);
+        }
+    }
+    if (mBuildingIndexReader)
+    {
+        mBuildingIndexReader->CreateOrderedTermIterators(iters);
+    }
+
+    // the first maxTerms terms of all segments are in the first maxTerms
+    // terms of each segment
+    bool complete = true;
+    map<string, dictkey_t> mergedTerms;
+    for (size_t i = 0; i < iters.size(); ++i)
+    {
+        OrderedTermMatcher::TermKeyVector segTerms;
+        complete = matchFunc(iters[i], maxTerms, segTerms) && complete;
+        mergedTerms.insert(segTerms.begin(), segTerms.end());
+    }
+    for (map<string, dictkey_t>::const_iterator it = mergedTerms.begin();
+         it != mergedTerms.end(); ++it)
+    {
+        if (terms.size() >= maxTerms)
+        {
+            return false;
+        }
+        terms.push_back(*it);
+    }
+    return complete;
+}
+
+bool NormalIndexReader::RangeTerms(const ConstString& lower, bool lowerInclusive,
+                                   const ConstString& upper, bool upperInclusive,
+                                   size_t maxTerms, OrderedTermMatcher::TermKeyVector& terms) const
+{
+    return MatchTerms(
+            [&](const OrderedTermIteratorPtr& iter, size_t limit,
+                OrderedTermMatcher::TermKeyVector& segTerms) {
+                return OrderedTermMatcher::RangeMatch(iter, lower, lowerInclusive,
+                        upper, upperInclusive, limit, segTerms);
+            }, maxTerms, terms);
+}
+
+bool NormalIndexReader::PrefixTerms(const ConstString& prefix, size_t maxTerms,
+                                    OrderedTermMatcher::TermKeyVector& terms) const
+{
+    return MatchTerms(
+            [&](const OrderedTermIteratorPtr& iter, size_t limit,
+                OrderedTermMatcher::TermKeyVector& segTerms) {
+                return OrderedTermMatcher::PrefixMatch(iter, prefix, limit, segTerms);
+            }, maxTerms, terms);
+}
+
+bool NormalIndexReader::WildcardTerms(const ConstString& pattern, size_t maxTerms,
+                                      OrderedTermMatcher::TermKeyVector& terms) const
+{
+    return MatchTerms(
+            [&](const OrderedTermIteratorPtr& iter, size_t limit,
+                OrderedTermMatcher::TermKeyVector& segTerms) {
+                return OrderedTermMatcher::WildcardMatch(iter, pattern, limit, segTerms);
+            }, maxTerms, terms);
+}
+
+bool NormalIndexReader::FuzzyTerms(const ConstString& term, uint32_t maxEdits,
+                                   size_t prefixLength, size_t maxTerms,
+                                   OrderedTermMatcher::TermKeyVector& terms) const
+{
+    return MatchTerms(
+            [&](const OrderedTermIteratorPtr& iter, size_t limit,
+                OrderedTermMatcher::TermKeyVector& segTerms) {
+                return OrderedTermMatcher::FuzzyMatch(iter, term, maxEdits,
+                        prefixLength, limit, segTerms);
+            }, maxTerms, terms);
+}
+
+PostingIterator* NormalIndexReader::LookupTerms(const vector<dictkey_t>& keys,
+                                                autil::mem_pool::Pool* sessionPool)
+{
+    SegmentPostingsVec segPostingsVec;
+    PostingFormatOption formatOption = mIndexFormatOption.GetPostingFormatOption();
+    for (size_t i = 0; i < mSegmentReaders.size(); ++i)
+    {
+        SegmentPostingsPtr segPostings(new SegmentPostings);
+        for (size_t j = 0; j < keys.size(); ++j)
+        {
+            SegmentPosting segPosting(formatOption);
+            if (mSegmentReaders[i]->GetSegmentPosting(keys[j], 0, segPosting, sessionPool))
+            {
+                segPostings->AddSegmentPosting(segPosting);
+            }
+        }
+        if (!segPostings->GetSegmentPostings().empty())
+        {
+            segPostingsVec.push_back(segPostings);
+        }
+    }
+    if (mBuildingIndexReader)
+    {
+        mBuildingIndexReader->GetSegmentPostings(keys, segPostingsVec, sessionPool);
+    }
+    if (segPostingsVec.empty())
+    {
+        return NULL;
+    }
+
+    RangePostingIterator* iter = IE_POOL_COMPATIBLE_NEW_CLASS(sessionPool,
+            RangePostingIterator, formatOption, sessionPool);
+    if (!iter->Init(segPostingsVec))
+    {
+        IE_POOL_COMPATIBLE_DELETE_CLASS(sessionPool, iter);
+        return NULL;
+    }
+    return iter;
+}
+
 IE_NAMESPACE_END(index);
 
@@ -8,6 +8,8 @@
 #include "indexlib/index/normal/inverted_index/accessor/key_iterator_typed.h"
 #include "indexlib/index/normal/inverted_index/accessor/normal_index_segment_reader.h"
 #include "indexlib/index/normal/inverted_index/accessor/segment_posting.h"
+#include "indexlib/index/normal/inverted_index/format/dictionary/ordered_term_matcher.h"
+#include <functional>
 #include <future_lite/Future.h>
 #include <future_lite/Executor.h>
 
@@ -37,6 +39,10 @@ public:
     virtual void Open(const config::IndexConfigPtr& indexConfig,
                       const index_base::PartitionDataPtr& partitionData) override;
 
+    void Open(const config::IndexConfigPtr& indexConfig,
+              const index_base::PartitionDataPtr& partitionData,
+              const index::IndexReader* hintReader) override;
+
     
     const index::SectionAttributeReader* GetSectionReader(
             const std::string& indexName) const override;
@@ -84,6 +90,23 @@ public:
             dictkey_t key, uint32_t statePoolSize,
             autil::mem_pool::Pool *sessionPool);
 
+public:
+    // term enumeration of index with ordered term dictionary, terms of all
+    // segments are merged in byte order, return false if truncated by maxTerms
+    bool RangeTerms(const autil::ConstString& lower, bool lowerInclusive,
+                    const autil::ConstString& upper, bool upperInclusive,
+                    size_t maxTerms, OrderedTermMatcher::TermKeyVector& terms) const;
+    bool PrefixTerms(const autil::ConstString& prefix, size_t maxTerms,
+                     OrderedTermMatcher::TermKeyVector& terms) const;
+    bool WildcardTerms(const autil::ConstString& pattern, size_t maxTerms,
+                       OrderedTermMatcher::TermKeyVector& terms) const;
+    bool FuzzyTerms(const autil::ConstString& term, uint32_t maxEdits, size_t prefixLength,
+                    size_t maxTerms, OrderedTermMatcher::TermKeyVector& terms) const;
+
+    // union of the postings of keys, docids only, NULL if no posting
+    index::PostingIterator* LookupTerms(const std::vector<dictkey_t>& keys,
+            autil::mem_pool::Pool* sessionPool);
+
 protected:
     virtual index::PostingIterator* CreatePostingIterator(const common::Term& term,
         const DocIdRangeVector& ranges, uint32_t statePoolSize,
@@ -151,12 +174,20 @@ protected:
                               dictkey_t key, uint32_t segmentIdx, index::TermMeta &termMeta);
     
     virtual NormalIndexSegmentReaderPtr CreateSegmentReader();
+
+    NormalIndexSegmentReaderPtr GetHintSegmentReader(
+            const index_base::SegmentData& segData) const;
     
 protected:
     virtual index::BufferedPostingIterator* CreateBufferedPostingIterator(
             autil::mem_pool::Pool *sessionPool) const;
 
 private:
+    typedef std::function<bool(const OrderedTermIteratorPtr&, size_t,
+                               OrderedTermMatcher::TermKeyVector&)> TermMatchFunction;
+    bool MatchTerms(const TermMatchFunction& matchFunc, size_t maxTerms,
+                    OrderedTermMatcher::TermKeyVector& terms) const;
+
     future_lite::Future<index::PostingIterator*> DoLookupAsync(const common::Term* term,
         const DocIdRangeVector& ranges, uint32_t statePoolSize, PostingType type,
         autil::mem_pool::Pool* pool);
@@ -177,6 +208,8 @@ protected:
     BuildingIndexReaderPtr mBuildingIndexReader;
 
     future_lite::Executor* mExecutor;
+    // only valid in Open with hint reader
+    const NormalIndexReader* mHintReader;
 
 private:
     friend class NormalIndexReaderTest;
@@ -2,6 +2,7 @@
 #include "indexlib/index/normal/inverted_index/accessor/segment_posting.h"
 #include "indexlib/index/normal/inverted_index/format/short_list_optimize_util.h"
 #include "indexlib/index/normal/inverted_index/format/dictionary/dictionary_creator.h"
+#include "indexlib/index/normal/inverted_index/format/dictionary/ordered_term_dictionary_reader.h"
 #include "indexlib/index_base/segment/segment_data.h"
 #include "indexlib/file_system/file_reader.h"
 #include "indexlib/util/path_util.h"
@@ -53,6 +54,12 @@ void NormalIndexSegmentReader::Open(const config::IndexConfigPtr& indexConfig,
 
     mDictReader.reset(CreateDictionaryReader(indexConfig));
     mDictReader->Open(indexDirectory, dictFilePath);
+    if (indexConfig->HasOrderedTermDictionary()
+        && indexDirectory->IsExist(ORDERED_TERM_DICTIONARY_FILE_NAME))
+    {
+        mOrderedTermDictReader.reset(new OrderedTermDictionaryReader);
+        mOrderedTermDictReader->Open(indexDirectory, ORDERED_TERM_DICTIONARY_FILE_NAME);
+    }
 
     mPostingReader = indexDirectory->CreateFileReader(postingFilePath,
             FSOT_LOAD_CONFIG);
@@ -105,6 +112,15 @@ bool NormalIndexSegmentReader::GetSegmentPosting(dictkey_t key,
     return true;
 }
 
+OrderedTermIteratorPtr NormalIndexSegmentReader::CreateOrderedTermIterator() const
+{
+    if (!mOrderedTermDictReader)
+    {
+        return OrderedTermIteratorPtr();
+    }
+    return mOrderedTermDictReader->CreateIterator();
+}
+
 Future<bool> NormalIndexSegmentReader::GetSegmentPostingAsync(dictkey_t key, docid_t baseDocId,
     index::SegmentPosting& segPosting, autil::mem_pool::Pool* sessionPool) const
 {
@@ -10,6 +10,7 @@
 #include "indexlib/index_base/segment/segment_data.h"
 
 DECLARE_REFERENCE_CLASS(index, DictionaryReader);
+DECLARE_REFERENCE_CLASS(index, OrderedTermDictionaryReader);
 DECLARE_REFERENCE_CLASS(file_system, FileReader);
 
 IE_NAMESPACE_BEGIN(index);
@@ -34,7 +35,9 @@ public:
     const index::DictionaryReaderPtr& GetDictionaryReader() const
     { return mDictReader; }
 
-    const index_base::SegmentData& GetSegmentData()
+    index::OrderedTermIteratorPtr CreateOrderedTermIterator() const override;
+
+    const index_base::SegmentData& GetSegmentData() const
     { return mSegmentData; }
 protected:
     void GetSegmentPosting(dictvalue_t value,
@@ -50,6 +53,7 @@ protected:
 
 protected:
     index::DictionaryReaderPtr mDictReader;
+    index::OrderedTermDictionaryReaderPtr mOrderedTermDictReader;
     file_system::FileReaderPtr mPostingReader;
     IndexFormatOption mOption;
     index_base::SegmentData mSegmentData;
@@ -1,6 +1,7 @@
 #include "indexlib/index/normal/inverted_index/accessor/normal_index_writer.h"
 #include "indexlib/index/normal/inverted_index/format/dictionary/dictionary_typed_factory.h"
 #include "indexlib/index/normal/inverted_index/format/dictionary/tiered_dictionary_writer.h"
+#include "indexlib/index/normal/inverted_index/format/dictionary/in_mem_ordered_term_dictionary.h"
 #include "indexlib/index/normal/inverted_index/accessor/index_format_writer_creator.h"
 #include "indexlib/index/normal/inverted_index/accessor/in_mem_normal_index_segment_reader.h"
 #include "indexlib/index/normal/inverted_index/accessor/buffered_posting_iterator.h"
@@ -40,6 +41,7 @@ NormalIndexWriter::NormalIndexWriter(
     , mPostingWriterResource(NULL)
     , mOptions(options)
     , mToCompressShortListCount(0)
+    , mTermTextKeyCursor(0)
 {
     if (lastSegmentDistinctTermCount == 0)
     {
@@ -105,6 +107,10 @@ void NormalIndexWriter::Init(const config::IndexConfigPtr& indexConfig,
                 buildResourceMetrics);
     }
     mHighFreqVol = indexConfig->GetHighFreqVocabulary();
+    if (indexConfig->HasOrderedTermDictionary())
+    {
+        mOrderedTermDictionary.reset(new InMemOrderedTermDictionary);
+    }
     UpdateBuildResourceMetrics();
 }
 
@@ -128,6 +134,10 @@ void NormalIndexWriter::UpdateBuildResourceMetrics()
     int64_t poolSize = mByteSlicePool->getUsedBytes() +
                        mSimplePool.getUsedBytes() +
                        mBufferPool->getUsedBytes();
+    if (mOrderedTermDictionary)
+    {
+        poolSize += mOrderedTermDictionary->EstimateMemoryUse();
+    }
 
     int64_t dumpTempBufferSize = TieredDictionaryWriter<dictkey_t>::GetInitialMemUse();
     int64_t dumpExpandBufferSize = mBufferPool->getUsedBytes() +
@@ -284,6 +294,10 @@ void NormalIndexWriter::EndDocument(const IndexDocument &indexDocument)
     }
    
     mModifiedPosting.clear();
+    if (mOrderedTermDictionary)
+    {
+        AddNewTermTexts(indexDocument);
+    }
 
     if (mSectionAttributeWriter)
     {
@@ -302,6 +316,21 @@ void NormalIndexWriter::EndDocument(const IndexDocument &indexDocument)
     UpdateBuildResourceMetrics();
 }
 
+void NormalIndexWriter::AddNewTermTexts(const IndexDocument& indexDocument)
+{
+    // new terms of this document are appended to mHashKeyVector, terms
+    // without text (document from old client) can not be enumerated
+    for (; mTermTextKeyCursor < mHashKeyVector.size(); ++mTermTextKeyCursor)
+    {
+        dictkey_t hashKey = mHashKeyVector[mTermTextKeyCursor];
+        autil::ConstString termText = indexDocument.GetTermText(hashKey);
+        if (!termText.empty())
+        {
+            mOrderedTermDictionary->AddTerm(termText, hashKey);
+        }
+    }
+}
+
 void NormalIndexWriter::EndSegment()
 {
     PostingTable::Iterator it = mPostingTable->CreateIterator();
@@ -355,6 +384,11 @@ void NormalIndexWriter::Dump(const file_system::DirectoryPtr& directory,
 
     mIndexFormatOption->Store(indexDirectory);
 
+    if (mOrderedTermDictionary)
+    {
+        mOrderedTermDictionary->Dump(indexDirectory, ORDERED_TERM_DICTIONARY_FILE_NAME);
+    }
+
     if (mBitmapIndexWriter)
     {
         mBitmapIndexWriter->Dump(indexDirectory, dumpPool);
@@ -455,6 +489,7 @@ IndexSegmentReaderPtr NormalIndexWriter::CreateInMemReader()
     InMemNormalIndexSegmentReaderPtr indexSegmentReader(
             new InMemNormalIndexSegmentReader(mPostingTable, sectionReader, 
                     bitmapReader, *mIndexFormatOption));
+    indexSegmentReader->SetOrderedTermDictionary(mOrderedTermDictionary);
     return indexSegmentReader;
 }
 
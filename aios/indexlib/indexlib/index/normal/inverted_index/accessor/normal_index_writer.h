@@ -20,6 +20,8 @@
 #include "indexlib/util/key_hasher_typed.h"
 #include "indexlib/config/index_partition_options.h"
 
+DECLARE_REFERENCE_CLASS(index, InMemOrderedTermDictionary);
+
 IE_NAMESPACE_BEGIN(index);
 
 class NormalIndexWriter : public index::IndexWriter
@@ -86,6 +88,7 @@ private:
                         fieldid_t fieldId, pos_t tokenBasePos);
 
     void PrintIndexDocument(const document::IndexDocument& indexDocument);
+    void AddNewTermTexts(const document::IndexDocument& indexDocument);
 
 // for test
 public:
@@ -129,6 +132,9 @@ protected:
     config::IndexPartitionOptions mOptions;
     size_t mToCompressShortListCount;
     size_t mHashMapInitSize;
+    // term texts of mHashKeyVector, for indexes with ordered term dictionary
+    index::InMemOrderedTermDictionaryPtr mOrderedTermDictionary;
+    size_t mTermTextKeyCursor;
     
 private:
     friend class NormalIndexWriterTest;
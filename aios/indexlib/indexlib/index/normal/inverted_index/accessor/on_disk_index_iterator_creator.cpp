@@ -16,7 +16,13 @@ OnDiskIndexIteratorCreator::~OnDiskIndexIteratorCreator()
 OnDiskIndexIterator* OnDiskIndexIteratorCreator::CreateBitmapIterator(
         const DirectoryPtr& indexDirectory) const
 {
-    return new OnDiskBitmapIndexIterator(indexDirectory);
+    return CreateBitmapIterator(indexDirectory, config::MergeIOConfig());
+}
+
+OnDiskIndexIterator* OnDiskIndexIteratorCreator::CreateBitmapIterator(
+        const DirectoryPtr& indexDirectory, const config::MergeIOConfig& ioConfig)
+{
+    return new OnDiskBitmapIndexIterator(indexDirectory, ioConfig);
 }
 
 IE_NAMESPACE_END(index);
@@ -37,6 +37,12 @@ IE_NAMESPACE_BEGIN(index);
             }                                                           \
             return NULL;                                                \
         }                                                               \
+        OnDiskIndexIterator* CreateBitmapIterator(                      \
+                const file_system::DirectoryPtr& indexDirectory) const override \
+        {                                                               \
+            return OnDiskIndexIteratorCreator::CreateBitmapIterator(    \
+                    indexDirectory, mIOConfig);                         \
+        }                                                               \
     private:                                                            \
         index::PostingFormatOption mPostingFormatOption;       \
         config::MergeIOConfig mIOConfig;                                \
@@ -56,6 +62,11 @@ public:
 
     virtual OnDiskIndexIterator* CreateBitmapIterator(
             const file_system::DirectoryPtr& indexDirectory) const;
+
+protected:
+    static OnDiskIndexIterator* CreateBitmapIterator(
+            const file_system::DirectoryPtr& indexDirectory,
+            const config::MergeIOConfig& ioConfig);
 };
 
 DEFINE_SHARED_PTR(OnDiskIndexIteratorCreator);
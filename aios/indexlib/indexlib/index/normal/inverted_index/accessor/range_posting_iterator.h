@@ -25,6 +25,9 @@ public:
     bool HasPosition() const override
     { return false; }
     uint32_t GetSeekDocCount() const { return mSeekDocCounter; }
+    // of the segment the last seek stopped in
+    bool IsSegmentMaterialized() const
+    { return mSegmentPostingsIterator.IsMaterialized(); }
     //TODO: support
     void Unpack(TermMatchData& termMatchData) override;
     PostingIterator* Clone() const override;
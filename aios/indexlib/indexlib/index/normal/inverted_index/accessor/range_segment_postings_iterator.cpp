@@ -6,6 +6,7 @@
 #include "indexlib/index/normal/inverted_index/format/short_list_segment_decoder.h"
 #include "indexlib/index/normal/inverted_index/format/skip_list_segment_decoder.h"
 #include "indexlib/index/normal/inverted_index/format/in_mem_posting_decoder.h"
+#include <cmath>
 
 using namespace std;
 using namespace autil;
@@ -27,6 +28,8 @@ RangeSegmentPostingsIterator::RangeSegmentPostingsIterator(
     , mBaseDocId(INVALID_DOCID)
     , mNextSegmentDocId(INVALID_DOCID)
     , mBufferLength(0)
+    , mBitmap(false, sessionPool)
+    , mMaterialized(false)
 {
 }
 
@@ -39,6 +42,8 @@ void RangeSegmentPostingsIterator::Reset()
    mCurrentDocId = INVALID_DOCID;
    mBaseDocId = INVALID_DOCID;
    mNextSegmentDocId = INVALID_DOCID;
+   mBitmap.Clear();
+   mMaterialized = false;
    for (size_t i = 0; i < mSegmentDecoders.size(); i++)
    {
        if (mSegmentDecoders[i])
@@ -104,12 +109,30 @@ void RangeSegmentPostingsIterator::Init(const SegmentPostingsPtr& segPostings,
     mBaseDocId = mSegPostings->GetBaseDocId();
     mNextSegmentDocId = nextSegmentDocId;
     docid_t curSegDocId = std::max(docid_t(0), startDocId - mBaseDocId);
+    mBitmap.Clear();
+    mMaterialized = false;
+
+    int64_t sumDf = 0;
+    bool hasRealtimePosting = false;
+    for (size_t i = 0; i < postingVec.size(); i ++)
+    {
+        mSegmentDecoders[i] = CreateSegmentDecoder(postingVec[i], &mDocListReaders[i]);
+        sumDf += std::max(df_t(1), postingVec[i].GetMainChainTermMeta().GetDocFreq());
+        hasRealtimePosting = hasRealtimePosting || postingVec[i].GetInMemPostingWriter();
+    }
+    // building segment grows after Init, its doc count is not final
+    if (!hasRealtimePosting &&
+        NeedMaterialize(postingVec.size(), sumDf, mSegPostings->GetDocCount()))
+    {
+        Materialize(curSegDocId);
+        return;
+    }
+
     ttf_t currentTTF = 0;
     docid_t firstDocId = INVALID_DOCID;
     docid_t lastDocId = INVALID_DOCID;
     for (size_t i = 0; i < postingVec.size(); i ++)
     {
-        mSegmentDecoders[i] = CreateSegmentDecoder(postingVec[i], &mDocListReaders[i]);
         if (!mSegmentDecoders[i]->DecodeDocBuffer(curSegDocId, mDocBuffer + i * MAX_DOC_PER_RECORD,
                         firstDocId, lastDocId, currentTTF))
         {
@@ -119,6 +142,57 @@ void RangeSegmentPostingsIterator::Init(const SegmentPostingsPtr& segPostings,
     }
 }
 
+bool RangeSegmentPostingsIterator::NeedMaterialize(
+        size_t postingCount, int64_t sumDf, size_t docCount)
+{
+    if (postingCount < MIN_MATERIALIZE_POSTING_COUNT || docCount == 0 || sumDf <= 0)
+    {
+        return false;
+    }
+    if ((size_t)sumDf * MIN_MATERIALIZE_DENSITY < docCount)
+    {
+        return false;
+    }
+    double heapCost = sumDf * log2((double)postingCount);
+    double bitmapCost = sumDf + docCount / 32.0;
+    return bitmapCost < heapCost;
+}
+
+void RangeSegmentPostingsIterator::Materialize(docid_t startDocId)
+{
+    size_t docCount = mSegPostings->GetDocCount();
+    mBitmap.Alloc(docCount, false);
+    ttf_t currentTTF = 0;
+    docid_t firstDocId = INVALID_DOCID;
+    docid_t lastDocId = INVALID_DOCID;
+    for (size_t i = 0; i < mSegmentDecoders.size(); i++)
+    {
+        docid_t nextDocId = startDocId;
+        while (mSegmentDecoders[i]->DecodeDocBuffer(
+                        nextDocId, mDocBuffer, firstDocId, lastDocId, currentTTF))
+        {
+            docid_t* cursor = mDocBuffer;
+            docid_t curDocId = firstDocId;
+            while (true)
+            {
+                if ((size_t)curDocId < docCount)
+                {
+                    mBitmap.Set(curDocId);
+                }
+                if (curDocId >= lastDocId)
+                {
+                    break;
+                }
+                curDocId += *(++cursor);
+            }
+            nextDocId = lastDocId + 1;
+        }
+    }
+    mMaterialized = true;
+    IE_LOG(DEBUG, "materialize [%lu] postings of segment [%d] into bitmap, doc count [%lu]",
+           mSegmentDecoders.size(), mBaseDocId, docCount);
+}
+
 BufferedSegmentIndexDecoder* RangeSegmentPostingsIterator::CreateSegmentDecoder(
         const SegmentPosting& curSegPosting, common::ByteSliceReader* docListReaderPtr)
 {
@@ -11,6 +11,7 @@
 #include "indexlib/index/normal/inverted_index/accessor/segment_postings.h"
 #include "indexlib/common/byte_slice_reader.h"
 #include "indexlib/common/error_code.h"
+#include "indexlib/util/bitmap.h"
 
 IE_NAMESPACE_BEGIN(index);
 class RangeSegmentPostingsIterator
@@ -51,7 +52,16 @@ public:
     common::Result<bool> Seek(docid_t docid);
     docid_t GetCurrentDocid() const { return mCurrentDocId; }
     void Reset();
+    bool IsMaterialized() const { return mMaterialized; }
+
+public:
+    // wide ranges union many level postings, decoding all of them into a
+    // bitmap of the segment costs sumDf + docCount / 32, which is cheaper
+    // than sumDf * log2(postingCount) heap operations when dense enough
+    static bool NeedMaterialize(size_t postingCount, int64_t sumDf, size_t docCount);
 private:
+    void Materialize(docid_t startDocId);
+    common::Result<bool> SeekInBitmap(docid_t innerDocId);
     BufferedSegmentIndexDecoder* CreateSegmentDecoder(const SegmentPosting& segmentPosting,
             common::ByteSliceReader* docListReaderPtr);
     BufferedSegmentIndexDecoder* CreateNormalSegmentDecoder(
@@ -71,6 +81,12 @@ private:
     std::vector<BufferedSegmentIndexDecoder*> mSegmentDecoders;
     std::vector<common::ByteSliceReader> mDocListReaders;
     RangeHeap mHeap;
+    util::Bitmap mBitmap;
+    bool mMaterialized;
+private:
+    static const size_t MIN_MATERIALIZE_POSTING_COUNT = 4;
+    // sumDf * MIN_MATERIALIZE_DENSITY >= docCount
+    static const size_t MIN_MATERIALIZE_DENSITY = 16;
 private:
     IE_LOG_DECLARE();
 };
@@ -84,6 +100,10 @@ inline common::Result<bool> RangeSegmentPostingsIterator::Seek(docid_t docid)
         return false;
     }
     docid_t innerDocId = docid - mBaseDocId;
+    if (mMaterialized)
+    {
+        return SeekInBitmap(innerDocId);
+    }
     while(!mHeap.empty())
     {
         mSeekDocCounter++;
@@ -127,6 +147,18 @@ inline common::Result<bool> RangeSegmentPostingsIterator::Seek(docid_t docid)
     return false;
 }
 
+inline common::Result<bool> RangeSegmentPostingsIterator::SeekInBitmap(docid_t innerDocId)
+{
+    mSeekDocCounter++;
+    uint32_t docid = innerDocId <= 0 ? mBitmap.Begin() : mBitmap.Next(innerDocId - 1);
+    if (docid == util::Bitmap::INVALID_INDEX)
+    {
+        return false;
+    }
+    mCurrentDocId = (docid_t)docid + mBaseDocId;
+    return true;
+}
+
 IE_NAMESPACE_END(index);
 
 #endif //__INDEXLIB_RANGE_SEGMENT_POSTINGS_ITERATOR_H
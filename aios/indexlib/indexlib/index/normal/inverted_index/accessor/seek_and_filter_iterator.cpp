@@ -1,4 +1,5 @@
 #include "indexlib/index/normal/inverted_index/accessor/seek_and_filter_iterator.h"
+#include "indexlib/index/normal/inverted_index/builtin_index/spatial/spatial_posting_iterator.h"
 
 using namespace std;
 
@@ -54,7 +55,7 @@ docid_t SeekAndFilterIterator::SeekDoc(docid_t docid)
         {
             break;
         }
-        if (mDocFilter->Test(curDocId))
+        if (IsInteriorDoc() || mDocFilter->Test(curDocId))
         {
             return curDocId;
         }
@@ -63,6 +64,13 @@ docid_t SeekAndFilterIterator::SeekDoc(docid_t docid)
     return INVALID_DOCID;
 }
 
+bool SeekAndFilterIterator::IsInteriorDoc() const
+{
+    // spatial docs hit by cells inside query shape need no filter
+    assert(mIndexSeekIterator->GetType() == pi_spatial);
+    return static_cast<SpatialPostingIterator*>(mIndexSeekIterator)->IsInteriorDoc();
+}
+
 common::ErrorCode SeekAndFilterIterator::SeekDocWithErrorCode(docid_t docId, docid_t& result) {
 {
     if (!mNeedInnerFilter || !mDocFilter)
@@ -81,7 +89,7 @@ common::ErrorCode SeekAndFilterIterator::SeekDocWithErrorCode(docid_t docId, doc
         {
             break;
         }
-        if (mDocFilter->Test(curDocId))
+        if (IsInteriorDoc() || mDocFilter->Test(curDocId))
         {
             result = curDocId;
             return common::ErrorCode::OK;
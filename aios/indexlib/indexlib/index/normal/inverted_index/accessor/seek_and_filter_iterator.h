@@ -50,6 +50,9 @@ private:
     void Reset() override
     { mIndexSeekIterator->Reset(); }
 
+private:
+    bool IsInteriorDoc() const;
+
 private:
     PostingIterator* mIndexSeekIterator;
     DocValueFilter* mDocFilter;
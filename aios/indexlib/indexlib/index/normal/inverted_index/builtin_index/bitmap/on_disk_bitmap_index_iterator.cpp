@@ -19,8 +19,9 @@ IE_NAMESPACE_BEGIN(index);
 IE_LOG_SETUP(index, OnDiskBitmapIndexIterator);
 
 OnDiskBitmapIndexIterator::OnDiskBitmapIndexIterator(
-        const file_system::DirectoryPtr& indexDirectory)
-    : OnDiskIndexIterator(indexDirectory, OPTION_FLAG_ALL)
+        const file_system::DirectoryPtr& indexDirectory,
+        const config::MergeIOConfig& ioConfig)
+    : OnDiskIndexIterator(indexDirectory, OPTION_FLAG_ALL, ioConfig)
     , mTermMeta(NULL)    
     , mBufferSize(DEFAULT_DATA_BUFFER_SIZE)
     , mDataBuffer(mDefaultDataBuffer)
@@ -48,6 +49,9 @@ void OnDiskBitmapIndexIterator::Init()
     mDocListFile = DYNAMIC_POINTER_CAST(
             file_system::BufferedFileReader, postingFileReader);
     assert(mDocListFile);
+    mDocListFile->ResetBufferParam(mIOConfig.readBufferSize,
+                                   mIOConfig.enableAsyncRead,
+                                   mIOConfig.enableDropCacheRead);
 
     mDecoder.reset(new BitmapPostingDecoder());
     mTermMeta = new TermMeta();
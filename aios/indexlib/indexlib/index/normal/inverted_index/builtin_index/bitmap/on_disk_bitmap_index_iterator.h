@@ -26,7 +26,8 @@ public:
         uint8_t*  data;
     };
 public:
-    OnDiskBitmapIndexIterator(const file_system::DirectoryPtr& indexDirectory);
+    OnDiskBitmapIndexIterator(const file_system::DirectoryPtr& indexDirectory,
+                              const config::MergeIOConfig& ioConfig = config::MergeIOConfig());
     ~OnDiskBitmapIndexIterator();
 
     // class Creator : public OnDiskIndexIteratorCreator
@@ -173,7 +173,8 @@ void OnDiskPackIndexIteratorTyped<DictKey>::Init()
     assert(mPostingFile);
 
     mPostingFile->ResetBufferParam(this->mIOConfig.readBufferSize, 
-                                   this->mIOConfig.enableAsyncRead);
+                                   this->mIOConfig.enableAsyncRead,
+                                   this->mIOConfig.enableDropCacheRead);
 
     mDocListReader.reset(new common::ByteSliceReader());
     if (this->mPostingFormatOption.HasTfBitmap())
@@ -5,8 +5,10 @@
 #include "indexlib/test/searcher.h"
 #include "indexlib/partition/index_partition.h"
 #include "indexlib/common/number_term.h"
+#include <autil/StringUtil.h>
 
 using namespace std;
+using namespace autil;
 IE_NAMESPACE_USE(test);
 IE_NAMESPACE_USE(config);
 IE_NAMESPACE_USE(common);
@@ -87,5 +89,40 @@ void RangeIndexReaderTest::TestSimpleProcess()
     delete iter;
 }
 
+void RangeIndexReaderTest::TestBatchTest()
+{
+    string fullDocString;
+    for (size_t i = 0; i < 100; ++i)
+    {
+        fullDocString += "cmd=add,price=" + StringUtil::toString(i) + ",pk="
+                         + StringUtil::toString(i) + ",ts=1;";
+    }
+    PartitionStateMachine psm;
+    INDEXLIB_TEST_TRUE(psm.Init(mSchema, mOptions, mRootDir));
+    INDEXLIB_TEST_TRUE(psm.Transfer(BUILD_FULL, fullDocString, "", ""));
+    auto indexReader = psm.GetIndexPartition()->GetReader()->GetIndexReader();
+    Int64Term term(10, true, 80, true, "price");
+    PostingIterator* iter = indexReader->Lookup(term);
+    SeekAndFilterIterator* stIter = dynamic_cast<SeekAndFilterIterator*>(iter);
+    ASSERT_TRUE(stIter);
+    DocValueFilter* dvIter = stIter->GetDocValueFilter();
+
+    // more than one block, with out of range docid
+    vector<docid_t> docIds;
+    for (docid_t docId = 0; docId < 100; ++docId)
+    {
+        docIds.push_back(docId);
+    }
+    docIds.push_back(1000);
+    vector<uint8_t> mask(docIds.size(), 2);
+    ASSERT_EQ(71u, dvIter->BatchTest(docIds.data(), docIds.size(), mask.data()));
+    for (size_t i = 0; i < docIds.size(); ++i)
+    {
+        ASSERT_EQ(dvIter->Test(docIds[i]), (bool)mask[i]) << docIds[i];
+        ASSERT_TRUE(mask[i] <= 1);
+    }
+    delete iter;
+}
+
 IE_NAMESPACE_END(index);
 
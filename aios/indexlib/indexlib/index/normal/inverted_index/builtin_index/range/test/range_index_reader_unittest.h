@@ -22,6 +22,7 @@ public:
     void CaseTearDown() override;
     void TestSimpleProcess();
     void TestRangeIndexReaderTermIllegal();
+    void TestBatchTest();
 private:
     config::IndexPartitionOptions mOptions;
     config::IndexPartitionSchemaPtr mSchema;
@@ -32,6 +33,7 @@ private:
 
 INDEXLIB_UNIT_TEST_CASE(RangeIndexReaderTest, TestSimpleProcess);
 INDEXLIB_UNIT_TEST_CASE(RangeIndexReaderTest, TestRangeIndexReaderTermIllegal);
+INDEXLIB_UNIT_TEST_CASE(RangeIndexReaderTest, TestBatchTest);
 
 IE_NAMESPACE_END(index);
 
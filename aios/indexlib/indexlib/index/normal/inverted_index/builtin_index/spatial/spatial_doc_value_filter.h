@@ -60,18 +60,66 @@ public:
             return false;
         }
         assert(value.size() % 2 == 0);
-        uint32_t cursor = 0;
         uint32_t pointCount = value.size() >> 1;
-        for (uint32_t i = 0; i < pointCount; i++)
+        if (pointCount == 0)
         {
-            double lon = value[cursor++];
-            double lat = value[cursor++];
-            if (mShape->IsInnerCoordinate(lon, lat))
+            return false;
+        }
+        return mShape->HasInnerCoordinate(value.data(), pointCount);
+    }
+
+    size_t BatchTest(const docid_t* docIds, size_t count, uint8_t* mask) override
+    {
+        if (!mAttrIter)
+        {
+            memset(mask, 0, count);
+            return 0;
+        }
+        // single point docs are gathered block by block and tested by the
+        // batch kernel of the shape, multi point docs are tested one by one
+        double lons[BATCH_BLOCK_SIZE];
+        double lats[BATCH_BLOCK_SIZE];
+        uint8_t pointMask[BATCH_BLOCK_SIZE];
+        uint32_t pointPos[BATCH_BLOCK_SIZE];
+        size_t passCount = 0;
+        for (size_t begin = 0; begin < count; begin += BATCH_BLOCK_SIZE)
+        {
+            size_t blockSize = count - begin;
+            if (blockSize > BATCH_BLOCK_SIZE)
             {
-                return true;
+                blockSize = BATCH_BLOCK_SIZE;
+            }
+            uint8_t* blockMask = mask + begin;
+            size_t pointCount = 0;
+            for (size_t i = 0; i < blockSize; ++i)
+            {
+                blockMask[i] = 0;
+                autil::MultiDouble value;
+                if (!mAttrIter->Seek(docIds[begin + i], value) || value.size() < 2)
+                {
+                    continue;
+                }
+                assert(value.size() % 2 == 0);
+                if (value.size() == 2)
+                {
+                    lons[pointCount] = value[0];
+                    lats[pointCount] = value[1];
+                    pointPos[pointCount++] = i;
+                    continue;
+                }
+                blockMask[i] = mShape->HasInnerCoordinate(value.data(), value.size() >> 1) ? 1 : 0;
+            }
+            mShape->BatchIsInnerCoordinate(lons, lats, pointCount, pointMask);
+            for (size_t i = 0; i < pointCount; ++i)
+            {
+                blockMask[pointPos[i]] = pointMask[i];
+            }
+            for (size_t i = 0; i < blockSize; ++i)
+            {
+                passCount += blockMask[i];
             }
         }
-        return false;
+        return passCount;
     }
         
     DocValueFilter* Clone() const override
@@ -80,6 +128,9 @@ public:
                 SpatialDocValueFilter, *this);
     }
 
+private:
+    static const size_t BATCH_BLOCK_SIZE = 64;
+
 private:
     typedef typename VarNumAttributeReader<double>::AttributeIterator AttributeIterator;
     common::ShapePtr mShape;
@@ -95,24 +95,21 @@ PostingIterator* SpatialIndexReader::Lookup(
         return NULL;
     }
 
-    vector<dictkey_t> terms;
-    mQueryStrategy->CalculateTerms(shape, terms);
+    vector<dictkey_t> boundaryTerms;
+    vector<dictkey_t> interiorTerms;
+    mQueryStrategy->CalculateBoundaryAndInteriorTerms(
+            shape, boundaryTerms, interiorTerms);
 
     vector<BufferedPostingIterator*> postingIterators;
-    Term defaultTerm;
-    for (size_t i = 0; i < terms.size(); i++)
-    {
-        PostingIterator* postingIterator = NormalIndexReader::CreatePostingIteratorByHashKey(
-            &defaultTerm, terms[i], {}, statePoolSize, sessionPool).get();
-        if (postingIterator)
-        {
-            postingIterators.push_back((BufferedPostingIterator*)postingIterator);
-        }
-    }
+    vector<bool> interiorFlags;
+    AppendPostingIterators(boundaryTerms, false, statePoolSize, sessionPool,
+                           postingIterators, interiorFlags);
+    AppendPostingIterators(interiorTerms, true, statePoolSize, sessionPool,
+                           postingIterators, interiorFlags);
 
     // TODO: if postingIterators.size() == 1 return it self
-    SpatialPostingIterator* iter =
-        CreateSpatialPostingIterator(postingIterators, sessionPool);
+    SpatialPostingIterator* iter = CreateSpatialPostingIterator(
+            postingIterators, interiorFlags, sessionPool);
     if (!iter)
     {
         return NULL;
@@ -124,8 +121,28 @@ PostingIterator* SpatialIndexReader::Lookup(
     return compositeIter;
 }
 
+void SpatialIndexReader::AppendPostingIterators(
+        const vector<dictkey_t>& terms, bool isInterior,
+        uint32_t statePoolSize, Pool* sessionPool,
+        vector<BufferedPostingIterator*>& postingIterators,
+        vector<bool>& interiorFlags)
+{
+    Term defaultTerm;
+    for (size_t i = 0; i < terms.size(); i++)
+    {
+        PostingIterator* postingIterator = NormalIndexReader::CreatePostingIteratorByHashKey(
+            &defaultTerm, terms[i], {}, statePoolSize, sessionPool).get();
+        if (postingIterator)
+        {
+            postingIterators.push_back((BufferedPostingIterator*)postingIterator);
+            interiorFlags.push_back(isInterior);
+        }
+    }
+}
+
 SpatialPostingIterator* SpatialIndexReader::CreateSpatialPostingIterator(
-        vector<BufferedPostingIterator*>& postingIterators, Pool* sessionPool)
+        vector<BufferedPostingIterator*>& postingIterators,
+        const vector<bool>& interiorFlags, Pool* sessionPool)
 {
     if (postingIterators.empty())
     {
@@ -134,7 +151,7 @@ SpatialPostingIterator* SpatialIndexReader::CreateSpatialPostingIterator(
 
     SpatialPostingIterator* iter = IE_POOL_COMPATIBLE_NEW_CLASS(
             sessionPool, SpatialPostingIterator, sessionPool);
-    iter->Init(postingIterators);
+    iter->Init(postingIterators, interiorFlags);
     return iter;
 }
 
@@ -159,8 +176,7 @@ DocValueFilter* SpatialIndexReader::CreateDocValueFilter(
         const ShapePtr& shape, Pool *sessionPool)
 {
     //current not support filter
-    if (shape->GetType() == Shape::POLYGON ||
-        shape->GetType() == Shape::LINE)
+    if (shape->GetType() == Shape::LINE)
     {
         return NULL;
     }
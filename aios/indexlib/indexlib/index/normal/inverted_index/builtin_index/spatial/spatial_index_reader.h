@@ -49,7 +49,13 @@ public:
 private:
     SpatialPostingIterator* CreateSpatialPostingIterator(
             std::vector<BufferedPostingIterator*>& postingIterators,
+            const std::vector<bool>& interiorFlags,
             autil::mem_pool::Pool* sessionPool);
+    void AppendPostingIterators(const std::vector<dictkey_t>& terms,
+                                bool isInterior, uint32_t statePoolSize,
+                                autil::mem_pool::Pool* sessionPool,
+                                std::vector<BufferedPostingIterator*>& postingIterators,
+                                std::vector<bool>& interiorFlags);
     common::ShapePtr ParseShape(const std::string& shapeStr) const;
 
     DocValueFilter* CreateDocValueFilter(
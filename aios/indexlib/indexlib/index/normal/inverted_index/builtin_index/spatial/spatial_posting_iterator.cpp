@@ -10,6 +10,8 @@ IE_LOG_SETUP(index, SpatialPostingIterator);
 SpatialPostingIterator::SpatialPostingIterator(
         autil::mem_pool::Pool* sessionPool) 
     : mCurDocid(INVALID_DOCID)
+    , mIsInteriorDoc(false)
+    , mHasInteriorPosting(false)
     , mTermMeta(NULL)
     , mSessionPool(sessionPool)
     , mSeekDocCounter(0)
@@ -27,18 +29,28 @@ SpatialPostingIterator::~SpatialPostingIterator()
 
 void SpatialPostingIterator::Init(const std::vector<BufferedPostingIterator*>& postingIterators)
 {
+    Init(postingIterators, vector<bool>(postingIterators.size(), false));
+}
+
+void SpatialPostingIterator::Init(
+        const std::vector<BufferedPostingIterator*>& postingIterators,
+        const std::vector<bool>& interiorFlags)
+{
+    assert(postingIterators.size() == interiorFlags.size());
     df_t docFreq = 0;
     tf_t totalTF = 0;
     for (size_t i = 0; i < postingIterators.size(); i++)
     {
         mPostingIterators.push_back(postingIterators[i]);
+        mInteriorFlags.push_back(interiorFlags[i]);
         TermMeta* termMeta = postingIterators[i]->GetTermMeta();
         docFreq += termMeta->GetDocFreq();
         totalTF += termMeta->GetTotalTermFreq();
         docid_t docid = postingIterators[i]->SeekDoc(INVALID_DOCID);
         if (docid != INVALID_DOCID)
         {
-            mHeap.push(make_pair(postingIterators[i], docid));
+            mHeap.push(PostingIteratorPair(postingIterators[i], docid, interiorFlags[i]));
+            mHasInteriorPosting = mHasInteriorPosting || interiorFlags[i];
         }
     }
     mTermMeta = IE_POOL_COMPATIBLE_NEW_CLASS(mSessionPool, 
@@ -54,6 +66,7 @@ void SpatialPostingIterator::Unpack(TermMatchData& termMatchData)
 void SpatialPostingIterator::Reset()
 {
     mCurDocid = INVALID_DOCID;
+    mIsInteriorDoc = false;
     while(!mHeap.empty())
     {
         mHeap.pop();
@@ -66,7 +79,7 @@ void SpatialPostingIterator::Reset()
         docid_t docid = iter->SeekDoc(INVALID_DOCID);
         if (docid != INVALID_DOCID)
         {
-            mHeap.push(make_pair(iter, docid));
+            mHeap.push(PostingIteratorPair(iter, docid, mInteriorFlags[i]));
         }
     }
 }
@@ -82,7 +95,7 @@ PostingIterator* SpatialPostingIterator::Clone() const
         PostingIterator* subPostingIterator = mPostingIterators[i]->Clone();
         newPostingIterators.push_back((BufferedPostingIterator*)subPostingIterator);
     }
-    iter->Init(newPostingIterators);
+    iter->Init(newPostingIterators, mInteriorFlags);
     return iter;
 }
 
@@ -20,6 +20,10 @@ public:
 
 public:
     void Init(const std::vector<BufferedPostingIterator*>& postingIterators);
+    // interiorFlags[i] marks postingIterators[i] as posting of a cell fully
+    // inside query shape, docs from it need no exact refine
+    void Init(const std::vector<BufferedPostingIterator*>& postingIterators,
+              const std::vector<bool>& interiorFlags);
 
     docid_t SeekDoc(docid_t docid) override;
     common::ErrorCode SeekDocWithErrorCode(docid_t docId, docid_t& result) override {
@@ -37,15 +41,36 @@ public:
     autil::mem_pool::Pool *GetSessionPool() const override
     { return mSessionPool; }
     uint32_t GetSeekDocCount() const { return mSeekDocCounter; }
+    // true when current doc is hit by an interior cell
+    bool IsInteriorDoc() const { return mIsInteriorDoc; }
+    // true when any interior cell has docs, some hits skip exact refine
+    bool HasInteriorPosting() const { return mHasInteriorPosting; }
 
 private:
-    typedef std::pair<BufferedPostingIterator*, docid_t> PostingIteratorPair;
+    struct PostingIteratorPair
+    {
+        PostingIteratorPair(BufferedPostingIterator* iter_, docid_t docid_, bool isInterior_)
+            : iter(iter_)
+            , docid(docid_)
+            , isInterior(isInterior_)
+        {}
+        BufferedPostingIterator* iter;
+        docid_t docid;
+        bool isInterior;
+    };
     class PostingIteratorComparator
     {
     public:
+        // on same docid interior posting goes top
         bool operator() (const PostingIteratorPair& left,
                          const PostingIteratorPair& right)
-        { return left.second >= right.second; }
+        {
+            if (left.docid != right.docid)
+            {
+                return left.docid > right.docid;
+            }
+            return !left.isInterior && right.isInterior;
+        }
     };
 
     typedef std::priority_queue<PostingIteratorPair, 
@@ -61,6 +86,9 @@ private:
     docid_t mCurDocid;
     PostingIteratorHeap mHeap;
     std::vector<BufferedPostingIterator*> mPostingIterators;
+    std::vector<bool> mInteriorFlags;
+    bool mIsInteriorDoc;
+    bool mHasInteriorPosting;
     index::TermMeta* mTermMeta;
     autil::mem_pool::Pool *mSessionPool;
     uint32_t mSeekDocCounter;
@@ -87,21 +115,22 @@ inline common::ErrorCode SpatialPostingIterator::InnerSeekDoc(docid_t docid, doc
     {
         mSeekDocCounter ++;
         auto item = mHeap.top();
-        if (item.second >= docid)
+        if (item.docid >= docid)
         {
-            mCurDocid = item.second;
+            mCurDocid = item.docid;
+            mIsInteriorDoc = item.isInterior;
             result = mCurDocid;
             return common::ErrorCode::OK;
         }
         mHeap.pop();
-        auto ec = item.first->InnerSeekDoc(docid, nextDocid);
+        auto ec = item.iter->InnerSeekDoc(docid, nextDocid);
         if (unlikely(ec != common::ErrorCode::OK))
         {
             return ec;
         }
         if (nextDocid != INVALID_DOCID)
         {
-            item.second = nextDocid;
+            item.docid = nextDocid;
             mHeap.push(item);
         }
     }
@@ -200,5 +200,75 @@ void SpatialPostingIteratorTest::TestReset()
     IE_POOL_COMPATIBLE_DELETE_CLASS(pool, iter);
 }
 
-IE_NAMESPACE_END(index);
+void SpatialPostingIteratorTest::TestInteriorDoc()
+{
+    SingleFieldPartitionDataProvider provider;
+    provider.Init(GET_TEST_DATA_PATH(), "location", SFP_INDEX);
+    string docsStr = "1 1,5 5,3.5 3.5,7.99 7.99,10 10";
+    provider.Build(docsStr, SFP_OFFLINE);
+
+    SpatialIndexReaderPtr reader(new SpatialIndexReader);
+    reader->Open(provider.GetIndexConfig(), provider.GetPartitionData());
+    PostingIterator* iter = reader->Lookup(Term("rectangle(0 0,8 8)", "spatial"));
+    SeekAndFilterIterator* seekAndFilterIter =
+        dynamic_cast<SeekAndFilterIterator*>(iter);
+    SpatialPostingIterator* spatialIter =
+        dynamic_cast<SpatialPostingIterator*>(
+                seekAndFilterIter->GetIndexIterator());
+    ASSERT_TRUE(spatialIter);
+    ASSERT_EQ(spatialIter->mPostingIterators.size(), spatialIter->mInteriorFlags.size());
+    ASSERT_TRUE(spatialIter->HasInteriorPosting());
+
+    PostingIterator* cloneIter = iter->Clone();
+    SpatialPostingIterator* cloneSpatialIter =
+        dynamic_cast<SpatialPostingIterator*>(
+                dynamic_cast<SeekAndFilterIterator*>(cloneIter)->GetIndexIterator());
+    ASSERT_TRUE(spatialIter->mInteriorFlags == cloneSpatialIter->mInteriorFlags);
+
+    // doc 2 lies deep inside query rectangle
+    ASSERT_EQ((docid_t)0, iter->SeekDoc(INVALID_DOCID));
+    ASSERT_EQ((docid_t)1, iter->SeekDoc(0));
+    ASSERT_EQ((docid_t)2, iter->SeekDoc(1));
+    ASSERT_TRUE(spatialIter->IsInteriorDoc());
+    ASSERT_EQ((docid_t)3, iter->SeekDoc(2));
+    ASSERT_EQ((docid_t)INVALID_DOCID, iter->SeekDoc(3));
+
+    ASSERT_EQ((docid_t)2, cloneIter->SeekDoc(2));
+    ASSERT_TRUE(cloneSpatialIter->IsInteriorDoc());
+    autil::mem_pool::Pool* pool = iter->GetSessionPool();
+    IE_POOL_COMPATIBLE_DELETE_CLASS(pool, iter);
+    IE_POOL_COMPATIBLE_DELETE_CLASS(pool, cloneIter);
+}
+
+void SpatialPostingIteratorTest::TestFilterBatchTest()
+{
+    SingleFieldPartitionDataProvider provider;
+    provider.Init(GET_TEST_DATA_PATH(), "location", SFP_INDEX);
+    string docsStr = "1 1,5 5,3 3,1 1,10 10";
+    provider.Build(docsStr, SFP_OFFLINE);
 
+    SpatialIndexReaderPtr reader(new SpatialIndexReader);
+    reader->Open(provider.GetIndexConfig(), provider.GetPartitionData());
+    // (3 3) is about 314km from center, (5 5) about 628km
+    PostingIterator* iter = reader->Lookup(Term("circle(1 1,400000)", "spatial"));
+    SeekAndFilterIterator* seekAndFilterIter =
+        dynamic_cast<SeekAndFilterIterator*>(iter);
+    ASSERT_TRUE(seekAndFilterIter);
+    DocValueFilter* filter = seekAndFilterIter->GetDocValueFilter();
+    ASSERT_TRUE(filter);
+
+    docid_t docIds[] = { 0, 1, 2, 3, 4, 2, 100 };
+    uint8_t expectMask[] = { 1, 0, 1, 1, 0, 1, 0 };
+    size_t count = sizeof(docIds) / sizeof(docIds[0]);
+    uint8_t mask[sizeof(docIds) / sizeof(docIds[0])];
+    ASSERT_EQ((size_t)4, filter->BatchTest(docIds, count, mask));
+    for (size_t i = 0; i < count; ++i)
+    {
+        ASSERT_EQ(expectMask[i], mask[i]) << i;
+        ASSERT_EQ((bool)expectMask[i], filter->Test(docIds[i])) << i;
+    }
+    autil::mem_pool::Pool* pool = iter->GetSessionPool();
+    IE_POOL_COMPATIBLE_DELETE_CLASS(pool, iter);
+}
+
+IE_NAMESPACE_END(index);
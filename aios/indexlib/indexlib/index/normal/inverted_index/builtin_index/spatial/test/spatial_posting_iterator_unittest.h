@@ -26,6 +26,8 @@ public:
     void TestTermMeta();
     void TestReset();
     void TestSeekDocCount();
+    void TestInteriorDoc();
+    void TestFilterBatchTest();
 private:
     IE_LOG_DECLARE();
 };
@@ -37,6 +39,8 @@ INDEXLIB_UNIT_TEST_CASE(SpatialPostingIteratorTest, TestUnpack);
 INDEXLIB_UNIT_TEST_CASE(SpatialPostingIteratorTest, TestTermMeta);
 INDEXLIB_UNIT_TEST_CASE(SpatialPostingIteratorTest, TestReset);
 INDEXLIB_UNIT_TEST_CASE(SpatialPostingIteratorTest, TestSeekDocCount);
+INDEXLIB_UNIT_TEST_CASE(SpatialPostingIteratorTest, TestInteriorDoc);
+INDEXLIB_UNIT_TEST_CASE(SpatialPostingIteratorTest, TestFilterBatchTest);
 
 IE_NAMESPACE_END(index);
 
@@ -0,0 +1,117 @@
+#include "indexlib/index/normal/inverted_index/format/dictionary/in_mem_ordered_term_dictionary.h"
+#include "indexlib/index/normal/inverted_index/format/dictionary/ordered_term_dictionary_writer.h"
+
+using namespace std;
+using namespace autil;
+IE_NAMESPACE_USE(file_system);
+
+IE_NAMESPACE_BEGIN(index);
+IE_LOG_SETUP(index, InMemOrderedTermDictionary);
+
+const size_t InMemOrderedTermDictionary::TERM_NODE_OVERHEAD;
+
+class InMemOrderedTermIterator : public OrderedTermIterator
+{
+public:
+    InMemOrderedTermIterator(const InMemOrderedTermDictionary* dictionary)
+        : mDictionary(dictionary)
+        , mIsValid(false)
+        , mKey(0)
+    {
+        ScopedReadWriteLock lock(mDictionary->mLock, 'r');
+        mIter = mDictionary->mTerms.begin();
+        CopyCurrent();
+    }
+    ~InMemOrderedTermIterator() {}
+
+public:
+    void Seek(const ConstString& lowerBound) override
+    {
+        string bound(lowerBound.data(), lowerBound.size());
+        ScopedReadWriteLock lock(mDictionary->mLock, 'r');
+        mIter = mDictionary->mTerms.lower_bound(bound);
+        CopyCurrent();
+    }
+    bool IsValid() const override { return mIsValid; }
+    void Next() override
+    {
+        ScopedReadWriteLock lock(mDictionary->mLock, 'r');
+        ++mIter;
+        CopyCurrent();
+    }
+    ConstString GetTerm() const override
+    { return ConstString(mTerm.data(), mTerm.size()); }
+    dictkey_t GetKey() const override { return mKey; }
+
+private:
+    // under read lock
+    void CopyCurrent()
+    {
+        mIsValid = (mIter != mDictionary->mTerms.end());
+        if (mIsValid)
+        {
+            mTerm = mIter->first;
+            mKey = mIter->second;
+        }
+    }
+
+private:
+    const InMemOrderedTermDictionary* mDictionary;
+    InMemOrderedTermDictionary::TermMap::const_iterator mIter;
+    bool mIsValid;
+    std::string mTerm;
+    dictkey_t mKey;
+};
+
+InMemOrderedTermDictionary::InMemOrderedTermDictionary()
+    : mLock(ReadWriteLock::PREFER_WRITER)
+    , mTermBytes(0)
+{
+}
+
+InMemOrderedTermDictionary::~InMemOrderedTermDictionary()
+{
+}
+
+void InMemOrderedTermDictionary::AddTerm(const ConstString& term, dictkey_t key)
+{
+    string termStr(term.data(), term.size());
+    ScopedReadWriteLock lock(mLock, 'w');
+    if (mTerms.insert(make_pair(termStr, key)).second)
+    {
+        mTermBytes += termStr.size();
+    }
+}
+
+size_t InMemOrderedTermDictionary::GetTermCount() const
+{
+    ScopedReadWriteLock lock(mLock, 'r');
+    return mTerms.size();
+}
+
+size_t InMemOrderedTermDictionary::EstimateMemoryUse() const
+{
+    ScopedReadWriteLock lock(mLock, 'r');
+    return mTermBytes + mTerms.size() * (sizeof(TermMap::value_type) + TERM_NODE_OVERHEAD);
+}
+
+OrderedTermIteratorPtr InMemOrderedTermDictionary::CreateIterator() const
+{
+    return OrderedTermIteratorPtr(new InMemOrderedTermIterator(this));
+}
+
+void InMemOrderedTermDictionary::Dump(const DirectoryPtr& directory, const string& fileName) const
+{
+    OrderedTermDictionaryWriter writer;
+    writer.Open(directory, fileName);
+    ScopedReadWriteLock lock(mLock, 'r');
+    for (TermMap::const_iterator it = mTerms.begin(); it != mTerms.end(); ++it)
+    {
+        writer.AddTerm(ConstString(it->first.data(), it->first.size()), it->second);
+    }
+    writer.Close();
+    IE_LOG(INFO, "dump ordered term dictionary [%s], term count [%lu]",
+           fileName.c_str(), mTerms.size());
+}
+
+IE_NAMESPACE_END(index);
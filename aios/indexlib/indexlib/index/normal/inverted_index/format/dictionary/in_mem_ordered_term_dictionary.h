@@ -0,0 +1,50 @@
+#ifndef __INDEXLIB_IN_MEM_ORDERED_TERM_DICTIONARY_H
+#define __INDEXLIB_IN_MEM_ORDERED_TERM_DICTIONARY_H
+
+#include <tr1/memory>
+#include <map>
+#include <autil/Lock.h>
+#include <autil/ConstString.h>
+#include "indexlib/indexlib.h"
+#include "indexlib/common_define.h"
+#include "indexlib/index/normal/inverted_index/format/dictionary/ordered_term_iterator.h"
+
+DECLARE_REFERENCE_CLASS(file_system, Directory);
+
+IE_NAMESPACE_BEGIN(index);
+
+// term texts of a building segment. terms are never erased, so iterators
+// keep their map position across inserts, take the read lock only to step
+// and copy the current term out
+class InMemOrderedTermDictionary
+{
+public:
+    typedef std::map<std::string, dictkey_t> TermMap;
+
+public:
+    InMemOrderedTermDictionary();
+    ~InMemOrderedTermDictionary();
+
+public:
+    void AddTerm(const autil::ConstString& term, dictkey_t key);
+    size_t GetTermCount() const;
+    size_t EstimateMemoryUse() const;
+    OrderedTermIteratorPtr CreateIterator() const;
+    void Dump(const file_system::DirectoryPtr& directory, const std::string& fileName) const;
+
+private:
+    mutable autil::ReadWriteLock mLock;
+    TermMap mTerms;
+    size_t mTermBytes;
+
+private:
+    static const size_t TERM_NODE_OVERHEAD = 64;
+    friend class InMemOrderedTermIterator;
+    IE_LOG_DECLARE();
+};
+
+DEFINE_SHARED_PTR(InMemOrderedTermDictionary);
+
+IE_NAMESPACE_END(index);
+
+#endif //__INDEXLIB_IN_MEM_ORDERED_TERM_DICTIONARY_H
@@ -0,0 +1,186 @@
+#include <cstring>
+#include "indexlib/index/normal/inverted_index/format/dictionary/ordered_term_dictionary_reader.h"
+#include "indexlib/index/normal/inverted_index/format/dictionary/ordered_term_dictionary_writer.h"
+#include "indexlib/common/numeric_compress/vbyte_compressor.h"
+#include "indexlib/file_system/directory.h"
+#include "indexlib/file_system/file_reader.h"
+#include "indexlib/misc/exception.h"
+
+using namespace std;
+using namespace autil;
+IE_NAMESPACE_USE(file_system);
+IE_NAMESPACE_USE(common);
+
+IE_NAMESPACE_BEGIN(index);
+IE_LOG_SETUP(index, OrderedTermDictionaryReader);
+
+namespace {
+int CompareTerm(const ConstString& left, const ConstString& right)
+{
+    size_t len = min(left.size(), right.size());
+    int ret = len > 0 ? memcmp(left.data(), right.data(), len) : 0;
+    if (ret != 0)
+    {
+        return ret;
+    }
+    return left.size() < right.size() ? -1 : (left.size() > right.size() ? 1 : 0);
+}
+}
+
+class OrderedTermDictionaryIterator : public OrderedTermIterator
+{
+public:
+    OrderedTermDictionaryIterator(const OrderedTermDictionaryReader* reader)
+        : mReader(reader)
+        , mCursor(NULL)
+        , mTermIdx(0)
+        , mKey(0)
+    {
+        SeekBlock(0);
+    }
+
+public:
+    void Seek(const ConstString& lowerBound) override
+    {
+        SeekBlock(mReader->LocateBlock(lowerBound));
+        while (IsValid() && CompareTerm(GetTerm(), lowerBound) < 0)
+        {
+            Next();
+        }
+    }
+    bool IsValid() const override { return mTermIdx < mReader->mTermCount; }
+    void Next() override
+    {
+        ++mTermIdx;
+        if (IsValid())
+        {
+            DecodeTerm();
+        }
+    }
+    ConstString GetTerm() const override { return ConstString(mTerm.data(), mTerm.size()); }
+    dictkey_t GetKey() const override { return mKey; }
+
+private:
+    void SeekBlock(uint32_t blockIdx)
+    {
+        mTermIdx = blockIdx * mReader->mTermCountPerBlock;
+        if (!IsValid())
+        {
+            return;
+        }
+        mCursor = (char*)mReader->mData + mReader->mBlockOffsets[blockIdx];
+        DecodeTerm();
+    }
+    void DecodeTerm()
+    {
+        size_t shared = 0;
+        if (mTermIdx % mReader->mTermCountPerBlock != 0)
+        {
+            shared = VByteCompressor::ReadVUInt32(mCursor);
+        }
+        uint32_t suffixLen = VByteCompressor::ReadVUInt32(mCursor);
+        mTerm.resize(shared);
+        mTerm.append(mCursor, suffixLen);
+        mCursor += suffixLen;
+        uint64_t key;
+        memcpy(&key, mCursor, sizeof(key));
+        mCursor += sizeof(key);
+        mKey = key;
+    }
+
+private:
+    const OrderedTermDictionaryReader* mReader;
+    char* mCursor;
+    uint32_t mTermIdx;
+    std::string mTerm;
+    dictkey_t mKey;
+};
+
+OrderedTermDictionaryReader::OrderedTermDictionaryReader()
+    : mData(NULL)
+    , mBlockOffsets(NULL)
+    , mDataLength(0)
+    , mTermCount(0)
+    , mTermCountPerBlock(OrderedTermDictionaryWriter::TERM_COUNT_PER_BLOCK)
+    , mBlockCount(0)
+{
+}
+
+OrderedTermDictionaryReader::~OrderedTermDictionaryReader()
+{
+}
+
+void OrderedTermDictionaryReader::Open(const DirectoryPtr& directory, const string& fileName)
+{
+    mFileReader = directory->CreateIntegratedFileReader(fileName);
+    size_t fileLength = mFileReader->GetLength();
+    mData = (const char*)mFileReader->GetBaseAddress();
+    if (!mData)
+    {
+        mBuffer.resize(fileLength);
+        if (fileLength > 0 && mFileReader->Read(mBuffer.data(), fileLength, 0) != fileLength)
+        {
+            INDEXLIB_FATAL_ERROR(FileIO, "read ordered term dictionary [%s] failed",
+                    mFileReader->GetPath().c_str());
+        }
+        mData = mBuffer.data();
+    }
+
+    const size_t tailLength = sizeof(uint32_t) * 4;
+    if (fileLength < tailLength)
+    {
+        INDEXLIB_FATAL_ERROR(IndexCollapsed, "ordered term dictionary [%s] is too short",
+                             mFileReader->GetPath().c_str());
+    }
+    uint32_t tail[4];
+    memcpy(tail, mData + fileLength - tailLength, tailLength);
+    mTermCount = tail[0];
+    mTermCountPerBlock = tail[1];
+    mBlockCount = tail[2];
+    uint32_t version = tail[3];
+    if (version != OrderedTermDictionaryWriter::ORDERED_TERM_DICTIONARY_VERSION
+        || mTermCountPerBlock == 0
+        || mBlockCount != (mTermCount + mTermCountPerBlock - 1) / mTermCountPerBlock
+        || fileLength < tailLength + mBlockCount * sizeof(uint64_t))
+    {
+        INDEXLIB_FATAL_ERROR(IndexCollapsed, "bad ordered term dictionary [%s], version [%u], "
+                             "term count [%u], block count [%u]",
+                             mFileReader->GetPath().c_str(), version, mTermCount, mBlockCount);
+    }
+    mDataLength = fileLength - tailLength - mBlockCount * sizeof(uint64_t);
+    mBlockOffsets = (const uint64_t*)(mData + mDataLength);
+}
+
+OrderedTermIteratorPtr OrderedTermDictionaryReader::CreateIterator() const
+{
+    return OrderedTermIteratorPtr(new OrderedTermDictionaryIterator(this));
+}
+
+ConstString OrderedTermDictionaryReader::GetBlockFirstTerm(uint32_t blockIdx) const
+{
+    char* cursor = (char*)mData + mBlockOffsets[blockIdx];
+    uint32_t len = VByteCompressor::ReadVUInt32(cursor);
+    return ConstString(cursor, len);
+}
+
+uint32_t OrderedTermDictionaryReader::LocateBlock(const ConstString& term) const
+{
+    // last block whose first term is not greater than term
+    uint32_t begin = 0;
+    uint32_t end = mBlockCount;
+    while (begin < end)
+    {
+        uint32_t mid = begin + (end - begin) / 2;
+        if (CompareTerm(GetBlockFirstTerm(mid), term) <= 0)
+        {
+            begin = mid + 1;
+        }
+        else
+        {
+            end = mid;
+        }
+    }
+    return begin > 0 ? begin - 1 : 0;
+}
+
+IE_NAMESPACE_END(index);
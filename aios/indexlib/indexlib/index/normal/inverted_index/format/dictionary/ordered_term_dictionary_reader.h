@@ -0,0 +1,54 @@
+#ifndef __INDEXLIB_ORDERED_TERM_DICTIONARY_READER_H
+#define __INDEXLIB_ORDERED_TERM_DICTIONARY_READER_H
+
+#include <tr1/memory>
+#include "indexlib/indexlib.h"
+#include "indexlib/common_define.h"
+#include "indexlib/index/normal/inverted_index/format/dictionary/ordered_term_iterator.h"
+
+DECLARE_REFERENCE_CLASS(file_system, Directory);
+DECLARE_REFERENCE_CLASS(file_system, FileReader);
+
+IE_NAMESPACE_BEGIN(index);
+
+// reads the file of OrderedTermDictionaryWriter, iterators locate the
+// block by binary search on block first terms and scan inside the block
+class OrderedTermDictionaryReader
+{
+public:
+    OrderedTermDictionaryReader();
+    ~OrderedTermDictionaryReader();
+
+public:
+    void Open(const file_system::DirectoryPtr& directory, const std::string& fileName);
+    // iterator positioned at the first term
+    OrderedTermIteratorPtr CreateIterator() const;
+
+    uint32_t GetTermCount() const { return mTermCount; }
+    uint32_t GetBlockCount() const { return mBlockCount; }
+
+private:
+    // first term of block, for binary search
+    autil::ConstString GetBlockFirstTerm(uint32_t blockIdx) const;
+    uint32_t LocateBlock(const autil::ConstString& term) const;
+
+private:
+    file_system::FileReaderPtr mFileReader;
+    std::vector<char> mBuffer;
+    const char* mData;
+    const uint64_t* mBlockOffsets;
+    size_t mDataLength;
+    uint32_t mTermCount;
+    uint32_t mTermCountPerBlock;
+    uint32_t mBlockCount;
+
+private:
+    friend class OrderedTermDictionaryIterator;
+    IE_LOG_DECLARE();
+};
+
+DEFINE_SHARED_PTR(OrderedTermDictionaryReader);
+
+IE_NAMESPACE_END(index);
+
+#endif //__INDEXLIB_ORDERED_TERM_DICTIONARY_READER_H
@@ -0,0 +1,96 @@
+#include "indexlib/index/normal/inverted_index/format/dictionary/ordered_term_dictionary_writer.h"
+#include "indexlib/file_system/directory.h"
+#include "indexlib/file_system/file_writer.h"
+#include "indexlib/misc/exception.h"
+
+using namespace std;
+using namespace autil;
+IE_NAMESPACE_USE(file_system);
+
+IE_NAMESPACE_BEGIN(index);
+IE_LOG_SETUP(index, OrderedTermDictionaryWriter);
+
+const uint32_t OrderedTermDictionaryWriter::TERM_COUNT_PER_BLOCK;
+const uint32_t OrderedTermDictionaryWriter::ORDERED_TERM_DICTIONARY_VERSION;
+
+OrderedTermDictionaryWriter::OrderedTermDictionaryWriter()
+    : mTermCount(0)
+{
+}
+
+OrderedTermDictionaryWriter::~OrderedTermDictionaryWriter()
+{
+}
+
+void OrderedTermDictionaryWriter::Open(const DirectoryPtr& directory, const string& fileName)
+{
+    assert(directory);
+    mFile = directory->CreateFileWriter(fileName);
+    mLastTerm.clear();
+    mTermCount = 0;
+    mBlockOffsets.clear();
+}
+
+void OrderedTermDictionaryWriter::AddTerm(const ConstString& term, dictkey_t key)
+{
+    assert(mFile);
+    size_t shared = 0;
+    if (mTermCount > 0)
+    {
+        size_t maxShared = min(mLastTerm.size(), term.size());
+        while (shared < maxShared && mLastTerm[shared] == term.data()[shared])
+        {
+            ++shared;
+        }
+        bool isGreater = shared < term.size() &&
+                         (shared == mLastTerm.size() ||
+                          (uint8_t)term.data()[shared] > (uint8_t)mLastTerm[shared]);
+        if (!isGreater)
+        {
+            INDEXLIB_FATAL_ERROR(InconsistentState,
+                    "term [%s] is not greater than last term [%s] in [%s]",
+                    string(term.data(), term.size()).c_str(), mLastTerm.c_str(),
+                    mFile->GetPath().c_str());
+        }
+    }
+
+    if (mTermCount % TERM_COUNT_PER_BLOCK == 0)
+    {
+        mBlockOffsets.push_back(mFile->GetLength());
+        mFile->WriteVUInt32(term.size());
+        mFile->Write(term.data(), term.size());
+    }
+    else
+    {
+        mFile->WriteVUInt32(shared);
+        mFile->WriteVUInt32(term.size() - shared);
+        mFile->Write(term.data() + shared, term.size() - shared);
+    }
+    uint64_t termKey = key;
+    mFile->Write(&termKey, sizeof(termKey));
+    mLastTerm.assign(term.data(), term.size());
+    ++mTermCount;
+}
+
+void OrderedTermDictionaryWriter::Close()
+{
+    if (!mFile)
+    {
+        return;
+    }
+    if (!mBlockOffsets.empty())
+    {
+        mFile->Write(mBlockOffsets.data(), mBlockOffsets.size() * sizeof(uint64_t));
+    }
+    uint32_t blockSize = TERM_COUNT_PER_BLOCK;
+    uint32_t blockCount = mBlockOffsets.size();
+    uint32_t version = ORDERED_TERM_DICTIONARY_VERSION;
+    mFile->Write(&mTermCount, sizeof(mTermCount));
+    mFile->Write(&blockSize, sizeof(blockSize));
+    mFile->Write(&blockCount, sizeof(blockCount));
+    mFile->Write(&version, sizeof(version));
+    mFile->Close();
+    mFile.reset();
+}
+
+IE_NAMESPACE_END(index);
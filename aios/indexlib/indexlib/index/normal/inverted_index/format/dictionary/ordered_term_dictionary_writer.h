@@ -0,0 +1,51 @@
+#ifndef __INDEXLIB_ORDERED_TERM_DICTIONARY_WRITER_H
+#define __INDEXLIB_ORDERED_TERM_DICTIONARY_WRITER_H
+
+#include <tr1/memory>
+#include <autil/ConstString.h>
+#include "indexlib/indexlib.h"
+#include "indexlib/common_define.h"
+
+DECLARE_REFERENCE_CLASS(file_system, Directory);
+DECLARE_REFERENCE_CLASS(file_system, FileWriter);
+
+IE_NAMESPACE_BEGIN(index);
+
+// front coded sorted term blocks:
+//   block:  [vuint32 len][term][uint64 key]
+//           ([vuint32 shared][vuint32 suffix len][suffix][uint64 key]) * (TERM_COUNT_PER_BLOCK - 1)
+//   tail:   [uint64 block offset] * blockCount
+//           [uint32 termCount][uint32 termCountPerBlock][uint32 blockCount][uint32 version]
+class OrderedTermDictionaryWriter
+{
+public:
+    OrderedTermDictionaryWriter();
+    ~OrderedTermDictionaryWriter();
+
+public:
+    void Open(const file_system::DirectoryPtr& directory, const std::string& fileName);
+    // terms should be added in strictly increasing byte order
+    void AddTerm(const autil::ConstString& term, dictkey_t key);
+    void Close();
+
+    uint32_t GetTermCount() const { return mTermCount; }
+
+public:
+    static const uint32_t TERM_COUNT_PER_BLOCK = 32;
+    static const uint32_t ORDERED_TERM_DICTIONARY_VERSION = 1;
+
+private:
+    file_system::FileWriterPtr mFile;
+    std::string mLastTerm;
+    uint32_t mTermCount;
+    std::vector<uint64_t> mBlockOffsets;
+
+private:
+    IE_LOG_DECLARE();
+};
+
+DEFINE_SHARED_PTR(OrderedTermDictionaryWriter);
+
+IE_NAMESPACE_END(index);
+
+#endif //__INDEXLIB_ORDERED_TERM_DICTIONARY_WRITER_H
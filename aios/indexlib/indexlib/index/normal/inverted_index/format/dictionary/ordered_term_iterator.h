@@ -0,0 +1,33 @@
+#ifndef __INDEXLIB_ORDERED_TERM_ITERATOR_H
+#define __INDEXLIB_ORDERED_TERM_ITERATOR_H
+
+#include <tr1/memory>
+#include <autil/ConstString.h>
+#include "indexlib/indexlib.h"
+#include "indexlib/common_define.h"
+
+IE_NAMESPACE_BEGIN(index);
+
+// iterates term texts of an index in byte order, the key of a term is the
+// dictkey_t of its posting in the hash based dictionary
+class OrderedTermIterator
+{
+public:
+    OrderedTermIterator() {}
+    virtual ~OrderedTermIterator() {}
+
+public:
+    // position at the first term not less than lowerBound
+    virtual void Seek(const autil::ConstString& lowerBound) = 0;
+    virtual bool IsValid() const = 0;
+    virtual void Next() = 0;
+    // valid until Next or Seek
+    virtual autil::ConstString GetTerm() const = 0;
+    virtual dictkey_t GetKey() const = 0;
+};
+
+DEFINE_SHARED_PTR(OrderedTermIterator);
+
+IE_NAMESPACE_END(index);
+
+#endif //__INDEXLIB_ORDERED_TERM_ITERATOR_H
@@ -0,0 +1,241 @@
+#include <cstring>
+#include "indexlib/index/normal/inverted_index/format/dictionary/ordered_term_matcher.h"
+
+using namespace std;
+using namespace autil;
+
+IE_NAMESPACE_BEGIN(index);
+IE_LOG_SETUP(index, OrderedTermMatcher);
+
+int OrderedTermMatcher::Compare(const ConstString& left, const ConstString& right)
+{
+    size_t len = min(left.size(), right.size());
+    int ret = len > 0 ? memcmp(left.data(), right.data(), len) : 0;
+    if (ret != 0)
+    {
+        return ret;
+    }
+    return left.size() < right.size() ? -1 : (left.size() > right.size() ? 1 : 0);
+}
+
+bool OrderedTermMatcher::StartsWith(const ConstString& term, const string& prefix)
+{
+    return term.size() >= prefix.size()
+        && memcmp(term.data(), prefix.data(), prefix.size()) == 0;
+}
+
+string OrderedTermMatcher::GetPrefixUpperBound(const string& prefix)
+{
+    string upper = prefix;
+    while (!upper.empty() && (uint8_t)upper[upper.size() - 1] == 0xff)
+    {
+        upper.resize(upper.size() - 1);
+    }
+    if (!upper.empty())
+    {
+        upper[upper.size() - 1] = (char)((uint8_t)upper[upper.size() - 1] + 1);
+    }
+    return upper;
+}
+
+bool OrderedTermMatcher::RangeMatch(const OrderedTermIteratorPtr& iter,
+                                    const ConstString& lower, bool lowerInclusive,
+                                    const ConstString& upper, bool upperInclusive,
+                                    size_t maxTerms, TermKeyVector& terms)
+{
+    iter->Seek(lower);
+    if (!lowerInclusive && iter->IsValid() && Compare(iter->GetTerm(), lower) == 0)
+    {
+        iter->Next();
+    }
+    for (; iter->IsValid(); iter->Next())
+    {
+        ConstString term = iter->GetTerm();
+        if (!upper.empty())
+        {
+            int ret = Compare(term, upper);
+            if (ret > 0 || (ret == 0 && !upperInclusive))
+            {
+                break;
+            }
+        }
+        if (terms.size() >= maxTerms)
+        {
+            return false;
+        }
+        terms.push_back(make_pair(string(term.data(), term.size()), iter->GetKey()));
+    }
+    return true;
+}
+
+bool OrderedTermMatcher::PrefixMatch(const OrderedTermIteratorPtr& iter,
+                                     const ConstString& prefix,
+                                     size_t maxTerms, TermKeyVector& terms)
+{
+    string upper = GetPrefixUpperBound(string(prefix.data(), prefix.size()));
+    return RangeMatch(iter, prefix, true, ConstString(upper), false, maxTerms, terms);
+}
+
+bool OrderedTermMatcher::IsWildcardMatch(const char* pattern, size_t patternLen,
+                                         const char* term, size_t termLen)
+{
+    // greedy match with backtrack to the last '*'
+    size_t p = 0;
+    size_t t = 0;
+    size_t starPos = patternLen;
+    size_t starMatch = 0;
+    while (t < termLen)
+    {
+        if (p < patternLen && (pattern[p] == '?' || pattern[p] == term[t]))
+        {
+            ++p;
+            ++t;
+        }
+        else if (p < patternLen && pattern[p] == '*')
+        {
+            starPos = p++;
+            starMatch = t;
+        }
+        else if (starPos != patternLen)
+        {
+            p = starPos + 1;
+            t = ++starMatch;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    while (p < patternLen && pattern[p] == '*')
+    {
+        ++p;
+    }
+    return p == patternLen;
+}
+
+bool OrderedTermMatcher::WildcardMatch(const OrderedTermIteratorPtr& iter,
+                                       const ConstString& pattern,
+                                       size_t maxTerms, TermKeyVector& terms)
+{
+    size_t literalLen = 0;
+    while (literalLen < pattern.size() && pattern.data()[literalLen] != '*'
+           && pattern.data()[literalLen] != '?')
+    {
+        ++literalLen;
+    }
+    string prefix(pattern.data(), literalLen);
+    if (literalLen == pattern.size())
+    {
+        iter->Seek(pattern);
+        if (iter->IsValid() && Compare(iter->GetTerm(), pattern) == 0)
+        {
+            if (terms.size() >= maxTerms)
+            {
+                return false;
+            }
+            terms.push_back(make_pair(prefix, iter->GetKey()));
+        }
+        return true;
+    }
+    for (iter->Seek(ConstString(prefix)); iter->IsValid(); iter->Next())
+    {
+        ConstString term = iter->GetTerm();
+        if (!StartsWith(term, prefix))
+        {
+            break;
+        }
+        if (!IsWildcardMatch(pattern.data() + literalLen, pattern.size() - literalLen,
+                             term.data() + literalLen, term.size() - literalLen))
+        {
+            continue;
+        }
+        if (terms.size() >= maxTerms)
+        {
+            return false;
+        }
+        terms.push_back(make_pair(string(term.data(), term.size()), iter->GetKey()));
+    }
+    return true;
+}
+
+bool OrderedTermMatcher::FuzzyMatch(const OrderedTermIteratorPtr& iter,
+                                    const ConstString& term, uint32_t maxEdits,
+                                    size_t prefixLength, size_t maxTerms,
+                                    TermKeyVector& terms)
+{
+    prefixLength = min(prefixLength, term.size());
+    string prefix(term.data(), prefixLength);
+    size_t termLen = term.size();
+
+    // rows[i] is the dp row of the first i bytes of lastTerm
+    vector<vector<uint32_t> > rows(1, vector<uint32_t>(termLen + 1));
+    for (size_t j = 0; j <= termLen; ++j)
+    {
+        rows[0][j] = j;
+    }
+    string lastTerm;
+
+    iter->Seek(ConstString(prefix));
+    while (iter->IsValid())
+    {
+        ConstString candidate = iter->GetTerm();
+        if (!StartsWith(candidate, prefix))
+        {
+            break;
+        }
+        size_t shared = 0;
+        size_t maxShared = min(lastTerm.size(), candidate.size());
+        while (shared < maxShared && lastTerm[shared] == candidate.data()[shared])
+        {
+            ++shared;
+        }
+        rows.resize(shared + 1);
+        lastTerm.resize(shared);
+
+        bool pruned = false;
+        for (size_t i = shared; i < candidate.size(); ++i)
+        {
+            rows.push_back(vector<uint32_t>(termLen + 1));
+            const vector<uint32_t>& prev = rows[i];
+            vector<uint32_t>& row = rows[i + 1];
+            char c = candidate.data()[i];
+            row[0] = prev[0] + 1;
+            uint32_t rowMin = row[0];
+            for (size_t j = 1; j <= termLen; ++j)
+            {
+                uint32_t cost = term.data()[j - 1] == c ? 0 : 1;
+                row[j] = min(min(row[j - 1] + 1, prev[j] + 1), prev[j - 1] + cost);
+                rowMin = min(rowMin, row[j]);
+            }
+            lastTerm.push_back(c);
+            if (rowMin > maxEdits)
+            {
+                pruned = true;
+                break;
+            }
+        }
+        if (pruned)
+        {
+            // no term with the prefix lastTerm can match
+            string upper = GetPrefixUpperBound(lastTerm);
+            if (upper.empty())
+            {
+                break;
+            }
+            iter->Seek(ConstString(upper));
+            continue;
+        }
+        if (rows.back()[termLen] <= maxEdits)
+        {
+            if (terms.size() >= maxTerms)
+            {
+                return false;
+            }
+            terms.push_back(make_pair(lastTerm, iter->GetKey()));
+        }
+        iter->Next();
+    }
+    return true;
+}
+
+IE_NAMESPACE_END(index);
@@ -0,0 +1,62 @@
+#ifndef __INDEXLIB_ORDERED_TERM_MATCHER_H
+#define __INDEXLIB_ORDERED_TERM_MATCHER_H
+
+#include <tr1/memory>
+#include <autil/ConstString.h>
+#include "indexlib/indexlib.h"
+#include "indexlib/common_define.h"
+#include "indexlib/index/normal/inverted_index/format/dictionary/ordered_term_iterator.h"
+
+IE_NAMESPACE_BEGIN(index);
+
+// enumerates terms of an OrderedTermIterator in byte order, at most
+// maxTerms terms are appended, return false if truncated by maxTerms
+class OrderedTermMatcher
+{
+public:
+    typedef std::vector<std::pair<std::string, dictkey_t> > TermKeyVector;
+
+public:
+    // empty upper means no upper bound
+    static bool RangeMatch(const OrderedTermIteratorPtr& iter,
+                           const autil::ConstString& lower, bool lowerInclusive,
+                           const autil::ConstString& upper, bool upperInclusive,
+                           size_t maxTerms, TermKeyVector& terms);
+
+    static bool PrefixMatch(const OrderedTermIteratorPtr& iter,
+                            const autil::ConstString& prefix,
+                            size_t maxTerms, TermKeyVector& terms);
+
+    // '*' matches any bytes, '?' matches one byte, no escape
+    static bool WildcardMatch(const OrderedTermIteratorPtr& iter,
+                              const autil::ConstString& pattern,
+                              size_t maxTerms, TermKeyVector& terms);
+
+    // terms within maxEdits byte level levenshtein distance of term, the
+    // first prefixLength bytes should match exactly. dp rows are shared by
+    // the common prefix of adjacent terms, and subtrees whose row minimum
+    // exceeds maxEdits are skipped by seeking past the prefix
+    static bool FuzzyMatch(const OrderedTermIteratorPtr& iter,
+                           const autil::ConstString& term, uint32_t maxEdits,
+                           size_t prefixLength, size_t maxTerms, TermKeyVector& terms);
+
+public:
+    // smallest string greater than all strings with the prefix, empty if
+    // not exist (prefix is empty or all 0xff)
+    static std::string GetPrefixUpperBound(const std::string& prefix);
+    static bool IsWildcardMatch(const char* pattern, size_t patternLen,
+                                const char* term, size_t termLen);
+    static int Compare(const autil::ConstString& left, const autil::ConstString& right);
+
+private:
+    static bool StartsWith(const autil::ConstString& term, const std::string& prefix);
+
+private:
+    IE_LOG_DECLARE();
+};
+
+DEFINE_SHARED_PTR(OrderedTermMatcher);
+
+IE_NAMESPACE_END(index);
+
+#endif //__INDEXLIB_ORDERED_TERM_MATCHER_H
@@ -0,0 +1,295 @@
+#include <algorithm>
+#include <functional>
+#include "indexlib/index/normal/inverted_index/format/dictionary/test/ordered_term_dictionary_unittest.h"
+
+using namespace std;
+using namespace autil;
+IE_NAMESPACE_USE(file_system);
+
+IE_NAMESPACE_BEGIN(index);
+IE_LOG_SETUP(index, OrderedTermDictionaryTest);
+
+OrderedTermDictionaryTest::OrderedTermDictionaryTest()
+{
+}
+
+OrderedTermDictionaryTest::~OrderedTermDictionaryTest()
+{
+}
+
+void OrderedTermDictionaryTest::CaseSetUp()
+{
+}
+
+void OrderedTermDictionaryTest::CaseTearDown()
+{
+}
+
+void OrderedTermDictionaryTest::PrepareTerms(size_t count)
+{
+    // three letter words of "abcd" and some longer ones, more than one block
+    const char letters[] = "abcd";
+    mTerms.clear();
+    for (size_t i = 0; i < count; ++i)
+    {
+        string term;
+        size_t value = i;
+        do
+        {
+            term.push_back(letters[value % 4]);
+            value /= 4;
+        } while (value > 0);
+        mTerms.push_back(term);
+        mTerms.push_back(term + "xyz");
+    }
+    sort(mTerms.begin(), mTerms.end());
+    mTerms.erase(unique(mTerms.begin(), mTerms.end()), mTerms.end());
+
+    OrderedTermDictionaryWriter writer;
+    writer.Open(GET_PARTITION_DIRECTORY(), "ordered_term_dictionary");
+    for (size_t i = 0; i < mTerms.size(); ++i)
+    {
+        writer.AddTerm(ConstString(mTerms[i]), (dictkey_t)i);
+    }
+    writer.Close();
+    ASSERT_EQ(mTerms.size(), (size_t)writer.GetTermCount());
+
+    mReader.reset(new OrderedTermDictionaryReader);
+    mReader->Open(GET_PARTITION_DIRECTORY(), "ordered_term_dictionary");
+}
+
+OrderedTermIteratorPtr OrderedTermDictionaryTest::CreateDiskIterator()
+{
+    return mReader->CreateIterator();
+}
+
+uint32_t OrderedTermDictionaryTest::EditDistance(const string& left, const string& right)
+{
+    vector<vector<uint32_t> > dp(left.size() + 1, vector<uint32_t>(right.size() + 1));
+    for (size_t i = 0; i <= left.size(); ++i)
+    {
+        for (size_t j = 0; j <= right.size(); ++j)
+        {
+            if (i == 0 || j == 0)
+            {
+                dp[i][j] = i + j;
+                continue;
+            }
+            dp[i][j] = min(min(dp[i - 1][j] + 1, dp[i][j - 1] + 1),
+                           dp[i - 1][j - 1] + (left[i - 1] == right[j - 1] ? 0 : 1));
+        }
+    }
+    return dp[left.size()][right.size()];
+}
+
+OrderedTermMatcher::TermKeyVector OrderedTermDictionaryTest::ExpectedTerms(
+        const function<bool(const string&)>& predicate) const
+{
+    OrderedTermMatcher::TermKeyVector expected;
+    for (size_t i = 0; i < mTerms.size(); ++i)
+    {
+        if (predicate(mTerms[i]))
+        {
+            expected.push_back(make_pair(mTerms[i], (dictkey_t)i));
+        }
+    }
+    return expected;
+}
+
+string OrderedTermDictionaryTest::ToString(const OrderedTermMatcher::TermKeyVector& terms)
+{
+    string result;
+    for (size_t i = 0; i < terms.size(); ++i)
+    {
+        if (i > 0)
+        {
+            result += ",";
+        }
+        result += terms[i].first;
+    }
+    return result;
+}
+
+void OrderedTermDictionaryTest::TestWriteAndRead()
+{
+    PrepareTerms(200);
+    ASSERT_EQ(mTerms.size(), (size_t)mReader->GetTermCount());
+    ASSERT_TRUE(mReader->GetBlockCount() > 1);
+
+    OrderedTermIteratorPtr iter = CreateDiskIterator();
+    for (size_t i = 0; i < mTerms.size(); ++i, iter->Next())
+    {
+        ASSERT_TRUE(iter->IsValid());
+        ASSERT_EQ(mTerms[i], iter->GetTerm().toString());
+        ASSERT_EQ((dictkey_t)i, iter->GetKey());
+    }
+    ASSERT_FALSE(iter->IsValid());
+
+    // seek to every term and between terms
+    for (size_t i = 0; i < mTerms.size(); ++i)
+    {
+        iter->Seek(ConstString(mTerms[i]));
+        ASSERT_TRUE(iter->IsValid());
+        ASSERT_EQ((dictkey_t)i, iter->GetKey());
+
+        string lower = mTerms[i] + string(1, '\0');
+        iter->Seek(ConstString(lower));
+        if (i + 1 < mTerms.size())
+        {
+            ASSERT_TRUE(iter->IsValid());
+            ASSERT_EQ((dictkey_t)(i + 1), iter->GetKey());
+        }
+        else
+        {
+            ASSERT_FALSE(iter->IsValid());
+        }
+    }
+    iter->Seek(ConstString());
+    ASSERT_EQ((dictkey_t)0, iter->GetKey());
+}
+
+void OrderedTermDictionaryTest::TestInMemDictionary()
+{
+    InMemOrderedTermDictionary dictionary;
+    dictionary.AddTerm(ConstString("banana"), 2);
+    dictionary.AddTerm(ConstString("apple"), 1);
+    dictionary.AddTerm(ConstString("cherry"), 3);
+    dictionary.AddTerm(ConstString("apple"), 1);
+    ASSERT_EQ((size_t)3, dictionary.GetTermCount());
+    ASSERT_TRUE(dictionary.EstimateMemoryUse() > 0);
+    {
+        OrderedTermIteratorPtr iter = dictionary.CreateIterator();
+        OrderedTermMatcher::TermKeyVector terms;
+        ASSERT_TRUE(OrderedTermMatcher::RangeMatch(iter, ConstString("b"), true,
+                        ConstString(), true, 10, terms));
+        ASSERT_EQ(string("banana,cherry"), ToString(terms));
+    }
+    {
+        // an alive iterator does not hold the lock, adding terms goes on
+        OrderedTermIteratorPtr iter = dictionary.CreateIterator();
+        ASSERT_EQ(string("apple"), iter->GetTerm().toString());
+        dictionary.AddTerm(ConstString("apricot"), 4);
+        iter->Next();
+        ASSERT_EQ(string("apricot"), iter->GetTerm().toString());
+        ASSERT_EQ((dictkey_t)4, iter->GetKey());
+        dictionary.AddTerm(ConstString("avocado"), 5);
+        iter->Seek(ConstString("b"));
+        ASSERT_EQ(string("banana"), iter->GetTerm().toString());
+    }
+
+    dictionary.Dump(GET_PARTITION_DIRECTORY(), "dumped");
+    OrderedTermDictionaryReader reader;
+    reader.Open(GET_PARTITION_DIRECTORY(), "dumped");
+    OrderedTermIteratorPtr iter = reader.CreateIterator();
+    ASSERT_EQ(string("apple"), iter->GetTerm().toString());
+    ASSERT_EQ((dictkey_t)1, iter->GetKey());
+    iter->Next();
+    ASSERT_EQ(string("banana"), iter->GetTerm().toString());
+    iter->Next();
+    ASSERT_EQ(string("apricot"), iter->GetTerm().toString());
+    iter->Next();
+    ASSERT_EQ(string("avocado"), iter->GetTerm().toString());
+    iter->Next();
+    ASSERT_EQ(string("banana"), iter->GetTerm().toString());
+    iter->Next();
+    ASSERT_EQ(string("cherry"), iter->GetTerm().toString());
+    ASSERT_EQ((dictkey_t)3, iter->GetKey());
+    iter->Next();
+    ASSERT_FALSE(iter->IsValid());
+}
+
+void OrderedTermDictionaryTest::TestRangeAndPrefixMatch()
+{
+    PrepareTerms(200);
+    OrderedTermMatcher::TermKeyVector terms;
+    ASSERT_TRUE(OrderedTermMatcher::PrefixMatch(CreateDiskIterator(), ConstString("dd"),
+                    100, terms));
+    ASSERT_EQ(string("dd,ddxyz"), ToString(terms));
+
+    terms.clear();
+    ASSERT_TRUE(OrderedTermMatcher::RangeMatch(CreateDiskIterator(), ConstString("dd"), false,
+                    ConstString("ddxyz"), true, 100, terms));
+    ASSERT_EQ(string("ddxyz"), ToString(terms));
+
+    terms.clear();
+    ASSERT_TRUE(OrderedTermMatcher::RangeMatch(CreateDiskIterator(), ConstString("b"), true,
+                    ConstString("bb"), false, 100, terms));
+    ASSERT_EQ(ExpectedTerms([](const string& term) { return term >= "b" && term < "bb"; }),
+              terms);
+
+    terms.clear();
+    ASSERT_FALSE(OrderedTermMatcher::PrefixMatch(CreateDiskIterator(), ConstString("a"),
+                    3, terms));
+    OrderedTermMatcher::TermKeyVector expected =
+        ExpectedTerms([](const string& term) { return term[0] == 'a'; });
+    expected.resize(3);
+    ASSERT_EQ(expected, terms);
+
+    ASSERT_EQ(string("ab"), OrderedTermMatcher::GetPrefixUpperBound("aa"));
+    ASSERT_EQ(string("b"), OrderedTermMatcher::GetPrefixUpperBound("a\xff"));
+    ASSERT_EQ(string(), OrderedTermMatcher::GetPrefixUpperBound("\xff\xff"));
+}
+
+void OrderedTermDictionaryTest::TestWildcardMatch()
+{
+    ASSERT_TRUE(OrderedTermMatcher::IsWildcardMatch("a*c", 3, "abbc", 4));
+    ASSERT_TRUE(OrderedTermMatcher::IsWildcardMatch("a?c", 3, "abc", 3));
+    ASSERT_TRUE(OrderedTermMatcher::IsWildcardMatch("*", 1, "", 0));
+    ASSERT_FALSE(OrderedTermMatcher::IsWildcardMatch("a?c", 3, "ac", 2));
+    ASSERT_FALSE(OrderedTermMatcher::IsWildcardMatch("a*c", 3, "abcd", 4));
+
+    PrepareTerms(200);
+    OrderedTermMatcher::TermKeyVector terms;
+    ASSERT_TRUE(OrderedTermMatcher::WildcardMatch(CreateDiskIterator(), ConstString("d?d*z"),
+                    100, terms));
+    ASSERT_EQ(ExpectedTerms([](const string& term) {
+                        return term.size() >= 4 && term[0] == 'd' && term[2] == 'd'
+                            && term[term.size() - 1] == 'z';
+                    }), terms);
+    ASSERT_FALSE(terms.empty());
+
+    terms.clear();
+    ASSERT_TRUE(OrderedTermMatcher::WildcardMatch(CreateDiskIterator(), ConstString("cc"),
+                    100, terms));
+    ASSERT_EQ(string("cc"), ToString(terms));
+}
+
+void OrderedTermDictionaryTest::TestFuzzyMatch()
+{
+    PrepareTerms(300);
+    string queries[] = { "abc", "dcba", "bxyz", "aaaaa", "" };
+    for (size_t q = 0; q < sizeof(queries) / sizeof(queries[0]); ++q)
+    {
+        for (uint32_t maxEdits = 0; maxEdits <= 2; ++maxEdits)
+        {
+            for (size_t prefixLength = 0; prefixLength <= 1; ++prefixLength)
+            {
+                const string& query = queries[q];
+                OrderedTermMatcher::TermKeyVector expected = ExpectedTerms(
+                        [&](const string& term) {
+                            return term.compare(0, prefixLength, query, 0, prefixLength) == 0
+                                && EditDistance(term, query) <= maxEdits;
+                        });
+                OrderedTermMatcher::TermKeyVector terms;
+                ASSERT_TRUE(OrderedTermMatcher::FuzzyMatch(CreateDiskIterator(),
+                                ConstString(queries[q]), maxEdits, prefixLength, 10000, terms));
+                ASSERT_EQ(ToString(expected), ToString(terms))
+                    << queries[q] << ":" << maxEdits << ":" << prefixLength;
+                ASSERT_TRUE(expected == terms);
+            }
+        }
+    }
+}
+
+void OrderedTermDictionaryTest::TestAddTermOutOfOrder()
+{
+    OrderedTermDictionaryWriter writer;
+    writer.Open(GET_PARTITION_DIRECTORY(), "bad");
+    writer.AddTerm(ConstString("b"), 1);
+    ASSERT_THROW(writer.AddTerm(ConstString("a"), 2), misc::InconsistentStateException);
+    ASSERT_THROW(writer.AddTerm(ConstString("b"), 2), misc::InconsistentStateException);
+    writer.AddTerm(ConstString("ba"), 3);
+    writer.Close();
+}
+
+IE_NAMESPACE_END(index);
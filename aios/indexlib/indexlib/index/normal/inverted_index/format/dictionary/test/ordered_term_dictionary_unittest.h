@@ -0,0 +1,59 @@
+#ifndef __INDEXLIB_ORDEREDTERMDICTIONARYTEST_H
+#define __INDEXLIB_ORDEREDTERMDICTIONARYTEST_H
+
+#include <functional>
+#include "indexlib/common_define.h"
+
+#include "indexlib/test/test.h"
+#include "indexlib/test/unittest.h"
+#include "indexlib/index/normal/inverted_index/format/dictionary/ordered_term_dictionary_reader.h"
+#include "indexlib/index/normal/inverted_index/format/dictionary/ordered_term_dictionary_writer.h"
+#include "indexlib/index/normal/inverted_index/format/dictionary/in_mem_ordered_term_dictionary.h"
+#include "indexlib/index/normal/inverted_index/format/dictionary/ordered_term_matcher.h"
+
+IE_NAMESPACE_BEGIN(index);
+
+class OrderedTermDictionaryTest : public INDEXLIB_TESTBASE
+{
+public:
+    OrderedTermDictionaryTest();
+    ~OrderedTermDictionaryTest();
+
+    DECLARE_CLASS_NAME(OrderedTermDictionaryTest);
+public:
+    void CaseSetUp() override;
+    void CaseTearDown() override;
+
+    void TestWriteAndRead();
+    void TestInMemDictionary();
+    void TestRangeAndPrefixMatch();
+    void TestWildcardMatch();
+    void TestFuzzyMatch();
+    void TestAddTermOutOfOrder();
+
+private:
+    void PrepareTerms(size_t count);
+    OrderedTermIteratorPtr CreateDiskIterator();
+    OrderedTermMatcher::TermKeyVector ExpectedTerms(
+            const std::function<bool(const std::string&)>& predicate) const;
+    static uint32_t EditDistance(const std::string& left, const std::string& right);
+    static std::string ToString(const OrderedTermMatcher::TermKeyVector& terms);
+
+private:
+    std::vector<std::string> mTerms;
+    OrderedTermDictionaryReaderPtr mReader;
+
+private:
+    IE_LOG_DECLARE();
+};
+
+INDEXLIB_UNIT_TEST_CASE(OrderedTermDictionaryTest, TestWriteAndRead);
+INDEXLIB_UNIT_TEST_CASE(OrderedTermDictionaryTest, TestInMemDictionary);
+INDEXLIB_UNIT_TEST_CASE(OrderedTermDictionaryTest, TestRangeAndPrefixMatch);
+INDEXLIB_UNIT_TEST_CASE(OrderedTermDictionaryTest, TestWildcardMatch);
+INDEXLIB_UNIT_TEST_CASE(OrderedTermDictionaryTest, TestFuzzyMatch);
+INDEXLIB_UNIT_TEST_CASE(OrderedTermDictionaryTest, TestAddTermOutOfOrder);
+
+IE_NAMESPACE_END(index);
+
+#endif //__INDEXLIB_ORDEREDTERMDICTIONARYTEST_H
@@ -0,0 +1,169 @@
+#include <math.h>
+#include <autil/TimeUtility.h>
+#include "indexlib/index/normal/inverted_index/perf_test/spatial_query_perf_unittest.h"
+#include "indexlib/index/normal/inverted_index/accessor/index_reader.h"
+#include "indexlib/index/normal/inverted_index/accessor/posting_iterator.h"
+#include "indexlib/common/field_format/spatial/shape/shape_creator.h"
+#include "indexlib/config/spatial_index_config.h"
+#include "indexlib/partition/online_partition.h"
+#include "indexlib/test/schema_maker.h"
+
+using namespace std;
+using namespace autil;
+using namespace autil::mem_pool;
+IE_NAMESPACE_USE(test);
+IE_NAMESPACE_USE(config);
+IE_NAMESPACE_USE(common);
+IE_NAMESPACE_USE(partition);
+
+IE_NAMESPACE_BEGIN(index);
+IE_LOG_SETUP(index, SpatialQueryPerfTest);
+
+namespace {
+// a city sized area, about 38km * 33km
+const double CITY_MIN_LON = 120.0;
+const double CITY_MIN_LAT = 30.1;
+const double CITY_MAX_LON = 120.4;
+const double CITY_MAX_LAT = 30.4;
+const size_t DOC_COUNT = 100000;
+const size_t QUERY_COUNT = 200;
+
+double RandomIn(double min, double max)
+{
+    return min + (max - min) * rand() / RAND_MAX;
+}
+}
+
+SpatialQueryPerfTest::SpatialQueryPerfTest()
+{
+}
+
+SpatialQueryPerfTest::~SpatialQueryPerfTest()
+{
+}
+
+void SpatialQueryPerfTest::CaseSetUp()
+{
+    string field = "pk:string:pk;coordinate:location";
+    string index = "pk:primarykey64:pk;spatial_index:spatial:coordinate";
+    mSchema = SchemaMaker::MakeSchema(field, index, "coordinate", "");
+    ASSERT_TRUE(mSchema);
+    SpatialIndexConfigPtr spatialIndexConfig = DYNAMIC_POINTER_CAST(SpatialIndexConfig,
+            mSchema->GetIndexSchema()->GetIndexConfig("spatial_index"));
+    spatialIndexConfig->SetMaxSearchDist(50000.0);
+    spatialIndexConfig->SetMaxDistError(20.0);
+
+    srand(2019);
+    stringstream ss;
+    // keep full precision so that brute force check sees indexed coordinates
+    ss.precision(17);
+    mPoints.clear();
+    for (size_t i = 0; i < DOC_COUNT; i++)
+    {
+        double lon = RandomIn(CITY_MIN_LON, CITY_MAX_LON);
+        double lat = RandomIn(CITY_MIN_LAT, CITY_MAX_LAT);
+        mPoints.push_back(make_pair(lon, lat));
+        ss << "cmd=add,pk=" << i << ",coordinate=" << lon << " " << lat << ";";
+    }
+    mPsm.reset(new PartitionStateMachine);
+    ASSERT_TRUE(mPsm->Init(mSchema, mOptions, GET_TEST_DATA_PATH()));
+    ASSERT_TRUE(mPsm->Transfer(BUILD_FULL, ss.str(), "", ""));
+}
+
+void SpatialQueryPerfTest::CaseTearDown()
+{
+}
+
+void SpatialQueryPerfTest::TestCircleQuery()
+{
+    vector<string> shapeStrs;
+    for (size_t i = 0; i < QUERY_COUNT; i++)
+    {
+        stringstream ss;
+        ss << RandomIn(CITY_MIN_LON, CITY_MAX_LON) << " "
+           << RandomIn(CITY_MIN_LAT, CITY_MAX_LAT) << ","
+           << RandomIn(1000, 5000);
+        shapeStrs.push_back(ss.str());
+    }
+    DoQuery("circle", shapeStrs);
+}
+
+void SpatialQueryPerfTest::TestPolygonQuery()
+{
+    // star shaped district polygons, concave but never self intersected
+    const size_t vertexCount = 12;
+    vector<string> shapeStrs;
+    for (size_t i = 0; i < QUERY_COUNT; i++)
+    {
+        double centerLon = RandomIn(CITY_MIN_LON, CITY_MAX_LON);
+        double centerLat = RandomIn(CITY_MIN_LAT, CITY_MAX_LAT);
+        stringstream ss;
+        for (size_t k = 0; k <= vertexCount; k++)
+        {
+            double angle = 2 * M_PI * (k % vertexCount) / vertexCount;
+            double radius = (k % 2 == 0) ? 0.05 : 0.03;
+            if (k > 0)
+            {
+                ss << ",";
+            }
+            ss << centerLon + radius * cos(angle) << " "
+               << centerLat + radius * sin(angle);
+        }
+        shapeStrs.push_back(ss.str());
+    }
+    DoQuery("polygon", shapeStrs);
+}
+
+void SpatialQueryPerfTest::DoQuery(const string& shapeName,
+                                   const vector<string>& shapeStrs)
+{
+    OnlinePartitionPtr onlinePart = DYNAMIC_POINTER_CAST(
+            OnlinePartition, mPsm->GetIndexPartition());
+    ASSERT_TRUE(onlinePart);
+    IndexReaderPtr indexReader = onlinePart->GetReader()->GetIndexReader("spatial_index");
+    ASSERT_TRUE(indexReader);
+
+    int64_t totalTime = 0;
+    uint64_t totalMatchCount = 0;
+    for (size_t i = 0; i < shapeStrs.size(); i++)
+    {
+        ShapePtr shape = ShapeCreator::Create(shapeName, shapeStrs[i]);
+        ASSERT_TRUE(shape) << shapeStrs[i];
+        Term term(shapeName + "(" + shapeStrs[i] + ")", "spatial_index");
+        Pool pool;
+        int64_t beginTime = TimeUtility::currentTime();
+        PostingIterator* iter = indexReader->Lookup(term, 1000, pt_default, &pool);
+        uint32_t matchCount = 0;
+        docid_t docId = 0;
+        while (iter && (docId = iter->SeekDoc(docId)) != INVALID_DOCID)
+        {
+            ++docId;
+            ++matchCount;
+        }
+        totalTime += TimeUtility::currentTime() - beginTime;
+        totalMatchCount += matchCount;
+        ASSERT_EQ(GetExpectDocCount(shape), matchCount) << shapeStrs[i];
+        if (iter)
+        {
+            POOL_COMPATIBLE_DELETE_CLASS(&pool, iter);
+        }
+    }
+    cout << shapeName << " query count: " << shapeStrs.size()
+         << ", avg match: " << totalMatchCount / shapeStrs.size()
+         << ", avg latency: " << totalTime / shapeStrs.size() << "us" << endl;
+}
+
+uint32_t SpatialQueryPerfTest::GetExpectDocCount(const ShapePtr& shape) const
+{
+    uint32_t count = 0;
+    for (size_t i = 0; i < mPoints.size(); i++)
+    {
+        if (shape->IsInnerCoordinate(mPoints[i].first, mPoints[i].second))
+        {
+            ++count;
+        }
+    }
+    return count;
+}
+
+IE_NAMESPACE_END(index);
@@ -0,0 +1,52 @@
+#ifndef __INDEXLIB_SPATIALQUERYPERFTEST_H
+#define __INDEXLIB_SPATIALQUERYPERFTEST_H
+
+#include "indexlib/common_define.h"
+
+#include "indexlib/test/test.h"
+#include "indexlib/test/unittest.h"
+#include "indexlib/config/index_partition_schema.h"
+#include "indexlib/config/index_partition_options.h"
+#include "indexlib/test/partition_state_machine.h"
+#include "indexlib/common/field_format/spatial/shape/shape.h"
+
+DECLARE_REFERENCE_CLASS(index, IndexReader);
+
+IE_NAMESPACE_BEGIN(index);
+
+// city scale radius and polygon queries over a location index, recall is
+// checked against a brute force scan of all docs
+class SpatialQueryPerfTest : public INDEXLIB_TESTBASE
+{
+public:
+    SpatialQueryPerfTest();
+    ~SpatialQueryPerfTest();
+
+    DECLARE_CLASS_NAME(SpatialQueryPerfTest);
+public:
+    void CaseSetUp() override;
+    void CaseTearDown() override;
+    void TestCircleQuery();
+    void TestPolygonQuery();
+
+private:
+    void DoQuery(const std::string& shapeName,
+                 const std::vector<std::string>& shapeStrs);
+    uint32_t GetExpectDocCount(const common::ShapePtr& shape) const;
+
+private:
+    config::IndexPartitionSchemaPtr mSchema;
+    config::IndexPartitionOptions mOptions;
+    test::PartitionStateMachinePtr mPsm;
+    std::vector<std::pair<double, double> > mPoints;
+
+private:
+    IE_LOG_DECLARE();
+};
+
+INDEXLIB_UNIT_TEST_CASE(SpatialQueryPerfTest, TestCircleQuery);
+INDEXLIB_UNIT_TEST_CASE(SpatialQueryPerfTest, TestPolygonQuery);
+
+IE_NAMESPACE_END(index);
+
+#endif //__INDEXLIB_SPATIALQUERYPERFTEST_H
@@ -5,6 +5,8 @@
 #include "indexlib/common/in_mem_file_writer.h"
 #include "indexlib/common/term.h"
 #include "indexlib/index/normal/inverted_index/accessor/in_mem_normal_index_segment_reader.h"
+#include "indexlib/index/normal/inverted_index/accessor/multi_field_index_reader.h"
+#include "indexlib/partition/index_partition_reader.h"
 #include "indexlib/index_base/schema_adapter.h"
 #include "indexlib/storage/file_system_wrapper.h"
 #include "indexlib/index/normal/inverted_index/test/normal_index_reader_helper.h"
@@ -727,6 +729,100 @@ void NormalIndexReaderTest::TestPartialLookup()
     CheckPostingIterator(reader, pt_normal, "index1:B", "1,2,5", { { 0, 1 }, { 3, 4 }, { 5, 6 } });
 }
 
+void NormalIndexReaderTest::TestOrderedTerms()
+{
+    IndexPartitionOptions options;
+    string field = "pk:uint64:pk;string1:string;long1:uint32;";
+    string index = "pk:primarykey64:pk;index1:string:string1;";
+    config::IndexPartitionSchemaPtr schema = SchemaMaker::MakeSchema(field, index, "long1", "");
+    IndexConfigPtr indexConfig = schema->GetIndexSchema()->GetIndexConfig("index1");
+    assert(indexConfig);
+    indexConfig->SetHasOrderedTermDictionary(true);
+
+    PartitionStateMachine psm;
+    ASSERT_TRUE(psm.Init(schema, options, GET_TEST_DATA_PATH()));
+    // merged full segment
+    string fullDocs = "cmd=add,pk=0,string1=apple,long1=0;"
+                      "cmd=add,pk=1,string1=apply,long1=1;"
+                      "cmd=add,pk=2,string1=banana,long1=2;";
+    ASSERT_TRUE(psm.Transfer(BUILD_FULL, fullDocs, "", ""));
+    string incDocs = "cmd=add,pk=3,string1=apple,long1=3;"
+                     "cmd=add,pk=4,string1=apricot,long1=4;"
+                     "cmd=add,pk=5,string1=cherry,long1=5;";
+    ASSERT_TRUE(psm.Transfer(BUILD_INC_NO_MERGE, incDocs, "", ""));
+    // dumped realtime segment
+    string rtSegmentDocs = "cmd=add,pk=6,string1=applet,long1=6,ts=6;"
+                           "cmd=add,pk=7,string1=banana,long1=7,ts=7;";
+    ASSERT_TRUE(psm.Transfer(BUILD_RT_SEGMENT, rtSegmentDocs, "", ""));
+    // building segment
+    string rtDocs = "cmd=add,pk=8,string1=apples,long1=8,ts=8;"
+                    "cmd=add,pk=9,string1=cherry,long1=9,ts=9;";
+    ASSERT_TRUE(psm.Transfer(BUILD_RT, rtDocs, "", ""));
+
+    IndexPartitionReaderPtr partReader = psm.GetIndexPartition()->GetReader();
+    IndexReaderPtr multiFieldReader = partReader->GetIndexReader();
+    NormalIndexReaderPtr reader = DYNAMIC_POINTER_CAST(NormalIndexReader,
+            DYNAMIC_POINTER_CAST(MultiFieldIndexReader, multiFieldReader)->GetIndexReader("index1"));
+    ASSERT_TRUE(reader);
+
+    OrderedTermMatcher::TermKeyVector terms;
+    ASSERT_TRUE(reader->PrefixTerms(ConstString("app"), 10, terms));
+    CheckTerms(reader.get(), terms, "apple,applet,apples,apply", "0,1,3,6,8");
+
+    terms.clear();
+    ASSERT_TRUE(reader->RangeTerms(ConstString("apply"), false,
+                    ConstString("cherry"), true, 10, terms));
+    CheckTerms(reader.get(), terms, "apricot,banana,cherry", "2,4,5,7,9");
+
+    terms.clear();
+    ASSERT_TRUE(reader->WildcardTerms(ConstString("*e*"), 10, terms));
+    CheckTerms(reader.get(), terms, "apple,applet,apples,cherry", "0,3,5,6,8,9");
+
+    terms.clear();
+    ASSERT_TRUE(reader->FuzzyTerms(ConstString("apply"), 1, 1, 10, terms));
+    CheckTerms(reader.get(), terms, "apple,apply", "0,1,3");
+
+    // truncated by maxTerms, the smallest terms of all segments are kept
+    terms.clear();
+    ASSERT_FALSE(reader->PrefixTerms(ConstString("a"), 2, terms));
+    CheckTerms(reader.get(), terms, "apple,applet", "0,3,6");
+
+    terms.clear();
+    ASSERT_TRUE(reader->PrefixTerms(ConstString("durian"), 10, terms));
+    ASSERT_TRUE(terms.empty());
+    Pool pool;
+    ASSERT_FALSE(reader->LookupTerms(vector<dictkey_t>(), &pool));
+}
+
+void NormalIndexReaderTest::CheckTerms(NormalIndexReader* indexReader,
+        const OrderedTermMatcher::TermKeyVector& terms,
+        const string& termsStr, const string& docIdListStr)
+{
+    vector<string> expectTerms;
+    StringUtil::fromString(termsStr, expectTerms, ",");
+    ASSERT_EQ(expectTerms.size(), terms.size());
+    vector<dictkey_t> keys;
+    for (size_t i = 0; i < terms.size(); ++i)
+    {
+        ASSERT_EQ(expectTerms[i], terms[i].first);
+        keys.push_back(terms[i].second);
+    }
+
+    Pool pool;
+    PostingIterator* postingIter = indexReader->LookupTerms(keys, &pool);
+    ASSERT_TRUE(postingIter);
+    vector<docid_t> docIds;
+    StringUtil::fromString(docIdListStr, docIds, ",");
+    docid_t curDocId = INVALID_DOCID;
+    for (size_t i = 0; i < docIds.size(); i++)
+    {
+        curDocId = postingIter->SeekDoc(curDocId);
+        ASSERT_EQ(docIds[i], curDocId);
+    }
+    ASSERT_EQ(INVALID_DOCID, postingIter->SeekDoc(curDocId));
+    IE_POOL_COMPATIBLE_DELETE_CLASS(&pool, postingIter);
+}
+
 void NormalIndexReaderTest::CheckPostingIterator(const IndexReaderPtr& indexReader,
     PostingType postingType, const string& termInfoStr, const string& docIdListStr,
     const DocIdRangeVector& ranges)
@@ -761,4 +857,34 @@ void NormalIndexReaderTest::CheckPostingIterator(const IndexReaderPtr& indexRead
     IE_POOL_COMPATIBLE_DELETE_CLASS(&pool, postingIter);
 }
 
+void NormalIndexReaderTest::TestOpenWithHintReader()
+{
+    SingleFieldPartitionDataProvider provider;
+    provider.Init(GET_TEST_DATA_PATH(), "text", SFP_INDEX);
+    IndexConfigPtr indexConfig = provider.GetIndexConfig();
+    provider.Build("A,A B", SFP_OFFLINE);
+    NormalIndexReader hintReader;
+    hintReader.Open(indexConfig, provider.GetPartitionData());
+    ASSERT_EQ((size_t)1, hintReader.mSegmentReaders.size());
+
+    provider.Build("B", SFP_OFFLINE);
+    NormalIndexReader reader;
+    reader.Open(indexConfig, provider.GetPartitionData(), &hintReader);
+    ASSERT_FALSE(reader.mHintReader);
+    ASSERT_EQ((size_t)2, reader.mSegmentReaders.size());
+    ASSERT_EQ(hintReader.mSegmentReaders[0], reader.mSegmentReaders[0]);
+    PostingIterator* iter = reader.Lookup(Term("B", "index"));
+    ASSERT_TRUE(iter);
+    ASSERT_EQ((docid_t)1, iter->SeekDoc(0));
+    ASSERT_EQ((docid_t)2, iter->SeekDoc(2));
+    ASSERT_EQ(INVALID_DOCID, iter->SeekDoc(3));
+    delete iter;
+
+    // reader of another index config is not shared
+    NormalIndexReader otherReader;
+    otherReader.Open(IndexConfigPtr(indexConfig->Clone()),
+                     provider.GetPartitionData(), &reader);
+    ASSERT_NE(reader.mSegmentReaders[0], otherReader.mSegmentReaders[0]);
+}
+
 IE_NAMESPACE_END(index);
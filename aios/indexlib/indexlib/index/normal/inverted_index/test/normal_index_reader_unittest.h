@@ -35,6 +35,8 @@ public:
     void TestCacheLoadConfig();
     void TestLookupWithMultiInMemSegments();
     void TestPartialLookup();
+    void TestOrderedTerms();
+    void TestOpenWithHintReader();
 
 private:
     void PrepareSegmentPosting(MockNormalIndexReader &indexReader,
@@ -51,6 +53,10 @@ private:
     void CheckPostingIterator(const index::IndexReaderPtr& indexReader, PostingType postingType,
         const std::string& termInfoStr, const std::string& docIdListStr,
         const DocIdRangeVector& ranges = {});
+    // terms: "term,term,..."; docIdListStr: docs of the looked up terms
+    void CheckTerms(NormalIndexReader* indexReader,
+                    const OrderedTermMatcher::TermKeyVector& terms,
+                    const std::string& termsStr, const std::string& docIdListStr);
 
 private:
     std::string mRootDir;
@@ -84,6 +90,8 @@ INDEXLIB_UNIT_TEST_CASE(NormalIndexReaderTest, TestMmapLoadConfig);
 INDEXLIB_UNIT_TEST_CASE(NormalIndexReaderTest, TestCacheLoadConfig);
 INDEXLIB_UNIT_TEST_CASE(NormalIndexReaderTest, TestLookupWithMultiInMemSegments);
 INDEXLIB_UNIT_TEST_CASE(NormalIndexReaderTest, TestPartialLookup);
+INDEXLIB_UNIT_TEST_CASE(NormalIndexReaderTest, TestOrderedTerms);
+INDEXLIB_UNIT_TEST_CASE(NormalIndexReaderTest, TestOpenWithHintReader);
 
 IE_NAMESPACE_END(index);
 
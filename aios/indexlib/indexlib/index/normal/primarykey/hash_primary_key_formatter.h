@@ -21,7 +21,7 @@ class HashPrimaryKeyFormatter : public PrimaryKeyFormatter<Key>
 {
 public:
     typedef index::PKPair<Key> PKPair;
-    typedef util::HashMap<Key, docid_t> HashMapType;
+    typedef InMemPrimaryKeyHashTable<Key> HashMapType;
     typedef std::tr1::shared_ptr<HashMapType> HashMapTypePtr;
     typedef std::tr1::shared_ptr<PrimaryKeyIterator<Key> > PrimaryKeyIteratorPtr;
     typedef std::tr1::shared_ptr<OrderedPrimaryKeyIterator<Key> > OrderedPrimaryKeyIteratorPtr;
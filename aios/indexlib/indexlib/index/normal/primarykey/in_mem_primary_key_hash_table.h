@@ -0,0 +1,410 @@
+#ifndef __INDEXLIB_IN_MEM_PRIMARY_KEY_HASH_TABLE_H
+#define __INDEXLIB_IN_MEM_PRIMARY_KEY_HASH_TABLE_H
+
+#include <tr1/memory>
+#include <algorithm>
+#include <autil/mem_pool/Pool.h>
+#include "indexlib/indexlib.h"
+#include "indexlib/common_define.h"
+#include "indexlib/misc/exception.h"
+#include "indexlib/util/hash_util.h"
+#include "indexlib/common/hash_table/dense_hash_table.h"
+
+IE_NAMESPACE_BEGIN(index);
+
+// NOTE: open addressing pk table for building segment, single writer & multi reader
+//       buckets are published by value (docid) after key is written, readers never lock
+//       resize is incremental: a bigger table is published at once, old buckets
+//       are moved in by following inserts, readers fall back to old table until done
+//       all tables are allocated from pool, reclaimed when pool released
+template <typename Key>
+class InMemPrimaryKeyHashTable
+{
+private:
+    typedef InMemPrimaryKeyHashTable<Key> Typed;
+    InMemPrimaryKeyHashTable(const Typed&) = delete;
+    Typed& operator=(const Typed&) = delete;
+
+public:
+    typedef Key KeyType;
+    typedef docid_t ValueType;
+    typedef std::pair<Key, docid_t> KeyValuePair;
+    typedef autil::mem_pool::Pool PoolType;
+
+    // empty: max docid, deleted: max docid - 1, means bucket not published
+    typedef common::SpecialValue<docid_t> PKValue;
+    typedef common::SpecialValueBucket<Key, PKValue> Bucket;
+    // probing & capacity follow DenseHashTable, with hash of key as bucket key
+    typedef common::DenseHashTable<uint64_t, PKValue> DenseHashTableType;
+
+    static const size_t DEFAULT_HASHTABLE_POOL_SIZE = DEFAULT_CHUNK_SIZE * 1024 * 1024; // 10M
+    static const int32_t OCCUPANCY_PCT = DenseHashTableType::OCCUPANCY_PCT;
+    // old buckets moved per insert, migration done before new table reach capacity
+    static const uint64_t MIGRATE_STEP = 8;
+
+private:
+    struct Table
+    {
+        Bucket* buckets;
+        uint64_t bucketCount;
+        uint64_t capacity;
+        uint64_t keyCount;
+        Table* prev;
+        volatile bool migrated;
+    };
+
+public:
+    class Iterator
+    {
+    public:
+        Iterator()
+            : mHashTable(NULL)
+            , mTable(NULL)
+            , mPrevTable(NULL)
+            , mBucketIdx(0)
+            , mInPrevTable(false)
+        {
+        }
+
+        Iterator(const InMemPrimaryKeyHashTable* hashTable)
+            : mHashTable(hashTable)
+            , mTable(hashTable->mTable)
+            , mPrevTable(mTable->migrated ? NULL : mTable->prev)
+            , mBucketIdx(0)
+            , mInPrevTable(false)
+        {
+            SkipToValidBucket();
+        }
+
+        bool HasNext() const
+        {
+            return mTable && (mInPrevTable ?
+                    mBucketIdx < mPrevTable->bucketCount :
+                    mBucketIdx < mTable->bucketCount);
+        }
+
+        KeyValuePair Next()
+        {
+            const Bucket& bucket = mInPrevTable ?
+                mPrevTable->buckets[mBucketIdx] : mTable->buckets[mBucketIdx];
+            KeyValuePair kv(bucket.Key(), bucket.Value().Value());
+            ++mBucketIdx;
+            SkipToValidBucket();
+            return kv;
+        }
+
+    private:
+        void SkipToValidBucket();
+
+    private:
+        const InMemPrimaryKeyHashTable* mHashTable;
+        const Table* mTable;
+        const Table* mPrevTable;
+        uint64_t mBucketIdx;
+        bool mInPrevTable;
+    };
+
+public:
+    InMemPrimaryKeyHashTable(PoolType* pool, size_t initSize);
+    InMemPrimaryKeyHashTable(size_t initSize);
+    ~InMemPrimaryKeyHashTable();
+
+public:
+    // lock free, safe to call concurrently with FindAndInsert
+    docid_t Find(const Key& key, docid_t none) const;
+
+    // single writer
+    void FindAndInsert(const Key& key, docid_t docId);
+
+    size_t Size() const { return mKeyCount; }
+    uint64_t BucketCount() const { return mTable->bucketCount; }
+    bool IsMigrating() const { return !mTable->migrated; }
+    Iterator CreateIterator() const { return Iterator(this); }
+
+private:
+    Table* CreateTable(uint64_t bucketCount, Table* prev);
+    bool FindInTable(const Table* table, const Key& key, docid_t& docId) const;
+    Bucket* FindBucketForWrite(const Table* table, const Key& key) const;
+    void Publish(Bucket* bucket, const Key& key, docid_t docId);
+    void Expand();
+    void MigrateStep(uint64_t step);
+    uint64_t HashKey(const Key& key) const { return mHasher(key); }
+
+private:
+    Table* volatile mTable;
+    uint64_t mMigratePos;
+    size_t mKeyCount;
+    util::KeyHash<Key> mHasher;
+    PoolType* mPool;
+    bool mOwnPool;
+
+private:
+    friend class InMemPrimaryKeyHashTableTest;
+    IE_LOG_DECLARE();
+};
+
+/////////////////////////////////////////////////////////
+IE_LOG_SETUP_TEMPLATE(index, InMemPrimaryKeyHashTable);
+
+template <typename Key>
+InMemPrimaryKeyHashTable<Key>::InMemPrimaryKeyHashTable(PoolType* pool, size_t initSize)
+    : mTable(NULL)
+    , mMigratePos(0)
+    , mKeyCount(0)
+    , mPool(pool)
+    , mOwnPool(false)
+{
+    assert(mPool);
+    mTable = CreateTable(initSize * 100 / OCCUPANCY_PCT, NULL);
+}
+
+template <typename Key>
+InMemPrimaryKeyHashTable<Key>::InMemPrimaryKeyHashTable(size_t initSize)
+    : mTable(NULL)
+    , mMigratePos(0)
+    , mKeyCount(0)
+    , mPool(new PoolType(DEFAULT_HASHTABLE_POOL_SIZE))
+    , mOwnPool(true)
+{
+    mTable = CreateTable(initSize * 100 / OCCUPANCY_PCT, NULL);
+}
+
+template <typename Key>
+InMemPrimaryKeyHashTable<Key>::~InMemPrimaryKeyHashTable()
+{
+    mTable = NULL;
+    if (mOwnPool && mPool)
+    {
+        mPool->release();
+        delete mPool;
+        mPool = NULL;
+    }
+}
+
+template <typename Key>
+typename InMemPrimaryKeyHashTable<Key>::Table*
+InMemPrimaryKeyHashTable<Key>::CreateTable(uint64_t bucketCount, Table* prev)
+{
+    bucketCount = std::max(bucketCount, (uint64_t)2);
+    void* tableBuffer = mPool->allocate(sizeof(Table));
+    void* bucketBuffer = mPool->allocate(sizeof(Bucket) * bucketCount);
+    if (!tableBuffer || !bucketBuffer)
+    {
+        INDEXLIB_FATAL_ERROR(OutOfMemory, "allocate pk hash table failed, bucketCount[%lu]",
+                             bucketCount);
+    }
+    Table* table = (Table*)tableBuffer;
+    table->buckets = new (bucketBuffer) Bucket[bucketCount];
+    table->bucketCount = bucketCount;
+    table->capacity = DenseHashTableType::BucketCountToCapacity(bucketCount, OCCUPANCY_PCT);
+    table->keyCount = 0;
+    table->prev = prev;
+    table->migrated = (prev == NULL);
+    return table;
+}
+
+template <typename Key>
+inline bool InMemPrimaryKeyHashTable<Key>::FindInTable(
+        const Table* table, const Key& key, docid_t& docId) const
+{
+    uint64_t hashKey = HashKey(key);
+    uint64_t bucketCount = table->bucketCount;
+    uint64_t bucketId = hashKey % bucketCount;
+    uint64_t probeCount = 0;
+    while (true)
+    {
+        const Bucket& bucket = table->buckets[bucketId];
+        PKValue value = bucket.Value();
+        MEMORY_BARRIER();
+        if (value.IsEmpty())
+        {
+            return false;
+        }
+        // deleted means writer is publishing this bucket, key not visible yet
+        if (!value.IsDeleted() && bucket.IsEqual(key))
+        {
+            docId = value.Value();
+            return true;
+        }
+        if (unlikely(!DenseHashTableType::Probe(hashKey, probeCount, bucketId, bucketCount)))
+        {
+            return false;
+        }
+    }
+    return false;
+}
+
+template <typename Key>
+inline docid_t InMemPrimaryKeyHashTable<Key>::Find(const Key& key, docid_t none) const
+{
+    const Table* table = mTable;
+    // check before lookup: if migrated, all keys of prev table are in current table
+    bool migrated = table->migrated;
+    MEMORY_BARRIER();
+    docid_t docId = none;
+    if (FindInTable(table, key, docId))
+    {
+        return docId;
+    }
+    if (!migrated && FindInTable(table->prev, key, docId))
+    {
+        return docId;
+    }
+    return none;
+}
+
+template <typename Key>
+inline typename InMemPrimaryKeyHashTable<Key>::Bucket*
+InMemPrimaryKeyHashTable<Key>::FindBucketForWrite(const Table* table, const Key& key) const
+{
+    uint64_t hashKey = HashKey(key);
+    uint64_t bucketCount = table->bucketCount;
+    uint64_t bucketId = hashKey % bucketCount;
+    uint64_t probeCount = 0;
+    while (true)
+    {
+        Bucket& bucket = table->buckets[bucketId];
+        if (bucket.IsEmpty() || bucket.IsEqual(key))
+        {
+            return &bucket;
+        }
+        if (unlikely(!DenseHashTableType::Probe(hashKey, probeCount, bucketId, bucketCount)))
+        {
+            return NULL;
+        }
+    }
+    return NULL;
+}
+
+template <typename Key>
+inline void InMemPrimaryKeyHashTable<Key>::Publish(
+        Bucket* bucket, const Key& key, docid_t docId)
+{
+    // hide bucket from readers while key is written
+    bucket->SetDelete(key, PKValue());
+    MEMORY_BARRIER();
+    bucket->UpdateValue(PKValue(docId));
+}
+
+template <typename Key>
+inline void InMemPrimaryKeyHashTable<Key>::FindAndInsert(const Key& key, docid_t docId)
+{
+    Table* table = mTable;
+    if (!table->migrated)
+    {
+        MigrateStep(MIGRATE_STEP);
+    }
+    Bucket* bucket = FindBucketForWrite(table, key);
+    if (unlikely(!bucket))
+    {
+        INDEXLIB_FATAL_ERROR(OutOfMemory, "pk hash table is full, bucketCount[%lu]",
+                             table->bucketCount);
+    }
+    if (!bucket->IsEmpty())
+    {
+        bucket->UpdateValue(PKValue(docId));
+        return;
+    }
+    docid_t oldDocId = INVALID_DOCID;
+    if (table->migrated || !FindInTable(table->prev, key, oldDocId))
+    {
+        ++mKeyCount;
+    }
+    Publish(bucket, key, docId);
+    ++table->keyCount;
+    if (table->keyCount >= table->capacity)
+    {
+        Expand();
+    }
+}
+
+template <typename Key>
+void InMemPrimaryKeyHashTable<Key>::Expand()
+{
+    Table* table = mTable;
+    if (!table->migrated)
+    {
+        MigrateStep(table->prev->bucketCount);
+    }
+    Table* newTable = CreateTable(table->bucketCount * 2, table);
+    mMigratePos = 0;
+    MEMORY_BARRIER();
+    mTable = newTable;
+    IE_LOG(DEBUG, "expand pk hash table, bucketCount[%lu], keyCount[%lu]",
+           newTable->bucketCount, mKeyCount);
+}
+
+template <typename Key>
+void InMemPrimaryKeyHashTable<Key>::MigrateStep(uint64_t step)
+{
+    Table* table = mTable;
+    const Table* prev = table->prev;
+    assert(prev && !table->migrated);
+    uint64_t end = std::min(mMigratePos + step, prev->bucketCount);
+    for (; mMigratePos < end; ++mMigratePos)
+    {
+        const Bucket& oldBucket = prev->buckets[mMigratePos];
+        if (oldBucket.IsEmpty())
+        {
+            continue;
+        }
+        Bucket* bucket = FindBucketForWrite(table, oldBucket.Key());
+        assert(bucket);
+        if (!bucket->IsEmpty())
+        {
+            // updated after expand, newer than old bucket
+            continue;
+        }
+        Publish(bucket, oldBucket.Key(), oldBucket.Value().Value());
+        ++table->keyCount;
+    }
+    if (mMigratePos >= prev->bucketCount)
+    {
+        MEMORY_BARRIER();
+        table->migrated = true;
+    }
+}
+
+template <typename Key>
+inline void InMemPrimaryKeyHashTable<Key>::Iterator::SkipToValidBucket()
+{
+    if (!mTable)
+    {
+        return;
+    }
+    if (!mInPrevTable)
+    {
+        for (; mBucketIdx < mTable->bucketCount; ++mBucketIdx)
+        {
+            const Bucket& bucket = mTable->buckets[mBucketIdx];
+            if (!bucket.IsEmpty() && !bucket.IsDeleted())
+            {
+                return;
+            }
+        }
+        if (!mPrevTable)
+        {
+            return;
+        }
+        mInPrevTable = true;
+        mBucketIdx = 0;
+    }
+    // keys not moved into current table yet
+    for (; mBucketIdx < mPrevTable->bucketCount; ++mBucketIdx)
+    {
+        const Bucket& bucket = mPrevTable->buckets[mBucketIdx];
+        if (bucket.IsEmpty() || bucket.IsDeleted())
+        {
+            continue;
+        }
+        docid_t docId = INVALID_DOCID;
+        if (!mHashTable->FindInTable(mTable, bucket.Key(), docId))
+        {
+            return;
+        }
+    }
+}
+
+IE_NAMESPACE_END(index);
+
+#endif //__INDEXLIB_IN_MEM_PRIMARY_KEY_HASH_TABLE_H
@@ -4,7 +4,7 @@
 #include <tr1/memory>
 #include "indexlib/indexlib.h"
 #include "indexlib/common_define.h"
-#include "indexlib/util/hash_map.h"
+#include "indexlib/index/normal/primarykey/in_mem_primary_key_hash_table.h"
 #include "indexlib/index/normal/inverted_index/accessor/index_segment_reader.h"
 
 DECLARE_REFERENCE_CLASS(index, AttributeSegmentReader);
@@ -14,9 +14,9 @@ template <typename Key>
 class InMemPrimaryKeySegmentReaderTyped : public IndexSegmentReader
 {
 public:
-    typedef util::HashMap<Key, docid_t> HashMapTyped;
+    typedef InMemPrimaryKeyHashTable<Key> HashMapTyped;
     typedef std::tr1::shared_ptr<HashMapTyped> HashMapTypedPtr;
-    typedef typename util::HashMap<Key, docid_t>::KeyValuePair KeyValuePair;
+    typedef typename InMemPrimaryKeyHashTable<Key>::KeyValuePair KeyValuePair;
     typedef typename HashMapTyped::Iterator Iterator;
 public:
     InMemPrimaryKeySegmentReaderTyped(HashMapTypedPtr hashMap, 
@@ -9,7 +9,7 @@
 #include "indexlib/index/normal/primarykey/primary_key_iterator.h"
 #include "indexlib/index/normal/primarykey/ordered_primary_key_iterator.h"
 #include "indexlib/index/segment_output_mapper.h"
-#include "indexlib/util/hash_map.h"
+#include "indexlib/index/normal/primarykey/in_mem_primary_key_hash_table.h"
 
 DECLARE_REFERENCE_CLASS(file_system, FileWriter);
 DECLARE_REFERENCE_CLASS(file_system, SliceFile);
@@ -28,7 +28,7 @@ class PrimaryKeyFormatter
 {
 public:
     typedef index::PKPair<Key> PKPair;
-    typedef util::HashMap<Key, docid_t> HashMapType;
+    typedef InMemPrimaryKeyHashTable<Key> HashMapType;
     typedef std::tr1::shared_ptr<HashMapType> HashMapTypePtr;
     typedef std::tr1::shared_ptr<PrimaryKeyIterator<Key> > PrimaryKeyIteratorPtr;
     typedef std::tr1::shared_ptr<OrderedPrimaryKeyIterator<Key> > OrderedPrimaryKeyIteratorPtr;
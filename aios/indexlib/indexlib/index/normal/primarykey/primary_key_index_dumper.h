@@ -7,7 +7,7 @@
 
 #include "indexlib/common_define.h"
 #include "indexlib/config/primary_key_index_config.h"
-#include "indexlib/util/hash_map.h"
+#include "indexlib/index/normal/primarykey/in_mem_primary_key_hash_table.h"
 #include "indexlib/file_system/file_writer.h"
 #include "indexlib/index/normal/primarykey/primary_key_formatter.h"
 #include "indexlib/index/normal/primarykey/sorted_primary_key_formatter.h"
@@ -29,7 +29,7 @@ public:
     ~PrimaryKeyIndexDumper() {}
 
 private:
-    typedef util::HashMap<Key, docid_t> HashMapTyped;
+    typedef InMemPrimaryKeyHashTable<Key> HashMapTyped;
     typedef std::tr1::shared_ptr<HashMapTyped> HashMapTypedPtr;
     typedef std::tr1::shared_ptr<PrimaryKeyFormatter<Key> > PrimaryKeyFormatterPtr;
     
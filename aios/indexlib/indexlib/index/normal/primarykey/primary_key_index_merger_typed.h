@@ -28,7 +28,7 @@ template<typename Key>
 class PrimaryKeyIndexMergerTyped : public IndexMerger
 {
 public:
-    typedef util::HashMap<Key, docid_t> HashMapTyped;
+    typedef InMemPrimaryKeyHashTable<Key> HashMapTyped;
     typedef std::tr1::shared_ptr<HashMapTyped> HashMapTypedPtr;
     typedef PrimaryKeyAttributeMerger<Key> PKAttributeMergerTyped;
     typedef std::tr1::shared_ptr<InMemPrimaryKeySegmentReaderTyped<Key> > InMemPrimaryKeySegmentReaderTypedPtr;
@@ -6,7 +6,7 @@
 #include <autil/LongHashValue.h>
 #include "indexlib/util/key_hasher_factory.h"
 #include "indexlib/common_define.h"
-#include "indexlib/util/hash_map.h"
+#include "indexlib/index/normal/primarykey/in_mem_primary_key_hash_table.h"
 #include "indexlib/indexlib.h"
 #include "indexlib/index/in_memory_segment_reader.h"
 #include "indexlib/index/normal/primarykey/primary_key_posting_iterator.h"
@@ -28,7 +28,7 @@ template<typename Key>
 class PrimaryKeyIndexReaderTyped : public PrimaryKeyIndexReader
 {
 public:
-    typedef util::HashMap<Key, docid_t> HashMapTyped;
+    typedef InMemPrimaryKeyHashTable<Key> HashMapTyped;
     typedef std::tr1::shared_ptr<HashMapTyped> HashMapTypedPtr;
 
 public:
@@ -8,7 +8,7 @@
 #include <autil/mem_pool/Pool.h>
 #include "indexlib/common_define.h"
 #include "indexlib/indexlib.h"
-#include "indexlib/util/hash_map.h"
+#include "indexlib/index/normal/primarykey/in_mem_primary_key_hash_table.h"
 #include "indexlib/misc/exception.h"
 #include "indexlib/index/normal/primarykey/primary_key_index_writer.h"
 #include "indexlib/index/normal/attribute/accessor/single_value_attribute_writer.h"
@@ -25,7 +25,7 @@ template<typename Key>
 class PrimaryKeyIndexWriterTyped : public PrimaryKeyIndexWriter
 {
 public:
-    typedef util::HashMap<Key, docid_t> HashMapTyped;
+    typedef InMemPrimaryKeyHashTable<Key> HashMapTyped;
     typedef std::tr1::shared_ptr<HashMapTyped> HashMapTypedPtr;
     typedef SingleValueAttributeWriter<Key> PKAttributeWriterType;
     typedef std::tr1::shared_ptr<PKAttributeWriterType> PKAttributeWriterTypePtr;
@@ -17,7 +17,7 @@ class PrimaryKeySegmentFormatter
 public:
     typedef std::tr1::shared_ptr<PrimaryKeyFormatter<Key> > PrimaryKeyFormatterPtr;
     typedef index::PKPair<Key> PKPair;
-    typedef util::HashMap<Key, docid_t> HashMapType;
+    typedef InMemPrimaryKeyHashTable<Key> HashMapType;
     typedef std::tr1::shared_ptr<HashMapType> HashMapTypePtr;
 
 public:
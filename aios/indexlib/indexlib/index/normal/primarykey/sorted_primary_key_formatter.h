@@ -9,7 +9,7 @@
 #include "indexlib/file_system/file_reader.h"
 #include "indexlib/file_system/file_writer.h"
 #include "indexlib/file_system/slice_file_writer.h"
-#include "indexlib/util/hash_map.h"
+#include "indexlib/index/normal/primarykey/in_mem_primary_key_hash_table.h"
 #include "indexlib/index/normal/primarykey/primary_key_pair.h"
 #include "indexlib/index/normal/primarykey/primary_key_formatter.h"
 
@@ -20,7 +20,7 @@ class SortedPrimaryKeyFormatter : public PrimaryKeyFormatter<Key>
 {
 public:
     typedef index::PKPair<Key> PKPair;
-    typedef util::HashMap<Key, docid_t> HashMapType;
+    typedef InMemPrimaryKeyHashTable<Key> HashMapType;
     typedef std::tr1::shared_ptr<HashMapType> HashMapTypePtr;
     typedef std::tr1::shared_ptr<PrimaryKeyIterator<Key> > PrimaryKeyIteratorPtr;
     typedef std::tr1::shared_ptr<OrderedPrimaryKeyIterator<Key> > OrderedPrimaryKeyIteratorPtr;
@@ -0,0 +1,138 @@
+#include "indexlib/index/normal/primarykey/test/in_mem_primary_key_hash_table_unittest.h"
+
+using namespace std;
+
+IE_NAMESPACE_BEGIN(index);
+IE_LOG_SETUP(index, InMemPrimaryKeyHashTableTest);
+
+InMemPrimaryKeyHashTableTest::InMemPrimaryKeyHashTableTest()
+    : mInsertedCount(0)
+{
+}
+
+InMemPrimaryKeyHashTableTest::~InMemPrimaryKeyHashTableTest()
+{
+}
+
+void InMemPrimaryKeyHashTableTest::CaseSetUp()
+{
+    mInsertedCount = 0;
+}
+
+void InMemPrimaryKeyHashTableTest::CaseTearDown()
+{
+    mHashTable.reset();
+}
+
+void InMemPrimaryKeyHashTableTest::TestSimpleProcess()
+{
+    autil::mem_pool::Pool pool;
+    InMemPrimaryKeyHashTable<uint64_t> hashTable(&pool, 16);
+    ASSERT_EQ((size_t)0, hashTable.Size());
+    ASSERT_EQ(INVALID_DOCID, hashTable.Find(1, INVALID_DOCID));
+
+    hashTable.FindAndInsert(1, 0);
+    hashTable.FindAndInsert(2, 1);
+    hashTable.FindAndInsert(1, 2);
+    ASSERT_EQ((size_t)2, hashTable.Size());
+    ASSERT_EQ((docid_t)2, hashTable.Find(1, INVALID_DOCID));
+    ASSERT_EQ((docid_t)1, hashTable.Find(2, INVALID_DOCID));
+    ASSERT_EQ(INVALID_DOCID, hashTable.Find(3, INVALID_DOCID));
+
+    // empty & deleted docid of bucket value are never real docids
+    hashTable.FindAndInsert(0, 3);
+    ASSERT_EQ((docid_t)3, hashTable.Find(0, INVALID_DOCID));
+}
+
+void InMemPrimaryKeyHashTableTest::TestFindAndInsertWhenExpand()
+{
+    InnerTestFindAndInsertWhenExpand<uint64_t>();
+    InnerTestFindAndInsertWhenExpand<autil::uint128_t>();
+}
+
+void InMemPrimaryKeyHashTableTest::TestIteratorWhenMigrating()
+{
+    InMemPrimaryKeyHashTable<uint64_t> hashTable(4);
+    uint64_t keyCount = 0;
+    // stop right after an expand, most keys are still in old table
+    while (keyCount < 16 || !hashTable.IsMigrating())
+    {
+        hashTable.FindAndInsert(MakeKey<uint64_t>(keyCount), (docid_t)keyCount);
+        ++keyCount;
+    }
+    hashTable.FindAndInsert(MakeKey<uint64_t>(0), (docid_t)keyCount);
+    ASSERT_TRUE(hashTable.IsMigrating());
+
+    map<uint64_t, docid_t> result;
+    InMemPrimaryKeyHashTable<uint64_t>::Iterator iter = hashTable.CreateIterator();
+    while (iter.HasNext())
+    {
+        InMemPrimaryKeyHashTable<uint64_t>::KeyValuePair kv = iter.Next();
+        ASSERT_TRUE(result.insert(kv).second) << kv.first;
+    }
+    ASSERT_EQ((size_t)keyCount, result.size());
+    ASSERT_EQ(hashTable.Size(), result.size());
+    ASSERT_EQ((docid_t)keyCount, result[MakeKey<uint64_t>(0)]);
+    for (uint64_t i = 1; i < keyCount; ++i)
+    {
+        ASSERT_EQ((docid_t)i, result[MakeKey<uint64_t>(i)]);
+    }
+}
+
+void InMemPrimaryKeyHashTableTest::TestMultiThreadReadWrite()
+{
+    mHashTable.reset(new InMemPrimaryKeyHashTable<uint64_t>(16));
+    DoMultiThreadTest(4, 5);
+    ASSERT_EQ((size_t)KEY_COUNT, mHashTable->Size());
+}
+
+void InMemPrimaryKeyHashTableTest::DoWrite()
+{
+    // first round insert, following rounds update: docid % KEY_COUNT == key id
+    docid_t docId = 0;
+    while (!IsFinished())
+    {
+        uint64_t id = docId % KEY_COUNT;
+        mHashTable->FindAndInsert(MakeKey<uint64_t>(id), docId);
+        if (mInsertedCount < KEY_COUNT)
+        {
+            MEMORY_BARRIER();
+            mInsertedCount = id + 1;
+        }
+        if (++docId == numeric_limits<docid_t>::max() - 2)
+        {
+            docId = KEY_COUNT;
+        }
+    }
+}
+
+void InMemPrimaryKeyHashTableTest::DoRead(int* status)
+{
+    uint64_t seed = 0;
+    while (!IsFinished())
+    {
+        uint64_t insertedCount = mInsertedCount;
+        MEMORY_BARRIER();
+        if (insertedCount == 0)
+        {
+            continue;
+        }
+        seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+        uint64_t id = (seed >> 17) % insertedCount;
+        docid_t docId = mHashTable->Find(MakeKey<uint64_t>(id), INVALID_DOCID);
+        if (docId == INVALID_DOCID || (uint64_t)docId % KEY_COUNT != id)
+        {
+            IE_LOG(ERROR, "lookup key [%lu] failed, docid [%d]", id, docId);
+            *status = -1;
+            return;
+        }
+        if (mHashTable->Find(MakeKey<uint64_t>(KEY_COUNT + id), INVALID_DOCID)
+            != INVALID_DOCID)
+        {
+            *status = -1;
+            return;
+        }
+    }
+}
+
+IE_NAMESPACE_END(index);
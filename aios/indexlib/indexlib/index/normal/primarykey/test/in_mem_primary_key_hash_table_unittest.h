@@ -0,0 +1,104 @@
+#ifndef __INDEXLIB_INMEMPRIMARYKEYHASHTABLETEST_H
+#define __INDEXLIB_INMEMPRIMARYKEYHASHTABLETEST_H
+
+#include "indexlib/common_define.h"
+
+#include "indexlib/test/test.h"
+#include "indexlib/test/unittest.h"
+#include "indexlib/test/multi_thread_test_base.h"
+#include "indexlib/index/normal/primarykey/in_mem_primary_key_hash_table.h"
+
+IE_NAMESPACE_BEGIN(index);
+
+class InMemPrimaryKeyHashTableTest : public test::MultiThreadTestBase
+{
+public:
+    InMemPrimaryKeyHashTableTest();
+    ~InMemPrimaryKeyHashTableTest();
+
+    DECLARE_CLASS_NAME(InMemPrimaryKeyHashTableTest);
+public:
+    void CaseSetUp() override;
+    void CaseTearDown() override;
+    void TestSimpleProcess();
+    void TestFindAndInsertWhenExpand();
+    void TestIteratorWhenMigrating();
+    void TestMultiThreadReadWrite();
+
+private:
+    void DoWrite() override;
+    void DoRead(int* status) override;
+
+    template <typename Key>
+    void InnerTestFindAndInsertWhenExpand();
+
+    template <typename Key>
+    static Key MakeKey(uint64_t id);
+
+private:
+    static const uint64_t KEY_COUNT = 200000;
+    std::tr1::shared_ptr<InMemPrimaryKeyHashTable<uint64_t> > mHashTable;
+    volatile uint64_t mInsertedCount;
+
+private:
+    IE_LOG_DECLARE();
+};
+
+INDEXLIB_UNIT_TEST_CASE(InMemPrimaryKeyHashTableTest, TestSimpleProcess);
+INDEXLIB_UNIT_TEST_CASE(InMemPrimaryKeyHashTableTest, TestFindAndInsertWhenExpand);
+INDEXLIB_UNIT_TEST_CASE(InMemPrimaryKeyHashTableTest, TestIteratorWhenMigrating);
+INDEXLIB_UNIT_TEST_CASE(InMemPrimaryKeyHashTableTest, TestMultiThreadReadWrite);
+
+//////////////////////////////////////////////////////////////////////////
+
+template <typename Key>
+void InMemPrimaryKeyHashTableTest::InnerTestFindAndInsertWhenExpand()
+{
+    InMemPrimaryKeyHashTable<Key> hashTable(4);
+    const uint64_t keyCount = 10000;
+    for (uint64_t i = 0; i < keyCount; ++i)
+    {
+        hashTable.FindAndInsert(MakeKey<Key>(i), (docid_t)i);
+        // update part of keys, some of them still in old table
+        if (i % 3 == 0)
+        {
+            hashTable.FindAndInsert(MakeKey<Key>(i / 2), (docid_t)(i + keyCount));
+        }
+    }
+    ASSERT_EQ((size_t)keyCount, hashTable.Size());
+    ASSERT_LT(hashTable.BucketCount(), (uint64_t)(keyCount * 8));
+
+    std::vector<docid_t> expected(keyCount);
+    for (uint64_t i = 0; i < keyCount; ++i)
+    {
+        expected[i] = (docid_t)i;
+        if (i % 3 == 0)
+        {
+            expected[i / 2] = (docid_t)(i + keyCount);
+        }
+    }
+    for (uint64_t i = 0; i < keyCount; ++i)
+    {
+        ASSERT_EQ(expected[i], hashTable.Find(MakeKey<Key>(i), INVALID_DOCID)) << i;
+    }
+    ASSERT_EQ(INVALID_DOCID, hashTable.Find(MakeKey<Key>(keyCount), INVALID_DOCID));
+}
+
+template <>
+inline uint64_t InMemPrimaryKeyHashTableTest::MakeKey<uint64_t>(uint64_t id)
+{
+    return id * 7919;
+}
+
+template <>
+inline autil::uint128_t InMemPrimaryKeyHashTableTest::MakeKey<autil::uint128_t>(uint64_t id)
+{
+    autil::uint128_t key;
+    key.value[0] = id * 7919;
+    key.value[1] = id;
+    return key;
+}
+
+IE_NAMESPACE_END(index);
+
+#endif //__INDEXLIB_INMEMPRIMARYKEYHASHTABLETEST_H
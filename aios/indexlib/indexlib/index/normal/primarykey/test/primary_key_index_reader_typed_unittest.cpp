@@ -132,7 +132,7 @@ UInt64InMemPKSegmentReaderPtr PrimaryKeyIndexReaderTypedTest::CreateInMemPkSegme
         const vector<vector<uint32_t> >& rtDocInfos, docid_t baseDocId, 
         DeletionMapReaderPtr deletionMapReader)
 {
-    typedef HashMap<uint64_t, docid_t> PKHashMap;
+    typedef InMemPrimaryKeyHashTable<uint64_t> PKHashMap;
     typedef std::tr1::shared_ptr<PKHashMap> PKHashMapPtr;
 
     assert(deletionMapReader);
@@ -126,6 +126,112 @@ bool LocalDiskSummaryReader::GetDocumentFromSummary(
     return false;
 }
 
+vector<bool> LocalDiskSummaryReader::BatchGetDocument(
+        const vector<docid_t>& docIds,
+        const vector<SearchSummaryDocument*>& summaryDocs,
+        int64_t deadline) const
+{
+    vector<bool> results(docIds.size(), true);
+    BatchFillDocument(docIds, summaryDocs, deadline, results);
+    return results;
+}
+
+void LocalDiskSummaryReader::BatchFillDocument(
+        const vector<docid_t>& docIds,
+        const vector<SearchSummaryDocument*>& summaryDocs,
+        int64_t deadline, vector<bool>& results) const
+{
+    assert(docIds.size() == summaryDocs.size());
+    assert(docIds.size() == results.size());
+    BatchGetDocumentFromSummary(docIds, summaryDocs, deadline, results);
+    for (size_t i = 0; i < docIds.size(); ++i)
+    {
+        if (results[i])
+        {
+            results[i] = GetDocumentFromAttributes(docIds[i], summaryDocs[i]);
+        }
+    }
+}
+
+void LocalDiskSummaryReader::BatchGetDocumentFromSummary(
+        const vector<docid_t>& docIds,
+        const vector<SearchSummaryDocument*>& summaryDocs,
+        int64_t deadline, vector<bool>& results) const
+{
+    if (!mSummaryGroupConfig->NeedStoreSummary())
+    {
+        for (size_t i = 0; i < docIds.size(); ++i)
+        {
+            results[i] = results[i] && docIds[i] >= 0;
+        }
+        return;
+    }
+
+    // group built docs by segment, building docs are read one by one
+    vector<vector<size_t> > segmentDocIdx(mSegmentInfos.size());
+    for (size_t i = 0; i < docIds.size(); ++i)
+    {
+        if (!results[i])
+        {
+            continue;
+        }
+        docid_t docId = docIds[i];
+        if (docId < 0)
+        {
+            results[i] = false;
+            continue;
+        }
+        if (docId >= mBuildingBaseDocId)
+        {
+            results[i] = mBuildingSummaryReader &&
+                mBuildingSummaryReader->GetDocument(docId, summaryDocs[i]);
+            continue;
+        }
+        results[i] = false;
+        docid_t baseDocId = 0;
+        for (uint32_t j = 0; j < mSegmentInfos.size(); j++)
+        {
+            if (docId < baseDocId + (docid_t)mSegmentInfos[j].docCount)
+            {
+                segmentDocIdx[j].push_back(i);
+                break;
+            }
+            baseDocId += mSegmentInfos[j].docCount;
+        }
+    }
+
+    docid_t baseDocId = 0;
+    bool hasRead = false;
+    for (uint32_t i = 0; i < mSegmentInfos.size(); i++)
+    {
+        const vector<size_t>& docIdx = segmentDocIdx[i];
+        if (!docIdx.empty())
+        {
+            if (hasRead && deadline >= 0 && TimeUtility::currentTime() >= deadline)
+            {
+                break;
+            }
+            hasRead = true;
+            vector<docid_t> localDocIds;
+            vector<SearchSummaryDocument*> segmentSummaryDocs;
+            localDocIds.reserve(docIdx.size());
+            segmentSummaryDocs.reserve(docIdx.size());
+            for (size_t idx : docIdx)
+            {
+                localDocIds.push_back(docIds[idx] - baseDocId);
+                segmentSummaryDocs.push_back(summaryDocs[idx]);
+            }
+            vector<bool> segmentResults = mSegmentReaders[i]->BatchGetDocument(
+                    localDocIds, segmentSummaryDocs, deadline);
+            for (size_t j = 0; j < docIdx.size(); ++j)
+            {
+                results[docIdx[j]] = segmentResults[j];
+            }
+        }
+        baseDocId += mSegmentInfos[i].docCount;
+    }
+}
+
 bool LocalDiskSummaryReader::SetSummaryDocField(SearchSummaryDocument *summaryDoc,
                                                 fieldid_t fieldId, const string& value) const
 {
@@ -34,6 +34,16 @@ public:
     bool GetDocument(docid_t docId,
                      document::SearchSummaryDocument *summaryDoc) const override;
 
+    std::vector<bool> BatchGetDocument(
+            const std::vector<docid_t>& docIds,
+            const std::vector<document::SearchSummaryDocument*>& summaryDocs,
+            int64_t deadline = -1) const override;
+
+    // fill fields of this group into summaryDocs, docs with false result are skipped
+    void BatchFillDocument(const std::vector<docid_t>& docIds,
+                           const std::vector<document::SearchSummaryDocument*>& summaryDocs,
+                           int64_t deadline, std::vector<bool>& results) const;
+
     void AddAttrReader(fieldid_t fieldId, const AttributeReaderPtr& attrReader) override;
     void AddPackAttrReader(fieldid_t fieldId, const PackAttributeReaderPtr& attrReader) override;
     
@@ -42,6 +52,10 @@ private:
     void LoadSegmentInfo(const std::string& segPath, index_base::SegmentInfo& segInfo);
     bool GetDocumentFromSummary(
             docid_t docId, document::SearchSummaryDocument *summaryDoc) const;
+    void BatchGetDocumentFromSummary(
+            const std::vector<docid_t>& docIds,
+            const std::vector<document::SearchSummaryDocument*>& summaryDocs,
+            int64_t deadline, std::vector<bool>& results) const;
     bool GetDocumentFromAttributes(
             docid_t docId, document::SearchSummaryDocument *summaryDoc) const;
     bool LoadSegmentReader(const index_base::SegmentData& segmentData);
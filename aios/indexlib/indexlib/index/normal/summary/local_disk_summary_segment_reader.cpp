@@ -1,4 +1,7 @@
 #include <sys/mman.h>
+#include <algorithm>
+#include <future_lite/Future.h>
+#include <autil/TimeUtility.h>
 #include "indexlib/index/normal/summary/local_disk_summary_segment_reader.h"
 #include "indexlib/util/mmap_allocator.h"
 #include "indexlib/file_system/directory.h"
@@ -6,6 +9,7 @@
 using namespace std;
 using namespace fslib;
 using namespace fslib::fs;
+using namespace autil;
 
 IE_NAMESPACE_USE(config);
 IE_NAMESPACE_USE(util);
@@ -75,20 +79,9 @@ file_system::FileReaderPtr LocalDiskSummarySegmentReader::LoadOffsetFile(
 bool LocalDiskSummarySegmentReader::GetDocument(docid_t localDocId, 
         SearchSummaryDocument *summaryDoc) const
 {
-    assert(localDocId != INVALID_DOCID);
-    assert(mOffsetData);
-
-    uint64_t offset = mOffsetData[localDocId];
-    uint32_t len;
-    if (localDocId == (docid_t)mSegmentInfo.docCount - 1)
-    {
-        len = mDataFileLength - offset;
-    }
-    else
-    {
-        len = mOffsetData[localDocId + 1] - offset;
-    }
-
+    uint64_t offset = 0;
+    uint32_t len = 0;
+    GetDocLocation(localDocId, offset, len);
     if (len == 0)
     {
         return false; 
@@ -122,5 +115,146 @@ bool LocalDiskSummarySegmentReader::GetDocument(docid_t localDocId,
     return false;
 }
 
+void LocalDiskSummarySegmentReader::GetDocLocation(
+        docid_t localDocId, uint64_t& offset, uint32_t& len) const
+{
+    assert(localDocId != INVALID_DOCID);
+    assert(mOffsetData);
+
+    offset = mOffsetData[localDocId];
+    if (localDocId == (docid_t)mSegmentInfo.docCount - 1)
+    {
+        len = mDataFileLength - offset;
+    }
+    else
+    {
+        len = mOffsetData[localDocId + 1] - offset;
+    }
+}
+
+vector<bool> LocalDiskSummarySegmentReader::BatchGetDocument(
+        const vector<docid_t>& localDocIds,
+        const vector<SearchSummaryDocument*>& summaryDocs,
+        int64_t deadline) const
+{
+    assert(localDocIds.size() == summaryDocs.size());
+    struct DocLocation
+    {
+        uint64_t offset;
+        uint32_t len;
+        size_t bufferOffset;
+        size_t rangeIdx;
+    };
+    struct ReadRange
+    {
+        uint64_t offset;
+        uint64_t len;
+        size_t bufferOffset;
+    };
+
+    vector<bool> results(localDocIds.size(), false);
+    vector<DocLocation> locations(localDocIds.size());
+    vector<size_t> sortedIdx;
+    sortedIdx.reserve(localDocIds.size());
+    for (size_t i = 0; i < localDocIds.size(); ++i)
+    {
+        GetDocLocation(localDocIds[i], locations[i].offset, locations[i].len);
+        if (locations[i].len > 0)
+        {
+            sortedIdx.push_back(i);
+        }
+    }
+    sort(sortedIdx.begin(), sortedIdx.end(),
+         [&locations](size_t lhs, size_t rhs) {
+             return locations[lhs].offset < locations[rhs].offset;
+         });
+
+    vector<ReadRange> ranges;
+    size_t bufferSize = 0;
+    for (size_t idx : sortedIdx)
+    {
+        DocLocation& location = locations[idx];
+        uint64_t docEnd = location.offset + location.len;
+        if (!ranges.empty())
+        {
+            ReadRange& last = ranges.back();
+            uint64_t lastEnd = last.offset + last.len;
+            if (location.offset <= lastEnd + MAX_COALESCE_GAP
+                && max(lastEnd, docEnd) - last.offset <= MAX_COALESCE_READ_SIZE)
+            {
+                if (docEnd > lastEnd)
+                {
+                    bufferSize += docEnd - lastEnd;
+                    last.len = docEnd - last.offset;
+                }
+                location.bufferOffset = last.bufferOffset + (location.offset - last.offset);
+                location.rangeIdx = ranges.size() - 1;
+                continue;
+            }
+        }
+        ranges.push_back({location.offset, location.len, bufferSize});
+        location.bufferOffset = bufferSize;
+        location.rangeIdx = ranges.size() - 1;
+        bufferSize += location.len;
+    }
+
+    // kept alive by the reads still in flight when the deadline passes
+    shared_ptr<vector<char> > buffer(new vector<char>(bufferSize));
+    vector<future_lite::Future<size_t>> futures;
+    futures.reserve(ranges.size());
+    for (const ReadRange& range : ranges)
+    {
+        futures.push_back(mDataFileReader->ReadAsync(buffer->data() + range.bufferOffset,
+                        range.len, range.offset, ReadOption()));
+    }
+    size_t readRangeCount = 0;
+    while (readRangeCount < futures.size())
+    {
+        future_lite::Future<size_t>& future = futures[readRangeCount];
+        future.wait();
+        size_t readSize = future.value();
+        const ReadRange& range = ranges[readRangeCount];
+        if (readSize != range.len)
+        {
+            INDEXLIB_FATAL_ERROR(FileIO, "read summary data [%s] failed, offset [%lu],"
+                    " expect length [%lu], actual length [%lu]",
+                    mDataFileReader->GetPath().c_str(), range.offset,
+                    range.len, readSize);
+        }
+        ++readRangeCount;
+        if (deadline >= 0 && readRangeCount < futures.size()
+            && TimeUtility::currentTime() >= deadline)
+        {
+            IE_LOG(WARN, "batch read summary [%s] timeout, [%lu] of [%lu] reads done",
+                   mDataFileReader->GetPath().c_str(), readRangeCount, futures.size());
+            break;
+        }
+    }
+    FileReaderPtr fileReader = mDataFileReader;
+    for (size_t i = readRangeCount; i < futures.size(); ++i)
+    {
+        std::move(futures[i]).thenValue([buffer, fileReader](size_t) {});
+    }
+
+    SummaryGroupFormatter formatter(mSummaryGroupConfig);
+    for (size_t idx : sortedIdx)
+    {
+        const DocLocation& location = locations[idx];
+        if (location.rangeIdx >= readRangeCount)
+        {
+            continue;
+        }
+        if (!formatter.DeserializeSummary(summaryDocs[idx],
+                        buffer->data() + location.bufferOffset, location.len))
+        {
+            stringstream ss;
+            ss << "Deserialize summary[docid = " << localDocIds[idx] << "] FAILED.";
+            INDEXLIB_THROW(misc::IndexCollapsedException, "%s", ss.str().c_str());
+        }
+        results[idx] = true;
+    }
+    return results;
+}
+
 IE_NAMESPACE_END(index);
 
@@ -27,6 +27,13 @@ public:
     bool GetDocument(
             docid_t localDocId, document::SearchSummaryDocument *summaryDoc) const override;
 
+    // docs are read in offset order, nearby docs share one async read,
+    // deadline is checked as each read completes
+    std::vector<bool> BatchGetDocument(
+            const std::vector<docid_t>& localDocIds,
+            const std::vector<document::SearchSummaryDocument*>& summaryDocs,
+            int64_t deadline = -1) const;
+
     size_t GetRawDataLength(docid_t localDocId) override 
     { assert(false); return 0; }
 
@@ -40,6 +47,9 @@ protected:
     virtual file_system::FileReaderPtr LoadOffsetFile(
             const file_system::DirectoryPtr& directory);
 
+private:
+    void GetDocLocation(docid_t localDocId, uint64_t& offset, uint32_t& len) const;
+
 protected:
     uint64_t* mOffsetData;
     file_system::FileReaderPtr mDataFileReader;
@@ -50,6 +60,11 @@ protected:
     uint64_t mDataFileLength;
     index_base::SegmentInfo mSegmentInfo;
 
+private:
+    // max hole between two docs merged into one read
+    static const uint64_t MAX_COALESCE_GAP = 4 * 1024;
+    static const uint64_t MAX_COALESCE_READ_SIZE = 1024 * 1024;
+
 private:
     friend class LocalDiskSummarySegmentReaderTest;
     IE_LOG_DECLARE();
@@ -4,6 +4,7 @@
 #include "indexlib/common_define.h"
 #include "indexlib/indexlib.h"
 #include <tr1/memory>
+#include <autil/TimeUtility.h>
 #include "indexlib/index/normal/primarykey/primary_key_index_reader_typed.h"
 #include "indexlib/misc/exception.h"
 
@@ -37,6 +38,18 @@ public:
                              const SummaryGroupIdVec& groupVec) const
     { assert(false); return false; }
 
+    // batch version of GetDocument, result[i] tells whether docIds[i] is
+    // fetched into summaryDocs[i]. deadline is a TimeUtility::currentTime()
+    // timestamp, docs not read before it are left with false, -1 means no deadline
+    virtual std::vector<bool> BatchGetDocument(
+            const std::vector<docid_t>& docIds,
+            const std::vector<document::SearchSummaryDocument*>& summaryDocs,
+            int64_t deadline = -1) const;
+    virtual std::vector<bool> BatchGetDocument(
+            const std::vector<docid_t>& docIds,
+            const std::vector<document::SearchSummaryDocument*>& summaryDocs,
+            const SummaryGroupIdVec& groupVec, int64_t deadline = -1) const;
+
     virtual std::string GetIdentifier() const = 0;
 
     virtual void AddAttrReader(fieldid_t fieldId, const AttributeReaderPtr& attrReader) = 0;
@@ -74,6 +87,42 @@ inline void SummaryReader::AssertPkIndexExist() const
     }
 }
 
+inline std::vector<bool> SummaryReader::BatchGetDocument(
+        const std::vector<docid_t>& docIds,
+        const std::vector<document::SearchSummaryDocument*>& summaryDocs,
+        int64_t deadline) const
+{
+    assert(docIds.size() == summaryDocs.size());
+    std::vector<bool> results(docIds.size(), false);
+    for (size_t i = 0; i < docIds.size(); ++i)
+    {
+        if (deadline >= 0 && autil::TimeUtility::currentTime() >= deadline)
+        {
+            break;
+        }
+        results[i] = GetDocument(docIds[i], summaryDocs[i]);
+    }
+    return results;
+}
+
+inline std::vector<bool> SummaryReader::BatchGetDocument(
+        const std::vector<docid_t>& docIds,
+        const std::vector<document::SearchSummaryDocument*>& summaryDocs,
+        const SummaryGroupIdVec& groupVec, int64_t deadline) const
+{
+    assert(docIds.size() == summaryDocs.size());
+    std::vector<bool> results(docIds.size(), false);
+    for (size_t i = 0; i < docIds.size(); ++i)
+    {
+        if (deadline >= 0 && autil::TimeUtility::currentTime() >= deadline)
+        {
+            break;
+        }
+        results[i] = GetDocument(docIds[i], summaryDocs[i], groupVec);
+    }
+    return results;
+}
+
 inline bool SummaryReader::GetDocumentByPkStr(const std::string &pkStr,
                                        document::SearchSummaryDocument *summaryDoc) const
 {
@@ -111,5 +111,52 @@ bool SummaryReaderImpl::DoGetDocument(docid_t docId,
     return true;
 }
 
+vector<bool> SummaryReaderImpl::BatchGetDocument(
+        const vector<docid_t>& docIds,
+        const vector<SearchSummaryDocument*>& summaryDocs,
+        const SummaryGroupIdVec& groupVec, int64_t deadline) const
+{
+    assert(docIds.size() == summaryDocs.size());
+    vector<bool> results(docIds.size(), true);
+    try
+    {
+        DoBatchGetDocument(docIds, summaryDocs, groupVec, deadline, results);
+        return results;
+    }
+    catch (const misc::ExceptionBase &e)
+    {
+        IE_LOG(ERROR, "BatchGetDocument exception: %s", e.what());
+    }
+    catch (const std::exception& e)
+    {
+        IE_LOG(ERROR, "BatchGetDocument exception: %s", e.what());
+    }
+    catch (...)
+    {
+        IE_LOG(ERROR, "BatchGetDocument exception");
+    }
+    return vector<bool>(docIds.size(), false);
+}
+
+void SummaryReaderImpl::DoBatchGetDocument(
+        const vector<docid_t>& docIds,
+        const vector<SearchSummaryDocument*>& summaryDocs,
+        const SummaryGroupIdVec& groupVec, int64_t deadline,
+        vector<bool>& results) const
+{
+    for (size_t i = 0; i < groupVec.size(); ++i)
+    {
+        if (unlikely(groupVec[i] < 0 ||
+                     groupVec[i] >= (summarygroupid_t)mSummaryGroups.size()))
+        {
+            IE_LOG(WARN, "invalid summary group id [%d], max group id [%d]",
+                   groupVec[i], (summarygroupid_t)mSummaryGroups.size());
+            results.assign(docIds.size(), false);
+            return;
+        }
+        mSummaryGroups[groupVec[i]]->BatchFillDocument(docIds, summaryDocs, deadline, results);
+    }
+}
+
 IE_NAMESPACE_END(index);
 
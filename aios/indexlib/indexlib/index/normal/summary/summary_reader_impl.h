@@ -32,10 +32,25 @@ public:
                      document::SearchSummaryDocument *summaryDoc,
                      const SummaryGroupIdVec& groupVec) const override final;
 
+    std::vector<bool> BatchGetDocument(
+            const std::vector<docid_t>& docIds,
+            const std::vector<document::SearchSummaryDocument*>& summaryDocs,
+            int64_t deadline = -1) const override final
+    { return BatchGetDocument(docIds, summaryDocs, mAllGroupIds, deadline); }
+
+    std::vector<bool> BatchGetDocument(
+            const std::vector<docid_t>& docIds,
+            const std::vector<document::SearchSummaryDocument*>& summaryDocs,
+            const SummaryGroupIdVec& groupVec, int64_t deadline = -1) const override final;
+
 private:
     bool DoGetDocument(docid_t docId,
                        document::SearchSummaryDocument *summaryDoc,
                        const SummaryGroupIdVec& groupVec) const;
+    void DoBatchGetDocument(const std::vector<docid_t>& docIds,
+                            const std::vector<document::SearchSummaryDocument*>& summaryDocs,
+                            const SummaryGroupIdVec& groupVec, int64_t deadline,
+                            std::vector<bool>& results) const;
 
 private:
     typedef std::vector<LocalDiskSummaryReaderPtr> SummaryGroupVec;
@@ -146,6 +146,79 @@ public:
 
     }
 
+    void TestCaseForBatchGetDocument()
+    {
+        vector<uint32_t> fullBuildDocCounts;
+        fullBuildDocCounts.push_back(10);
+        fullBuildDocCounts.push_back(5);
+        fullBuildDocCounts.push_back(27);
+        for (bool compress : {false, true})
+        {
+            for (const string& loadStrategyName : {READ_MODE_MMAP, READ_MODE_CACHE})
+            {
+                TearDown();
+                SetUp();
+                mIndexPartitionSchema->GetRegionSchema(DEFAULT_REGIONID)->SetSummaryCompress(compress);
+                autil::mem_pool::Pool pool;
+                DocumentArray answerDocArray;
+                FullBuild(fullBuildDocCounts, &pool, answerDocArray);
+                AttrReaderMapPtr attrReaderMap = MakeAttrReaderMap();
+                SummaryReaderPtr summaryReader = CreateSummaryReader(
+                        fullBuildDocCounts.size(), attrReaderMap, loadStrategyName);
+                CheckBatchGetDocument(summaryReader, answerDocArray, attrReaderMap);
+            }
+        }
+    }
+
+    void TestCaseForBatchGetDocumentWithDeadline()
+    {
+        vector<uint32_t> fullBuildDocCounts;
+        fullBuildDocCounts.push_back(10);
+        fullBuildDocCounts.push_back(5);
+        fullBuildDocCounts.push_back(27);
+        autil::mem_pool::Pool pool;
+        DocumentArray answerDocArray;
+        FullBuild(fullBuildDocCounts, &pool, answerDocArray);
+        AttrReaderMapPtr attrReaderMap = MakeAttrReaderMap();
+        SummaryReaderPtr summaryReader = CreateSummaryReader(
+                fullBuildDocCounts.size(), attrReaderMap, READ_MODE_CACHE);
+
+        size_t summaryCount = mIndexPartitionSchema->GetSummarySchema()->GetSummaryCount();
+        vector<docid_t> docIds;
+        vector<SearchSummaryDocumentPtr> gotDocs;
+        vector<SearchSummaryDocument*> summaryDocs;
+        for (docid_t docId = 0; docId < (docid_t)answerDocArray.size(); ++docId)
+        {
+            if (!answerDocArray[docId])
+            {
+                continue;
+            }
+            docIds.push_back(docId);
+            gotDocs.push_back(SearchSummaryDocumentPtr(
+                            new SearchSummaryDocument(NULL, summaryCount)));
+            summaryDocs.push_back(gotDocs.back().get());
+        }
+        // deadline already passed: the first read completes, later segments are skipped
+        vector<bool> results = summaryReader->BatchGetDocument(docIds, summaryDocs, 0);
+        ASSERT_EQ(docIds.size(), results.size());
+        ASSERT_TRUE(docIds[0] < (docid_t)fullBuildDocCounts[0]);
+        ASSERT_TRUE(results[0]);
+        for (size_t i = 0; i < docIds.size(); ++i)
+        {
+            if (docIds[i] >= (docid_t)fullBuildDocCounts[0])
+            {
+                ASSERT_FALSE(results[i]) << docIds[i];
+            }
+        }
+
+        results = summaryReader->BatchGetDocument(docIds, summaryDocs,
+                autil::TimeUtility::currentTime() + 10 * 1000 * 1000);
+        for (size_t i = 0; i < docIds.size(); ++i)
+        {
+            ASSERT_TRUE(results[i]) << docIds[i];
+        }
+    }
+
     void TestCaseForGetDocumentFromSummary()
     {
         autil::mem_pool::Pool pool;
@@ -291,6 +364,62 @@ private:
         }
     }
 
+    void CheckBatchGetDocument(const SummaryReaderPtr& summaryReader,
+                               const DocumentArray& answerDocArray,
+                               AttrReaderMapPtr attrReaderMap)
+    {
+        // reversed, with duplicated and invalid docids
+        vector<docid_t> docIds;
+        for (docid_t docId = (docid_t)answerDocArray.size() - 1; docId >= 0; docId -= 2)
+        {
+            docIds.push_back(docId);
+        }
+        for (docid_t docId = 0; docId < (docid_t)answerDocArray.size(); docId += 3)
+        {
+            docIds.push_back(docId);
+        }
+        docIds.push_back(INVALID_DOCID);
+        docIds.push_back((docid_t)answerDocArray.size());
+
+        size_t summaryCount = mIndexPartitionSchema->GetSummarySchema()->GetSummaryCount();
+        vector<SearchSummaryDocumentPtr> gotDocs;
+        vector<SearchSummaryDocument*> summaryDocs;
+        for (size_t i = 0; i < docIds.size(); ++i)
+        {
+            gotDocs.push_back(SearchSummaryDocumentPtr(
+                            new SearchSummaryDocument(NULL, summaryCount)));
+            summaryDocs.push_back(gotDocs.back().get());
+        }
+        vector<bool> results = summaryReader->BatchGetDocument(docIds, summaryDocs);
+        ASSERT_EQ(docIds.size(), results.size());
+        for (size_t i = 0; i < docIds.size(); ++i)
+        {
+            docid_t docId = docIds[i];
+            if (docId < 0 || docId >= (docid_t)answerDocArray.size()
+                || !answerDocArray[docId])
+            {
+                ASSERT_FALSE(results[i]) << docId;
+                continue;
+            }
+            ASSERT_TRUE(results[i]) << docId;
+            SummaryDocumentPtr answerDoc = answerDocArray[docId];
+            ASSERT_EQ(answerDoc->GetNotEmptyFieldCount(), summaryDocs[i]->GetFieldCount());
+            for (uint32_t j = 0; j < summaryDocs[i]->GetFieldCount(); ++j)
+            {
+                ConstString constStr = answerDoc->GetField((fieldid_t)j);
+                string expectField(constStr.data(), constStr.size());
+                AttrReaderMap::const_iterator it = attrReaderMap->find((fieldid_t)j);
+                if (it != attrReaderMap->end())
+                {
+                    it->second->Read(answerDoc->GetDocId(), expectField);
+                }
+                const autil::ConstString* str =
+                    summaryDocs[i]->GetFieldValue((summaryfieldid_t)j);
+                ASSERT_EQ(expectField, string(str->data(), str->size())) << docId;
+            }
+        }
+    }
+
     bool FloatEqual(float a, float b)
     {
         return fabs(a - b) < 1E-6;
@@ -399,5 +528,7 @@ INDEXLIB_UNIT_TEST_CASE(LocalDiskSummaryReaderTest, TestCaseForOneSegment);
 INDEXLIB_UNIT_TEST_CASE(LocalDiskSummaryReaderTest, TestCaseForMultiSegments);
 INDEXLIB_UNIT_TEST_CASE(LocalDiskSummaryReaderTest, TestCaseForInvalidDocId);
 INDEXLIB_UNIT_TEST_CASE(LocalDiskSummaryReaderTest, TestCaseForGetDocumentFromSummary);
+INDEXLIB_UNIT_TEST_CASE(LocalDiskSummaryReaderTest, TestCaseForBatchGetDocument);
+INDEXLIB_UNIT_TEST_CASE(LocalDiskSummaryReaderTest, TestCaseForBatchGetDocumentWithDeadline);
 IE_NAMESPACE_END(index);
 
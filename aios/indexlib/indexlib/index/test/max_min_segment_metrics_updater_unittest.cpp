@@ -1,5 +1,6 @@
 #include "indexlib/index/test/max_min_segment_metrics_updater_unittest.h"
 #include "indexlib/config/index_partition_options.h"
+#include "indexlib/index_base/index_meta/segment_group_metrics.h"
 #include "indexlib/test/document_creator.h"
 #include "indexlib/test/schema_maker.h"
 
@@ -89,4 +90,55 @@ void MaxMinSegmentMetricsUpdaterTest::TestSimpleProcess()
     }
 }
 
+void MaxMinSegmentMetricsUpdaterTest::TestBlockValues()
+{
+    string field = "pk:uint64:pk;long1:uint32;";
+    string index = "pk:primarykey64:pk;";
+    string attr = "long1";
+    auto schema = SchemaMaker::MakeSchema(field, index, attr, "");
+    IndexPartitionOptions options;
+    util::KeyValueMap parameters;
+    parameters["attribute_name"] = "long1";
+    parameters["block_size"] = "2";
+    MaxMinSegmentMetricsUpdater updater;
+    ASSERT_TRUE(updater.Init(schema, options, parameters));
+    string docStrings = "cmd=add,pk=1,long1=100;"
+                        "cmd=add,pk=2,long1=10;"
+                        "cmd=add,pk=3,long1=55;"
+                        "cmd=add,pk=4,long1=70;"
+                        "cmd=add,pk=5,long1=3;";
+    auto docs = DocumentCreator::CreateDocuments(schema, docStrings);
+    ASSERT_EQ(5u, docs.size());
+    for (const auto& doc : docs)
+    {
+        updater.Update(doc);
+    }
+    json::JsonMap jsonMap = updater.Dump();
+    SegmentGroupMetricsPtr groupMetrics(new SegmentGroupMetrics(jsonMap));
+    uint32_t maxValue = 0;
+    uint32_t minValue = 0;
+    ASSERT_TRUE(MaxMinSegmentMetricsUpdater::GetAttrValues(
+                    groupMetrics, "long1", maxValue, minValue));
+    EXPECT_EQ(100u, maxValue);
+    EXPECT_EQ(3u, minValue);
+
+    uint32_t blockSize = 0;
+    vector<uint32_t> blockMaxValues;
+    vector<uint32_t> blockMinValues;
+    ASSERT_TRUE(MaxMinSegmentMetricsUpdater::GetBlockAttrValues(
+                    groupMetrics, "long1", blockSize, blockMaxValues, blockMinValues));
+    EXPECT_EQ(2u, blockSize);
+    EXPECT_EQ(vector<uint32_t>({100, 70, 3}), blockMaxValues);
+    EXPECT_EQ(vector<uint32_t>({10, 55, 3}), blockMinValues);
+
+    parameters.erase("block_size");
+    MaxMinSegmentMetricsUpdater noBlockUpdater;
+    ASSERT_TRUE(noBlockUpdater.Init(schema, options, parameters));
+    noBlockUpdater.Update(docs[0]);
+    jsonMap = noBlockUpdater.Dump();
+    groupMetrics.reset(new SegmentGroupMetrics(jsonMap));
+    ASSERT_FALSE(MaxMinSegmentMetricsUpdater::GetBlockAttrValues(
+                    groupMetrics, "long1", blockSize, blockMaxValues, blockMinValues));
+}
+
 IE_NAMESPACE_END(index);
@@ -19,11 +19,13 @@ public:
     void CaseSetUp() override;
     void CaseTearDown() override;
     void TestSimpleProcess();
+    void TestBlockValues();
 private:
     IE_LOG_DECLARE();
 };
 
 INDEXLIB_UNIT_TEST_CASE(MaxMinSegmentMetricsUpdaterTest, TestSimpleProcess);
+INDEXLIB_UNIT_TEST_CASE(MaxMinSegmentMetricsUpdaterTest, TestBlockValues);
 
 IE_NAMESPACE_END(index);
 
@@ -0,0 +1,531 @@
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+#include <autil/MurmurHash.h>
+#include <autil/StringUtil.h>
+#include "indexlib/index_base/deploy_index_executor.h"
+#include "indexlib/storage/file_system_wrapper.h"
+#include "indexlib/storage/file_wrapper.h"
+#include "indexlib/util/thread_pool.h"
+#include "indexlib/util/lambda_work_item.h"
+#include "indexlib/util/path_util.h"
+#include "indexlib/misc/exception.h"
+#include "indexlib/index_define.h"
+
+using namespace std;
+using namespace autil;
+IE_NAMESPACE_USE(storage);
+IE_NAMESPACE_USE(util);
+IE_NAMESPACE_USE(misc);
+
+IE_NAMESPACE_BEGIN(index_base);
+IE_LOG_SETUP(index_base, DeployIndexExecutor);
+
+const string DeployIndexExecutor::TEMP_FILE_SUFFIX = ".__deploy_tmp__";
+const string DeployIndexExecutor::PROGRESS_FILE_SUFFIX = ".__deploy_progress__";
+const string DeployIndexExecutor::DONE_RECORD_FILE_NAME = "__deploy_done__";
+
+DeployIndexExecutor::DeployIndexExecutor(const string& sourceRoot,
+                                         const string& targetRoot,
+                                         const DeployOption& option)
+    : mSourceRoot(sourceRoot)
+    , mTargetRoot(targetRoot)
+    , mOption(option)
+    , mDoneRecordFd(-1)
+    , mHasError(false)
+    , mCopiedChunkCount(0)
+{
+    if (mOption.threadNum == 0)
+    {
+        mOption.threadNum = 1;
+    }
+    if (mOption.chunkSize == 0)
+    {
+        mOption.chunkSize = DeployOption().chunkSize;
+    }
+    if (mOption.maxOpenFileCount == 0)
+    {
+        mOption.maxOpenFileCount = 1;
+    }
+}
+
+DeployIndexExecutor::~DeployIndexExecutor()
+{
+    CloseDoneRecord();
+}
+
+DeployIndexExecutor::DeployPriority DeployIndexExecutor::GetDeployPriority(
+        const string& filePath)
+{
+    vector<string> items = StringUtil::split(filePath, "/");
+    if (!items.empty() && items[0] == SUB_SEGMENT_DIR_NAME)
+    {
+        items.erase(items.begin());
+    }
+    // version, schema, index_format_version ...
+    if (items.size() <= 1)
+    {
+        return DP_META;
+    }
+    if (items[0] == TRUNCATE_META_DIR_NAME || items[0] == ADAPTIVE_DICT_DIR_NAME)
+    {
+        // only used by merger
+        return DP_COLD;
+    }
+    size_t dirIdx = 1;
+    if (items[dirIdx] == SUB_SEGMENT_DIR_NAME)
+    {
+        ++dirIdx;
+    }
+    // segment_info, segment_file_list, counter ...
+    if (items.size() <= dirIdx + 1)
+    {
+        return DP_META;
+    }
+    // position lists are inline in posting files, index is serving as a whole
+    if (items[dirIdx] == SUMMARY_DIR_NAME)
+    {
+        return DP_COLD;
+    }
+    return DP_SERVING;
+}
+
+string DeployIndexExecutor::GetTargetPath(const string& filePath) const
+{
+    return FileSystemWrapper::JoinPath(mTargetRoot, filePath);
+}
+
+uint64_t DeployIndexExecutor::CalculateChecksum(const char* data, size_t length)
+{
+    return MurmurHash::MurmurHash64A(data, length, 0);
+}
+
+bool DeployIndexExecutor::Deploy(const IndexFileList& deployIndexMeta,
+                                 const OpenableCallback& openableCallback)
+{
+    mHasError = false;
+    vector<FileInfo> groups[DP_COUNT];
+    try
+    {
+        FileSystemWrapper::MkDirIfNotExist(mTargetRoot);
+        OpenDoneRecord();
+        for (const FileInfo& fileInfo : deployIndexMeta.deployFileMetas)
+        {
+            if (fileInfo.isDirectory())
+            {
+                FileSystemWrapper::MkDirIfNotExist(GetTargetPath(fileInfo.filePath));
+                continue;
+            }
+            DeployPriority priority = mClassifier ?
+                mClassifier(fileInfo.filePath) : GetDeployPriority(fileInfo.filePath);
+            groups[priority].push_back(fileInfo);
+        }
+    }
+    catch (const ExceptionBase& e)
+    {
+        IE_LOG(ERROR, "prepare deploy to [%s] failed, exception [%s]",
+               mTargetRoot.c_str(), e.what());
+        CloseDoneRecord();
+        return false;
+    }
+
+    mThreadPool.reset(new ThreadPool(mOption.threadNum, mOption.threadNum * 4));
+    if (!mThreadPool->Start("indexDeploy"))
+    {
+        IE_LOG(ERROR, "start deploy thread pool failed");
+        mThreadPool.reset();
+        CloseDoneRecord();
+        return false;
+    }
+
+    bool ret = DeployFiles(groups[DP_META])
+               && DeployFiles(groups[DP_SERVING])
+               && DeployFiles(deployIndexMeta.finalDeployFileMetas);
+    if (ret)
+    {
+        IE_LOG(INFO, "serving files of [%s] deployed to [%s]",
+               mSourceRoot.c_str(), mTargetRoot.c_str());
+        if (openableCallback)
+        {
+            openableCallback();
+        }
+        ret = DeployFiles(groups[DP_COLD]);
+    }
+    mThreadPool->Stop();
+    mThreadPool.reset();
+    CloseDoneRecord();
+    IE_LOG(INFO, "deploy [%s] to [%s] %s, [%lu] chunks copied",
+           mSourceRoot.c_str(), mTargetRoot.c_str(),
+           ret ? "done" : "failed", mCopiedChunkCount.load());
+    return ret;
+}
+
+bool DeployIndexExecutor::DeployFiles(const vector<FileInfo>& fileInfos)
+{
+    size_t cursor = 0;
+    bool ret = true;
+    while (ret && cursor < fileInfos.size())
+    {
+        // every opened file holds a source handle and two fds until it finishes
+        FileTaskVec tasks;
+        try
+        {
+            for (; cursor < fileInfos.size() && tasks.size() < mOption.maxOpenFileCount; ++cursor)
+            {
+                FileTaskPtr task = PrepareFile(fileInfos[cursor]);
+                if (!task)
+                {
+                    continue;
+                }
+                tasks.push_back(task);
+                if (!PushChunks(task))
+                {
+                    break;
+                }
+            }
+        }
+        catch (const ExceptionBase& e)
+        {
+            IE_LOG(ERROR, "prepare deploy files failed, exception [%s]", e.what());
+            mHasError = true;
+        }
+        ret = FinishFiles(tasks);
+    }
+    return ret;
+}
+
+bool DeployIndexExecutor::PushChunks(const FileTaskPtr& task)
+{
+    for (size_t i = 0; i < task->doneChunks.size(); ++i)
+    {
+        if (task->doneChunks[i])
+        {
+            continue;
+        }
+        autil::WorkItem* workItem = makeLambdaWorkItem(
+                [this, task, i]() { CopyChunk(task, i); });
+        ThreadPool::ERROR_TYPE ec = mThreadPool->PushWorkItem(workItem);
+        if (ec != ThreadPool::ERROR_NONE)
+        {
+            // CopyChunk never throws, so a rejected item is never dropped by the pool
+            IE_LOG(ERROR, "push chunk [%lu] of [%s] failed, error [%d]",
+                   i, task->filePath.c_str(), ec);
+            workItem->destroy();
+            mHasError = true;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool DeployIndexExecutor::FinishFiles(const FileTaskVec& tasks)
+{
+    mThreadPool->WaitFinish();
+    bool ret = !mHasError;
+    for (const FileTaskPtr& task : tasks)
+    {
+        if (ret)
+        {
+            ret = FinishFile(task);
+        }
+        CloseFileTask(task);
+    }
+    return ret;
+}
+
+DeployIndexExecutor::FileTaskPtr DeployIndexExecutor::PrepareFile(const FileInfo& fileInfo)
+{
+    string srcPath = FileSystemWrapper::JoinPath(mSourceRoot, fileInfo.filePath);
+    string dstPath = GetTargetPath(fileInfo.filePath);
+    size_t fileLength = fileInfo.fileLength >= 0 ? (size_t)fileInfo.fileLength
+                        : FileSystemWrapper::GetFileLength(srcPath);
+    if (IsDeployed(fileInfo.filePath, fileLength, fileInfo.modifyTime))
+    {
+        IE_LOG(DEBUG, "file [%s] already deployed", dstPath.c_str());
+        return FileTaskPtr();
+    }
+    FileSystemWrapper::MkDirIfNotExist(PathUtil::GetParentDirPath(dstPath));
+
+    FileTaskPtr task(new FileTask);
+    task->filePath = fileInfo.filePath;
+    task->fileLength = fileLength;
+    task->modifyTime = fileInfo.modifyTime;
+    task->doneChunks.assign(GetChunkCount(fileLength), false);
+    if (fileLength > 0)
+    {
+        task->srcFile.reset(FileSystemWrapper::OpenFile(srcPath, fslib::READ));
+    }
+
+    string tempPath = PathUtil::GetRelativePath(GetTempPath(dstPath));
+    task->dstFd = ::open(tempPath.c_str(), O_RDWR | O_CREAT, 0644);
+    if (task->dstFd < 0 || ::ftruncate(task->dstFd, fileLength) < 0)
+    {
+        int err = errno;
+        CloseFileTask(task);
+        INDEXLIB_FATAL_ERROR(FileIO, "open deploy temp file [%s] failed, %s",
+                             tempPath.c_str(), strerror(err));
+    }
+    try
+    {
+        LoadProgress(task);
+    }
+    catch (const ExceptionBase&)
+    {
+        CloseFileTask(task);
+        throw;
+    }
+
+    string progressPath = PathUtil::GetRelativePath(GetProgressPath(dstPath));
+    task->progressFd = ::open(progressPath.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+    if (task->progressFd < 0)
+    {
+        int err = errno;
+        CloseFileTask(task);
+        INDEXLIB_FATAL_ERROR(FileIO, "open deploy progress file [%s] failed, %s",
+                             progressPath.c_str(), strerror(err));
+    }
+    return task;
+}
+
+bool DeployIndexExecutor::IsDeployed(const string& filePath, size_t fileLength,
+                                     uint64_t modifyTime) const
+{
+    // a target of the same length may be a stale or foreign file,
+    // only files finished by a deploy of the same source are trusted
+    DoneRecordMap::const_iterator it = mDoneRecords.find(filePath);
+    if (it == mDoneRecords.end()
+        || it->second.first != fileLength || it->second.second != modifyTime)
+    {
+        return false;
+    }
+    string dstPath = GetTargetPath(filePath);
+    return FileSystemWrapper::IsExist(dstPath)
+        && FileSystemWrapper::GetFileLength(dstPath) == fileLength;
+}
+
+void DeployIndexExecutor::LoadProgress(const FileTaskPtr& task)
+{
+    string progressPath = GetProgressPath(GetTargetPath(task->filePath));
+    string content;
+    if (!FileSystemWrapper::Load(progressPath, content, true))
+    {
+        return;
+    }
+    vector<char> buffer;
+    size_t resumedCount = 0;
+    // a torn line of an interrupted append is dropped by the parse
+    vector<string> lines = StringUtil::split(content, "\n");
+    for (const string& line : lines)
+    {
+        vector<string> fields = StringUtil::split(line, " ");
+        size_t chunkIdx = 0;
+        uint64_t checksum = 0;
+        if (fields.size() != 2
+            || !StringUtil::fromString(fields[0], chunkIdx)
+            || !StringUtil::fromString(fields[1], checksum)
+            || chunkIdx >= task->doneChunks.size()
+            || task->doneChunks[chunkIdx])
+        {
+            continue;
+        }
+        if (mOption.verifyChecksum)
+        {
+            size_t chunkLength = GetChunkLength(task->fileLength, chunkIdx);
+            buffer.resize(chunkLength);
+            ssize_t readLen = ::pread(task->dstFd, buffer.data(), chunkLength,
+                    chunkIdx * mOption.chunkSize);
+            if (readLen != (ssize_t)chunkLength
+                || CalculateChecksum(buffer.data(), chunkLength) != checksum)
+            {
+                IE_LOG(WARN, "chunk [%lu] of [%s] checksum mismatch, will copy again",
+                       chunkIdx, task->filePath.c_str());
+                continue;
+            }
+        }
+        task->doneChunks[chunkIdx] = true;
+        ++resumedCount;
+    }
+    IE_LOG(INFO, "resume deploy file [%s], [%lu/%lu] chunks done",
+           task->filePath.c_str(), resumedCount, task->doneChunks.size());
+}
+
+void DeployIndexExecutor::CopyChunk(const FileTaskPtr& task, size_t chunkIdx)
+{
+    if (mHasError)
+    {
+        return;
+    }
+    size_t chunkLength = GetChunkLength(task->fileLength, chunkIdx);
+    off_t offset = chunkIdx * mOption.chunkSize;
+    vector<char> buffer(chunkLength);
+    try
+    {
+        size_t readLen = task->srcFile->PRead(buffer.data(), chunkLength, offset);
+        if (readLen != chunkLength)
+        {
+            INDEXLIB_FATAL_ERROR(FileIO, "read [%s] at [%ld] expect [%lu], actual [%lu]",
+                    task->srcFile->GetFileName(), offset, chunkLength, readLen);
+        }
+        size_t written = 0;
+        while (written < chunkLength)
+        {
+            ssize_t ret = ::pwrite(task->dstFd, buffer.data() + written,
+                    chunkLength - written, offset + written);
+            if (ret < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                INDEXLIB_FATAL_ERROR(FileIO, "write deploy temp file of [%s] failed, %s",
+                        task->filePath.c_str(), strerror(errno));
+            }
+            written += ret;
+        }
+        // record is trusted only after checksum verified on resume,
+        // so no sync is needed between data and record
+        string record = StringUtil::toString(chunkIdx) + " "
+                        + StringUtil::toString(CalculateChecksum(buffer.data(), chunkLength))
+                        + "\n";
+        if (::write(task->progressFd, record.data(), record.size()) != (ssize_t)record.size())
+        {
+            IE_LOG(WARN, "record progress of [%s] failed, %s",
+                   task->filePath.c_str(), strerror(errno));
+        }
+        ++mCopiedChunkCount;
+    }
+    catch (const exception& e)
+    {
+        IE_LOG(ERROR, "copy chunk [%lu] of [%s] failed, exception [%s]",
+               chunkIdx, task->filePath.c_str(), e.what());
+        mHasError = true;
+    }
+    catch (...)
+    {
+        IE_LOG(ERROR, "copy chunk [%lu] of [%s] failed, unknown exception",
+               chunkIdx, task->filePath.c_str());
+        mHasError = true;
+    }
+}
+
+bool DeployIndexExecutor::FinishFile(const FileTaskPtr& task)
+{
+    string dstPath = GetTargetPath(task->filePath);
+    try
+    {
+        if (::fdatasync(task->dstFd) < 0)
+        {
+            INDEXLIB_FATAL_ERROR(FileIO, "sync deploy temp file of [%s] failed, %s",
+                    dstPath.c_str(), strerror(errno));
+        }
+        FileSystemWrapper::DeleteIfExist(dstPath);
+        FileSystemWrapper::Rename(GetTempPath(dstPath), dstPath);
+        FileSystemWrapper::DeleteIfExist(GetProgressPath(dstPath));
+        RecordDone(task);
+    }
+    catch (const ExceptionBase& e)
+    {
+        IE_LOG(ERROR, "finish deploy file [%s] failed, exception [%s]",
+               dstPath.c_str(), e.what());
+        return false;
+    }
+    return true;
+}
+
+void DeployIndexExecutor::CloseFileTask(const FileTaskPtr& task)
+{
+    if (task->dstFd >= 0)
+    {
+        ::close(task->dstFd);
+        task->dstFd = -1;
+    }
+    if (task->progressFd >= 0)
+    {
+        ::close(task->progressFd);
+        task->progressFd = -1;
+    }
+    if (task->srcFile)
+    {
+        try
+        {
+            task->srcFile->Close();
+        }
+        catch (const ExceptionBase& e)
+        {
+            IE_LOG(WARN, "close source file [%s] failed, exception [%s]",
+                   task->filePath.c_str(), e.what());
+        }
+        task->srcFile.reset();
+    }
+}
+
+void DeployIndexExecutor::OpenDoneRecord()
+{
+    CloseDoneRecord();
+    mDoneRecords.clear();
+    string recordPath = GetTargetPath(DONE_RECORD_FILE_NAME);
+    string content;
+    size_t lineCount = 0;
+    if (FileSystemWrapper::Load(recordPath, content, true))
+    {
+        // line: path \t length \t modifyTime, later lines override earlier ones,
+        // a torn line of an interrupted append is dropped by the parse
+        vector<string> lines = StringUtil::split(content, "\n");
+        for (const string& line : lines)
+        {
+            vector<string> fields = StringUtil::split(line, "\t", false);
+            size_t fileLength = 0;
+            uint64_t modifyTime = 0;
+            if (fields.size() != 3
+                || !StringUtil::fromString(fields[1], fileLength)
+                || !StringUtil::fromString(fields[2], modifyTime))
+            {
+                continue;
+            }
+            mDoneRecords[fields[0]] = make_pair(fileLength, modifyTime);
+            ++lineCount;
+        }
+    }
+    if (lineCount > mDoneRecords.size() * 2)
+    {
+        string compacted;
+        for (const auto& record : mDoneRecords)
+        {
+            compacted += record.first + "\t" + StringUtil::toString(record.second.first)
+                         + "\t" + StringUtil::toString(record.second.second) + "\n";
+        }
+        FileSystemWrapper::AtomicStoreIgnoreExist(recordPath, compacted);
+    }
+    string localPath = PathUtil::GetRelativePath(recordPath);
+    mDoneRecordFd = ::open(localPath.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+    if (mDoneRecordFd < 0)
+    {
+        INDEXLIB_FATAL_ERROR(FileIO, "open deploy done record [%s] failed, %s",
+                             localPath.c_str(), strerror(errno));
+    }
+}
+
+void DeployIndexExecutor::RecordDone(const FileTaskPtr& task)
+{
+    // appended after the rename, a crash in between only costs a copy again
+    string record = task->filePath + "\t" + StringUtil::toString(task->fileLength)
+                    + "\t" + StringUtil::toString(task->modifyTime) + "\n";
+    if (::write(mDoneRecordFd, record.data(), record.size()) != (ssize_t)record.size())
+    {
+        INDEXLIB_FATAL_ERROR(FileIO, "record deploy done of [%s] failed, %s",
+                             task->filePath.c_str(), strerror(errno));
+    }
+    mDoneRecords[task->filePath] = make_pair(task->fileLength, task->modifyTime);
+}
+
+void DeployIndexExecutor::CloseDoneRecord()
+{
+    if (mDoneRecordFd >= 0)
+    {
+        ::close(mDoneRecordFd);
+        mDoneRecordFd = -1;
+    }
+}
+
+IE_NAMESPACE_END(index_base);
@@ -0,0 +1,150 @@
+#ifndef __INDEXLIB_DEPLOY_INDEX_EXECUTOR_H
+#define __INDEXLIB_DEPLOY_INDEX_EXECUTOR_H
+
+#include <tr1/memory>
+#include <atomic>
+#include <functional>
+#include <map>
+#include "indexlib/indexlib.h"
+#include "indexlib/common_define.h"
+#include "indexlib/index_base/index_meta/index_file_list.h"
+
+DECLARE_REFERENCE_CLASS(storage, FileWrapper);
+DECLARE_REFERENCE_CLASS(util, ThreadPool);
+
+IE_NAMESPACE_BEGIN(index_base);
+
+// copy files of a DeployIndexMeta from sourceRoot (remote) to targetRoot (local disk)
+// 1. files are split into chunks, chunks are copied by a thread pool
+// 2. finished chunks are recorded with checksum in a progress file,
+//    an interrupted deploy resumes from verified chunks
+// 3. files are deployed by priority: meta -> serving -> final(version) -> cold,
+//    openableCallback is called before cold files begin
+// 4. finished files are appended to a done record in targetRoot, a file is
+//    skipped only when it exists and its record matches length and modify time
+class DeployIndexExecutor
+{
+public:
+    enum DeployPriority
+    {
+        DP_META = 0,
+        DP_SERVING,
+        DP_COLD,
+        DP_COUNT,
+    };
+
+    struct DeployOption
+    {
+        DeployOption()
+            : threadNum(8)
+            , chunkSize(4 * 1024 * 1024)
+            , verifyChecksum(true)
+            , maxOpenFileCount(64)
+        {}
+        uint32_t threadNum;
+        size_t chunkSize;
+        // verify chunks recorded in progress file before trust them on resume
+        bool verifyChecksum;
+        // files of a priority group are opened and copied in batches of this size
+        size_t maxOpenFileCount;
+    };
+
+    typedef std::function<DeployPriority(const std::string&)> PriorityClassifier;
+    typedef std::function<void()> OpenableCallback;
+
+public:
+    DeployIndexExecutor(const std::string& sourceRoot,
+                        const std::string& targetRoot,
+                        const DeployOption& option = DeployOption());
+    ~DeployIndexExecutor();
+
+public:
+    // return false when any file fails, call again to resume
+    bool Deploy(const IndexFileList& deployIndexMeta,
+                const OpenableCallback& openableCallback = OpenableCallback());
+
+    void SetPriorityClassifier(const PriorityClassifier& classifier)
+    { mClassifier = classifier; }
+
+    size_t GetCopiedChunkCount() const { return mCopiedChunkCount.load(); }
+
+public:
+    // relative path in partition, eg: segment_0_level_0/index/pk/data
+    static DeployPriority GetDeployPriority(const std::string& filePath);
+
+private:
+    struct FileTask
+    {
+        FileTask()
+            : fileLength(0)
+            , modifyTime(0)
+            , dstFd(-1)
+            , progressFd(-1)
+        {}
+        std::string filePath;
+        size_t fileLength;
+        uint64_t modifyTime;
+        storage::FileWrapperPtr srcFile;
+        int dstFd;
+        int progressFd;
+        std::vector<bool> doneChunks;
+    };
+    DEFINE_SHARED_PTR(FileTask);
+    typedef std::vector<FileTaskPtr> FileTaskVec;
+
+private:
+    bool DeployFiles(const std::vector<FileInfo>& fileInfos);
+    bool PushChunks(const FileTaskPtr& task);
+    bool FinishFiles(const FileTaskVec& tasks);
+    FileTaskPtr PrepareFile(const FileInfo& fileInfo);
+    bool IsDeployed(const std::string& filePath, size_t fileLength,
+                    uint64_t modifyTime) const;
+    void LoadProgress(const FileTaskPtr& task);
+    void CopyChunk(const FileTaskPtr& task, size_t chunkIdx);
+    bool FinishFile(const FileTaskPtr& task);
+    void CloseFileTask(const FileTaskPtr& task);
+    void OpenDoneRecord();
+    void RecordDone(const FileTaskPtr& task);
+    void CloseDoneRecord();
+
+    size_t GetChunkCount(size_t fileLength) const
+    { return (fileLength + mOption.chunkSize - 1) / mOption.chunkSize; }
+    size_t GetChunkLength(size_t fileLength, size_t chunkIdx) const
+    { return std::min(mOption.chunkSize, fileLength - chunkIdx * mOption.chunkSize); }
+
+    std::string GetTargetPath(const std::string& filePath) const;
+    static std::string GetTempPath(const std::string& targetPath)
+    { return targetPath + TEMP_FILE_SUFFIX; }
+    static std::string GetProgressPath(const std::string& targetPath)
+    { return targetPath + PROGRESS_FILE_SUFFIX; }
+    static uint64_t CalculateChecksum(const char* data, size_t length);
+
+private:
+    static const std::string TEMP_FILE_SUFFIX;
+    static const std::string PROGRESS_FILE_SUFFIX;
+    static const std::string DONE_RECORD_FILE_NAME;
+
+private:
+    typedef std::map<std::string, std::pair<size_t, uint64_t> > DoneRecordMap;
+
+private:
+    std::string mSourceRoot;
+    std::string mTargetRoot;
+    DeployOption mOption;
+    PriorityClassifier mClassifier;
+    DoneRecordMap mDoneRecords;
+    int mDoneRecordFd;
+    util::ThreadPoolPtr mThreadPool;
+    std::atomic<bool> mHasError;
+    std::atomic<size_t> mCopiedChunkCount;
+
+private:
+    friend class DeployIndexExecutorTest;
+    IE_LOG_DECLARE();
+};
+
+DEFINE_SHARED_PTR(DeployIndexExecutor);
+
+IE_NAMESPACE_END(index_base);
+
+#endif //__INDEXLIB_DEPLOY_INDEX_EXECUTOR_H
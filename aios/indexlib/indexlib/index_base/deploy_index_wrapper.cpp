@@ -723,6 +723,28 @@ bool DeployIndexWrapper::GetDeployIndexMeta(IndexFileList& deployIndexMeta,
     }
 }
 
+bool DeployIndexWrapper::DeployIndex(const versionid_t newVersion,
+        const versionid_t lastVersion,
+        const DeployIndexExecutor::OpenableCallback& openableCallback,
+        const DeployIndexExecutor::DeployOption& deployOption)
+{
+    if (mLastPath.empty())
+    {
+        IE_LOG(ERROR, "deploy version [%d] from [%s] failed, local path is empty",
+               newVersion, mNewPath.c_str());
+        return false;
+    }
+    IndexFileList deployIndexMeta;
+    if (!GetDeployIndexMeta(deployIndexMeta, newVersion, lastVersion))
+    {
+        IE_LOG(ERROR, "get deploy index meta of version [%d] from [%s] failed",
+               newVersion, mNewPath.c_str());
+        return false;
+    }
+    DeployIndexExecutor executor(mNewPath, mLastPath, deployOption);
+    return executor.Deploy(deployIndexMeta, openableCallback);
+}
+
 bool DeployIndexWrapper::DoGetDeployIndexMeta(IndexFileList& deployIndexMeta,
         const versionid_t newVersionId, const versionid_t lastVersionId, bool needComplete)
 {
@@ -8,6 +8,7 @@
 #include "indexlib/config/online_config.h"
 #include "indexlib/index_base/index_meta/segment_file_list_wrapper.h"
 #include "indexlib/index_base/index_meta/index_file_list.h"
+#include "indexlib/index_base/deploy_index_executor.h"
 
 DECLARE_REFERENCE_CLASS(file_system, Directory);
 DECLARE_REFERENCE_CLASS(file_system, LoadConfig);
@@ -50,6 +51,16 @@ public:
                             const versionid_t lastVersion = INVALID_VERSION,
                             bool needComplete = true);
 
+    // copy files of newVersion which are not in lastVersion from newPath to lastPath,
+    // openableCallback is called when the partition can be opened with newPath as
+    // secondary path, before cold files (eg. summary) are deployed
+    bool DeployIndex(const versionid_t newVersion,
+                     const versionid_t lastVersion = INVALID_VERSION,
+                     const DeployIndexExecutor::OpenableCallback& openableCallback =
+                     DeployIndexExecutor::OpenableCallback(),
+                     const DeployIndexExecutor::DeployOption& deployOption =
+                     DeployIndexExecutor::DeployOption());
+
     static bool GetDeployIndexMeta(
         DeployIndexMeta& remoteDeployIndexMeta,  // files will read from remote, for now maybe dcache or mpangu
         DeployIndexMeta& localDeployIndexMeta,   // files will read from local
@@ -0,0 +1,278 @@
+#include <autil/StringUtil.h>
+#include "indexlib/common_define.h"
+#include "indexlib/test/unittest.h"
+#include "indexlib/index_base/deploy_index_executor.h"
+#include "indexlib/index_define.h"
+#include "indexlib/storage/file_system_wrapper.h"
+
+using namespace std;
+using namespace autil;
+
+IE_NAMESPACE_USE(storage);
+
+IE_NAMESPACE_BEGIN(index_base);
+class DeployIndexExecutorTest : public INDEXLIB_TESTBASE
+{
+public:
+    DECLARE_CLASS_NAME(DeployIndexExecutorTest);
+
+public:
+    void CaseSetUp() override
+    {
+        mSrcDir = FileSystemWrapper::JoinPath(GET_TEST_DATA_PATH(), "remote");
+        mDstDir = FileSystemWrapper::JoinPath(GET_TEST_DATA_PATH(), "local");
+        mOption.threadNum = 4;
+        mOption.chunkSize = 16;
+    }
+
+    void CaseTearDown() override
+    {
+    }
+
+    string MakeContent(size_t length, char seed)
+    {
+        string content;
+        for (size_t i = 0; i < length; ++i)
+        {
+            content.push_back((char)(seed + i % 26));
+        }
+        return content;
+    }
+
+    // filePaths : file1:length1;file2:length2, dir ends with '/'
+    IndexFileList PrepareSource(const string& filePaths)
+    {
+        IndexFileList meta;
+        vector<string> items = StringUtil::split(filePaths, ";");
+        for (size_t i = 0; i < items.size(); ++i)
+        {
+            vector<string> fields = StringUtil::split(items[i], ":");
+            string path = FileSystemWrapper::JoinPath(mSrcDir, fields[0]);
+            if (fields.size() == 1)
+            {
+                FileSystemWrapper::MkDirIfNotExist(path);
+                meta.Append(FileInfo(fields[0]));
+                continue;
+            }
+            size_t length = StringUtil::fromString<size_t>(fields[1]);
+            FileSystemWrapper::AtomicStore(path, MakeContent(length, 'a' + i));
+            if (fields[0].find(VERSION_FILE_NAME_PREFIX) == 0)
+            {
+                meta.AppendFinal(FileInfo(fields[0], length));
+            }
+            else
+            {
+                meta.Append(FileInfo(fields[0], length));
+            }
+        }
+        return meta;
+    }
+
+    void CheckDeployed(const IndexFileList& meta)
+    {
+        vector<FileInfo> fileInfos = meta.deployFileMetas;
+        fileInfos.insert(fileInfos.end(), meta.finalDeployFileMetas.begin(),
+                         meta.finalDeployFileMetas.end());
+        for (const FileInfo& fileInfo : fileInfos)
+        {
+            string dstPath = FileSystemWrapper::JoinPath(mDstDir, fileInfo.filePath);
+            ASSERT_TRUE(FileSystemWrapper::IsExist(dstPath)) << dstPath;
+            if (fileInfo.isDirectory())
+            {
+                continue;
+            }
+            string expect, actual;
+            FileSystemWrapper::AtomicLoad(
+                    FileSystemWrapper::JoinPath(mSrcDir, fileInfo.filePath), expect);
+            FileSystemWrapper::AtomicLoad(dstPath, actual);
+            ASSERT_EQ(expect, actual) << dstPath;
+            ASSERT_FALSE(FileSystemWrapper::IsExist(
+                            DeployIndexExecutor::GetTempPath(dstPath)));
+            ASSERT_FALSE(FileSystemWrapper::IsExist(
+                            DeployIndexExecutor::GetProgressPath(dstPath)));
+        }
+    }
+
+    void TestGetDeployPriority()
+    {
+        ASSERT_EQ(DeployIndexExecutor::DP_META,
+                  DeployIndexExecutor::GetDeployPriority("version.1"));
+        ASSERT_EQ(DeployIndexExecutor::DP_META,
+                  DeployIndexExecutor::GetDeployPriority("schema.json"));
+        ASSERT_EQ(DeployIndexExecutor::DP_META,
+                  DeployIndexExecutor::GetDeployPriority("segment_1_level_0/segment_info"));
+        ASSERT_EQ(DeployIndexExecutor::DP_META,
+                  DeployIndexExecutor::GetDeployPriority(
+                          "segment_1_level_0/sub_segment/segment_info"));
+        ASSERT_EQ(DeployIndexExecutor::DP_SERVING,
+                  DeployIndexExecutor::GetDeployPriority(
+                          "segment_1_level_0/deletionmap/data_0"));
+        ASSERT_EQ(DeployIndexExecutor::DP_SERVING,
+                  DeployIndexExecutor::GetDeployPriority(
+                          "segment_1_level_0/index/pk/data"));
+        ASSERT_EQ(DeployIndexExecutor::DP_SERVING,
+                  DeployIndexExecutor::GetDeployPriority(
+                          "segment_1_level_0/sub_segment/attribute/price/data"));
+        ASSERT_EQ(DeployIndexExecutor::DP_COLD,
+                  DeployIndexExecutor::GetDeployPriority(
+                          "segment_1_level_0/summary/data"));
+        ASSERT_EQ(DeployIndexExecutor::DP_COLD,
+                  DeployIndexExecutor::GetDeployPriority("truncate_meta/index.meta"));
+    }
+
+    void TestSimpleProcess()
+    {
+        IndexFileList meta = PrepareSource(
+                "segment_0_level_0/;segment_0_level_0/index/;"
+                "segment_0_level_0/segment_info:10;"
+                "segment_0_level_0/index/posting:100;"
+                "segment_0_level_0/summary/data:33;"
+                "segment_0_level_0/attribute/empty:0;"
+                "version.0:7");
+        DeployIndexExecutor executor(mSrcDir, mDstDir, mOption);
+        ASSERT_TRUE(executor.Deploy(meta));
+        CheckDeployed(meta);
+        // 1 + 7 + 3 + 1
+        ASSERT_EQ(12u, executor.GetCopiedChunkCount());
+
+        // deployed files are skipped
+        DeployIndexExecutor executor2(mSrcDir, mDstDir, mOption);
+        ASSERT_TRUE(executor2.Deploy(meta));
+        ASSERT_EQ(0u, executor2.GetCopiedChunkCount());
+    }
+
+    void TestSkipOnlyRecordedFiles()
+    {
+        IndexFileList meta = PrepareSource(
+                "segment_0_level_0/index/posting:100;"
+                "segment_0_level_0/attribute/price/data:50");
+        string postingPath = FileSystemWrapper::JoinPath(
+                mDstDir, "segment_0_level_0/index/posting");
+        string pricePath = FileSystemWrapper::JoinPath(
+                mDstDir, "segment_0_level_0/attribute/price/data");
+        // a stale target of the same length is not trusted
+        FileSystemWrapper::AtomicStore(postingPath, string(100, '#'));
+        DeployIndexExecutor executor(mSrcDir, mDstDir, mOption);
+        ASSERT_TRUE(executor.Deploy(meta));
+        CheckDeployed(meta);
+        ASSERT_EQ(11u, executor.GetCopiedChunkCount());
+
+        // lost target or changed source is copied again
+        FileSystemWrapper::DeleteFile(postingPath);
+        meta.deployFileMetas[1].modifyTime = 12345;
+        DeployIndexExecutor executor2(mSrcDir, mDstDir, mOption);
+        ASSERT_TRUE(executor2.Deploy(meta));
+        CheckDeployed(meta);
+        ASSERT_EQ(11u, executor2.GetCopiedChunkCount());
+
+        // lost record
+        FileSystemWrapper::DeleteFile(FileSystemWrapper::JoinPath(
+                        mDstDir, DeployIndexExecutor::DONE_RECORD_FILE_NAME));
+        FileSystemWrapper::AtomicStoreIgnoreExist(pricePath, string(50, '#'));
+        DeployIndexExecutor executor3(mSrcDir, mDstDir, mOption);
+        ASSERT_TRUE(executor3.Deploy(meta));
+        CheckDeployed(meta);
+        ASSERT_EQ(11u, executor3.GetCopiedChunkCount());
+    }
+
+    void TestMaxOpenFileCount()
+    {
+        string filePaths;
+        for (size_t i = 0; i < 7; ++i)
+        {
+            filePaths += "segment_0_level_0/attribute/attr" + StringUtil::toString(i)
+                         + "/data:" + StringUtil::toString(10 + i * 10) + ";";
+        }
+        IndexFileList meta = PrepareSource(filePaths + "version.0:7");
+        mOption.maxOpenFileCount = 2;
+        DeployIndexExecutor executor(mSrcDir, mDstDir, mOption);
+        ASSERT_TRUE(executor.Deploy(meta));
+        CheckDeployed(meta);
+        // 1 + 2 + 2 + 3 + 4 + 4 + 5 + 1
+        ASSERT_EQ(22u, executor.GetCopiedChunkCount());
+    }
+
+    void TestOpenableBeforeColdFiles()
+    {
+        IndexFileList meta = PrepareSource(
+                "segment_0_level_0/summary/data:100;"
+                "segment_0_level_0/deletionmap/data_0:20;"
+                "segment_0_level_0/attribute/price/data:50;"
+                "segment_0_level_0/segment_info:10;"
+                "version.0:7");
+        bool called = false;
+        auto callback = [this, &called]() {
+            called = true;
+            auto exist = [this](const string& path) {
+                return FileSystemWrapper::IsExist(FileSystemWrapper::JoinPath(mDstDir, path));
+            };
+            EXPECT_TRUE(exist("version.0"));
+            EXPECT_TRUE(exist("segment_0_level_0/segment_info"));
+            EXPECT_TRUE(exist("segment_0_level_0/deletionmap/data_0"));
+            EXPECT_TRUE(exist("segment_0_level_0/attribute/price/data"));
+            EXPECT_FALSE(exist("segment_0_level_0/summary/data"));
+        };
+        DeployIndexExecutor executor(mSrcDir, mDstDir, mOption);
+        ASSERT_TRUE(executor.Deploy(meta, callback));
+        ASSERT_TRUE(called);
+        CheckDeployed(meta);
+    }
+
+    void TestResume()
+    {
+        IndexFileList meta = PrepareSource("segment_0_level_0/index/posting:100");
+        string content = MakeContent(100, 'a');
+        string dstPath = FileSystemWrapper::JoinPath(mDstDir, "segment_0_level_0/index/posting");
+        FileSystemWrapper::MkDirIfNotExist(FileSystemWrapper::JoinPath(
+                        mDstDir, "segment_0_level_0/index"));
+
+        // chunk 0, 1, 2 copied before restart, chunk 2 is corrupted,
+        // chunk 3 has a torn record
+        string temp = content.substr(0, 48);
+        temp[40] = '#';
+        FileSystemWrapper::AtomicStore(DeployIndexExecutor::GetTempPath(dstPath), temp);
+        string progress;
+        for (size_t i = 0; i < 3; ++i)
+        {
+            uint64_t checksum = DeployIndexExecutor::CalculateChecksum(
+                    content.data() + i * 16, 16);
+            progress += StringUtil::toString(i) + " " + StringUtil::toString(checksum) + "\n";
+        }
+        progress += "3 12";
+        FileSystemWrapper::AtomicStore(DeployIndexExecutor::GetProgressPath(dstPath), progress);
+
+        DeployIndexExecutor executor(mSrcDir, mDstDir, mOption);
+        ASSERT_TRUE(executor.Deploy(meta));
+        CheckDeployed(meta);
+        // chunk 2 ~ 6
+        ASSERT_EQ(5u, executor.GetCopiedChunkCount());
+    }
+
+    void TestDeployFailed()
+    {
+        IndexFileList meta = PrepareSource("segment_0_level_0/index/posting:100");
+        meta.Append(FileInfo("segment_0_level_0/index/not_exist", 10));
+        DeployIndexExecutor executor(mSrcDir, mDstDir, mOption);
+        ASSERT_FALSE(executor.Deploy(meta));
+    }
+
+private:
+    string mSrcDir;
+    string mDstDir;
+    DeployIndexExecutor::DeployOption mOption;
+
+private:
+    IE_LOG_DECLARE();
+};
+
+IE_LOG_SETUP(index_base, DeployIndexExecutorTest);
+
+INDEXLIB_UNIT_TEST_CASE(DeployIndexExecutorTest, TestGetDeployPriority);
+INDEXLIB_UNIT_TEST_CASE(DeployIndexExecutorTest, TestSimpleProcess);
+INDEXLIB_UNIT_TEST_CASE(DeployIndexExecutorTest, TestSkipOnlyRecordedFiles);
+INDEXLIB_UNIT_TEST_CASE(DeployIndexExecutorTest, TestMaxOpenFileCount);
+INDEXLIB_UNIT_TEST_CASE(DeployIndexExecutorTest, TestOpenableBeforeColdFiles);
+INDEXLIB_UNIT_TEST_CASE(DeployIndexExecutorTest, TestResume);
+INDEXLIB_UNIT_TEST_CASE(DeployIndexExecutorTest, TestDeployFailed);
+
+IE_NAMESPACE_END(index_base);
@@ -45,6 +45,7 @@ static const std::string SCHEMA_FILE_NAME = "schema.json";
 #define POSTING_FILE_NAME "posting"
 #define BITMAP_DICTIONARY_FILE_NAME "bitmap_dictionary"
 #define BITMAP_POSTING_FILE_NAME "bitmap_posting"
+#define ORDERED_TERM_DICTIONARY_FILE_NAME "ordered_term_dictionary"
 #define INDEX_FORMAT_OPTION_FILE_NAME "index_format_option"
 #define SEGMETN_METRICS_FILE_NAME "segment_metrics"
 #define SEGMENT_CUSTOMIZE_METRICS_GROUP "customize"
@@ -477,6 +477,7 @@ const size_t HASHMAP_INIT_SIZE = 1024;
 #define MAIN_DOCID_TO_SUB_DOCID_ATTR_NAME "main_docid_to_sub_docid_attr_name"
 #define SUB_DOCID_TO_MAIN_DOCID_ATTR_NAME "sub_docid_to_main_docid_attr_name"
 #define INDEXLIB_REPORT_METRICS_INTERVAL (1 * 1000 * 1000); // 1s
+#define INDEXLIB_SAMPLE_ACCESS_PROFILE_INTERVAL (60 * 1000 * 1000) // 60s
 
 #define INDEXLIB_BUILD_INFO_COLLECTOR_NAME "index_build_info"
 
@@ -491,7 +492,7 @@ static inline void __FOR_UNUSED_VAR_FUNC__()
     (void)MAX_FREE_MEMORY;
 }
 
-static constexpr uint32_t  DOCUMENT_BINARY_VERSION = 7;
+static constexpr uint32_t  DOCUMENT_BINARY_VERSION = 8;
 
 namespace heavenask { namespace indexlib {
 enum TableType
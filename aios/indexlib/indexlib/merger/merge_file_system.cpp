@@ -48,6 +48,7 @@ MergeFileSystem::MergeFileSystem(const string& rootPath, const MergeConfig& merg
     mFileSystemOptions.enablePathMetaContainer = true;
     mFileSystemOptions.isOffline = true;
     mFileSystemOptions.enableAsyncFlush = mergeConfig.mergeIOConfig.enableAsyncWrite;
+    mFileSystemOptions.useDirectIOWrite = mergeConfig.mergeIOConfig.enableDirectWrite;
     mFileSystemOptions.useCache = false;
     mFileSystemOptions.raidConfig = raidConfig;
     // TODO: quota controller need a quota.
@@ -26,6 +26,7 @@ GroupMemoryReporter::GroupMemoryReporter(
     INIT_MEM_STAT_METRIC(groupName, totalBuildingSegmentMemoryUse, "byte");
     INIT_MEM_STAT_METRIC(groupName, totalOldInMemorySegmentMemoryUse, "byte");
     INIT_MEM_STAT_METRIC(groupName, totalPartitionMemoryQuotaUse, "byte");
+    INIT_MEM_STAT_METRIC(groupName, totalOldReaderDuplicatedMemoryUse, "byte");
 
 #undef INIT_MEM_STAT_METRIC
 }
@@ -44,6 +45,7 @@ void GroupMemoryReporter::Reset()
     mtotalBuildingSegmentMemoryUse = 0;
     mtotalOldInMemorySegmentMemoryUse = 0;
     mtotalPartitionMemoryQuotaUse = 0;
+    mtotalOldReaderDuplicatedMemoryUse = 0;
 }
 
 void GroupMemoryReporter::ReportMetrics()
@@ -56,6 +58,7 @@ void GroupMemoryReporter::ReportMetrics()
     IE_REPORT_METRIC(totalBuildingSegmentMemoryUse, mtotalBuildingSegmentMemoryUse);
     IE_REPORT_METRIC(totalOldInMemorySegmentMemoryUse, mtotalOldInMemorySegmentMemoryUse);
     IE_REPORT_METRIC(totalPartitionMemoryQuotaUse, mtotalPartitionMemoryQuotaUse);
+    IE_REPORT_METRIC(totalOldReaderDuplicatedMemoryUse, mtotalOldReaderDuplicatedMemoryUse);
 }
 
 IE_NAMESPACE_END(partition);
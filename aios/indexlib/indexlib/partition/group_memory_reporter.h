@@ -31,6 +31,7 @@ private:
     IE_DECLARE_PARAM_METRIC(int64_t, totalBuildingSegmentMemoryUse);
     IE_DECLARE_PARAM_METRIC(int64_t, totalOldInMemorySegmentMemoryUse);
     IE_DECLARE_PARAM_METRIC(int64_t, totalPartitionMemoryQuotaUse);
+    IE_DECLARE_PARAM_METRIC(int64_t, totalOldReaderDuplicatedMemoryUse);
 
 private:
     IE_LOG_DECLARE();
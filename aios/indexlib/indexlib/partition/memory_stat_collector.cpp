@@ -72,11 +72,13 @@ void MemoryStatCollector::PrintMetrics()
            "global searchCacheMemoryUse [%ld], global blockCacheMemoryUse [%ld], "
            "partitionIndexSize [%ld], partitionMemoryUse [%ld], incIndexMemoryUse [%ld], "
            "rtIndexMemoryUse [%ld], builtRtIndexMemoryUse [%ld], buildingSegmentMemoryUse [%ld], "
-           "oldInMemorySegmentMemoryUse [%ld], partitionMemoryQuotaUse [%ld]",
+           "oldInMemorySegmentMemoryUse [%ld], partitionMemoryQuotaUse [%ld], "
+           "oldReaderDuplicatedMemoryUse [%ld]",
            mMetricsVec.size(), searchCacheMemoryUse, blockCacheMemoryUse,
            mtotalPartitionIndexSize, mtotalPartitionMemoryUse, mtotalIncIndexMemoryUse,
            mtotalRtIndexMemoryUse, mtotalBuiltRtIndexMemoryUse,
-           mtotalBuildingSegmentMemoryUse, mtotalOldInMemorySegmentMemoryUse, mtotalPartitionMemoryQuotaUse);
+           mtotalBuildingSegmentMemoryUse, mtotalOldInMemorySegmentMemoryUse, mtotalPartitionMemoryQuotaUse,
+           mtotalOldReaderDuplicatedMemoryUse);
 
     cerr << "searchCacheMemoryUse: " << searchCacheMemoryUse << endl
          << "blockCacheMemoryUse: " << blockCacheMemoryUse << endl
@@ -87,7 +89,8 @@ void MemoryStatCollector::PrintMetrics()
          << "builtRtIndexMemoryUse: " << mtotalBuiltRtIndexMemoryUse << endl
          << "buildingSegmentMemoryUse: " << mtotalBuildingSegmentMemoryUse << endl
          << "oldInMemorySegmentMemoryUse: " << mtotalOldInMemorySegmentMemoryUse << endl
-         << "partitionMemoryQuotaUse: " << mtotalPartitionMemoryQuotaUse << endl;
+         << "partitionMemoryQuotaUse: " << mtotalPartitionMemoryQuotaUse << endl
+         << "oldReaderDuplicatedMemoryUse: " << mtotalOldReaderDuplicatedMemoryUse << endl;
 }
 
 void MemoryStatCollector::ReportMetrics()
@@ -107,6 +110,7 @@ void MemoryStatCollector::ReportMetrics()
     IE_REPORT_METRIC(totalBuildingSegmentMemoryUse, mtotalBuildingSegmentMemoryUse);
     IE_REPORT_METRIC(totalOldInMemorySegmentMemoryUse, mtotalOldInMemorySegmentMemoryUse);
     IE_REPORT_METRIC(totalPartitionMemoryQuotaUse, mtotalPartitionMemoryQuotaUse);
+    IE_REPORT_METRIC(totalOldReaderDuplicatedMemoryUse, mtotalOldReaderDuplicatedMemoryUse);
 
     ScopedLock lock(mLock);
     GroupReporterMap::const_iterator iter = mGroupReporterMap.begin();
@@ -131,6 +135,7 @@ void MemoryStatCollector::InnerUpdateMetrics()
     mtotalBuildingSegmentMemoryUse = 0;
     mtotalOldInMemorySegmentMemoryUse = 0;
     mtotalPartitionMemoryQuotaUse = 0;
+    mtotalOldReaderDuplicatedMemoryUse = 0;
 
     GroupReporterMap::const_iterator iter = mGroupReporterMap.begin();
     for (; iter != mGroupReporterMap.end(); iter++)
@@ -156,6 +161,7 @@ void MemoryStatCollector::InnerUpdateMetrics()
         mtotalBuildingSegmentMemoryUse += partMetrics->mbuildingSegmentMemoryUse;
         mtotalOldInMemorySegmentMemoryUse += partMetrics->moldInMemorySegmentMemoryUse;
         mtotalPartitionMemoryQuotaUse += partMetrics->mpartitionMemoryQuotaUse;
+        mtotalOldReaderDuplicatedMemoryUse += partMetrics->moldReaderDuplicatedMemoryUse;
 
         UpdateGroupMetrics(mMetricsVec[i].first, partMetrics);
     }
@@ -195,6 +201,8 @@ void MemoryStatCollector::UpdateGroupMetrics(const string& groupName,
                 partMetrics->moldInMemorySegmentMemoryUse);
         groupReporter->IncreasetotalPartitionMemoryQuotaUseValue(
                 partMetrics->mpartitionMemoryQuotaUse);
+        groupReporter->IncreasetotalOldReaderDuplicatedMemoryUseValue(
+                partMetrics->moldReaderDuplicatedMemoryUse);
     }
 }
 
@@ -217,6 +225,7 @@ void MemoryStatCollector::InnerInitMetrics()
     INIT_MEM_STAT_METRIC(totalBuildingSegmentMemoryUse, "byte");
     INIT_MEM_STAT_METRIC(totalOldInMemorySegmentMemoryUse, "byte");
     INIT_MEM_STAT_METRIC(totalPartitionMemoryQuotaUse, "byte");
+    INIT_MEM_STAT_METRIC(totalOldReaderDuplicatedMemoryUse, "byte");
 #undef INIT_MEM_STAT_METRIC
 
     mMetricsInitialized = true;
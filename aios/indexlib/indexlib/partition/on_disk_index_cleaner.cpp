@@ -1,5 +1,6 @@
 #include "indexlib/partition/on_disk_index_cleaner.h"
 #include "indexlib/file_system/directory.h"
+#include "indexlib/file_system/access_profile.h"
 #include "indexlib/partition/reader_container.h"
 #include "indexlib/index_base/patch/partition_patch_index_accessor.h"
 #include "indexlib/index_base/index_meta/version.h"
@@ -129,6 +130,9 @@ void OnDiskIndexCleaner::CleanVersionFiles(size_t firstKeepVersionIdx,
 
         string patchMetaFile = PartitionPatchMeta::GetPatchMetaFileName(versionId);
         mDirectory->RemoveFile(patchMetaFile, true);
+
+        string accessProfileFile = AccessProfile::GetProfileFileName(versionId);
+        mDirectory->RemoveFile(accessProfileFile, true);
         mDirectory->RemoveFile(fileList[i]);
         IE_LOG(INFO, "Version: [%s/%s] removed",
                mDirectory->GetPath().c_str(), fileList[i].c_str());
@@ -45,6 +45,7 @@
 #include "indexlib/index_base/segment/realtime_segment_directory.h"
 #include "indexlib/common/index_locator.h"
 #include "indexlib/common/executor_scheduler.h"
+#include "indexlib/common/file_system_factory.h"
 #include "indexlib/common/numeric_compress/encoder_provider.h"
 #include "indexlib/config/index_partition_options.h"
 #include "indexlib/config/index_partition_schema.h"
@@ -64,6 +65,7 @@
 #include "indexlib/plugin/index_plugin_loader.h"
 #include "indexlib/plugin/plugin_manager.h"
 #include "indexlib/file_system/indexlib_file_system.h"
+#include "indexlib/file_system/access_profile.h"
 
 using namespace std;
 using namespace autil;
@@ -100,6 +102,7 @@ OnlinePartition::OnlinePartition(
     , mCheckSecondIndexIntervalInMin(partitionResource.checkSecondIndexIntervalInMin)
     , mSubscribeIndexTaskId(TaskScheduler::INVALID_TASK_ID)
     , mSubscribeSecondIndexIntervalInMin(partitionResource.subscribeSecondIndexIntervalInMin)
+    , mSampleAccessProfileTaskId(TaskScheduler::INVALID_TASK_ID)
     , mMissingSegmentCount(0)
     , mFutureExecutor(nullptr)
 {
@@ -134,6 +137,7 @@ OnlinePartition::OnlinePartition(const string& partitionName,
     , mCheckSecondIndexIntervalInMin(-1)
     , mSubscribeIndexTaskId(TaskScheduler::INVALID_TASK_ID)
     , mSubscribeSecondIndexIntervalInMin(-1)
+    , mSampleAccessProfileTaskId(TaskScheduler::INVALID_TASK_ID)
     , mMissingSegmentCount(0)
     , mFutureExecutor(nullptr)
 {
@@ -158,6 +162,7 @@ OnlinePartition::OnlinePartition()
     , mCheckSecondIndexIntervalInMin(-1)
     , mSubscribeIndexTaskId(TaskScheduler::INVALID_TASK_ID)
     , mSubscribeSecondIndexIntervalInMin(-1)
+    , mSampleAccessProfileTaskId(TaskScheduler::INVALID_TASK_ID)
     , mMissingSegmentCount(0)
     , mFutureExecutor(nullptr)
 {
@@ -277,6 +282,7 @@ IndexPartition::OpenStatus OnlinePartition::DoOpen(
     Version onDiskVersion;
     VersionLoader::GetVersion(GetFileSystemRootDirectory(), onDiskVersion, targetVersionId);
     InitPathMetaCache(GetFileSystemRootDirectory(), onDiskVersion);
+    LoadAccessProfile(onDiskVersion);
 
     ScopedLock lock(mDataLock);
 
@@ -396,17 +402,93 @@ IndexPartition::OpenStatus OnlinePartition::DoOpen(
 IndexlibFileSystemPtr OnlinePartition::CreateFileSystem(
         const string& primaryDir, const string& secondaryDir)
 {
+    // filled by LoadAccessProfile once the version to open is known,
+    // no index file is opened before that
+    mAccessProfile.reset();
+    if (NeedAccessProfile())
+    {
+        mAccessProfile.reset(new AccessProfile);
+    }
     if (mOptions.TEST_mReadOnly)
     {
-        return IndexPartition::CreateFileSystem(primaryDir, secondaryDir);
+        return FileSystemFactory::Create(primaryDir, secondaryDir, mOptions, mMetricProvider,
+                mPartitionMemController, mFileBlockCache, mAccessProfile);
     }
 
     IndexlibFileSystem::DeleteRootLinks(primaryDir);
-    auto fileSystem = IndexPartition::CreateFileSystem(primaryDir, secondaryDir);
+    auto fileSystem = FileSystemFactory::Create(primaryDir, secondaryDir, mOptions,
+            mMetricProvider, mPartitionMemController, mFileBlockCache, mAccessProfile);
     ResetRtAndJoinDirPath(fileSystem);
     return fileSystem;
 }
 
+bool OnlinePartition::NeedAccessProfile() const
+{
+    const LoadConfigList& loadConfigList = mOptions.GetOnlineConfig().loadConfigList;
+    for (size_t i = 0; i < loadConfigList.Size(); ++i)
+    {
+        if (loadConfigList.GetLoadConfig(i).GetWarmupStrategy().GetWarmupType()
+            == WarmupStrategy::WARMUP_PROFILE)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void OnlinePartition::LoadAccessProfile(const Version& version)
+{
+    if (!mAccessProfile)
+    {
+        return;
+    }
+    // the profile stored with the version, or else with the latest one before it
+    fslib::FileList fileList;
+    FileSystemWrapper::ListDir(mOpenIndexPrimaryDir, fileList, true);
+    versionid_t profileVersionId = INVALID_VERSION;
+    for (size_t i = 0; i < fileList.size(); ++i)
+    {
+        versionid_t versionId = INVALID_VERSION;
+        if (!AccessProfile::ExtractVersionId(fileList[i], versionId))
+        {
+            continue;
+        }
+        if (versionId <= version.GetVersionId() && versionId > profileVersionId)
+        {
+            profileVersionId = versionId;
+        }
+    }
+    if (profileVersionId == INVALID_VERSION)
+    {
+        IE_PREFIX_LOG(INFO, "no access profile for version[%d]", version.GetVersionId());
+        return;
+    }
+    mAccessProfile->Load(PathUtil::JoinPath(mOpenIndexPrimaryDir,
+                    AccessProfile::GetProfileFileName(profileVersionId)));
+}
+
+void OnlinePartition::SampleAccessProfile()
+{
+    ScopedLock lock(mDataLock);
+    DoSampleAccessProfile();
+}
+
+void OnlinePartition::DoSampleAccessProfile()
+{
+    if (!mAccessProfile || mClosed)
+    {
+        return;
+    }
+    mFileSystem->SampleAccessProfile();
+    versionid_t versionId = mLoadedIncVersion.GetVersionId();
+    if (versionId == INVALID_VERSION || mOptions.TEST_mReadOnly)
+    {
+        return;
+    }
+    mAccessProfile->Store(PathUtil::JoinPath(mOpenIndexPrimaryDir,
+                    AccessProfile::GetProfileFileName(versionId)));
+}
+
 void OnlinePartition::InitPathMetaCache(const DirectoryPtr& deployMetaDir,
                                         const Version& version)
 {
@@ -606,6 +688,29 @@ bool OnlinePartition::PrepareIntervalTask()
             return false;
         }
     }
+
+    if (mAccessProfile)
+    {
+        int32_t sampleTime = INDEXLIB_SAMPLE_ACCESS_PROFILE_INTERVAL;
+        if (unlikely(mOptions.TEST_mQuickExit))
+        {
+            sampleTime /= 1000;
+        }
+        TaskItemPtr sampleAccessProfileTask(new OnlinePartitionTaskItem(
+                this, OnlinePartitionTaskItem::TT_SAMPLE_ACCESS_PROFILE));
+        if (!mTaskScheduler->DeclareTaskGroup("sample_access_profile", sampleTime))
+        {
+            IE_PREFIX_LOG(ERROR, "declare sample_access_profile task failed!");
+            return false;
+        }
+        mSampleAccessProfileTaskId = mTaskScheduler->AddTask(
+                "sample_access_profile", sampleAccessProfileTask);
+        if (mSampleAccessProfileTaskId == TaskScheduler::INVALID_TASK_ID)
+        {
+            IE_PREFIX_LOG(ERROR, "add sample_access_profile task failed!");
+            return false;
+        }
+    }
     return true;
 }
 
@@ -819,6 +924,8 @@ IndexPartition::OpenStatus OnlinePartition::ReOpen(
         // scopelock will forbidden cleanResource when process reopen
         ScopedLock lock(mCleanerLock);
         CleanResource();
+        // keep the hot ranges of the version being replaced
+        SampleAccessProfile();
 
         os = DoReopen(forceReopen, targetVersionId);
         IE_PREFIX_LOG(INFO, "reopen partition end, verison[%d], os[%d], used[%.3f]s",
@@ -1142,6 +1249,8 @@ void OnlinePartition::UpdateOnlinePartitionMetrics()
     int64_t readerCount = mReaderContainer->Size();
 
     mOnlinePartMetrics->SetpartitionReaderVersionCountValue(readerCount);
+    mOnlinePartMetrics->SetoldReaderDuplicatedMemoryUseValue(
+            mReaderContainer->GetOldReadersDuplicatedMemoryUse());
     mOnlinePartMetrics->SetoldestReaderVersionIdValue(oldestReaderVersion);
     mOnlinePartMetrics->SetlatestReaderVersionIdValue(latestReaderVersion);
 }
@@ -1269,6 +1378,7 @@ void OnlinePartition::DoClose()
     mTaskScheduler->DeleteTask(mAsyncDumpTaskId);
     mTaskScheduler->DeleteTask(mCheckIndexTaskId);
     mTaskScheduler->DeleteTask(mSubscribeIndexTaskId);
+    mTaskScheduler->DeleteTask(mSampleAccessProfileTaskId);
     
     ScopedLock lock(mDataLock);
 
@@ -1713,6 +1823,17 @@ void OnlinePartition::ExecuteTask(OnlinePartitionTaskItem::TaskType taskType)
         SubscribeSecondIndex();
         return;
     }
+
+    if (taskType == OnlinePartitionTaskItem::TT_SAMPLE_ACCESS_PROFILE)
+    {
+        if (mDataLock.trylock() != 0)
+        {
+            return;
+        }
+        DoSampleAccessProfile();
+        mDataLock.unlock();
+        return;
+    }
 }
 
 void OnlinePartition::ExecuteCleanResourceTask()
@@ -32,6 +32,7 @@ DECLARE_REFERENCE_CLASS(util, CounterMap);
 DECLARE_REFERENCE_CLASS(util, MemoryQuotaSynchronizer);
 DECLARE_REFERENCE_CLASS(util, SearchCachePartitionWrapper);
 DECLARE_REFERENCE_CLASS(config, IndexPartitionSchema);
+DECLARE_REFERENCE_CLASS(file_system, AccessProfile);
 
 namespace future_lite
 {
@@ -83,6 +84,9 @@ public:
         const config::AttributeConfigVector& mainVirtualAttrConfigs,
         const config::AttributeConfigVector& subVirtualAttrConfigs);
     bool CleanIndexFiles(const std::vector<versionid_t>& keepVersionIds) override;
+    // sample hot ranges of the live files and store them with the loaded
+    // version, the next open warms them up by WARMUP_PROFILE
+    void SampleAccessProfile();
 
 public:
     //only for test
@@ -276,6 +280,9 @@ private:
     }
     file_system::IndexlibFileSystemPtr CreateFileSystem(
             const std::string& primaryDir, const std::string& secondaryDir) override;
+    bool NeedAccessProfile() const;
+    void LoadAccessProfile(const index_base::Version& version);
+    void DoSampleAccessProfile();
     void RewriteSchemaAndOptions(const config::IndexPartitionSchemaPtr& schema,
                                  const index_base::Version& onDiskVersion);
 
@@ -320,6 +327,8 @@ protected:
     int64_t mCheckSecondIndexIntervalInMin;
     int32_t mSubscribeIndexTaskId;
     int64_t mSubscribeSecondIndexIntervalInMin;
+    int32_t mSampleAccessProfileTaskId;
+    file_system::AccessProfilePtr mAccessProfile;
     std::atomic<int64_t> mMissingSegmentCount;
     future_lite::Executor* mFutureExecutor;
 
@@ -40,6 +40,7 @@ void OnlinePartitionMetrics::RegisterOnlineMetrics()
     INIT_ONLINE_PARTITION_METRIC(buildingSegmentMemoryUse, "byte");
     INIT_ONLINE_PARTITION_METRIC(oldInMemorySegmentMemoryUse, "byte");
     INIT_ONLINE_PARTITION_METRIC(partitionMemoryQuotaUse, "byte");
+    INIT_ONLINE_PARTITION_METRIC(oldReaderDuplicatedMemoryUse, "byte");
     INIT_ONLINE_PARTITION_METRIC(memoryStatus, "count");
 #undef INIT_ONLINE_PARTITION_METRIC
 
@@ -114,6 +115,7 @@ void OnlinePartitionMetrics::ReportOnlineMetrics()
     IE_REPORT_METRIC(buildingSegmentMemoryUse, mbuildingSegmentMemoryUse);
     IE_REPORT_METRIC(oldInMemorySegmentMemoryUse, moldInMemorySegmentMemoryUse);
     IE_REPORT_METRIC(partitionMemoryQuotaUse, mpartitionMemoryQuotaUse);
+    IE_REPORT_METRIC(oldReaderDuplicatedMemoryUse, moldReaderDuplicatedMemoryUse);
     IE_REPORT_METRIC(partitionReaderVersionCount, mpartitionReaderVersionCount);
     IE_REPORT_METRIC(latestReaderVersionId, mlatestReaderVersionId);
     IE_REPORT_METRIC(oldestReaderVersionId, moldestReaderVersionId);
@@ -142,12 +144,12 @@ void OnlinePartitionMetrics::PrintMetrics(
                "partitionIndexSize [%ld], partitionMemoryUse [%ld], incIndexMemoryUse [%ld], "
                "rtIndexMemoryUse [%ld], builtRtIndexMemoryUse [%ld], buildingSegmentMemoryUse [%ld], "
                "oldInMemorySegmentMemoryUse [%ld], partitionMemoryQuotaUse [%ld], "
-               "partitionReaderVersionCount [%ld], "
+               "oldReaderDuplicatedMemoryUse [%ld], partitionReaderVersionCount [%ld], "
                "latestReaderVersionId [%d], oldestReaderVersionId [%d], missingSegmentCount [%ld]",
                partitionName.c_str(), mpartitionIndexSize, mpartitionMemoryUse,
                mincIndexMemoryUse, mrtIndexMemoryUse, mbuiltRtIndexMemoryUse,
                mbuildingSegmentMemoryUse, moldInMemorySegmentMemoryUse, mpartitionMemoryQuotaUse,
-               mpartitionReaderVersionCount, mlatestReaderVersionId, moldestReaderVersionId,
+               moldReaderDuplicatedMemoryUse, mpartitionReaderVersionCount, mlatestReaderVersionId, moldestReaderVersionId,
                mmissingSegmentCount);
 
         mPrintMetricsTsInSeconds = currentTsInSeconds;
@@ -68,6 +68,8 @@ private:
     IE_DECLARE_PARAM_METRIC(int64_t, buildingSegmentMemoryUse);
     IE_DECLARE_PARAM_METRIC(int64_t, oldInMemorySegmentMemoryUse);
     IE_DECLARE_PARAM_METRIC(int64_t, partitionMemoryQuotaUse);
+    // memory owned by each reader but the latest, duplicated across readers
+    IE_DECLARE_PARAM_METRIC(int64_t, oldReaderDuplicatedMemoryUse);
 
     // reopen
     IE_DECLARE_REACHABLE_METRIC(reopenIncLatency);
@@ -81,10 +81,16 @@ OnlinePartitionReader::~OnlinePartitionReader()
     mPartitionData.reset();
 }
 
-void OnlinePartitionReader::Open(const index_base::PartitionDataPtr& partitionData)
+void OnlinePartitionReader::Open(const index_base::PartitionDataPtr& partitionData,
+                                 const OnlinePartitionReader* hintReader)
 {
     IE_PREFIX_LOG(INFO, "OnlinePartitionReader open begin");
     mPartitionData = partitionData;
+    if (hintReader && hintReader->mSchema != mSchema)
+    {
+        // reader of another schema can not be shared
+        hintReader = NULL;
+    }
 
     SwitchToLinkDirectoryForRtSegments(mPartitionData);
     InitPartitionVersion(mPartitionData, mLatestValidRtLinkSegId);
@@ -93,11 +99,11 @@ void OnlinePartitionReader::Open(const index_base::PartitionDataPtr& partitionDa
     try
     {
         InitDeletionMapReader();
-        InitAttributeReaders();
-        InitIndexReaders(partitionData);
+        InitAttributeReaders(false, true, hintReader);
+        InitIndexReaders(partitionData, hintReader);
         InitSummaryReader();
         InitSortedDocidRangeSearcher();
-        InitSubPartitionReader();
+        InitSubPartitionReader(hintReader);
     }
     catch(const FileIOException& ioe)
     {
@@ -146,7 +152,8 @@ void OnlinePartitionReader::InitPrimaryKeyIndexReader(
 }
 
 void OnlinePartitionReader::InitIndexReaders(
-        const index_base::PartitionDataPtr& partitionData)
+        const index_base::PartitionDataPtr& partitionData,
+        const OnlinePartitionReader* hintReader)
 {
     IE_PREFIX_LOG(INFO, "InitIndexReaders begin");
     const IndexSchemaPtr indexSchema = mSchema->GetIndexSchema();
@@ -184,7 +191,7 @@ void OnlinePartitionReader::InitIndexReaders(
             continue;
         }
 
-        IndexReaderPtr indexReader = CreateIndexReader(indexConfig, partitionData);
+        IndexReaderPtr indexReader = CreateIndexReader(indexConfig, partitionData, hintReader);
         if (indexConfig->GetIndexType() == it_range)
         {
             AddAttributeReader<RangeIndexReader>(indexReader, indexConfig);
@@ -296,7 +303,8 @@ void OnlinePartitionReader::InitIndexAccessoryReader()
 
 IndexReaderPtr OnlinePartitionReader::CreateIndexReader(
         const IndexConfigPtr& indexConfig,
-        const PartitionDataPtr& partitionData) const
+        const PartitionDataPtr& partitionData,
+        const OnlinePartitionReader* hintReader) const
 {
     IndexConfig::IndexShardingType shardingType = indexConfig->GetShardingType();
     assert(shardingType != IndexConfig::IST_IS_SHARDING);
@@ -305,7 +313,9 @@ IndexReaderPtr OnlinePartitionReader::CreateIndexReader(
     {
         indexReader.reset(IndexReaderFactory::CreateIndexReader(
                         indexConfig->GetIndexType()));
-        indexReader->Open(indexConfig, partitionData);
+        const IndexReader* hintIndexReader = hintReader ?
+            hintReader->GetIndexReader(indexConfig->GetIndexId()).get() : NULL;
+        indexReader->Open(indexConfig, partitionData, hintIndexReader);
         return indexReader;
     }
 
@@ -327,7 +337,8 @@ SummaryReader* OnlinePartitionReader::CreateSummaryReader(
     return new SummaryReaderImpl(summarySchema);
 }
 
-void OnlinePartitionReader::InitAttributeReaders(bool lazyLoad, bool needPackAttrReader)
+void OnlinePartitionReader::InitAttributeReaders(bool lazyLoad, bool needPackAttrReader,
+        const OnlinePartitionReader* hintReader)
 {
     if (mSchema->GetTableType() == tt_kkv || mSchema->GetTableType() == tt_kv)
     {
@@ -342,7 +353,9 @@ void OnlinePartitionReader::InitAttributeReaders(bool lazyLoad, bool needPackAtt
     IE_PREFIX_LOG(INFO, "Init Attribute container begin");
     mAttrReaderContainer.reset(new IE_NAMESPACE(index)::AttributeReaderContainer(mSchema));
     mAttrReaderContainer->Init(mPartitionData, attrMetrics, lazyLoad, needPackAttrReader,
-                               mOptions.GetOnlineConfig().GetInitReaderThreadCount());
+                               mOptions.GetOnlineConfig().GetInitReaderThreadCount(),
+                               hintReader ? hintReader->mAttrReaderContainer
+                               : AttributeReaderContainerPtr());
     IE_PREFIX_LOG(INFO, "Init Attribute container end");
 }
 
@@ -465,7 +478,7 @@ OnlinePartitionReader::GetIndexAccessCounters() const
     return counters;
 }
 
-void OnlinePartitionReader::InitSubPartitionReader()
+void OnlinePartitionReader::InitSubPartitionReader(const OnlinePartitionReader* hintReader)
 {
     IndexPartitionSchemaPtr subSchema = mSchema->GetSubIndexPartitionSchema();
     if (!subSchema)
@@ -477,7 +490,8 @@ void OnlinePartitionReader::InitSubPartitionReader()
 
     OnlinePartitionReaderPtr partitionReader(new OnlinePartitionReader(
                     mOptions, subSchema, mSearchCache, mOnlinePartMetrics));
-    partitionReader->Open(mPartitionData->GetSubPartitionData());
+    partitionReader->Open(mPartitionData->GetSubPartitionData(),
+                          hintReader ? hintReader->mSubPartitionReader.get() : NULL);
     mSubPartitionReader = partitionReader;
 
     //TODO: refine attribute reader factory
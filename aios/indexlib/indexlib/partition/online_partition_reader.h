@@ -39,7 +39,13 @@ public:
     virtual ~OnlinePartitionReader();
 
 public:
-    void Open(const index_base::PartitionDataPtr& partitionData) override;
+    void Open(const index_base::PartitionDataPtr& partitionData) override
+    { Open(partitionData, NULL); }
+
+    // hintReader: reader of last version, readers of unchanged segments
+    // are shared with it instead of being opened again
+    void Open(const index_base::PartitionDataPtr& partitionData,
+              const OnlinePartitionReader* hintReader);
 
     index_base::PartitionDataPtr GetPartitionData() const override
     { return mPartitionData; }
@@ -92,13 +98,15 @@ public:
     { return mSwitchRtSegIds; }
 
 protected:
-    void InitIndexReaders(const index_base::PartitionDataPtr& partitionData);
+    void InitIndexReaders(const index_base::PartitionDataPtr& partitionData,
+                          const OnlinePartitionReader* hintReader = NULL);
 
     void InitPrimaryKeyIndexReader(const index_base::PartitionDataPtr& partitionData);
 
     void InitSummaryReader();
 
-    void InitAttributeReaders(bool lazyLoad = false, bool needPackAttributeReaders = true);
+    void InitAttributeReaders(bool lazyLoad = false, bool needPackAttributeReaders = true,
+                              const OnlinePartitionReader* hintReader = NULL);
 
     void InitIndexAccessoryReader();
 
@@ -106,13 +114,14 @@ protected:
 
     void AddAttrReadersToSummaryReader();
 
-    void InitSubPartitionReader();
+    void InitSubPartitionReader(const OnlinePartitionReader* hintReader = NULL);
 
     void InitDeletionMapReader();
 
     index::IndexReaderPtr CreateIndexReader(
             const config::IndexConfigPtr& indexConfig,
-            const index_base::PartitionDataPtr& partitionData) const;
+            const index_base::PartitionDataPtr& partitionData,
+            const OnlinePartitionReader* hintReader = NULL) const;
 
     index::SummaryReader* CreateSummaryReader(
             const config::SummarySchemaPtr& summarySchema);
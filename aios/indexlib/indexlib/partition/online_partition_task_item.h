@@ -22,6 +22,7 @@ public:
         TT_TRIGGER_ASYNC_DUMP,
         TT_CHECK_SECONDARY_INDEX,
         TT_SUBSCRIBE_SECONDARY_INDEX,
+        TT_SAMPLE_ACCESS_PROFILE,
         TT_UNKOWN
     };
     
@@ -164,7 +164,12 @@ void ReopenPartitionReaderExecutor::InitReader(ExecutorResource& resource,
     assert(attributeMetrics);
     attributeMetrics->ResetMetricsForNewReader();
 
-    reader->Open(clonedPartitionData);
+    const OnlinePartitionReader* hintReader = NULL;
+    if (resource.mOptions.GetOnlineConfig().enableReuseReaderOnReopen)
+    {
+        hintReader = resource.mReader.get();
+    }
+    reader->Open(clonedPartitionData, hintReader);
     if (patchLoader)
     {
         LoadReaderPatch(reader, patchLoader, resource);
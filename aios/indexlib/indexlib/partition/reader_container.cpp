@@ -1,6 +1,7 @@
 #include <autil/TimeUtility.h>
 #include "indexlib/partition/reader_container.h"
 #include "indexlib/partition/online_partition_reader.h"
+#include "indexlib/index/normal/deletionmap/deletion_map_reader.h"
 #include "indexlib/misc/exception.h"
 #include "indexlib/index_base/partition_data.h"
 #include "indexlib/index_base/index_meta/version.h"
@@ -246,5 +247,27 @@ bool ReaderContainer::HasAttributeReader(const std::string& attrName, bool isSub
     return false;
 }
 
+size_t ReaderContainer::GetOldReadersDuplicatedMemoryUse() const
+{
+    ScopedLock lock(mReaderVecLock);
+    size_t memUse = 0;
+    for (size_t i = 0; i + 1 < mReaderVec.size(); ++i)
+    {
+        // index and attribute data are shared through file system,
+        // each reader copies its own global deletion map
+        IndexPartitionReaderPtr reader = mReaderVec[i].second;
+        while (reader)
+        {
+            const DeletionMapReaderPtr& deletionMapReader = reader->GetDeletionMapReader();
+            if (deletionMapReader)
+            {
+                memUse += deletionMapReader->GetUsedBytes();
+            }
+            reader = reader->GetSubPartitionReader();
+        }
+    }
+    return memUse;
+}
+
 IE_NAMESPACE_END(partition);
 
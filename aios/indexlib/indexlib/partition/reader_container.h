@@ -39,6 +39,9 @@ public:
     void Close();
     void GetSwitchRtSegments(std::vector<segmentid_t>& segIds) const;
     bool HasAttributeReader(const std::string& attrName, bool isSub) const;
+    // memory owned by readers but the latest one, which is
+    // not shared with the latest reader
+    size_t GetOldReadersDuplicatedMemoryUse() const;
 
     bool EvictOldReaders();
 
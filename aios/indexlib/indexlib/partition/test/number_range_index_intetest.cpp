@@ -1,3 +1,4 @@
+#include <autil/StringUtil.h>
 #include "indexlib/partition/test/number_range_index_intetest.h"
 #include "indexlib/index_base/index_meta/parallel_build_info.h"
 #include "indexlib/merger/partition_merger_creator.h"
@@ -9,6 +10,7 @@
 #include "indexlib/partition/index_partition.h"
 #include "indexlib/common/number_term.h"
 #include "indexlib/index/normal/inverted_index/accessor/seek_and_filter_iterator.h"
+#include "indexlib/index/normal/inverted_index/accessor/range_segment_postings_iterator.h"
 #include "indexlib/merger/partition_merger_creator.h"
 #include "indexlib/storage/file_system_wrapper.h"
 #include "indexlib/util/path_util.h"
@@ -296,5 +298,60 @@ void NumberRangeIndexInteTest::TestDisableRange()
     ASSERT_TRUE(psm.Transfer(BUILD_INC, incDocString, "price:[100, 101]", ""));
 }
 
+void NumberRangeIndexInteTest::TestMaterializeWideRange()
+{
+    ASSERT_FALSE(RangeSegmentPostingsIterator::NeedMaterialize(2, 1000, 1000));
+    ASSERT_FALSE(RangeSegmentPostingsIterator::NeedMaterialize(16, 10, 100000));
+    ASSERT_TRUE(RangeSegmentPostingsIterator::NeedMaterialize(16, 1000, 1000));
+
+    string fullDocString;
+    string rtDocString;
+    string allResult;
+    string wideResult;
+    for (int64_t i = 0; i < 256; ++i)
+    {
+        string value = StringUtil::toString(i);
+        string result = "docid=" + value + ",pk=" + value + ";";
+        if (i < 128)
+        {
+            fullDocString += "cmd=add,price=" + value + ",pk=" + value + ",ts=1;";
+        }
+        else
+        {
+            rtDocString += "cmd=add,price=" + value + ",pk=" + value + ",ts=2;";
+        }
+        allResult += result;
+        if (i >= 3 && i <= 250)
+        {
+            wideResult += result;
+        }
+    }
+    PartitionStateMachine psm;
+    INDEXLIB_TEST_TRUE(psm.Init(mSchema, mOptions, mRootDir));
+    // built segment is materialized, building segment uses heap
+    INDEXLIB_TEST_TRUE(psm.Transfer(BUILD_FULL, fullDocString, "price:[3,250]",
+                                    wideResult.substr(0, wideResult.find("docid=128,"))));
+    INDEXLIB_TEST_TRUE(psm.Transfer(BUILD_RT, rtDocString, "price:[3,250]", wideResult));
+    INDEXLIB_TEST_TRUE(psm.Transfer(QUERY, "", "price:[0,)", allResult));
+    INDEXLIB_TEST_TRUE(psm.Transfer(QUERY, "", "price:(100,102)", "docid=101,pk=101;"));
+
+    IndexPartitionReaderPtr reader = psm.mIndexPartition->GetReader();
+    common::Int64Term term(3, true, 250, true, "price");
+    SeekAndFilterIteratorPtr iter(dynamic_cast<SeekAndFilterIterator*>(
+                    reader->GetIndexReader()->Lookup(term)));
+    ASSERT_TRUE(iter);
+    RangePostingIterator* rangeIter =
+        dynamic_cast<RangePostingIterator*>(iter->GetIndexIterator());
+    ASSERT_TRUE(rangeIter);
+    ASSERT_EQ((docid_t)3, iter->SeekDoc(0));
+    ASSERT_TRUE(rangeIter->IsSegmentMaterialized());
+    ASSERT_EQ((docid_t)127, iter->SeekDoc(127));
+    ASSERT_TRUE(rangeIter->IsSegmentMaterialized());
+    ASSERT_EQ((docid_t)128, iter->SeekDoc(128));
+    ASSERT_FALSE(rangeIter->IsSegmentMaterialized());
+    ASSERT_EQ((docid_t)250, iter->SeekDoc(250));
+    ASSERT_EQ(INVALID_DOCID, iter->SeekDoc(251));
+}
+
 IE_NAMESPACE_END(partition);
 
@@ -26,6 +26,7 @@ public:
     void TestFieldType();
     void TestRecoverFailed();
     void TestDisableRange();
+    void TestMaterializeWideRange();
 
 private:
     void InnerTestSeekDocCount(const IndexPartitionReaderPtr& reader);
@@ -49,6 +50,7 @@ INDEXLIB_UNIT_TEST_CASE(NumberRangeIndexInteTest, TestInterval);
 INDEXLIB_UNIT_TEST_CASE(NumberRangeIndexInteTest, TestFieldType);
 INDEXLIB_UNIT_TEST_CASE(NumberRangeIndexInteTest, TestRecoverFailed);
 INDEXLIB_UNIT_TEST_CASE(NumberRangeIndexInteTest, TestDisableRange);
+INDEXLIB_UNIT_TEST_CASE(NumberRangeIndexInteTest, TestMaterializeWideRange);
 
 IE_NAMESPACE_END(partition);
 
@@ -1,5 +1,6 @@
 #include "indexlib/partition/test/online_partition_unittest.h"
 #include "indexlib/index_base/partition_data.h"
+#include "indexlib/index_define.h"
 #include "indexlib/partition/partition_data_creator.h"
 #include "indexlib/index/test/partition_schema_maker.h"
 #include "indexlib/index/normal/deletionmap/deletion_map_reader.h"
@@ -11,6 +12,8 @@
 #include "indexlib/index_base/index_meta/index_file_list.h"
 #include "indexlib/index_base/deploy_index_wrapper.h"
 #include "indexlib/file_system/directory.h"
+#include "indexlib/file_system/access_profile.h"
+#include "indexlib/file_system/test/load_config_list_creator.h"
 #include "indexlib/common/executor_scheduler.h"
 #include "indexlib/util/memory_control/memory_quota_controller_creator.h"
 #include "indexlib/util/task_scheduler.h"
@@ -20,9 +23,12 @@
 #include "indexlib/config/virtual_attribute_config_creator.h"
 #include "indexlib/config/disable_fields_config.h"
 #include "indexlib/storage/file_system_wrapper.h"
+#include "indexlib/util/path_util.h"
 #include "indexlib/partition/open_executor/reopen_partition_reader_executor.h"
 #include "indexlib/test/schema_maker.h"
 #include "indexlib/common/numeric_compress/encoder_provider.h"
+#include "indexlib/index/normal/summary/summary_reader.h"
+#include "indexlib/document/index_document/normal_document/search_summary_document.h"
 
 using namespace std;
 using namespace autil;
@@ -35,6 +41,7 @@ IE_NAMESPACE_USE(common);
 IE_NAMESPACE_USE(misc);
 IE_NAMESPACE_USE(util);
 IE_NAMESPACE_USE(index_base);
+IE_NAMESPACE_USE(document);
 
 IE_NAMESPACE_BEGIN(partition);
 IE_LOG_SETUP(partition, OnlinePartitionTest);
@@ -1467,4 +1474,133 @@ void OnlinePartitionTest::TestCleanIndexFiles()
     ASSERT_FALSE(IndexPartition::CleanIndexFiles(primaryPath, secondaryPath, {}));
 }
 
+void OnlinePartitionTest::TestAccessProfile()
+{
+    IndexPartitionOptions options;
+    LoadConfig loadConfig = LoadConfigListCreator::MakeMmapLoadConfig(false, false);
+    WarmupStrategy warmupStrategy;
+    warmupStrategy.SetWarmupType(WarmupStrategy::WARMUP_PROFILE);
+    loadConfig.SetWarmupStrategy(warmupStrategy);
+    options.GetOnlineConfig().loadConfigList.PushBack(loadConfig);
+
+    PartitionStateMachine psm;
+    INDEXLIB_TEST_TRUE(psm.Init(mSchema, options, mRootDir));
+    string fullDocs = "cmd=add,string1=pk1,string2=a,long1=1;"
+                      "cmd=add,string1=pk2,string2=b,long1=2;";
+    INDEXLIB_TEST_TRUE(psm.Transfer(BUILD_FULL, fullDocs, "pk:pk1", "long1=1"));
+    OnlinePartitionPtr partition = DYNAMIC_POINTER_CAST(
+            OnlinePartition, psm.GetIndexPartition());
+    ASSERT_TRUE(partition);
+    ASSERT_TRUE(partition->mAccessProfile);
+    ASSERT_NE(TaskScheduler::INVALID_TASK_ID, partition->mSampleAccessProfileTaskId);
+
+    // sample the live files and store them with the loaded version
+    versionid_t fullVersionId = partition->mLoadedIncVersion.GetVersionId();
+    partition->SampleAccessProfile();
+    string fullProfilePath = PathUtil::JoinPath(
+            mRootDir, AccessProfile::GetProfileFileName(fullVersionId));
+    AccessProfile fullProfile;
+    ASSERT_TRUE(fullProfile.Load(fullProfilePath));
+    ASSERT_LT((size_t)0, fullProfile.GetFileCount());
+
+    string incDocs = "cmd=add,string1=pk3,string2=c,long1=3;";
+    INDEXLIB_TEST_TRUE(psm.Transfer(BUILD_INC, incDocs, "pk:pk3", "long1=3"));
+    versionid_t incVersionId = partition->mLoadedIncVersion.GetVersionId();
+    ASSERT_LT(fullVersionId, incVersionId);
+    partition->SampleAccessProfile();
+    string incProfilePath = PathUtil::JoinPath(
+            mRootDir, AccessProfile::GetProfileFileName(incVersionId));
+    AccessProfile incProfile;
+    ASSERT_TRUE(incProfile.Load(incProfilePath));
+    ASSERT_LE(fullProfile.GetFileCount(), incProfile.GetFileCount());
+
+    // the new segment is not in the profile the reopen started with, its
+    // files are warmed by the hot ranges of the same name files of segment 0
+    const Version& incVersion = partition->mLoadedIncVersion;
+    string incAttrPath = PathUtil::JoinPath(mRootDir,
+            incVersion.GetSegmentDirName(incVersion.GetLastSegment()) + "/attribute/long1/data");
+    ASSERT_FALSE(fullProfile.HasFile(incAttrPath));
+    ASSERT_FALSE(fullProfile.GetRanges(incAttrPath,
+                    FileSystemWrapper::GetFileLength(incAttrPath)).empty());
+    ASSERT_TRUE(incProfile.HasFile(incAttrPath));
+    partition->Close();
+
+    // read only: no sampling task, loaded profile stays as stored
+    options.SetIsOnline(true);
+    options.TEST_mReadOnly = true;
+    MemoryQuotaControllerPtr memController(new MemoryQuotaController(1024*1024*1024));
+    OnlinePartitionPtr newPartition(new OnlinePartition("test", memController));
+    ASSERT_EQ(IndexPartition::OS_OK,
+              newPartition->Open(mRootDir, "", mSchema, options, incVersionId));
+    ASSERT_TRUE(newPartition->mAccessProfile);
+    ASSERT_EQ(incProfile.GetFileCount(), newPartition->mAccessProfile->GetFileCount());
+    newPartition->Close();
+
+    // no profile stored with the version, the one of the previous version is used
+    FileSystemWrapper::DeleteFile(incProfilePath);
+    newPartition.reset(new OnlinePartition("test", memController));
+    ASSERT_EQ(IndexPartition::OS_OK,
+              newPartition->Open(mRootDir, "", mSchema, options, incVersionId));
+    ASSERT_EQ(fullProfile.GetFileCount(), newPartition->mAccessProfile->GetFileCount());
+    newPartition->Close();
+}
+
+void OnlinePartitionTest::TestOpenBeforeColdFilesDeployed()
+{
+    IndexPartitionSchemaPtr schema = SchemaMaker::MakeSchema(
+            "string1:string;string2:string;long1:uint32",
+            "pk:primarykey64:string1;index2:string:string2", "long1", "string2");
+    string remoteDir = PathUtil::JoinPath(mRootDir, "remote");
+    string localDir = PathUtil::JoinPath(mRootDir, "local");
+    {
+        PartitionStateMachine psm;
+        INDEXLIB_TEST_TRUE(psm.Init(schema, IndexPartitionOptions(), remoteDir));
+        string fullDocs = "cmd=add,string1=pk1,string2=a,long1=1;"
+                          "cmd=add,string1=pk2,string2=b,long1=2;";
+        INDEXLIB_TEST_TRUE(psm.Transfer(BUILD_FULL, fullDocs, "pk:pk2", "long1=2"));
+    }
+    Version version;
+    VersionLoader::GetVersion(remoteDir, version, INVALID_VERSION);
+    ASSERT_EQ((size_t)1, version.GetSegmentCount());
+    string summaryData = PathUtil::JoinPath(localDir,
+            version.GetSegmentDirName(version[0]) + "/" + SUMMARY_DIR_NAME + "/" + SUMMARY_DATA_FILE_NAME);
+
+    IndexPartitionOptions options;
+    options.SetIsOnline(true);
+    options.GetOnlineConfig().needReadRemoteIndex = true;
+    options.TEST_mReadOnly = true;
+    MemoryQuotaControllerPtr memController(new MemoryQuotaController(1024*1024*1024));
+    bool opened = false;
+    auto openableCallback = [&]() {
+        // summary is not deployed yet, it is read from the remote dir
+        ASSERT_FALSE(FileSystemWrapper::IsExist(summaryData));
+        OnlinePartitionPtr partition(new OnlinePartition("test", memController));
+        ASSERT_EQ(IndexPartition::OS_OK, partition->Open(
+                        localDir, remoteDir, schema, options, version.GetVersionId()));
+        IndexPartitionReaderPtr reader = partition->GetReader();
+        docid_t docId = reader->GetPrimaryKeyReader()->Lookup("pk2");
+        ASSERT_EQ((docid_t)1, docId);
+        string value;
+        ASSERT_TRUE(reader->GetAttributeReader("long1")->Read(docId, value));
+        ASSERT_EQ("2", value);
+        SearchSummaryDocument summaryDoc(NULL, 4096);
+        ASSERT_TRUE(reader->GetSummaryReader()->GetDocument(docId, &summaryDoc));
+        ASSERT_EQ("b", summaryDoc.GetFieldValue(0)->toString());
+        reader.reset();
+        partition->Close();
+        opened = true;
+    };
+    DeployIndexWrapper deployWrapper(remoteDir, localDir);
+    ASSERT_TRUE(deployWrapper.DeployIndex(
+                    version.GetVersionId(), INVALID_VERSION, openableCallback));
+    ASSERT_TRUE(opened);
+    ASSERT_TRUE(FileSystemWrapper::IsExist(summaryData));
+
+    // all files are local now
+    OnlinePartitionPtr partition(new OnlinePartition("test", memController));
+    ASSERT_EQ(IndexPartition::OS_OK, partition->Open(
+                    localDir, "", schema, options, version.GetVersionId()));
+    partition->Close();
+}
+
 IE_NAMESPACE_END(partition);
@@ -44,6 +44,8 @@ public:
     void TestMultiThreadLoadPatchWhenDisableField();
     void TestInitPathMetaCache();
     void TestCleanIndexFiles();
+    void TestAccessProfile();
+    void TestOpenBeforeColdFilesDeployed();
 
 private:
     void PrepareData(const config::IndexPartitionOptions& options, bool hasSub = false);
@@ -91,6 +93,8 @@ INDEXLIB_UNIT_TEST_CASE(OnlinePartitionTest, TestDisableAllAttribute);
 INDEXLIB_UNIT_TEST_CASE(OnlinePartitionTest, TestMultiThreadLoadPatchWhenDisableField);
 INDEXLIB_UNIT_TEST_CASE(OnlinePartitionTest, TestInitPathMetaCache);
 INDEXLIB_UNIT_TEST_CASE(OnlinePartitionTest, TestCleanIndexFiles);
+INDEXLIB_UNIT_TEST_CASE(OnlinePartitionTest, TestAccessProfile);
+INDEXLIB_UNIT_TEST_CASE(OnlinePartitionTest, TestOpenBeforeColdFilesDeployed);
 
 IE_NAMESPACE_END(partition);
 
@@ -1,5 +1,6 @@
 #include "indexlib/partition/test/reader_container_unittest.h"
 #include "indexlib/partition/test/mock_index_partition_reader.h"
+#include "indexlib/index/normal/deletionmap/deletion_map_reader.h"
 
 using namespace std;
 IE_NAMESPACE_USE(index);
@@ -91,5 +92,44 @@ void ReaderContainerTest::TestGetSwitchRtSegments()
     ASSERT_THAT(segIds, ElementsAre(1, 2, 4));
 }
 
+void ReaderContainerTest::TestGetOldReadersDuplicatedMemoryUse()
+{
+    ReaderContainer container;
+    ASSERT_EQ((size_t)0, container.GetOldReadersDuplicatedMemoryUse());
+
+    // bitmap of 100 docs takes 4 slots
+    DeletionMapReaderPtr deletionMapReader0(new DeletionMapReader(100));
+    MockIndexPartitionReaderPtr reader0(new MockIndexPartitionReader());
+    EXPECT_CALL(*reader0, GetVersion()).WillOnce(Return(Version(0)));
+    EXPECT_CALL(*reader0, GetDeletionMapReader())
+        .WillRepeatedly(ReturnRef(deletionMapReader0));
+    EXPECT_CALL(*reader0, GetSubPartitionReader())
+        .WillRepeatedly(Return(IndexPartitionReaderPtr()));
+    container.AddReader(reader0);
+    // latest reader is not counted
+    ASSERT_EQ((size_t)0, container.GetOldReadersDuplicatedMemoryUse());
+
+    DeletionMapReaderPtr deletionMapReader1(new DeletionMapReader(1000));
+    DeletionMapReaderPtr subDeletionMapReader1(new DeletionMapReader(64));
+    MockIndexPartitionReaderPtr subReader1(new MockIndexPartitionReader());
+    EXPECT_CALL(*subReader1, GetDeletionMapReader())
+        .WillRepeatedly(ReturnRef(subDeletionMapReader1));
+    EXPECT_CALL(*subReader1, GetSubPartitionReader())
+        .WillRepeatedly(Return(IndexPartitionReaderPtr()));
+    MockIndexPartitionReaderPtr reader1(new MockIndexPartitionReader());
+    EXPECT_CALL(*reader1, GetVersion()).WillOnce(Return(Version(1)));
+    EXPECT_CALL(*reader1, GetDeletionMapReader())
+        .WillRepeatedly(ReturnRef(deletionMapReader1));
+    EXPECT_CALL(*reader1, GetSubPartitionReader())
+        .WillRepeatedly(Return(subReader1));
+    container.AddReader(reader1);
+    ASSERT_EQ((size_t)16, container.GetOldReadersDuplicatedMemoryUse());
+
+    MockIndexPartitionReaderPtr reader2(new MockIndexPartitionReader());
+    EXPECT_CALL(*reader2, GetVersion()).WillOnce(Return(Version(2)));
+    container.AddReader(reader2);
+    ASSERT_EQ((size_t)(16 + 128 + 8), container.GetOldReadersDuplicatedMemoryUse());
+}
+
 IE_NAMESPACE_END(partition);
 
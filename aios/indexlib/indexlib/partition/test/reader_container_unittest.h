@@ -23,6 +23,7 @@ public:
     void TestSimpleProcess();
     void TestHasReader();
     void TestGetSwitchRtSegments();
+    void TestGetOldReadersDuplicatedMemoryUse();
     
 private:
     IE_LOG_DECLARE();
@@ -31,6 +32,7 @@ private:
 INDEXLIB_UNIT_TEST_CASE(ReaderContainerTest, TestSimpleProcess);
 INDEXLIB_UNIT_TEST_CASE(ReaderContainerTest, TestHasReader);
 INDEXLIB_UNIT_TEST_CASE(ReaderContainerTest, TestGetSwitchRtSegments);
+INDEXLIB_UNIT_TEST_CASE(ReaderContainerTest, TestGetOldReadersDuplicatedMemoryUse);
 
 IE_NAMESPACE_END(partition);
 
@@ -1,3 +1,5 @@
+#include <stdlib.h>
+#include "indexlib/misc/exception.h"
 #include "indexlib/storage/file_buffer.h"
 
 using namespace std;
@@ -10,12 +12,36 @@ FileBuffer::FileBuffer(uint32_t bufferSize)
     mBuffer = new char[bufferSize];
     mCursor = 0;
     mBufferSize = bufferSize;
+    mAligned = false;
+    mBusy = false;
+}
+
+FileBuffer::FileBuffer(uint32_t bufferSize, uint32_t alignment)
+{
+    assert(alignment > 0 && (alignment & (alignment - 1)) == 0);
+    void* addr = NULL;
+    if (posix_memalign(&addr, alignment, bufferSize) != 0)
+    {
+        INDEXLIB_FATAL_ERROR(OutOfMemory, "allocate aligned buffer failed, "
+                             "size [%u], alignment [%u]", bufferSize, alignment);
+    }
+    mBuffer = (char*)addr;
+    mCursor = 0;
+    mBufferSize = bufferSize;
+    mAligned = true;
     mBusy = false;
 }
 
 FileBuffer::~FileBuffer() 
 {
-    delete [] mBuffer;
+    if (mAligned)
+    {
+        free(mBuffer);
+    }
+    else
+    {
+        delete [] mBuffer;
+    }
 }
 
 void FileBuffer::Wait() 
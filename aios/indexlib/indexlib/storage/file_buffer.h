@@ -13,6 +13,8 @@ class FileBuffer
 {
 public:
     FileBuffer(uint32_t bufferSize);
+    // alignment should be power of 2, used by direct io
+    FileBuffer(uint32_t bufferSize, uint32_t alignment);
     ~FileBuffer();
 public:
     void Wait();
@@ -37,6 +39,7 @@ protected:
     char *mBuffer;
     uint32_t mCursor;
     uint32_t mBufferSize;
+    bool mAligned;
     volatile bool mBusy;
     autil::ThreadCond mCond;
 private:
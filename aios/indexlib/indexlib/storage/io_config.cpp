@@ -15,6 +15,8 @@ const uint32_t IOConfig::DEFAULT_WRITE_QUEUE_SIZE = 10;
 IOConfig::IOConfig() 
     : enableAsyncRead(false)
     , enableAsyncWrite(false)
+    , enableDirectWrite(false)
+    , enableDropCacheRead(false)
     , readBufferSize(DEFAULT_READ_BUFFER_SIZE)
     , writeBufferSize(DEFAULT_WRITE_BUFFER_SIZE)
     , readThreadNum(DEFAULT_READ_THREAD_NUM)
@@ -30,6 +32,8 @@ void IOConfig::Jsonize(autil::legacy::Jsonizable::JsonWrapper& json)
 {
     json.Jsonize("enable_async_read", enableAsyncRead, enableAsyncRead);
     json.Jsonize("enable_async_write", enableAsyncWrite, enableAsyncWrite);
+    json.Jsonize("enable_direct_write", enableDirectWrite, enableDirectWrite);
+    json.Jsonize("enable_drop_cache_read", enableDropCacheRead, enableDropCacheRead);
     json.Jsonize("read_buffer_size", readBufferSize, readBufferSize);
     json.Jsonize("write_buffer_size", writeBufferSize, writeBufferSize);
     json.Jsonize("read_thread_num", readThreadNum, readThreadNum);
@@ -28,6 +28,10 @@ public:
 public:
     bool enableAsyncRead;
     bool enableAsyncWrite;
+    // bypass page cache for merge output (O_DIRECT, or fadvise when unsupported)
+    bool enableDirectWrite;
+    // readahead merge input and drop consumed pages from page cache
+    bool enableDropCacheRead;
     uint32_t readBufferSize;
     uint32_t writeBufferSize;
     uint32_t readThreadNum;